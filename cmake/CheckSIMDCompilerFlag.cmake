@@ -15,6 +15,22 @@ try_compile(COMPILER_AVX512VPOPCNTDQ_SUPPORTED
     OUTPUT_VARIABLE COMPILE_OUTPUT
     )
 
+file(WRITE ${CMAKE_BINARY_DIR}/instructions_test_avx512vnni.cpp "#include <immintrin.h>\nint main() { __m512i a, b, c; c = _mm512_dpbusd_epi32(c, a, b); return 0; }")
+try_compile(COMPILER_AVX512VNNI_SUPPORTED
+    ${CMAKE_BINARY_DIR}/instructions_test_avx512vnni
+    ${CMAKE_BINARY_DIR}/instructions_test_avx512vnni.cpp
+    COMPILE_DEFINITIONS "-mavx512f -mavx512vnni"
+    OUTPUT_VARIABLE COMPILE_OUTPUT
+    )
+
+file(WRITE ${CMAKE_BINARY_DIR}/instructions_test_avx512bf16.cpp "#include <immintrin.h>\nint main() { __m512 a; __m512bh b, c; a = _mm512_dpbf16_ps(a, b, c); return 0; }")
+try_compile(COMPILER_AVX512BF16_SUPPORTED
+    ${CMAKE_BINARY_DIR}/instructions_test_avx512bf16
+    ${CMAKE_BINARY_DIR}/instructions_test_avx512bf16.cpp
+    COMPILE_DEFINITIONS "-mavx512f -mavx512bf16"
+    OUTPUT_VARIABLE COMPILE_OUTPUT
+    )
+
 file(WRITE ${CMAKE_BINARY_DIR}/instructions_test_avx2.cpp "#include <immintrin.h>\nint main() { __m256 a, b, c; c = _mm256_fmadd_ps(a, b, c); return 0; }")
 try_compile(COMPILER_AVX2_SUPPORTED
     ${CMAKE_BINARY_DIR}/instructions_test_avx2
@@ -63,6 +79,22 @@ try_compile(RUNTIME_AVX512VPOPCNTDQ_SUPPORTED
     OUTPUT_VARIABLE COMPILE_OUTPUT
     )
 
+file(WRITE ${CMAKE_BINARY_DIR}/instructions_test_avx512vnni.cpp "#include <immintrin.h>\nint main() { __m512i a, b, c; c = _mm512_dpbusd_epi32(c, a, b); return 0; }")
+try_compile(RUNTIME_AVX512VNNI_SUPPORTED
+    ${CMAKE_BINARY_DIR}/instructions_test_avx512vnni
+    ${CMAKE_BINARY_DIR}/instructions_test_avx512vnni.cpp
+    COMPILE_DEFINITIONS "-mavx512f -mavx512vnni"
+    OUTPUT_VARIABLE COMPILE_OUTPUT
+    )
+
+file(WRITE ${CMAKE_BINARY_DIR}/instructions_test_avx512bf16.cpp "#include <immintrin.h>\nint main() { __m512 a; __m512bh b, c; a = _mm512_dpbf16_ps(a, b, c); return 0; }")
+try_compile(RUNTIME_AVX512BF16_SUPPORTED
+    ${CMAKE_BINARY_DIR}/instructions_test_avx512bf16
+    ${CMAKE_BINARY_DIR}/instructions_test_avx512bf16.cpp
+    COMPILE_DEFINITIONS "-mavx512f -mavx512bf16"
+    OUTPUT_VARIABLE COMPILE_OUTPUT
+    )
+
 file(WRITE ${CMAKE_BINARY_DIR}/instructions_test_avx2.cpp "#include <immintrin.h>\nint main() { __m256 a, b, c; c = _mm256_fmadd_ps(a, b, c); return 0; }")
 try_compile(RUNTIME_AVX2_SUPPORTED
     ${CMAKE_BINARY_DIR}/instructions_test_avx2
@@ -112,6 +144,12 @@ endif ()
 if (COMPILER_AVX512VPOPCNTDQ_SUPPORTED)
   set (COMPILER_SUPPORTED "${COMPILER_SUPPORTED} AVX512VPOPCNTDQ")
 endif ()
+if (COMPILER_AVX512VNNI_SUPPORTED)
+  set (COMPILER_SUPPORTED "${COMPILER_SUPPORTED} AVX512VNNI")
+endif ()
+if (COMPILER_AVX512BF16_SUPPORTED)
+  set (COMPILER_SUPPORTED "${COMPILER_SUPPORTED} AVX512BF16")
+endif ()
 if (COMPILER_NEON_SUPPORTED)
   set (COMPILER_SUPPORTED "${COMPILER_SUPPORTED} NEON")
 endif ()
@@ -134,6 +172,12 @@ endif ()
 if (RUNTIME_AVX512VPOPCNTDQ_SUPPORTED)
   set (RUNTIME_SUPPORTED "${RUNTIME_SUPPORTED} AVX512VPOPCNTDQ")
 endif ()
+if (RUNTIME_AVX512VNNI_SUPPORTED)
+  set (RUNTIME_SUPPORTED "${RUNTIME_SUPPORTED} AVX512VNNI")
+endif ()
+if (RUNTIME_AVX512BF16_SUPPORTED)
+  set (RUNTIME_SUPPORTED "${RUNTIME_SUPPORTED} AVX512BF16")
+endif ()
 if (RUNTIME_NEON_SUPPORTED)
   set (RUNTIME_SUPPORTED "${RUNTIME_SUPPORTED} NEON")
 endif ()
@@ -162,6 +206,14 @@ if (NOT DISABLE_AVX512VPOPCNTDQ_FORCE AND COMPILER_AVX512VPOPCNTDQ_SUPPORTED AND
   set (DIST_CONTAINS_AVX512VPOPCNTDQ ON)
   set (DIST_CONTAINS_INSTRUCTIONS "${DIST_CONTAINS_INSTRUCTIONS} AVX512VPOPCNTDQ")
 endif ()
+if (NOT DISABLE_AVX512VNNI_FORCE AND COMPILER_AVX512VNNI_SUPPORTED AND DIST_CONTAINS_AVX512)
+  set (DIST_CONTAINS_AVX512VNNI ON)
+  set (DIST_CONTAINS_INSTRUCTIONS "${DIST_CONTAINS_INSTRUCTIONS} AVX512VNNI")
+endif ()
+if (NOT DISABLE_AVX512BF16_FORCE AND COMPILER_AVX512BF16_SUPPORTED AND DIST_CONTAINS_AVX512)
+  set (DIST_CONTAINS_AVX512BF16 ON)
+  set (DIST_CONTAINS_INSTRUCTIONS "${DIST_CONTAINS_INSTRUCTIONS} AVX512BF16")
+endif ()
 if (NOT DISABLE_NEON_FORCE AND COMPILER_NEON_SUPPORTED)
   set (DIST_CONTAINS_NEON ON)
   set (DIST_CONTAINS_INSTRUCTIONS "${DIST_CONTAINS_INSTRUCTIONS} NEON")
@@ -146,18 +146,26 @@ extern const char* const HGRAPH_BUILD_EF_CONSTRUCTION;
 extern const char* const HGRAPH_INIT_CAPACITY;
 extern const char* const HGRAPH_GRAPH_TYPE;
 extern const char* const HGRAPH_GRAPH_STORAGE_TYPE;
+extern const char* const HGRAPH_GRAPH_IO_TYPE;
+extern const char* const HGRAPH_GRAPH_FILE_PATH;
+extern const char* const HGRAPH_GRAPH_SECTOR_SIZE;
 extern const char* const HGRAPH_BUILD_THREAD_COUNT;
+extern const char* const HGRAPH_BUILD_BATCH_SIZE;
+extern const char* const HGRAPH_BUILD_CHECKPOINT_INTERVAL;
 extern const char* const HGRAPH_PRECISE_QUANTIZATION_TYPE;
 extern const char* const HGRAPH_BASE_IO_TYPE;
 extern const char* const HGRAPH_BASE_PQ_DIM;
 extern const char* const HGRAPH_BASE_FILE_PATH;
 extern const char* const HGRAPH_PRECISE_IO_TYPE;
 extern const char* const HGRAPH_PRECISE_FILE_PATH;
+extern const char* const HGRAPH_PRECISE_CACHE_SIZE;
 extern const char* const HGRAPH_PARAMETER_EF_RUNTIME;
 extern const char* const HGRAPH_EXTRA_INFO_SIZE;
 extern const char* const HGRAPH_SUPPORT_DUPLICATE;
 extern const char* const HGRAPH_USE_EXTRA_INFO_FILTER;
 extern const char* const HGRAPH_STORE_RAW_VECTOR;
+extern const char* const HGRAPH_VISITED_LIST_TYPE;
+extern const char* const HGRAPH_REMOVE_COMPACTION_RATIO;
 
 extern const char* const BRUTE_FORCE_QUANTIZATION_TYPE;
 extern const char* const BRUTE_FORCE_IO_TYPE;
@@ -97,6 +97,20 @@ public:
     static tl::expected<std::shared_ptr<ThreadPool>, Error>
     CreateThreadPool(uint32_t num_threads);
 
+    /**
+     * @brief Creates a thread pool with one group of workers per NUMA node.
+     *
+     * The workers of a group are pinned to the cpus of their node, and a task is run on the
+     * node of the thread which enqueues it. On a machine with one node it behaves like the
+     * pool of CreateThreadPool.
+     *
+     * @param num_threads_per_node The number of worker threads of each node.
+     * @return tl::expected<std::shared_ptr<ThreadPool>, Error> An expected value that contains either
+     * a shared pointer to the successfully created `ThreadPool` or an `Error` detailing
+     */
+    static tl::expected<std::shared_ptr<ThreadPool>, Error>
+    CreateNumaThreadPool(uint32_t num_threads_per_node);
+
 private:
     std::shared_ptr<Resource> resource_;  ///< The resource used by this engine.
 };
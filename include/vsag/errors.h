@@ -42,6 +42,8 @@ enum class ErrorType {
     READ_ERROR,        // cannot read from binary
     MISSING_FILE,      // some file missing in index diskann deserialization
     INVALID_BINARY,    // the content of binary is invalid
+    SEARCH_CANCELLED,  // the search was cancelled before it started
+    SEARCH_TIMEOUT,    // the deadline of the search passed before it started
 };
 
 struct Error {
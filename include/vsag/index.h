@@ -16,6 +16,8 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <limits>
 #include <stdexcept>
 
@@ -36,6 +38,9 @@ namespace vsag {
 class Index;
 using IndexPtr = std::shared_ptr<Index>;
 using IdMapFunction = std::function<std::tuple<bool, int64_t>(int64_t)>;
+using SearchCallback = std::function<void(tl::expected<DatasetPtr, Error>)>;
+using BuildProgressCallback =
+    std::function<void(const std::string& stage, uint64_t finished, uint64_t total)>;
 
 struct MergeUnit {
     IndexPtr index = nullptr;
@@ -94,6 +99,18 @@ public:
         throw std::runtime_error("Index not support partial build");
     }
 
+    /**
+      * @brief Setting the callback which reports the progress of Build, Add and ContinueBuild
+      *
+      * @param callback is called on the building thread with the stage ("train", "insert"
+      *        or "optimize"), the finished and the total count of the stage
+      * @return result indicates whether the callback is set successfully.
+      */
+    virtual tl::expected<void, Error>
+    SetBuildProgressCallback(BuildProgressCallback callback) {
+        throw std::runtime_error("Index not support build progress callback");
+    }
+
     /**
       * @brief Adding vectors into a built index, only HNSW supported now, called on other index will cause exception
       * 
@@ -225,16 +242,53 @@ public:
     /**
       * @brief Performing search with request on index
       * 
-      * @param request @see SearchRequest
-      * @return result contains 
+      * @param request @see SearchRequest, set request.statistics_ to get the per query
+      *                counters (@see SearchStatistics), their aggregation is in GetStats
+      * @return result contains, for a request with one query
       *                - num_elements: 1
       *                - ids, distances: length is (num_elements * k)               
+      *         for a request with several queries (hgraph only)
+      *                - num_elements: the query count, dim: k
+      *                - ids, distances: row i holds the k results of query i, the missing
+      *                  results are padded with id -1 and the max float distance
       */
     virtual tl::expected<DatasetPtr, Error>
     SearchWithRequest(const SearchRequest& request) const {
         throw std::runtime_error("Index doesn't support Search With Request");
     }
 
+    /**
+      * @brief Performing search with request on the thread pool of the index
+      *
+      * The search runs on the thread pool of the resource the index was created with, or on
+      * a pool owned by the index when the resource has none, so the calling thread is never
+      * blocked. A search still waiting when request.cancel_flag_ is set or request.deadline_
+      * passes fails with SEARCH_CANCELLED or SEARCH_TIMEOUT, a running graph or ivf search
+      * stops at its next hop or bucket and returns the results found so far. The request is
+      * copied, only request.statistics_ and request.search_allocator_ must outlive the search.
+      * An async search runs on its pool thread only, the intra-query parallelism of the
+      * search parameters is not used, so searches waiting on each other never fill the pool.
+      *
+      * @param request @see SearchRequest
+      * @return the future of the result of SearchWithRequest
+      */
+    virtual std::future<tl::expected<DatasetPtr, Error>>
+    SearchAsync(const SearchRequest& request) const {
+        throw std::runtime_error("Index doesn't support SearchAsync");
+    }
+
+    /**
+      * @brief Performing search with request on the thread pool of the index, as the future
+      *        version but calls callback with the result on the pool thread instead
+      *
+      * @param request @see SearchRequest
+      * @param callback is called exactly once with the result of SearchWithRequest
+      */
+    virtual tl::expected<void, Error>
+    SearchAsync(const SearchRequest& request, SearchCallback callback) const {
+        throw std::runtime_error("Index doesn't support SearchAsync");
+    }
+
     /**
       * @brief Performing single KNN search on index
       *
@@ -424,6 +478,22 @@ public:
         throw std::runtime_error("Index doesn't support get Min and Max id");
     }
 
+    /**
+     * @brief Warms up the in-memory cache of the codes kept on disk with recorded queries.
+     *
+     * Each query is searched as by KnnSearch, and the codes of its results are loaded into the
+     * cache regardless of the access frequency, so the first searches after a restart read the
+     * hot codes from memory. Does nothing if the index has no such cache.
+     *
+     * @param queries is the recorded query vectors
+     * @param k is the count of results of each query whose codes are cached
+     * @param parameters is the search parameters in json format
+     */
+    virtual tl::expected<void, Error>
+    WarmUp(const DatasetPtr& queries, int64_t k, const std::string& parameters) {
+        throw std::runtime_error("Index doesn't support WarmUp");
+    }
+
     /**
      * @brief Retrieve additional data associated with vectors identified by given IDs.
      *
@@ -595,6 +665,23 @@ public:
         throw std::runtime_error("Index not support deserialize from a file stream");
     }
 
+    /**
+      * @brief Deserialize index from a file by mapping it into memory
+      *
+      * In-memory data cells point into the read-only mapping instead of being copied, so the
+      * index is searchable right away and pages fault in on first access. A data cell is
+      * copied out of the mapping on its first write. Payloads serialized with
+      * Options::set_serialize_align_bit are always aligned; others are aliased only when
+      * they happen to be aligned and copied otherwise. The file must not be modified while
+      * the index is alive.
+      *
+      * @param file_path is the path of a file written by Serialize(std::ostream&)
+      */
+    virtual tl::expected<void, Error>
+    DeserializeWithMMap(const std::string& file_path) {
+        throw std::runtime_error("Index not support deserialize with mmap");
+    }
+
 public:
     // [statstics methods]
 
@@ -86,6 +86,20 @@ public:
         return num_threads_building_.load(std::memory_order_acquire);
     }
 
+    /**
+     * @brief Gets the number of threads which help to search one query.
+     *
+     * This function retrieves the size of the search pool of an index, whose threads run the
+     * workers of a query searched with a parallelism above 1.
+     * It is thread-safe, using memory order acquire operations.
+     *
+     * @return size_t The number of threads for searching.
+     */
+    [[nodiscard]] inline size_t
+    num_threads_search() const {
+        return num_threads_search_.load(std::memory_order_acquire);
+    }
+
     /**
      * @brief Sets the number of threads for IO operations in diskann.
      *
@@ -107,6 +121,18 @@ public:
     void
     set_num_threads_building(size_t num_threads);
 
+    /**
+     * @brief Sets the number of threads which help to search one query.
+     *
+     * This function sets the size of the search pool of an index, which is created on the first
+     * search with a parallelism above 1. The parallelism of a search is clamped to this size.
+     * The specified number of threads should be between 1 and 200.
+     *
+     * @param num_threads Number of threads for searching.
+     */
+    void
+    set_num_threads_search(size_t num_threads);
+
     /**
      * @brief Gets the limit of block size for memory allocations.
      *
@@ -155,6 +181,56 @@ public:
     void
     set_direct_IO_object_align_bit(size_t align_bit);
 
+    /**
+     * @brief Gets the alignment bits of serialized IO payloads.
+     *
+     * When it is not 0, each IO payload written by Serialize is padded to start at a multiple
+     * of 2^bits from the beginning of the serialized index, so an index loaded through
+     * Index::DeserializeWithMMap can point into the mapped file instead of copying.
+     * The default 0 keeps the serialized format unchanged.
+     *
+     * @return size_t The alignment bits of serialized IO payloads.
+     */
+    [[nodiscard]] inline size_t
+    serialize_align_bit() const {
+        return serialize_align_bit_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Sets the alignment bits of serialized IO payloads.
+     *
+     * Indexes serialized with a non-zero value can only be read by versions that support
+     * aligned payloads.
+     *
+     * @param align_bit The alignment bits, must not be greater than 12(4K).
+     */
+    void
+    set_serialize_align_bit(size_t align_bit);
+
+    /**
+     * @brief Gets whether the indexes replicate their hot read-only structures per NUMA node.
+     *
+     * @return bool True if NUMA replication is enabled.
+     */
+    [[nodiscard]] inline bool
+    numa_replication() const {
+        return numa_replication_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Sets whether the indexes replicate their hot read-only structures per NUMA node.
+     *
+     * When enabled, an immutable HGraph keeps one copy of its route graphs on each node, and
+     * a search reads the copy of the node it runs on. It takes effect on SetImmutable and
+     * costs one extra copy of the route graphs per node; without NUMA it does nothing.
+     *
+     * @param enable Whether to enable NUMA replication.
+     */
+    inline void
+    set_numa_replication(bool enable) {
+        numa_replication_.store(enable, std::memory_order_release);
+    }
+
     /**
      * @brief Gets the current logger instance.
      *
@@ -197,6 +273,9 @@ private:
     ///< The number of threads used for building a single index.
     std::atomic<size_t> num_threads_building_{4};
 
+    ///< The size of the thread pool helping the searches of a single index.
+    std::atomic<size_t> num_threads_search_{8};
+
     ///< The size of the maximum memory allocated each time (default is 128MB).
     std::atomic<size_t> block_size_limit_{128 * 1024 * 1024};
 
@@ -206,6 +285,12 @@ private:
     ///< A flag to ensure that the set_direct_IO_object_align_bit() is called only once.
     std::atomic<bool> direct_IO_object_align_bit_flag{false};
 
+    ///< The alignment bits of serialized IO payloads (default is 0, no padding).
+    std::atomic<size_t> serialize_align_bit_{0};
+
+    ///< Whether to replicate the hot read-only structures per NUMA node (default is false).
+    std::atomic<bool> numa_replication_{false};
+
     ///< Pointer to the logger instance.
     Logger* logger_ = nullptr;
 };
@@ -14,7 +14,10 @@
 // limitations under the License.
 
 #pragma once
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 
 #include "vsag/dataset.h"
@@ -26,8 +29,34 @@ enum class SearchMode {
     RANGE_SEARCH = 2,
 };
 
+/**
+ * @brief The counters of one search, filled when SearchRequest::statistics_ is set.
+ *
+ * For a request with several queries the counters are summed over the queries. The io
+ * counters and the time split are only measured on the calling thread, io_time_ms is not
+ * included in graph_time_ms or distance_time_ms.
+ */
+struct SearchStatistics {
+    uint64_t hops{0};                // nodes expanded
+    uint64_t dist_cmp{0};            // distances computed
+    uint64_t io_bytes{0};            // bytes read from non-memory io
+    uint64_t io_count{0};            // read requests issued to non-memory io
+    uint64_t filter_rejections{0};   // candidates dropped by the filters
+    uint64_t reorder_candidates{0};  // candidates re-ranked by the precise codes
+    // the filtered search planner, each plan counts the queries it was chosen for
+    float filter_selectivity{1.0F};  // estimated fraction of ids passing the filters
+    uint64_t plan_graph{0};          // filters checked inside the graph traversal
+    uint64_t plan_two_hop{0};        // graph traversal expanding the rejected neighbors
+    uint64_t plan_brute_force{0};    // exhaustive scan of the allowed ids
+    double graph_time_ms{0};
+    double distance_time_ms{0};
+    double io_time_ms{0};
+    double total_time_ms{0};
+};
+
 class SearchRequest {
 public:
+    // one query, or several for an hgraph batch search, @see Index::SearchWithRequest
     DatasetPtr query_{nullptr};
     SearchMode mode_{SearchMode::KNN_SEARCH};
     int64_t topk_;
@@ -38,6 +67,15 @@ public:
     FilterPtr filter_{nullptr};
 
     Allocator* search_allocator_{nullptr};
+
+    // opt-in, reset and filled by the search, owned by the caller
+    SearchStatistics* statistics_{nullptr};
+
+    // opt-in, set to true from any thread to stop the search, @see Index::SearchAsync
+    std::shared_ptr<std::atomic<bool>> cancel_flag_{nullptr};
+
+    // opt-in, the time the search stops at, @see Index::SearchAsync
+    std::chrono::steady_clock::time_point deadline_{std::chrono::steady_clock::time_point::max()};
 };
 
 }  // namespace vsag
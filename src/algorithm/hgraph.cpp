@@ -19,12 +19,17 @@
 #include <fmt/format.h>
 
 #include <memory>
+#include <sstream>
 #include <stdexcept>
+#include <thread>
 
 #include "attr/argparse.h"
 #include "common.h"
+#include "data_cell/colocated_datacell_parameter.h"
 #include "data_cell/sparse_graph_datacell.h"
 #include "dataset_impl.h"
+#include "impl/filter/tombstone_filter.h"
+#include "impl/filtered_search_planner.h"
 #include "impl/heap/standard_heap.h"
 #include "impl/odescent_graph_builder.h"
 #include "impl/pruning_strategy.h"
@@ -35,11 +40,43 @@
 #include "storage/serialization.h"
 #include "storage/stream_reader.h"
 #include "typing.h"
+#include "utils/numa.h"
+#include "utils/slow_task_timer.h"
 #include "utils/util_functions.h"
 #include "vsag/options.h"
 
 namespace vsag {
 
+// the stages of ContinueBuild, persisted in the checkpoints
+enum class HGraphBuildStage : uint64_t { TRAIN = 0, INSERT = 1, OPTIMIZE = 2, FINISH = 3 };
+
+static const std::string HGRAPH_BUILD_STAGE = "hgraph_build_stage";
+static const std::string HGRAPH_BUILD_INSERTED_COUNT = "hgraph_build_inserted_count";
+static const std::string HGRAPH_BUILD_SNAPSHOT_COUNT = "hgraph_build_snapshot_count";
+
+// the stages reported to the build progress callback
+static constexpr const char* BUILD_STAGE_TRAIN = "train";
+static constexpr const char* BUILD_STAGE_INSERT = "insert";
+static constexpr const char* BUILD_STAGE_OPTIMIZE = "optimize";
+
+static Binary
+uint64_to_binary(uint64_t value) {
+    Binary binary;
+    binary.size = sizeof(uint64_t);
+    binary.data = std::shared_ptr<int8_t[]>(new int8_t[binary.size]);
+    std::memcpy(binary.data.get(), &value, binary.size);
+    return binary;
+}
+
+static uint64_t
+binary_to_uint64(const Binary& binary) {
+    CHECK_ARGUMENT(binary.data != nullptr and binary.size == sizeof(uint64_t),
+                   "invalid build checkpoint");
+    uint64_t value = 0;
+    std::memcpy(&value, binary.data.get(), binary.size);
+    return value;
+}
+
 HGraph::HGraph(const HGraphParameterPtr& hgraph_param, const vsag::IndexCommonParam& common_param)
     : InnerIndexInterface(hgraph_param, common_param),
       route_graphs_(common_param.allocator_.get()),
@@ -50,12 +87,20 @@ HGraph::HGraph(const HGraphParameterPtr& hgraph_param, const vsag::IndexCommonPa
       use_attribute_filter_(hgraph_param->use_attribute_filter),
       ef_construct_(hgraph_param->ef_construction),
       build_thread_count_(hgraph_param->build_thread_count),
+      build_batch_size_(hgraph_param->build_batch_size),
+      build_checkpoint_interval_(hgraph_param->build_checkpoint_interval),
       odescent_param_(hgraph_param->odescent_param),
       graph_type_(hgraph_param->graph_type),
       hierarchical_datacell_param_(hgraph_param->hierarchical_graph_param),
       extra_info_size_(common_param.extra_info_size_),
-      deleted_ids_(allocator_) {
+      deleted_ids_(allocator_),
+      tombstones_(allocator_),
+      pending_repair_ids_(allocator_),
+      repaired_ids_(allocator_),
+      reclaimed_ids_(allocator_),
+      remove_compaction_ratio_(hgraph_param->remove_compaction_ratio) {
     this->label_table_->compress_duplicate_data_ = hgraph_param->support_duplicate;
+    this->visited_list_mode_ = hgraph_param->visited_list_mode;
     neighbors_mutex_ = std::make_shared<PointsMutex>(0, common_param.allocator_.get());
     this->basic_flatten_codes_ =
         FlattenInterface::MakeInstance(hgraph_param->base_codes_param, common_param);
@@ -65,6 +110,12 @@ HGraph::HGraph(const HGraphParameterPtr& hgraph_param, const vsag::IndexCommonPa
     }
     this->searcher_ = std::make_shared<BasicSearcher>(common_param, neighbors_mutex_);
 
+    auto colocated_param =
+        std::dynamic_pointer_cast<ColocatedDataCellParameter>(hgraph_param->bottom_graph_param);
+    if (colocated_param != nullptr) {
+        // the records of a co-located graph hold the precise codes of the reorder
+        colocated_param->code_size_ = this->high_precise_codes_->code_size_;
+    }
     this->bottom_graph_ =
         GraphInterface::MakeInstance(hgraph_param->bottom_graph_param, common_param);
     mult_ = 1 / log(1.0 * static_cast<double>(this->bottom_graph_->MaximumDegree()));
@@ -124,25 +175,126 @@ std::vector<int64_t>
 HGraph::Build(const DatasetPtr& data) {
     CHECK_ARGUMENT(GetNumElements() == 0, "index is not empty");
     this->Train(data);
+    this->report_build_progress(BUILD_STAGE_TRAIN, 1, 1);
     std::vector<int64_t> ret;
     if (graph_type_ == GRAPH_TYPE_NSW) {
         ret = this->Add(data);
     } else {
         ret = this->build_by_odescent(data);
+        this->report_build_progress(
+            BUILD_STAGE_INSERT, data->GetNumElements(), data->GetNumElements());
     }
     if (use_elp_optimizer_) {
         elp_optimize();
     }
+    this->report_build_progress(BUILD_STAGE_OPTIMIZE, 1, 1);
     return ret;
 }
 
+Index::Checkpoint
+HGraph::ContinueBuild(const DatasetPtr& base, const BinarySet& binary_set) {
+    if (data_type_ != DataTypes::DATA_TYPE_SPARSE) {
+        CHECK_ARGUMENT(
+            base->GetDim() == dim_,
+            fmt::format("base.dim({}) must be equal to index.dim({})", base->GetDim(), dim_));
+    }
+    CHECK_ARGUMENT(get_data(base) != nullptr, "base vectors are nullptr");
+
+    auto stage = HGraphBuildStage::TRAIN;
+    int64_t inserted_count = 0;
+    int64_t snapshot_count = 0;
+    bool restored = false;
+    if (not binary_set.GetKeys().empty()) {
+        CHECK_ARGUMENT(binary_set.Contains(HGRAPH_BUILD_STAGE),
+                       "missing build stage while partial building");
+        stage = static_cast<HGraphBuildStage>(binary_to_uint64(binary_set.Get(HGRAPH_BUILD_STAGE)));
+        inserted_count =
+            static_cast<int64_t>(binary_to_uint64(binary_set.Get(HGRAPH_BUILD_INSERTED_COUNT)));
+        snapshot_count = inserted_count;
+        if (binary_set.Contains(HGRAPH_BUILD_SNAPSHOT_COUNT)) {
+            snapshot_count = static_cast<int64_t>(
+                binary_to_uint64(binary_set.Get(HGRAPH_BUILD_SNAPSHOT_COUNT)));
+        }
+        // a fresh index resumes from the snapshot and replays the batches inserted after it,
+        // the index which made the checkpoint already holds them
+        if (this->total_count_ == 0 and stage != HGraphBuildStage::TRAIN) {
+            this->deserialize_build_checkpoint(binary_set.Get(this->GetName()));
+            inserted_count = snapshot_count;
+            restored = true;
+        }
+    } else {
+        CHECK_ARGUMENT(GetNumElements() == 0, "index is not empty");
+    }
+    CHECK_ARGUMENT(inserted_count <= base->GetNumElements(),
+                   fmt::format("checkpoint inserted {} vectors but base only has {}",
+                               inserted_count,
+                               base->GetNumElements()));
+
+    auto total = base->GetNumElements();
+    auto last_stage = stage;
+    switch (stage) {
+        case HGraphBuildStage::TRAIN: {
+            SlowTaskTimer t("hgraph build (train)");
+            this->Train(base);
+            this->report_build_progress(BUILD_STAGE_TRAIN, 1, 1);
+            stage = HGraphBuildStage::INSERT;
+            break;
+        }
+        case HGraphBuildStage::INSERT: {
+            if (graph_type_ == GRAPH_TYPE_NSW) {
+                auto end =
+                    std::min(total, inserted_count + static_cast<int64_t>(build_batch_size_));
+                SlowTaskTimer t(fmt::format("hgraph build (insert {}/{})", end, total));
+                this->add_rows(base, inserted_count, end);
+                inserted_count = end;
+            } else {
+                // odescent refines the graph over all the vectors at once
+                SlowTaskTimer t("hgraph build (odescent)");
+                this->build_by_odescent(base);
+                inserted_count = total;
+                this->report_build_progress(BUILD_STAGE_INSERT, total, total);
+            }
+            if (inserted_count == total) {
+                stage = HGraphBuildStage::OPTIMIZE;
+            }
+            break;
+        }
+        case HGraphBuildStage::OPTIMIZE: {
+            if (use_elp_optimizer_) {
+                elp_optimize();
+            }
+            this->report_build_progress(BUILD_STAGE_OPTIMIZE, 1, 1);
+            stage = HGraphBuildStage::FINISH;
+            break;
+        }
+        case HGraphBuildStage::FINISH:
+            logger::warn("build process is finished");
+    }
+
+    BinarySet after_binary_set;
+    after_binary_set.Set(HGRAPH_BUILD_STAGE, uint64_to_binary(static_cast<uint64_t>(stage)));
+    after_binary_set.Set(HGRAPH_BUILD_INSERTED_COUNT,
+                         uint64_to_binary(static_cast<uint64_t>(inserted_count)));
+    // the snapshot of a restored index is the only record of the batches it replayed
+    auto interval_count = static_cast<int64_t>(build_checkpoint_interval_ * build_batch_size_);
+    if (restored or stage != last_stage or inserted_count - snapshot_count >= interval_count) {
+        snapshot_count = inserted_count;
+        after_binary_set.Set(this->GetName(), this->serialize_build_checkpoint());
+    } else {
+        after_binary_set.Set(this->GetName(), binary_set.Get(this->GetName()));
+    }
+    after_binary_set.Set(HGRAPH_BUILD_SNAPSHOT_COUNT,
+                         uint64_to_binary(static_cast<uint64_t>(snapshot_count)));
+    return Index::Checkpoint{.data = after_binary_set,
+                             .finish = stage == HGraphBuildStage::FINISH};
+}
+
 std::vector<int64_t>
 HGraph::build_by_odescent(const DatasetPtr& data) {
     std::vector<int64_t> failed_ids;
 
     auto total = data->GetNumElements();
     const auto* labels = data->GetIds();
-    const auto* vectors = data->GetFloat32Vectors();
     const auto* extra_infos = data->GetExtraInfos();
     auto inner_ids = this->get_unique_inner_ids(total);
     Vector<Vector<InnerIdType>> route_graph_ids(allocator_);
@@ -156,10 +308,7 @@ HGraph::build_by_odescent(const DatasetPtr& data) {
         InnerIdType inner_id = inner_ids.at(cur_size);
         cur_size++;
         this->label_table_->Insert(inner_id, label);
-        this->basic_flatten_codes_->InsertVector(vectors + dim_ * i, inner_id);
-        if (use_reorder_) {
-            this->high_precise_codes_->InsertVector(vectors + dim_ * i, inner_id);
-        }
+        this->encode_one_point(get_data(data, i), inner_id);
         auto level = this->get_random_level() - 1;
         if (level >= 0) {
             if (level >= static_cast<int>(route_graph_ids.size()) || route_graph_ids.empty()) {
@@ -196,13 +345,12 @@ HGraph::build_by_odescent(const DatasetPtr& data) {
 
 std::vector<int64_t>
 HGraph::Add(const DatasetPtr& data) {
-    std::vector<int64_t> failed_ids;
     auto base_dim = data->GetDim();
     if (data_type_ != DataTypes::DATA_TYPE_SPARSE) {
         CHECK_ARGUMENT(base_dim == dim_,
                        fmt::format("base.dim({}) must be equal to index.dim({})", base_dim, dim_));
     }
-    CHECK_ARGUMENT(get_data(data) != nullptr, "base.float_vector is nullptr");
+    CHECK_ARGUMENT(get_data(data) != nullptr, "base vectors are nullptr");
 
     {
         std::lock_guard lock(this->add_mutex_);
@@ -210,28 +358,17 @@ HGraph::Add(const DatasetPtr& data) {
             this->Train(data);
         }
     }
+    return this->add_rows(data, 0, data->GetNumElements());
+}
 
-    auto add_func = [&](const void* data,
-                        int level,
-                        InnerIdType inner_id,
-                        const char* extra_info,
-                        const AttributeSet* attrs) -> void {
-        if (this->extra_infos_ != nullptr) {
-            this->extra_infos_->InsertExtraInfo(extra_info, inner_id);
-        }
-        if (attrs != nullptr and this->use_attribute_filter_) {
-            this->attr_filter_index_->Insert(*attrs, inner_id);
-        }
-        this->add_one_point(data, level, inner_id);
-    };
-
-    std::vector<std::future<void>> futures;
-    auto total = data->GetNumElements();
+std::vector<int64_t>
+HGraph::add_rows(const DatasetPtr& data, int64_t begin, int64_t end) {
+    std::vector<int64_t> failed_ids;
     const auto* labels = data->GetIds();
     const auto* extra_infos = data->GetExtraInfos();
     const auto* attr_sets = data->GetAttributeSets();
     Vector<std::pair<InnerIdType, LabelType>> inner_ids(allocator_);
-    for (int64_t j = 0; j < total; ++j) {
+    for (int64_t j = begin; j < end; ++j) {
         auto label = labels[j];
         InnerIdType inner_id;
         {
@@ -240,7 +377,7 @@ HGraph::Add(const DatasetPtr& data) {
                 failed_ids.emplace_back(label);
                 continue;
             }
-            {
+            if (not this->reuse_removed_inner_id(inner_id)) {
                 std::lock_guard lock(this->add_mutex_);
                 inner_id = this->get_unique_inner_ids(1).at(0);
                 uint64_t new_count = total_count_;
@@ -250,29 +387,74 @@ HGraph::Add(const DatasetPtr& data) {
             inner_ids.emplace_back(inner_id, j);
         }
     }
-    for (auto& [inner_id, local_idx] : inner_ids) {
-        int level;
-        {
-            std::lock_guard label_lock(this->label_lookup_mutex_);
+    Vector<int> levels(inner_ids.size(), allocator_);
+    {
+        std::lock_guard label_lock(this->label_lookup_mutex_);
+        for (auto& level : levels) {
             level = this->get_random_level() - 1;
         }
-        const auto* extra_info = extra_infos + local_idx * extra_info_size_;
-        const AttributeSet* cur_attr_set = nullptr;
-        if (attr_sets != nullptr) {
-            cur_attr_set = attr_sets + local_idx;
+    }
+
+    auto encode_func = [&](uint64_t first, uint64_t last) -> void {
+        for (auto i = first; i < last; ++i) {
+            auto inner_id = inner_ids[i].first;
+            auto local_idx = inner_ids[i].second;
+            if (this->extra_infos_ != nullptr) {
+                this->extra_infos_->InsertExtraInfo(extra_infos + local_idx * extra_info_size_,
+                                                    inner_id);
+            }
+            if (attr_sets != nullptr and this->use_attribute_filter_) {
+                this->attr_filter_index_->Insert(attr_sets[local_idx], inner_id);
+            }
+            this->encode_one_point(get_data(data, local_idx), inner_id);
         }
-        if (this->build_pool_ != nullptr) {
-            auto future = this->build_pool_->GeneralEnqueue(
-                add_func, get_data(data, local_idx), level, inner_id, extra_info, cur_attr_set);
-            futures.emplace_back(std::move(future));
-        } else {
-            add_func(get_data(data, local_idx), level, inner_id, extra_info, cur_attr_set);
+    };
+    auto link_func = [&](uint64_t i) -> void {
+        this->link_one_point(get_data(data, inner_ids[i].second), levels[i], inner_ids[i].first);
+    };
+
+    uint64_t insert_count = inner_ids.size();
+    std::vector<std::future<void>> encode_futures;
+    std::vector<std::future<void>> link_futures;
+    auto encode_batch = [&](uint64_t first) -> void {
+        auto last = std::min(first + BUILD_PIPELINE_BATCH_SIZE, insert_count);
+        for (auto chunk = first; chunk < last; chunk += BUILD_ENCODE_CHUNK_SIZE) {
+            auto chunk_end = std::min(chunk + BUILD_ENCODE_CHUNK_SIZE, last);
+            if (this->build_pool_ != nullptr) {
+                encode_futures.emplace_back(
+                    this->build_pool_->GeneralEnqueue(encode_func, chunk, chunk_end));
+            } else {
+                encode_func(chunk, chunk_end);
+            }
         }
-    }
-    if (this->build_pool_ != nullptr) {
+    };
+    auto wait_all = [](std::vector<std::future<void>>& futures) -> void {
         for (auto& future : futures) {
             future.get();
         }
+        futures.clear();
+    };
+
+    // a point is linked only after the codes of its batch are written, the codes of the
+    // next batch are queued ahead of the linking so both keep the pool busy
+    encode_batch(0);
+    for (uint64_t first = 0; first < insert_count; first += BUILD_PIPELINE_BATCH_SIZE) {
+        auto last = std::min(first + BUILD_PIPELINE_BATCH_SIZE, insert_count);
+        wait_all(encode_futures);
+        if (last < insert_count) {
+            encode_batch(last);
+        }
+        for (auto i = first; i < last; ++i) {
+            if (this->build_pool_ != nullptr) {
+                link_futures.emplace_back(this->build_pool_->GeneralEnqueue(link_func, i));
+            } else {
+                link_func(i);
+            }
+        }
+        wait_all(link_futures);
+        auto finished = last == insert_count ? end : inner_ids[last].second;
+        this->report_build_progress(
+            BUILD_STAGE_INSERT, static_cast<uint64_t>(finished), data->GetNumElements());
     }
     return failed_ids;
 }
@@ -340,6 +522,7 @@ HGraph::KnnSearch(const DatasetPtr& query,
             ft = std::make_shared<InnerIdWrapperFilter>(filter, *this->label_table_);
         }
     }
+    ft = this->wrap_tombstone_filter(ft);
 
     if (iter_ctx == nullptr) {
         auto cur_count = this->bottom_graph_->TotalCount();
@@ -355,6 +538,8 @@ HGraph::KnnSearch(const DatasetPtr& query,
     auto* iter_filter_ctx = static_cast<IteratorFilterContext*>(iter_ctx);
     auto search_result = DistanceHeap::MakeInstanceBySize<true, false>(search_allocator, k);
     const auto* query_data = get_data(query);
+    // the repair of removed points moves the entry point under the exclusive lock
+    std::shared_lock<std::shared_mutex> rlock(this->global_mutex_);
     if (is_last_filter) {
         while (!iter_filter_ctx->Empty()) {
             uint32_t cur_inner_id = iter_filter_ctx->GetTopID();
@@ -370,9 +555,10 @@ HGraph::KnnSearch(const DatasetPtr& query,
         search_param.is_inner_id_allowed = nullptr;
         search_param.search_alloc = search_allocator;
         if (iter_filter_ctx->IsFirstUsed()) {
-            for (auto i = static_cast<int64_t>(this->route_graphs_.size() - 1); i >= 0; --i) {
+            const auto& route_graphs = this->search_route_graphs();
+            for (auto i = static_cast<int64_t>(route_graphs.size() - 1); i >= 0; --i) {
                 auto result = this->search_one_graph(
-                    query_data, this->route_graphs_[i], this->basic_flatten_codes_, search_param);
+                    query_data, route_graphs[i], this->basic_flatten_codes_, search_param);
                 search_param.ep = result->Top().second;
             }
         }
@@ -472,6 +658,16 @@ HGraph::EstimateMemory(uint64_t num_elements) const {
     return estimate_memory;
 }
 
+SafeThreadPool*
+HGraph::get_search_pool() const {
+    std::call_once(this->search_pool_flag_, [this]() {
+        this->search_pool_size_ = static_cast<int64_t>(Options::Instance().num_threads_search());
+        this->search_pool_ = std::make_shared<SafeThreadPool>(
+            new DefaultThreadPool(this->search_pool_size_), true);
+    });
+    return this->search_pool_.get();
+}
+
 GraphInterfacePtr
 HGraph::generate_one_route_graph() {
     return std::make_shared<SparseGraphDataCell>(hierarchical_datacell_param_, this->allocator_);
@@ -483,7 +679,26 @@ HGraph::search_one_graph(const void* query,
                          const GraphInterfacePtr& graph,
                          const FlattenInterfacePtr& flatten,
                          InnerSearchParam& inner_search_param) const {
-    auto visited_list = this->pool_->TakeOne();
+    // a search on a pool thread waits for its workers, run it inline to not starve the pool
+    if (inner_search_param.search_mode == KNN_SEARCH and
+        inner_search_param.parallel_search_thread_count > 1 and
+        not SafeThreadPool::InWorkerThread()) {
+        auto* search_pool = this->get_search_pool();
+        // the caller searches too, more workers than the pool threads would wait in its queue
+        inner_search_param.parallel_search_thread_count = std::min(
+            inner_search_param.parallel_search_thread_count, this->search_pool_size_ + 1);
+        auto visited_list = this->parallel_pool_->TakeOne();
+        auto result = this->searcher_->ParallelSearch(graph,
+                                                      flatten,
+                                                      visited_list,
+                                                      query,
+                                                      inner_search_param,
+                                                      search_pool,
+                                                      this->label_table_);
+        this->parallel_pool_->ReturnOne(visited_list);
+        return result;
+    }
+    auto visited_list = this->pool_->TakeOne(inner_search_param.ef);
     auto result = this->searcher_->Search(
         graph, flatten, visited_list, query, inner_search_param, this->label_table_);
     this->pool_->ReturnOne(visited_list);
@@ -497,7 +712,7 @@ HGraph::search_one_graph(const void* query,
                          const FlattenInterfacePtr& flatten,
                          InnerSearchParam& inner_search_param,
                          IteratorFilterContext* iter_ctx) const {
-    auto visited_list = this->pool_->TakeOne();
+    auto visited_list = this->pool_->TakeOne(inner_search_param.ef);
     auto result =
         this->searcher_->Search(graph, flatten, visited_list, query, inner_search_param, iter_ctx);
     this->pool_->ReturnOne(visited_list);
@@ -510,10 +725,11 @@ HGraph::RangeSearch(const DatasetPtr& query,
                     const std::string& parameters,
                     const FilterPtr& filter,
                     int64_t limited_size) const {
-    std::shared_ptr<InnerIdWrapperFilter> ft = nullptr;
+    FilterPtr ft = nullptr;
     if (filter != nullptr) {
         ft = std::make_shared<InnerIdWrapperFilter>(filter, *this->label_table_);
     }
+    ft = this->wrap_tombstone_filter(ft);
     int64_t query_dim = query->GetDim();
     if (data_type_ != DataTypes::DATA_TYPE_SPARSE) {
         CHECK_ARGUMENT(
@@ -530,14 +746,17 @@ HGraph::RangeSearch(const DatasetPtr& query,
     CHECK_ARGUMENT(limited_size != 0,
                    fmt::format("limited_size({}) must not be equal to 0", limited_size));
 
+    // the repair of removed points moves the entry point under the exclusive lock
+    std::shared_lock<std::shared_mutex> rlock(this->global_mutex_);
     InnerSearchParam search_param;
     search_param.ep = this->entry_point_id_;
     search_param.topk = 1;
     search_param.ef = 1;
     const auto* raw_query = get_data(query);
-    for (auto i = static_cast<int64_t>(this->route_graphs_.size() - 1); i >= 0; --i) {
+    const auto& route_graphs = this->search_route_graphs();
+    for (auto i = static_cast<int64_t>(route_graphs.size() - 1); i >= 0; --i) {
         auto result = this->search_one_graph(
-            raw_query, this->route_graphs_[i], this->basic_flatten_codes_, search_param);
+            raw_query, route_graphs[i], this->basic_flatten_codes_, search_param);
         search_param.ep = result->Top().second;
     }
 
@@ -551,10 +770,13 @@ HGraph::RangeSearch(const DatasetPtr& query,
     search_param.search_mode = RANGE_SEARCH;
     search_param.consider_duplicate = true;
     search_param.range_search_limit_size = static_cast<int>(limited_size);
+    UnorderedMap<InnerIdType, float> exact_dists(allocator_);
+    this->bind_colocated_codes(search_param, exact_dists);
     auto search_result = this->search_one_graph(
         raw_query, this->bottom_graph_, this->basic_flatten_codes_, search_param);
     if (use_reorder_) {
-        this->reorder(raw_query, this->high_precise_codes_, search_result, limited_size);
+        this->reorder(
+            raw_query, this->high_precise_codes_, search_result, limited_size, &exact_dists);
     }
 
     if (limited_size > 0) {
@@ -596,13 +818,12 @@ HGraph::serialize_basic_info_v0_14(StreamWriter& writer) const {
     StreamWriter::WriteObj(writer, capacity);
     StreamWriter::WriteVector(writer, this->label_table_->label_table_);
 
-    uint64_t size = this->label_table_->label_remap_.size();
+    uint64_t size = this->label_table_->label_remap_.Size();
     StreamWriter::WriteObj(writer, size);
-    for (const auto& pair : this->label_table_->label_remap_) {
-        auto key = pair.first;
+    this->label_table_->label_remap_.ForEach([&writer](LabelType key, InnerIdType value) {
         StreamWriter::WriteObj(writer, key);
-        StreamWriter::WriteObj(writer, pair.second);
-    }
+        StreamWriter::WriteObj(writer, value);
+    });
 }
 
 void
@@ -625,12 +846,13 @@ HGraph::deserialize_basic_info_v0_14(StreamReader& reader) {
 
     uint64_t size;
     StreamReader::ReadObj(reader, size);
+    this->label_table_->label_remap_.Reserve(size);
     for (uint64_t i = 0; i < size; ++i) {
         LabelType key;
         StreamReader::ReadObj(reader, key);
         InnerIdType value;
         StreamReader::ReadObj(reader, value);
-        this->label_table_->label_remap_.emplace(key, value);
+        this->label_table_->label_remap_.Insert(key, value);
     }
 }
 
@@ -709,13 +931,12 @@ HGraph::serialize_label_info(StreamWriter& writer) const {
         return;
     }
     StreamWriter::WriteVector(writer, this->label_table_->label_table_);
-    uint64_t size = this->label_table_->label_remap_.size();
+    uint64_t size = this->label_table_->label_remap_.Size();
     StreamWriter::WriteObj(writer, size);
-    for (const auto& pair : this->label_table_->label_remap_) {
-        auto key = pair.first;
+    this->label_table_->label_remap_.ForEach([&writer](LabelType key, InnerIdType value) {
         StreamWriter::WriteObj(writer, key);
-        StreamWriter::WriteObj(writer, pair.second);
-    }
+        StreamWriter::WriteObj(writer, value);
+    });
 }
 
 void
@@ -727,17 +948,19 @@ HGraph::deserialize_label_info(StreamReader& reader) const {
     StreamReader::ReadVector(reader, this->label_table_->label_table_);
     uint64_t size;
     StreamReader::ReadObj(reader, size);
+    this->label_table_->label_remap_.Reserve(size);
     for (uint64_t i = 0; i < size; ++i) {
         LabelType key;
         StreamReader::ReadObj(reader, key);
         InnerIdType value;
         StreamReader::ReadObj(reader, value);
-        this->label_table_->label_remap_.emplace(key, value);
+        this->label_table_->label_remap_.Insert(key, value);
     }
 }
 
 void
 HGraph::Serialize(StreamWriter& writer) const {
+    this->wait_for_removal_repair();
     if (this->ignore_reorder_) {
         this->use_reorder_ = false;
     }
@@ -790,6 +1013,8 @@ HGraph::Serialize(StreamWriter& writer) const {
 
 void
 HGraph::Deserialize(StreamReader& reader) {
+    this->wait_for_removal_repair();
+    this->numa_route_graphs_.clear();
     // try to deserialize footer (only in new version)
     auto footer = Footer::Parse(reader);
 
@@ -812,8 +1037,12 @@ HGraph::Deserialize(StreamReader& reader) {
         }
         auto new_size = max_capacity_.load();
         this->neighbors_mutex_->Resize(new_size);
+        this->resize_tombstones(new_size);
 
-        pool_ = std::make_shared<VisitedListPool>(1, allocator_, new_size, allocator_);
+        pool_ = std::make_shared<AdaptiveVisitedListPool>(
+            1, allocator_, new_size, bottom_graph_->MaximumDegree(), visited_list_mode_);
+        parallel_pool_ =
+            std::make_shared<ConcurrentVisitedListPool>(0, allocator_, new_size, allocator_);
 
         if (this->extra_info_size_ > 0 && this->extra_infos_ != nullptr) {
             this->extra_infos_->Deserialize(buffer_reader);
@@ -842,8 +1071,12 @@ HGraph::Deserialize(StreamReader& reader) {
         }
         auto new_size = max_capacity_.load();
         this->neighbors_mutex_->Resize(new_size);
+        this->resize_tombstones(new_size);
 
-        pool_ = std::make_shared<VisitedListPool>(1, allocator_, new_size, allocator_);
+        pool_ = std::make_shared<AdaptiveVisitedListPool>(
+            1, allocator_, new_size, bottom_graph_->MaximumDegree(), visited_list_mode_);
+        parallel_pool_ =
+            std::make_shared<ConcurrentVisitedListPool>(0, allocator_, new_size, allocator_);
 
         if (this->extra_info_size_ > 0 && this->extra_infos_ != nullptr) {
             this->extra_infos_->Deserialize(buffer_reader);
@@ -859,6 +1092,9 @@ HGraph::Deserialize(StreamReader& reader) {
     if (use_elp_optimizer_) {
         elp_optimize();
     }
+    if (this->immutable_) {
+        freeze_route_graphs(this->route_graphs_);
+    }
 }
 
 std::string
@@ -886,6 +1122,7 @@ HGraph::GetMemoryUsageDetail() const {
 
 float
 HGraph::CalcDistanceById(const float* query, int64_t id) const {
+    check_float_query_supported();
     auto flat = this->basic_flatten_codes_;
     if (use_reorder_) {
         flat = this->high_precise_codes_;
@@ -902,6 +1139,7 @@ HGraph::CalcDistanceById(const float* query, int64_t id) const {
 
 DatasetPtr
 HGraph::CalDistanceById(const float* query, const int64_t* ids, int64_t count) const {
+    check_float_query_supported();
     auto flat = this->basic_flatten_codes_;
     if (use_reorder_) {
         flat = this->high_precise_codes_;
@@ -931,6 +1169,16 @@ HGraph::CalDistanceById(const float* query, const int64_t* ids, int64_t count) c
     return result;
 }
 
+void
+HGraph::check_float_query_supported() const {
+    // the codes of an int8 index are compared with int8 queries only
+    if (data_type_ == DataTypes::DATA_TYPE_INT8) {
+        throw VsagException(
+            ErrorType::UNSUPPORTED_INDEX_OPERATION,
+            fmt::format("HGraph with {} datatype does not support a float query", DATATYPE_INT8));
+    }
+}
+
 std::pair<int64_t, int64_t>
 HGraph::GetMinAndMaxId() const {
     int64_t min_id = INT64_MAX;
@@ -950,6 +1198,37 @@ HGraph::GetMinAndMaxId() const {
     return {min_id, max_id};
 }
 
+void
+HGraph::WarmUp(const DatasetPtr& queries, int64_t k, const std::string& parameters) {
+    if (not use_reorder_ or this->high_precise_codes_->GetCache() == nullptr) {
+        return;
+    }
+    CHECK_ARGUMENT(queries->GetDim() == dim_,
+                   fmt::format("queries.dim({}) must be equal to index.dim({})",
+                               queries->GetDim(),
+                               dim_));
+    Vector<InnerIdType> inner_ids(allocator_);
+    for (int64_t i = 0; i < queries->GetNumElements(); ++i) {
+        auto query = Dataset::Make();
+        query->Owner(false)->NumElements(1)->Dim(dim_);
+        if (data_type_ == DataTypes::DATA_TYPE_INT8) {
+            query->Int8Vectors(queries->GetInt8Vectors() + i * dim_);
+        } else {
+            query->Float32Vectors(queries->GetFloat32Vectors() + i * dim_);
+        }
+        // the replayed search itself feeds the access frequency of the reorder candidates
+        auto result = this->KnnSearch(query, k, parameters, nullptr);
+        std::shared_lock<std::shared_mutex> lock(this->label_lookup_mutex_);
+        for (int64_t j = 0; j < result->GetDim(); ++j) {
+            auto label = result->GetIds()[j];
+            if (this->label_table_->CheckLabel(label)) {
+                inner_ids.emplace_back(this->label_table_->GetIdByLabel(label));
+            }
+        }
+    }
+    this->high_precise_codes_->WarmUp(inner_ids.data(), inner_ids.size());
+}
+
 void
 HGraph::GetExtraInfoByIds(const int64_t* ids, int64_t count, char* extra_infos) const {
     if (this->extra_infos_ == nullptr) {
@@ -963,11 +1242,21 @@ HGraph::GetExtraInfoByIds(const int64_t* ids, int64_t count, char* extra_infos)
 }
 
 void
-HGraph::add_one_point(const void* data, int level, InnerIdType inner_id) {
+HGraph::encode_one_point(const void* data, InnerIdType inner_id) {
     this->basic_flatten_codes_->InsertVector(data, inner_id);
     if (use_reorder_) {
         this->high_precise_codes_->InsertVector(data, inner_id);
+        if (this->bottom_graph_->ColocatedCodeSize() > 0) {
+            // the record of the point carries a copy of its precise code for the searches
+            Vector<uint8_t> codes(this->high_precise_codes_->code_size_, allocator_);
+            this->high_precise_codes_->GetCodesById(inner_id, codes.data());
+            this->bottom_graph_->InsertCodes(inner_id, codes.data());
+        }
     }
+}
+
+void
+HGraph::link_one_point(const void* data, int level, InnerIdType inner_id) {
     std::unique_lock add_lock(add_mutex_);
     if (level >= static_cast<int>(this->route_graphs_.size()) || bottom_graph_->TotalCount() == 0) {
         std::lock_guard<std::shared_mutex> wlock(this->global_mutex_);
@@ -1011,6 +1300,7 @@ HGraph::graph_add_one(const void* data, int level, InnerIdType inner_id) {
 
     param.ef = this->ef_construct_;
     param.topk = static_cast<int64_t>(ef_construct_);
+    param.is_inner_id_allowed = this->wrap_tombstone_filter(nullptr);
 
     if (bottom_graph_->TotalCount() != 0) {
         result = search_one_graph(data, this->bottom_graph_, flatten_codes, param);
@@ -1049,7 +1339,11 @@ HGraph::resize(uint64_t new_size) {
     cur_size = this->max_capacity_.load();
     if (cur_size < new_size_power_2) {
         this->neighbors_mutex_->Resize(new_size_power_2);
-        pool_ = std::make_shared<VisitedListPool>(1, allocator_, new_size_power_2, allocator_);
+        this->resize_tombstones(new_size_power_2);
+        pool_ = std::make_shared<AdaptiveVisitedListPool>(
+            1, allocator_, new_size_power_2, bottom_graph_->MaximumDegree(), visited_list_mode_);
+        parallel_pool_ = std::make_shared<ConcurrentVisitedListPool>(
+            0, allocator_, new_size_power_2, allocator_);
         this->label_table_->Resize(new_size_power_2);
         bottom_graph_->Resize(new_size_power_2);
         this->max_capacity_.store(new_size_power_2);
@@ -1100,7 +1394,8 @@ HGraph::InitFeatures() {
     // About Train
     auto name = this->basic_flatten_codes_->GetQuantizerName();
 
-    if (name != QUANTIZATION_TYPE_VALUE_FP32 and name != QUANTIZATION_TYPE_VALUE_BF16) {
+    if (name != QUANTIZATION_TYPE_VALUE_FP32 and name != QUANTIZATION_TYPE_VALUE_BF16 and
+        name != QUANTIZATION_TYPE_VALUE_INT8) {
         this->index_feature_list_->SetFeature(IndexFeature::NEED_TRAIN);
     } else {
         this->index_feature_list_->SetFeatures({
@@ -1150,27 +1445,69 @@ HGraph::elp_optimize() {
     param.ef = 80;
     param.topk = 10;
     param.is_inner_id_allowed = nullptr;
-    searcher_->SetMockParameters(bottom_graph_, basic_flatten_codes_, pool_, param, dim_);
+    searcher_->SetMockParameters(bottom_graph_,
+                                 basic_flatten_codes_,
+                                 pool_->GetPool(pool_->SelectMode(param.ef)),
+                                 param,
+                                 dim_);
     // TODO(ZXY): optimize PREFETCH_DEPTH_CODE and add default value for the others
     optimizer_->RegisterParameter(RuntimeParameter(PREFETCH_STRIDE_CODE, 1, 10, 1));
     optimizer_->RegisterParameter(RuntimeParameter(PREFETCH_STRIDE_VISIT, 1, 10, 1));
     optimizer_->Optimize(searcher_);
 }
 
+void
+HGraph::report_build_progress(const char* stage, uint64_t finished, uint64_t total) const {
+    if (this->build_progress_callback_ != nullptr) {
+        this->build_progress_callback_(stage, finished, total);
+    }
+}
+
+Binary
+HGraph::serialize_build_checkpoint() const {
+    uint64_t num_bytes = this->CalSerializeSize();
+    std::shared_ptr<int8_t[]> bin(new int8_t[num_bytes]);
+    char* buffer = reinterpret_cast<char*>(bin.get());
+    BufferStreamWriter writer(buffer);
+    this->Serialize(writer);
+    return Binary{.data = bin, .size = num_bytes};
+}
+
+void
+HGraph::deserialize_build_checkpoint(const Binary& binary) {
+    CHECK_ARGUMENT(binary.data != nullptr, "missing index while partial building");
+    auto func = [&](uint64_t offset, uint64_t len, void* dest) -> void {
+        std::memcpy(dest, binary.data.get() + offset, len);
+    };
+    uint64_t cursor = 0;
+    auto reader = ReadFuncStreamReader(func, cursor, binary.size);
+    this->Deserialize(reader);
+}
+
 void
 HGraph::reorder(const void* query,
                 const FlattenInterfacePtr& flatten,
                 DistHeapPtr& candidate_heap,
-                int64_t k) const {
+                int64_t k,
+                const UnorderedMap<InnerIdType, float>* exact_dists) const {
     uint64_t size = candidate_heap->Size();
     if (k <= 0) {
         k = static_cast<int64_t>(size);
     }
     auto reorder_heap = Reorder::ReorderByFlatten(
-        candidate_heap, flatten, static_cast<const float*>(query), allocator_, k);
+        candidate_heap, flatten, static_cast<const float*>(query), allocator_, k, exact_dists);
     candidate_heap = reorder_heap;
 }
 
+void
+HGraph::bind_colocated_codes(InnerSearchParam& search_param,
+                             UnorderedMap<InnerIdType, float>& exact_dists) const {
+    if (use_reorder_ and this->bottom_graph_->ColocatedCodeSize() > 0) {
+        search_param.colocated_flatten = this->high_precise_codes_.get();
+        search_param.exact_dists = &exact_dists;
+    }
+}
+
 static const std::string HGRAPH_PARAMS_TEMPLATE =
     R"(
     {
@@ -1219,6 +1556,7 @@ static const std::string HGRAPH_PARAMS_TEMPLATE =
                 "{IO_FILE_PATH}": "{DEFAULT_FILE_PATH_VALUE}"
             },
             "codes_type": "flatten_codes",
+            "{FLATTEN_CACHE_SIZE_KEY}": 0,
             "{QUANTIZATION_PARAMS_KEY}": {
                 "{QUANTIZATION_TYPE_KEY}": "{QUANTIZATION_TYPE_VALUE_FP32}",
                 "{SQ4_UNIFORM_QUANTIZATION_TRUNC_RATE}": 0.05,
@@ -1229,7 +1567,9 @@ static const std::string HGRAPH_PARAMS_TEMPLATE =
         },
         "{BUILD_PARAMS_KEY}": {
             "{BUILD_EF_CONSTRUCTION}": 400,
-            "{BUILD_THREAD_COUNT}": 100
+            "{BUILD_THREAD_COUNT}": 100,
+            "{BUILD_BATCH_SIZE}": 100000,
+            "{BUILD_CHECKPOINT_INTERVAL}": 10
         },
         "{HGRAPH_EXTRA_INFO_KEY}": {
             "{IO_PARAMS_KEY}": {
@@ -1238,7 +1578,9 @@ static const std::string HGRAPH_PARAMS_TEMPLATE =
             }
         },
         "{HGRAPH_GET_RAW_VECTOR_COSINE}": false,
-        "{HGRAPH_SUPPORT_DUPLICATE}": false
+        "{HGRAPH_SUPPORT_DUPLICATE}": false,
+        "{REMOVE_COMPACTION_RATIO_KEY}": 0.1,
+        "{VISITED_LIST_TYPE_KEY}": "{VISITED_LIST_TYPE_AUTO}"
     })";
 
 ParamPtr
@@ -1322,6 +1664,13 @@ HGraph::CheckAndMappingExternalParam(const JsonType& external_param,
                                                     IO_FILE_PATH,
                                                 },
                                             },
+                                            {
+                                                HGRAPH_PRECISE_CACHE_SIZE,
+                                                {
+                                                    HGRAPH_PRECISE_CODES_KEY,
+                                                    FLATTEN_CACHE_SIZE_KEY,
+                                                },
+                                            },
                                             {
                                                 HGRAPH_PRECISE_QUANTIZATION_TYPE,
                                                 {
@@ -1373,6 +1722,29 @@ HGraph::CheckAndMappingExternalParam(const JsonType& external_param,
                                                     GRAPH_STORAGE_TYPE_KEY,
                                                 },
                                             },
+                                            {
+                                                HGRAPH_GRAPH_IO_TYPE,
+                                                {
+                                                    HGRAPH_GRAPH_KEY,
+                                                    IO_PARAMS_KEY,
+                                                    IO_TYPE_KEY,
+                                                },
+                                            },
+                                            {
+                                                HGRAPH_GRAPH_FILE_PATH,
+                                                {
+                                                    HGRAPH_GRAPH_KEY,
+                                                    IO_PARAMS_KEY,
+                                                    IO_FILE_PATH,
+                                                },
+                                            },
+                                            {
+                                                HGRAPH_GRAPH_SECTOR_SIZE,
+                                                {
+                                                    HGRAPH_GRAPH_KEY,
+                                                    GRAPH_PARAM_SECTOR_SIZE,
+                                                },
+                                            },
                                             {
                                                 ODESCENT_PARAMETER_ALPHA,
                                                 {
@@ -1415,6 +1787,20 @@ HGraph::CheckAndMappingExternalParam(const JsonType& external_param,
                                                     BUILD_THREAD_COUNT,
                                                 },
                                             },
+                                            {
+                                                HGRAPH_BUILD_BATCH_SIZE,
+                                                {
+                                                    BUILD_PARAMS_KEY,
+                                                    BUILD_BATCH_SIZE,
+                                                },
+                                            },
+                                            {
+                                                HGRAPH_BUILD_CHECKPOINT_INTERVAL,
+                                                {
+                                                    BUILD_PARAMS_KEY,
+                                                    BUILD_CHECKPOINT_INTERVAL,
+                                                },
+                                            },
                                             {
                                                 SQ4_UNIFORM_TRUNC_RATE,
                                                 {
@@ -1468,12 +1854,19 @@ HGraph::CheckAndMappingExternalParam(const JsonType& external_param,
                                                 {
                                                     SUPPORT_DUPLICATE,
                                                 },
+                                            },
+                                            {
+                                                HGRAPH_VISITED_LIST_TYPE,
+                                                {
+                                                    VISITED_LIST_TYPE_KEY,
+                                                },
+                                            },
+                                            {
+                                                HGRAPH_REMOVE_COMPACTION_RATIO,
+                                                {
+                                                    REMOVE_COMPACTION_RATIO_KEY,
+                                                },
                                             }};
-    if (common_param.data_type_ == DataTypes::DATA_TYPE_INT8) {
-        throw VsagException(ErrorType::INVALID_ARGUMENT,
-                            fmt::format("HGraph not support {} datatype", DATATYPE_INT8));
-    }
-
     std::string str = format_map(HGRAPH_PARAMS_TEMPLATE, DEFAULT_MAP);
     auto inner_json = JsonType::parse(str);
     mapping_external_param_to_inner(external_param, external_mapping, inner_json);
@@ -1481,6 +1874,25 @@ HGraph::CheckAndMappingExternalParam(const JsonType& external_param,
     auto hgraph_parameter = std::make_shared<HGraphParameter>();
     hgraph_parameter->data_type = common_param.data_type_;
     hgraph_parameter->FromJson(inner_json);
+    if (common_param.data_type_ == DataTypes::DATA_TYPE_INT8) {
+        // int8 vectors are only encoded by the int8 quantizer, never widened to float
+        auto base_name = hgraph_parameter->base_codes_param->quantizer_parameter->GetTypeName();
+        CHECK_ARGUMENT(base_name == QUANTIZATION_TYPE_VALUE_INT8,
+                       fmt::format("HGraph with {} datatype requires {} base quantization, got {}",
+                                   DATATYPE_INT8,
+                                   QUANTIZATION_TYPE_VALUE_INT8,
+                                   base_name));
+        if (hgraph_parameter->use_reorder) {
+            auto precise_name =
+                hgraph_parameter->precise_codes_param->quantizer_parameter->GetTypeName();
+            CHECK_ARGUMENT(
+                precise_name == QUANTIZATION_TYPE_VALUE_INT8,
+                fmt::format("HGraph with {} datatype requires {} precise quantization, got {}",
+                            DATATYPE_INT8,
+                            QUANTIZATION_TYPE_VALUE_INT8,
+                            precise_name));
+        }
+    }
     uint64_t max_degree = hgraph_parameter->bottom_graph_param->max_degree_;
 
     auto max_degree_threshold = std::max(common_param.dim_, 128L);
@@ -1515,12 +1927,106 @@ HGraph::GetCodeByInnerId(InnerIdType inner_id, uint8_t* data) const {
     }
 }
 
-// 搜候选集，修复全部
 bool
 HGraph::Remove(int64_t id) {
-    // TODO(inbao): support thread safe remove
-    auto inner_id = this->label_table_->GetIdByLabel(id);
+    InnerIdType inner_id;
+    {
+        std::lock_guard label_lock(this->label_lookup_mutex_);
+        inner_id = this->label_table_->GetIdByLabel(id);
+        this->tombstones_[inner_id].store(true, std::memory_order_release);
+        this->label_table_->Remove(id);
+        this->deleted_ids_.insert(inner_id);
+        delete_count_++;
+    }
+
+    bool repair_inline = false;
+    {
+        std::lock_guard lock(this->remove_mutex_);
+        this->pending_repair_ids_.emplace_back(inner_id);
+        if (not this->repair_running_) {
+            this->repair_running_ = true;
+            if (this->build_pool_ != nullptr) {
+                this->repair_future_ =
+                    this->build_pool_->GeneralEnqueue([this]() { this->repair_removed_points(); })
+                        .share();
+            } else {
+                repair_inline = true;
+            }
+        }
+    }
+    if (repair_inline) {
+        this->repair_removed_points();
+    }
+    return true;
+}
+
+void
+HGraph::repair_removed_points() {
+    Vector<InnerIdType> batch(allocator_);
+    Vector<InnerIdType> repaired(allocator_);
+    UnorderedSet<InnerIdType> affected(allocator_);
+    while (true) {
+        {
+            std::lock_guard lock(this->remove_mutex_);
+            if (this->pending_repair_ids_.empty()) {
+                this->repair_running_ = false;
+                return;
+            }
+            auto count = std::min(this->pending_repair_ids_.size(), REMOVE_REPAIR_BATCH_SIZE);
+            auto begin = this->pending_repair_ids_.end() - static_cast<int64_t>(count);
+            batch.assign(begin, this->pending_repair_ids_.end());
+            this->pending_repair_ids_.erase(begin, this->pending_repair_ids_.end());
+        }
+
+        {
+            // the entry point leaves the removed points before their neighbor lists are dropped
+            std::lock_guard<std::shared_mutex> wlock(this->global_mutex_);
+            this->reset_removed_entry_point();
+        }
+
+        repaired.clear();
+        affected.clear();
+        {
+            std::shared_lock<std::shared_mutex> rlock(this->global_mutex_);
+            for (auto inner_id : batch) {
+                try {
+                    this->repair_removed_point(inner_id, affected);
+                    repaired.emplace_back(inner_id);
+                } catch (const std::exception& e) {
+                    // the point keeps its tombstone and is never reclaimed
+                    logger::error("failed to repair removed point {}: {}", inner_id, e.what());
+                }
+            }
+        }
+
+        Vector<InnerIdType> removed_ids(allocator_);
+        UnorderedSet<InnerIdType> affected_ids(allocator_);
+        {
+            std::lock_guard lock(this->remove_mutex_);
+            this->repaired_ids_.insert(
+                this->repaired_ids_.end(), repaired.begin(), repaired.end());
+            this->repair_affected_ids_.insert(affected.begin(), affected.end());
+            // the attribute index and the duplicate records still refer to the removed ids
+            bool can_reclaim = this->remove_compaction_ratio_ > 0.0F and
+                               not this->use_attribute_filter_ and
+                               not this->label_table_->CompressDuplicateData();
+            auto threshold = static_cast<double>(this->remove_compaction_ratio_) *
+                             static_cast<double>(this->total_count_);
+            if (can_reclaim and static_cast<double>(this->repaired_ids_.size()) >= threshold) {
+                removed_ids.swap(this->repaired_ids_);
+                affected_ids.swap(this->repair_affected_ids_);
+            }
+        }
+        if (not removed_ids.empty()) {
+            this->compact_removed_points(removed_ids, affected_ids);
+        }
+    }
+}
 
+// relinks the neighbors of a removed point found by a search around it on every level, then
+// drops its own lists; the points holding edges to it are recorded in affected_ids
+void
+HGraph::repair_removed_point(InnerIdType inner_id, UnorderedSet<InnerIdType>& affected_ids) {
     DistHeapPtr result = nullptr;
     InnerSearchParam param{
         .topk = 1,
@@ -1537,7 +2043,16 @@ HGraph::Remove(int64_t id) {
     }
 
     Vector<float> delete_point_data(dim_, 0.0F, allocator_);
-    GetVectorByInnerId(inner_id, delete_point_data.data());
+    Vector<uint8_t> delete_point_codes(allocator_);
+    const void* delete_point = delete_point_data.data();
+    if (data_type_ == DataTypes::DATA_TYPE_INT8) {
+        // an int8 code is the raw int8 vector itself, the query of an int8 index
+        delete_point_codes.resize(flatten_codes->code_size_);
+        flatten_codes->GetCodesById(inner_id, delete_point_codes.data());
+        delete_point = delete_point_codes.data();
+    } else {
+        GetVectorByInnerId(inner_id, delete_point_data.data());
+    }
 
     int level = -1;
     for (int j = max_level; j >= 0; --j) {
@@ -1545,339 +2060,196 @@ HGraph::Remove(int64_t id) {
             level = j;
             break;
         }
-        result = search_one_graph(delete_point_data.data(), route_graphs_[j], flatten_codes, param);
+        result = search_one_graph(delete_point, route_graphs_[j], flatten_codes, param);
         param.ep = result->Top().second;
     }
 
     param.ef = this->ef_construct_;
     param.topk = static_cast<int64_t>(ef_construct_);
+    // the removed points are neither repaired nor linked to
+    param.is_inner_id_allowed = this->wrap_tombstone_filter(nullptr);
 
     if (level != -1) {
         for (int l = level; l >= 0 ; --l) {
             if (route_graphs_[l]->TotalCount() == 0) {
                 continue;
             }
-            result = search_one_graph(delete_point_data.data(), route_graphs_[l], flatten_codes, param);
+            result = search_one_graph(delete_point, route_graphs_[l], flatten_codes, param);
             auto result_data = result->GetData();
             Vector<InnerIdType> neighbors_to_repair(allocator_);
             for (int64_t i = 0; i < result->Size(); ++i) {
                 neighbors_to_repair.emplace_back(result_data[i].second);
             }
-            repair_neighbors_connectivity(
-                inner_id, neighbors_to_repair, result, route_graphs_[l], flatten_codes, neighbors_mutex_, allocator_);
+            affected_ids.insert(neighbors_to_repair.begin(), neighbors_to_repair.end());
+            repair_neighbors_connectivity(inner_id,
+                                          neighbors_to_repair,
+                                          result,
+                                          route_graphs_[l],
+                                          flatten_codes,
+                                          neighbors_mutex_,
+                                          allocator_);
         }
     }
 
     if (bottom_graph_->TotalCount() != 0) {
-        result = search_one_graph(delete_point_data.data(), bottom_graph_, flatten_codes, param);
+        result = search_one_graph(delete_point, bottom_graph_, flatten_codes, param);
         auto result_data = result->GetData();
         Vector<InnerIdType> neighbors_to_repair(allocator_);
         for (int64_t i = 0; i < result->Size(); ++i) {
             neighbors_to_repair.emplace_back(result_data[i].second);
         }
-        repair_neighbors_connectivity(
-            inner_id, neighbors_to_repair, result, bottom_graph_, flatten_codes, neighbors_mutex_, allocator_);
+        affected_ids.insert(neighbors_to_repair.begin(), neighbors_to_repair.end());
+        repair_neighbors_connectivity(inner_id,
+                                      neighbors_to_repair,
+                                      result,
+                                      bottom_graph_,
+                                      flatten_codes,
+                                      neighbors_mutex_,
+                                      allocator_);
+    }
+
+    // the out-neighbors of a removed point mostly link back to it
+    Vector<InnerIdType> neighbors(allocator_);
+    auto delete_neighbors = [&](const GraphInterfacePtr& graph) {
+        {
+            SharedLock lock(neighbors_mutex_, inner_id);
+            graph->GetNeighbors(inner_id, neighbors);
+        }
+        affected_ids.insert(neighbors.begin(), neighbors.end());
+        graph->DeleteNeighborsById(inner_id);
+    };
+    for (auto level = static_cast<int>(route_graphs_.size()) - 1; level >= 0; --level) {
+        delete_neighbors(this->route_graphs_[level]);
     }
+    delete_neighbors(this->bottom_graph_);
+}
 
-    if (inner_id == this->entry_point_id_) {
-        bool find_new_ep = false;
-        while (not route_graphs_.empty()) {
-            auto& upper_graph = route_graphs_.back();
-            Vector<InnerIdType> neighbors(allocator_);
-            upper_graph->GetNeighbors(this->entry_point_id_, neighbors);
+void
+HGraph::reset_removed_entry_point() {
+    if (this->entry_point_id_ >= this->tombstones_.size() or
+        not this->tombstones_[this->entry_point_id_].load(std::memory_order_acquire)) {
+        return;
+    }
+    Vector<InnerIdType> neighbors(allocator_);
+    auto move_to_neighbor = [&](const GraphInterfacePtr& graph) -> bool {
+        graph->GetNeighbors(this->entry_point_id_, neighbors);
+        for (const auto& nb_id : neighbors) {
+            if (not this->tombstones_[nb_id].load(std::memory_order_acquire)) {
+                this->entry_point_id_ = nb_id;
+                return true;
+            }
+        }
+        return false;
+    };
+    while (not route_graphs_.empty()) {
+        if (move_to_neighbor(route_graphs_.back())) {
+            break;
+        }
+        route_graphs_.pop_back();
+    }
+    if (route_graphs_.empty()) {
+        move_to_neighbor(bottom_graph_);
+    }
+    // the copies per numa node keep the same levels as route_graphs_
+    for (auto& replica : this->numa_route_graphs_) {
+        replica.resize(route_graphs_.size());
+    }
+}
+
+void
+HGraph::compact_removed_points(const Vector<InnerIdType>& removed_ids,
+                               const UnorderedSet<InnerIdType>& affected_ids) {
+    UnorderedSet<InnerIdType> removed_set(allocator_);
+    removed_set.insert(removed_ids.begin(), removed_ids.end());
+    {
+        // only the lists touched by the repair are rewritten, each under its own lock, so the
+        // searches and the adds keep running; the other edges to the removed points carry
+        // stale versions and are dropped by GetNeighbors
+        std::shared_lock<std::shared_mutex> rlock(this->global_mutex_);
+        Vector<InnerIdType> neighbors(allocator_);
+        Vector<InnerIdType> valid_neighbors(allocator_);
+        auto compact_one = [&](const GraphInterfacePtr& graph, InnerIdType id) {
+            LockGuard lock(this->neighbors_mutex_, id);
+            auto stored_size = graph->GetNeighborSize(id);
+            if (stored_size == 0) {
+                return;
+            }
+            graph->GetNeighbors(id, neighbors);
+            valid_neighbors.clear();
             for (const auto& nb_id : neighbors) {
-                if (inner_id == nb_id) {
-                    continue;
+                if (removed_set.count(nb_id) == 0) {
+                    valid_neighbors.emplace_back(nb_id);
                 }
-                this->entry_point_id_ = nb_id;
-                find_new_ep = true;
-                break;
             }
-            if (find_new_ep) {
-                break;
+            if (valid_neighbors.size() != stored_size) {
+                graph->InsertNeighborsById(id, valid_neighbors);
+            }
+        };
+        for (const auto& id : affected_ids) {
+            if (removed_set.count(id) != 0 or id >= this->total_count_) {
+                continue;
+            }
+            compact_one(this->bottom_graph_, id);
+            for (const auto& route_graph : this->route_graphs_) {
+                compact_one(route_graph, id);
             }
-            route_graphs_.pop_back();
         }
     }
-    for (auto level = static_cast<int>(route_graphs_.size()) - 1; level >= 0; --level) {
-        this->route_graphs_[level]->DeleteNeighborsById(inner_id);
-    }
-    this->bottom_graph_->DeleteNeighborsById(inner_id);
-    this->label_table_->Remove(id);
-    this->deleted_ids_.insert(inner_id);
-    delete_count_++;
+    // the short exclusive section waits for the adds in flight before the ids are handed out,
+    // and keeps the entry point off the reclaimed ids
+    std::lock_guard<std::shared_mutex> wlock(this->global_mutex_);
+    this->reset_removed_entry_point();
+    std::lock_guard lock(this->remove_mutex_);
+    this->reclaimed_ids_.insert(this->reclaimed_ids_.end(), removed_ids.begin(), removed_ids.end());
+}
 
+bool
+HGraph::reuse_removed_inner_id(InnerIdType& inner_id) {
+    {
+        std::lock_guard lock(this->remove_mutex_);
+        if (this->reclaimed_ids_.empty()) {
+            return false;
+        }
+        inner_id = this->reclaimed_ids_.back();
+        this->reclaimed_ids_.pop_back();
+    }
+    // no edge points to a reclaimed id, it stays unreachable until the new point is linked
+    this->deleted_ids_.erase(inner_id);
+    this->tombstones_[inner_id].store(false, std::memory_order_release);
+    reclaimed_count_++;
     return true;
 }
 
-// 搜候选集，只修复候选集里面的入度和出度邻居
-// bool
-// HGraph::Remove(int64_t id) {
-//     // TODO(inbao): support thread safe remove
-//     auto inner_id = this->label_table_->GetIdByLabel(id);
-//
-//     DistHeapPtr result = nullptr;
-//     InnerSearchParam param{
-//         .topk = 1,
-//         .ep = this->entry_point_id_,
-//         .ef = 1,
-//         .is_inner_id_allowed = nullptr,
-//     };
-//
-//     auto max_level = static_cast<int>(route_graphs_.size()) - 1;
-//
-//     auto flatten_codes = basic_flatten_codes_;
-//     Vector<float> delete_point_data(dim_, 0.0F, allocator_);
-//     GetVectorByInnerId(inner_id, delete_point_data.data());
-//
-//     int level = -1;
-//     for (int j = max_level; j >= 0; --j) {
-//         if (route_graphs_[j]->GetNeighborSize(inner_id) != 0) {
-//             level = j;
-//             break;
-//         }
-//         result = search_one_graph(delete_point_data.data(), route_graphs_[j], flatten_codes, param);
-//         param.ep = result->Top().second;
-//     }
-//
-//     param.ef = this->ef_construct_;
-//     param.topk = static_cast<int64_t>(ef_construct_);
-//
-//     if (level != -1) {
-//         for (int l = level; l >= 0 ; --l) {
-//             if (route_graphs_[l]->TotalCount() == 0) {
-//                 continue;
-//             }
-//             result = search_one_graph(delete_point_data.data(), route_graphs_[l], flatten_codes, param);
-//             auto result_data = result->GetData();
-//             Vector<InnerIdType> neighbors_to_repair(allocator_);
-//
-//             std::unordered_set<InnerIdType> delete_point_neighbors;
-//             Vector<InnerIdType> neighbors(allocator_);
-//             route_graphs_[l]->GetNeighbors(inner_id, neighbors);
-//             for (const auto& nb_id : neighbors) {
-//                 delete_point_neighbors.insert(nb_id);
-//             }
-//
-//             for (int64_t i = 0; i < result->Size(); ++i) {
-//                 route_graphs_[l]->GetNeighbors(result_data[i].second, neighbors);
-//                 std::unordered_set<InnerIdType> neighbor_set;
-//                 for (const auto& nb_id : neighbors) {
-//                     neighbor_set.insert(nb_id);
-//                 }
-//
-//                 if (delete_point_neighbors.find(result_data[i].second) !=
-//                     delete_point_neighbors.end() || neighbor_set.find(inner_id) != neighbor_set.end()) {
-//                     neighbors_to_repair.emplace_back(result_data[i].second);
-//                 }
-//             }
-//
-//             repair_neighbors_connectivity(
-//                 inner_id, neighbors_to_repair, result, route_graphs_[l], flatten_codes, neighbors_mutex_, allocator_);
-//         }
-//     }
-//
-//     if (bottom_graph_->TotalCount() != 0) {
-//         result = search_one_graph(delete_point_data.data(), bottom_graph_, flatten_codes, param);
-//         auto result_data = result->GetData();
-//         Vector<InnerIdType> neighbors_to_repair(allocator_);
-//
-//         std::unordered_set<InnerIdType> delete_point_neighbors;
-//         Vector<InnerIdType> neighbors(allocator_);
-//         bottom_graph_->GetNeighbors(inner_id, neighbors);
-//         for (const auto& nb_id : neighbors) {
-//             delete_point_neighbors.insert(nb_id);
-//         }
-//
-//         for (int64_t i = 0; i < result->Size(); ++i) {
-//             bottom_graph_->GetNeighbors(result_data[i].second, neighbors);
-//             std::unordered_set<InnerIdType> neighbor_set;
-//             for (const auto& nb_id : neighbors) {
-//                 neighbor_set.insert(nb_id);
-//             }
-//
-//             if (delete_point_neighbors.find(result_data[i].second) !=
-//                 delete_point_neighbors.end() || neighbor_set.find(inner_id) != neighbor_set.end()) {
-//                 neighbors_to_repair.emplace_back(result_data[i].second);
-//                 }
-//         }
-//         repair_neighbors_connectivity(
-//             inner_id, neighbors_to_repair, result, bottom_graph_, flatten_codes, neighbors_mutex_, allocator_);
-//     }
-//
-//     if (inner_id == this->entry_point_id_) {
-//         bool find_new_ep = false;
-//         while (not route_graphs_.empty()) {
-//             auto& upper_graph = route_graphs_.back();
-//             Vector<InnerIdType> neighbors(allocator_);
-//             upper_graph->GetNeighbors(this->entry_point_id_, neighbors);
-//             for (const auto& nb_id : neighbors) {
-//                 if (inner_id == nb_id) {
-//                     continue;
-//                 }
-//                 this->entry_point_id_ = nb_id;
-//                 find_new_ep = true;
-//                 break;
-//             }
-//             if (find_new_ep) {
-//                 break;
-//             }
-//             route_graphs_.pop_back();
-//         }
-//     }
-//     for (auto level = static_cast<int>(route_graphs_.size()) - 1; level >= 0; --level) {
-//         this->route_graphs_[level]->DeleteNeighborsById(inner_id);
-//     }
-//     this->bottom_graph_->DeleteNeighborsById(inner_id);
-//     this->label_table_->Remove(id);
-//     this->deleted_ids_.insert(inner_id);
-//     delete_count_++;
-//
-//     return true;
-// }
-
-// 以邻居为候选集，先修出度，然后搜索找到入度节点，修入度
-// bool
-// HGraph::Remove(int64_t id) {
-//     // TODO(inbao): support thread safe remove
-//     auto inner_id = this->label_table_->GetIdByLabel(id);
-//
-//     auto start = std::chrono::high_resolution_clock::now();
-//
-//     DistHeapPtr result = nullptr;
-//     InnerSearchParam param{
-//         .topk = 1,
-//         .ep = this->entry_point_id_,
-//         .ef = 1,
-//         .is_inner_id_allowed = nullptr,
-//     };
-//
-//     auto max_level = static_cast<int>(route_graphs_.size()) - 1;
-//
-//     auto flatten_codes = basic_flatten_codes_;
-//     Vector<float> delete_point_data(dim_, 0.0F, allocator_);
-//     GetVectorByInnerId(inner_id, delete_point_data.data());
-//
-//     auto end = std::chrono::high_resolution_clock::now();
-//     std::chrono::duration<double> diff = end - start;
-//     if (inner_id == 1) {
-//         logger::info("Prepare delete point data cost: {} seconds", diff.count());
-//     }
-//
-//     start = std::chrono::high_resolution_clock::now();
-//
-//     int level = -1;
-//     for (int j = max_level; j >= 0; --j) {
-//         if (route_graphs_[j]->GetNeighborSize(inner_id) != 0) {
-//             level = j;
-//             break;
-//         }
-//         result = search_one_graph(delete_point_data.data(), route_graphs_[j], flatten_codes, param);
-//         param.ep = result->Top().second;
-//     }
-//
-//     end = std::chrono::high_resolution_clock::now();
-//     diff = end - start;
-//     if (inner_id == 1) {
-//         logger::info("Routing search cost: {} seconds", diff.count());
-//     }
-//
-//     start = std::chrono::high_resolution_clock::now();
-//
-//     param.ef = this->ef_construct_;
-//     param.topk = static_cast<int64_t>(ef_construct_);
-//     if (level != -1) {
-//         for (int l = level; l >= 0 ; --l) {
-//             if (route_graphs_[l]->TotalCount() == 0) {
-//                 continue;
-//             }
-//             Vector<InnerIdType> neighbors(allocator_);
-//             route_graphs_[l]->GetNeighbors(inner_id, neighbors);
-//
-//             for (auto &&nb_id : neighbors) {
-//                 repair_neighbor_connectivity(inner_id, nb_id, neighbors, route_graphs_[l], flatten_codes, neighbors_mutex_, allocator_);
-//             }
-//
-//             result = search_one_graph(delete_point_data.data(), route_graphs_[l], flatten_codes, param);
-//             auto result_data = result->GetData();
-//             for (int64_t i = 0; i < result->Size(); ++i) {
-//                 Vector<InnerIdType> tmp_neighbors(allocator_);
-//                 route_graphs_[l]->GetNeighbors(result_data[i].second, tmp_neighbors);
-//                 for (auto &&nb_id : tmp_neighbors) {
-//                     if (nb_id == inner_id) {
-//                         repair_neighbor_connectivity(inner_id, result_data[i].second, neighbors, route_graphs_[l], flatten_codes, neighbors_mutex_, allocator_);
-//                         break;
-//                     }
-//                 }
-//             }
-//         }
-//     }
-//
-//     end = std::chrono::high_resolution_clock::now();
-//     diff = end - start;
-//     if (inner_id == 1) {
-//         logger::info("Repair routing neighbors cost: {} seconds", diff.count());
-//     }
-//
-//     start = std::chrono::high_resolution_clock::now();
-//     if (bottom_graph_->TotalCount() != 0) {
-//         Vector<InnerIdType> neighbors(allocator_);
-//         bottom_graph_->GetNeighbors(inner_id, neighbors);
-//
-//         for (auto &&nb_id : neighbors) {
-//             repair_neighbor_connectivity(inner_id, nb_id, neighbors, bottom_graph_, flatten_codes, neighbors_mutex_, allocator_);
-//         }
-//
-//         result = search_one_graph(delete_point_data.data(), bottom_graph_, flatten_codes, param);
-//         auto result_data = result->GetData();
-//         for (int64_t i = 0; i < result->Size(); ++i) {
-//             Vector<InnerIdType> tmp_neighbors(allocator_);
-//             bottom_graph_->GetNeighbors(result_data[i].second, tmp_neighbors);
-//             for (auto &&nb_id : tmp_neighbors) {
-//                 if (nb_id == inner_id) {
-//                     repair_neighbor_connectivity(inner_id, result_data[i].second, neighbors, bottom_graph_, flatten_codes, neighbors_mutex_, allocator_);
-//                     break;
-//                 }
-//             }
-//         }
-//     }
-//
-//     end = std::chrono::high_resolution_clock::now();
-//     diff = end - start;
-//     if (inner_id == 1) {
-//         logger::info("Repair bottom neighbors cost: {} seconds", diff.count());
-//     }
-//
-//     if (inner_id == this->entry_point_id_) {
-//         bool find_new_ep = false;
-//         while (not route_graphs_.empty()) {
-//             auto& upper_graph = route_graphs_.back();
-//             Vector<InnerIdType> neighbors(allocator_);
-//             upper_graph->GetNeighbors(this->entry_point_id_, neighbors);
-//             for (const auto& nb_id : neighbors) {
-//                 if (inner_id == nb_id) {
-//                     continue;
-//                 }
-//                 this->entry_point_id_ = nb_id;
-//                 find_new_ep = true;
-//                 break;
-//             }
-//             if (find_new_ep) {
-//                 break;
-//             }
-//             route_graphs_.pop_back();
-//         }
-//     }
-//     for (auto level = static_cast<int>(route_graphs_.size()) - 1; level >= 0; --level) {
-//         this->route_graphs_[level]->DeleteNeighborsById(inner_id);
-//     }
-//     this->bottom_graph_->DeleteNeighborsById(inner_id);
-//     this->label_table_->Remove(id);
-//     this->deleted_ids_.insert(inner_id);
-//     delete_count_++;
-//
-//     return true;
-// }
+void
+HGraph::wait_for_removal_repair() const {
+    std::shared_future<void> repair_future;
+    {
+        std::lock_guard lock(this->remove_mutex_);
+        repair_future = this->repair_future_;
+    }
+    if (repair_future.valid()) {
+        repair_future.wait();
+    }
+}
+
+FilterPtr
+HGraph::wrap_tombstone_filter(const FilterPtr& filter) const {
+    if (this->delete_count_ == this->reclaimed_count_) {
+        return filter;
+    }
+    return std::make_shared<TombstoneFilter>(filter, this->tombstones_);
+}
+
+void
+HGraph::resize_tombstones(uint64_t new_size) {
+    Vector<std::atomic<bool>> tombstones(new_size,
+                                         AllocatorWrapper<std::atomic<bool>>(allocator_));
+    auto copy_size = std::min(static_cast<uint64_t>(this->tombstones_.size()), new_size);
+    for (uint64_t i = 0; i < copy_size; ++i) {
+        tombstones[i].store(this->tombstones_[i].load());
+    }
+    this->tombstones_.swap(tombstones);
+}
 
 void
 HGraph::Merge(const std::vector<MergeUnit>& merge_units) {
@@ -1961,11 +2333,79 @@ HGraph::SetImmutable() {
     if (this->immutable_) {
         return;
     }
+    this->wait_for_removal_repair();
     std::lock_guard<std::shared_mutex> wlock(this->global_mutex_);
     this->neighbors_mutex_.reset();
     this->neighbors_mutex_ = std::make_shared<EmptyMutex>();
     this->searcher_->SetMutexArray(this->neighbors_mutex_);
     this->immutable_ = true;
+    // the upper levels are only read from now on, pack them for the greedy descent
+    freeze_route_graphs(this->route_graphs_);
+    if (Options::Instance().numa_replication() and NumaNodeCount() > 1) {
+        this->replicate_route_graphs();
+    }
+}
+
+void
+HGraph::freeze_route_graphs(const Vector<GraphInterfacePtr>& route_graphs) {
+    for (const auto& route_graph : route_graphs) {
+        auto sparse_graph = std::dynamic_pointer_cast<SparseGraphDataCell>(route_graph);
+        if (sparse_graph != nullptr) {
+            sparse_graph->Freeze();
+        }
+    }
+}
+
+void
+HGraph::replicate_route_graphs() {
+    std::stringstream buffer;
+    IOStreamWriter writer(buffer);
+    for (const auto& route_graph : this->route_graphs_) {
+        route_graph->Serialize(writer);
+    }
+    const auto data = buffer.str();
+
+    // each copy is built by a thread pinned to its node, so its pages are first touched there
+    auto node_count = NumaNodeCount();
+    std::vector<Vector<GraphInterfacePtr>> replicas(node_count,
+                                                     Vector<GraphInterfacePtr>(allocator_));
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> errors(node_count);
+    for (uint32_t node = 0; node < node_count; ++node) {
+        threads.emplace_back([&, node]() {
+            try {
+                PinThreadToNumaNode(node);
+                std::stringstream input(data);
+                IOStreamReader reader(input);
+                for (uint64_t level = 0; level < this->route_graphs_.size(); ++level) {
+                    auto graph = this->generate_one_route_graph();
+                    graph->Deserialize(reader);
+                    replicas[node].emplace_back(graph);
+                }
+                freeze_route_graphs(replicas[node]);
+            } catch (...) {
+                errors[node] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& error : errors) {
+        if (error != nullptr) {
+            logger::warn("failed to replicate the route graphs per numa node, use one copy");
+            return;
+        }
+    }
+    this->numa_route_graphs_ = std::move(replicas);
+}
+
+const Vector<GraphInterfacePtr>&
+HGraph::search_route_graphs() const {
+    if (this->numa_route_graphs_.empty()) {
+        return this->route_graphs_;
+    }
+    return this->numa_route_graphs_[CurrentNumaNode() % this->numa_route_graphs_.size()];
 }
 
 void
@@ -2004,18 +2444,58 @@ HGraph::SearchWithRequest(const SearchRequest& request) const {
     k = std::min(k, GetNumElements());
 
     // check query vector
-    CHECK_ARGUMENT(query->GetNumElements() == 1, "query dataset should contain 1 vector only");
+    CHECK_ARGUMENT(query->GetNumElements() >= 1, "query dataset should contain 1 vector at least");
+    SearchStatisticsScope statistics_scope(request.statistics_, &this->search_statistics_);
+    // the repair of removed points moves the entry point and drops the empty route levels
+    // under the exclusive lock, and resize swaps the tombstones under it
+    std::shared_lock<std::shared_mutex> rlock(this->global_mutex_);
+    if (query->GetNumElements() > 1) {
+        return this->batch_search(request, params, k, search_allocator);
+    }
+
+    auto search_result =
+        this->search_one_query(get_data(query), request, params, k, search_allocator);
+
+    // return an empty dataset directly if searcher returns nothing
+    if (search_result->Empty()) {
+        return DatasetImpl::MakeEmptyDataset();
+    }
+    auto count = static_cast<const int64_t>(search_result->Size());
+    auto [dataset_results, dists, ids] = create_fast_dataset(count, search_allocator);
+    char* extra_infos = nullptr;
+    if (extra_info_size_ > 0) {
+        extra_infos = (char*)search_allocator->Allocate(extra_info_size_ * search_result->Size());
+        dataset_results->ExtraInfos(extra_infos);
+    }
+    for (int64_t j = count - 1; j >= 0; --j) {
+        dists[j] = search_result->Top().first;
+        ids[j] = this->label_table_->GetLabelById(search_result->Top().second);
+        if (extra_infos != nullptr) {
+            this->extra_infos_->GetExtraInfoById(search_result->Top().second,
+                                                 extra_infos + extra_info_size_ * j);
+        }
+        search_result->Pop();
+    }
+    return std::move(dataset_results);
+}
 
+DistHeapPtr
+HGraph::search_one_query(const void* raw_query,
+                         const SearchRequest& request,
+                         const HGraphSearchParameters& params,
+                         int64_t k,
+                         Allocator* search_allocator) const {
     InnerSearchParam search_param;
     search_param.ep = this->entry_point_id_;
     search_param.topk = 1;
     search_param.ef = 1;
     search_param.is_inner_id_allowed = nullptr;
     search_param.search_alloc = search_allocator;
-    const auto* raw_query = get_data(query);
-    for (auto i = static_cast<int64_t>(this->route_graphs_.size() - 1); i >= 0; --i) {
+    search_param.statistics = request.statistics_;
+    const auto& route_graphs = this->search_route_graphs();
+    for (auto i = static_cast<int64_t>(route_graphs.size() - 1); i >= 0; --i) {
         auto result = this->search_one_graph(
-            raw_query, this->route_graphs_[i], this->basic_flatten_codes_, search_param);
+            raw_query, route_graphs[i], this->basic_flatten_codes_, search_param);
         search_param.ep = result->Top().second;
     }
 
@@ -2027,11 +2507,13 @@ HGraph::SearchWithRequest(const SearchRequest& request) const {
             ft = std::make_shared<InnerIdWrapperFilter>(request.filter_, *this->label_table_);
         }
     }
+    ft = this->wrap_tombstone_filter(ft);
 
+    ExecutorPtr executor = nullptr;
     if (request.enable_attribute_filter_ and this->attr_filter_index_ != nullptr) {
         auto& schema = this->attr_filter_index_->field_type_map_;
         auto expr = AstParse(request.attribute_filter_str_, &schema);
-        auto executor = Executor::MakeInstance(this->allocator_, expr, this->attr_filter_index_);
+        executor = Executor::MakeInstance(this->allocator_, expr, this->attr_filter_index_);
         executor->Init();
         search_param.executors.emplace_back(executor);
     }
@@ -2040,42 +2522,268 @@ HGraph::SearchWithRequest(const SearchRequest& request) const {
     search_param.is_inner_id_allowed = ft;
     search_param.topk = static_cast<int64_t>(search_param.ef);
     search_param.consider_duplicate = true;
+    search_param.parallel_search_thread_count = params.parallel_search_thread_count;
+    search_param.early_stop_patience = params.early_stop_patience;
+    search_param.early_stop_distance_ratio = params.early_stop_distance_ratio;
+    search_param.early_stop_k = k;
+    search_param.max_ef = std::max(params.max_ef_search, int64_t(0));
     if (params.enable_time_record) {
         search_param.time_cost = std::make_shared<Timer>();
         search_param.time_cost->SetThreshold(params.timeout_ms);
     }
-    auto search_result = this->search_one_graph(
-        raw_query, this->bottom_graph_, this->basic_flatten_codes_, search_param);
+    search_param.BindStopCondition(request);
+
+    // the tombstones alone never make a search selective, only the requested filters are planned
+    DistHeapPtr search_result = nullptr;
+    if (request.filter_ != nullptr or executor != nullptr) {
+        Filter* attr_ft = nullptr;
+        if (executor != nullptr) {
+            executor->Clear();
+            attr_ft = executor->Run();
+        }
+        uint64_t total_count = this->basic_flatten_codes_->TotalCount();
+        total_count = std::min(this->total_count_, total_count);
+        auto selectivity =
+            FilteredSearchPlanner::EstimateSelectivity(total_count, ft.get(), attr_ft);
+        FilteredSearchEstimate estimate{
+            .total_count = total_count,
+            .selectivity = selectivity,
+            .ef = search_param.ef,
+            .max_degree = this->bottom_graph_->MaximumDegree(),
+        };
+        auto plan = FilteredSearchPlanner::Plan(params.filter_plan, estimate);
+        if (request.statistics_ != nullptr) {
+            request.statistics_->filter_selectivity = selectivity;
+            if (plan == FilteredSearchPlan::BRUTE_FORCE) {
+                request.statistics_->plan_brute_force++;
+            } else if (plan == FilteredSearchPlan::TWO_HOP) {
+                request.statistics_->plan_two_hop++;
+            } else {
+                request.statistics_->plan_graph++;
+            }
+        }
+        if (plan == FilteredSearchPlan::BRUTE_FORCE) {
+            search_result = this->brute_force_search(raw_query,
+                                                     ft,
+                                                     attr_ft,
+                                                     search_param.topk,
+                                                     search_allocator,
+                                                     request.statistics_);
+        } else {
+            search_param.two_hop_expansion = plan == FilteredSearchPlan::TWO_HOP;
+            search_param.ef =
+                FilteredSearchPlanner::AdaptEf(search_param.ef, search_param.max_ef, selectivity);
+            search_param.topk = static_cast<int64_t>(search_param.ef);
+        }
+    }
+    UnorderedMap<InnerIdType, float> exact_dists(search_allocator);
+    if (search_result == nullptr) {
+        this->bind_colocated_codes(search_param, exact_dists);
+        search_result = this->search_one_graph(
+            raw_query, this->bottom_graph_, this->basic_flatten_codes_, search_param);
+    }
 
     if (use_reorder_) {
-        this->reorder(raw_query, this->high_precise_codes_, search_result, k);
+        if (request.statistics_ != nullptr) {
+            request.statistics_->reorder_candidates += search_result->Size();
+        }
+        this->reorder(raw_query, this->high_precise_codes_, search_result, k, &exact_dists);
     }
 
     while (search_result->Size() > k) {
         search_result->Pop();
     }
+    return search_result;
+}
 
-    // return an empty dataset directly if searcher returns nothing
-    if (search_result->Empty()) {
-        return DatasetImpl::MakeEmptyDataset();
+DistHeapPtr
+HGraph::brute_force_search(const void* query,
+                           const FilterPtr& filter,
+                           const Filter* attr_filter,
+                           int64_t topk,
+                           Allocator* allocator,
+                           SearchStatistics* stats) const {
+    constexpr InnerIdType batch_size = 256;
+    auto result = std::make_shared<StandardHeap<true, false>>(allocator, -1);
+    auto computer = this->basic_flatten_codes_->FactoryComputer(query);
+    Vector<InnerIdType> ids(allocator);
+    ids.reserve(batch_size);
+    Vector<float> dists(batch_size, allocator);
+    uint64_t dist_cmp = 0;
+
+    auto flush = [&]() {
+        auto count = static_cast<InnerIdType>(ids.size());
+        this->basic_flatten_codes_->Query(dists.data(), computer, ids.data(), count, allocator);
+        for (InnerIdType i = 0; i < count; ++i) {
+            if (result->Size() < topk or dists[i] < result->Top().first) {
+                result->Push(dists[i], ids[i]);
+                if (result->Size() > topk) {
+                    result->Pop();
+                }
+            }
+        }
+        dist_cmp += count;
+        ids.clear();
+    };
+
+    // the ids beyond the codes are still being inserted
+    uint64_t total_count = this->basic_flatten_codes_->TotalCount();
+    total_count = std::min(this->total_count_, total_count);
+    for (uint64_t id = 0; id < total_count; ++id) {
+        if ((filter == nullptr or filter->CheckValid(static_cast<int64_t>(id))) and
+            (attr_filter == nullptr or attr_filter->CheckValid(static_cast<int64_t>(id)))) {
+            ids.emplace_back(static_cast<InnerIdType>(id));
+            if (ids.size() == batch_size) {
+                flush();
+            }
+        }
     }
-    auto count = static_cast<const int64_t>(search_result->Size());
-    auto [dataset_results, dists, ids] = create_fast_dataset(count, search_allocator);
+    if (not ids.empty()) {
+        flush();
+    }
+    if (stats != nullptr) {
+        stats->dist_cmp += dist_cmp;
+        stats->filter_rejections += total_count - dist_cmp;
+    }
+    return result;
+}
+
+DatasetPtr
+HGraph::batch_search(const SearchRequest& request,
+                     const HGraphSearchParameters& params,
+                     int64_t k,
+                     Allocator* search_allocator) const {
+    const auto& query = request.query_;
+    auto query_count = static_cast<uint32_t>(query->GetNumElements());
+
+    std::vector<const void*> queries(query_count);
+    for (uint32_t i = 0; i < query_count; ++i) {
+        queries[i] = get_data(query, i);
+    }
+
+    // the interleaved search only covers the unfiltered searches with a fixed ef, the others
+    // run query by query with the same setup as a single query
+    bool use_attribute_filter =
+        request.enable_attribute_filter_ and this->attr_filter_index_ != nullptr;
+    std::vector<DistHeapPtr> search_results;
+    if (request.filter_ != nullptr or use_attribute_filter or
+        params.parallel_search_thread_count > 1 or params.early_stop_patience > 0) {
+        search_results.reserve(query_count);
+        for (uint32_t q = 0; q < query_count; ++q) {
+            search_results.emplace_back(
+                this->search_one_query(queries[q], request, params, k, search_allocator));
+        }
+    } else {
+        search_results = this->interleaved_search(request, params, queries, k, search_allocator);
+    }
+
+    // results are laid out as query_count rows of k, the missing ones are filled with -1
+    auto result = Dataset::Make();
+    result->NumElements(query_count)->Dim(k)->Owner(true, search_allocator);
+    auto* ids = reinterpret_cast<int64_t*>(
+        search_allocator->Allocate(sizeof(int64_t) * query_count * static_cast<uint64_t>(k)));
+    auto* dists = reinterpret_cast<float*>(
+        search_allocator->Allocate(sizeof(float) * query_count * static_cast<uint64_t>(k)));
+    result->Ids(ids)->Distances(dists);
+    std::fill(ids, ids + query_count * k, -1);
+    std::fill(dists, dists + query_count * k, std::numeric_limits<float>::max());
     char* extra_infos = nullptr;
     if (extra_info_size_ > 0) {
-        extra_infos = (char*)search_allocator->Allocate(extra_info_size_ * search_result->Size());
-        dataset_results->ExtraInfos(extra_infos);
+        extra_infos = (char*)search_allocator->Allocate(extra_info_size_ * query_count * k);
+        result->ExtraInfos(extra_infos);
+    }
+    for (uint32_t q = 0; q < query_count; ++q) {
+        auto& search_result = search_results[q];
+        auto* cur_ids = ids + q * k;
+        auto* cur_dists = dists + q * k;
+        for (auto j = static_cast<int64_t>(search_result->Size()) - 1; j >= 0; --j) {
+            cur_dists[j] = search_result->Top().first;
+            cur_ids[j] = this->label_table_->GetLabelById(search_result->Top().second);
+            if (extra_infos != nullptr) {
+                this->extra_infos_->GetExtraInfoById(
+                    search_result->Top().second, extra_infos + extra_info_size_ * (q * k + j));
+            }
+            search_result->Pop();
+        }
     }
-    for (int64_t j = count - 1; j >= 0; --j) {
-        dists[j] = search_result->Top().first;
-        ids[j] = this->label_table_->GetLabelById(search_result->Top().second);
-        if (extra_infos != nullptr) {
-            this->extra_infos_->GetExtraInfoById(search_result->Top().second,
-                                                 extra_infos + extra_info_size_ * j);
+    return result;
+}
+
+std::vector<DistHeapPtr>
+HGraph::interleaved_search(const SearchRequest& request,
+                           const HGraphSearchParameters& params,
+                           const std::vector<const void*>& queries,
+                           int64_t k,
+                           Allocator* search_allocator) const {
+    auto query_count = static_cast<uint32_t>(queries.size());
+    std::vector<InnerIdType> eps(query_count, this->entry_point_id_);
+    std::vector<VisitedListPtr> vls(query_count);
+    auto take_visited_lists = [&]() {
+        for (auto& vl : vls) {
+            vl = this->pool_->TakeOne(std::max(params.ef_search, k));
+        }
+    };
+    auto return_visited_lists = [&]() {
+        for (auto& vl : vls) {
+            this->pool_->ReturnOne(vl);
+        }
+    };
+
+    InnerSearchParam search_param;
+    search_param.topk = 1;
+    search_param.ef = 1;
+    search_param.is_inner_id_allowed = nullptr;
+    search_param.search_alloc = search_allocator;
+    search_param.statistics = request.statistics_;
+    const auto& route_graphs = this->search_route_graphs();
+    for (auto i = static_cast<int64_t>(route_graphs.size() - 1); i >= 0; --i) {
+        take_visited_lists();
+        auto results = this->searcher_->BatchSearch(route_graphs[i],
+                                                    this->basic_flatten_codes_,
+                                                    vls,
+                                                    queries,
+                                                    eps,
+                                                    search_param);
+        return_visited_lists();
+        for (uint32_t q = 0; q < query_count; ++q) {
+            if (not results[q]->Empty()) {
+                eps[q] = results[q]->Top().second;
+            }
         }
-        search_result->Pop();
     }
-    return std::move(dataset_results);
+
+    search_param.ef = std::max(params.ef_search, k);
+    search_param.is_inner_id_allowed = this->wrap_tombstone_filter(nullptr);
+    search_param.topk = static_cast<int64_t>(search_param.ef);
+    search_param.consider_duplicate = true;
+    if (params.enable_time_record) {
+        search_param.time_cost = std::make_shared<Timer>();
+        search_param.time_cost->SetThreshold(params.timeout_ms);
+    }
+    search_param.BindStopCondition(request);
+    take_visited_lists();
+    auto search_results = this->searcher_->BatchSearch(this->bottom_graph_,
+                                                       this->basic_flatten_codes_,
+                                                       vls,
+                                                       queries,
+                                                       eps,
+                                                       search_param,
+                                                       this->label_table_);
+    return_visited_lists();
+
+    for (uint32_t q = 0; q < query_count; ++q) {
+        auto& search_result = search_results[q];
+        if (use_reorder_) {
+            if (request.statistics_ != nullptr) {
+                request.statistics_->reorder_candidates += search_result->Size();
+            }
+            this->reorder(queries[q], this->high_precise_codes_, search_result, k);
+        }
+        while (search_result->Size() > k) {
+            search_result->Pop();
+        }
+    }
+    return search_results;
 }
 
 void
@@ -2124,6 +2832,15 @@ HGraph::GetStats() const {
     stats["duplicate_rate"] =
         static_cast<float>(duplicate_num) / static_cast<float>(this->total_count_);
     stats["deleted_count"] = delete_count_.load();
+    stats["reclaimed_count"] = reclaimed_count_.load();
+    stats["search_statistics"] = this->search_statistics_.ToJson();
+    if (use_reorder_ and this->high_precise_codes_->GetCache() != nullptr) {
+        const auto* cache = this->high_precise_codes_->GetCache();
+        stats["precise_codes_cache"]["capacity"] = cache->Capacity();
+        stats["precise_codes_cache"]["size"] = cache->Size();
+        stats["precise_codes_cache"]["hit_count"] = cache->HitCount();
+        stats["precise_codes_cache"]["miss_count"] = cache->MissCount();
+    }
     this->analyze_graph_connection(stats);
     this->analyze_graph_recall(stats, sample_base_datas, sample_size, topk, search_params);
     this->analyze_quantizer(stats, sample_base_datas, sample_size, topk, search_params);
@@ -2136,8 +2853,8 @@ HGraph::analyze_quantizer(JsonType& stats,
                           uint64_t sample_data_size,
                           int64_t topk,
                           const std::string& search_param) const {
-    // record quantized information
-    if (this->use_reorder_) {
+    // record quantized information, an int8 code is the raw vector and has no quantization error
+    if (this->use_reorder_ and data_type_ != DataTypes::DATA_TYPE_INT8) {
         logger::info("analyze_quantizer: sample_data_size = {}, topk = {}", sample_data_size, topk);
         float bias_ratio = 0.0F;
         float inversion_count_rate = 0.0F;
@@ -2196,6 +2913,7 @@ HGraph::analyze_graph_recall(JsonType& stats,
     size_t all_neighbor_count = 0;
     int64_t hit_neighbor_count = 0;
     float avg_distance_base = 0.0F;
+    Vector<uint8_t> sample_codes(codes->code_size_, allocator_);
     for (uint64_t i = 0; i < sample_data_size; ++i) {
         InnerIdType sample_id = rand() % this->total_count_;
         GetVectorByInnerId(sample_id, data.data() + i * dim_);
@@ -2237,7 +2955,14 @@ HGraph::analyze_graph_recall(JsonType& stats,
 
         // search
         auto query = Dataset::Make();
-        query->Owner(false)->NumElements(1)->Float32Vectors(data.data() + i * dim_)->Dim(dim_);
+        query->Owner(false)->NumElements(1)->Dim(dim_);
+        if (data_type_ == DataTypes::DATA_TYPE_INT8) {
+            // an int8 code is the raw int8 vector itself
+            codes->GetCodesById(sample_id, sample_codes.data());
+            query->Int8Vectors(reinterpret_cast<const int8_t*>(sample_codes.data()));
+        } else {
+            query->Float32Vectors(data.data() + i * dim_);
+        }
         auto result = this->KnnSearch(query, topk, search_param, nullptr);
         // calculate recall
         for (int64_t j = 0; j < result->GetDim(); ++j) {
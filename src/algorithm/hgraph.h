@@ -16,6 +16,8 @@
 #pragma once
 
 #include <nlohmann/json.hpp>
+#include <future>
+#include <mutex>
 #include <random>
 #include <shared_mutex>
 #include <string>
@@ -39,6 +41,7 @@
 #include "inner_index_interface.h"
 #include "lock_strategy.h"
 #include "typing.h"
+#include "utils/search_statistics.h"
 #include "utils/visited_list.h"
 #include "vsag/index.h"
 #include "vsag/index_features.h"
@@ -58,7 +61,9 @@ public:
     HGraph(const ParamPtr& param, const IndexCommonParam& common_param)
         : HGraph(std::dynamic_pointer_cast<HGraphParameter>(param), common_param){};
 
-    ~HGraph() override = default;
+    ~HGraph() override {
+        this->wait_for_removal_repair();
+    }
 
     [[nodiscard]] std::string
     GetName() const override {
@@ -87,6 +92,20 @@ public:
     std::vector<int64_t>
     Add(const DatasetPtr& data) override;
 
+    // runs one stage of Build per call: train, insert build_batch_size_ vectors of base,
+    // optimize; the returned checkpoint resumes the build on this or a fresh index.
+    // A checkpoint holds a snapshot of the whole index, which costs O(N) bytes, so it is only
+    // taken when the stage changes and every build_checkpoint_interval_ insert batches; the
+    // checkpoints in between share the last one, and a fresh index resumed from them replays
+    // the batches inserted after it
+    Index::Checkpoint
+    ContinueBuild(const DatasetPtr& base, const BinarySet& binary_set) override;
+
+    void
+    SetBuildProgressCallback(BuildProgressCallback callback) override {
+        this->build_progress_callback_ = std::move(callback);
+    }
+
     bool
     Remove(int64_t id) override;
 
@@ -132,7 +151,7 @@ public:
 
     int64_t
     GetNumElements() const override {
-        return static_cast<int64_t>(this->total_count_) - delete_count_;
+        return static_cast<int64_t>(this->total_count_) - delete_count_ + reclaimed_count_;
     }
 
     uint64_t
@@ -155,6 +174,9 @@ public:
     std::pair<int64_t, int64_t>
     GetMinAndMaxId() const override;
 
+    void
+    WarmUp(const DatasetPtr& queries, int64_t k, const std::string& parameters) override;
+
     void
     GetExtraInfoByIds(const int64_t* ids, int64_t count, char* extra_infos) const override;
 
@@ -204,6 +226,8 @@ private:
     get_data(const DatasetPtr& dataset, uint32_t index = 0) const {
         if (data_type_ == DataTypes::DATA_TYPE_FLOAT) {
             return dataset->GetFloat32Vectors() + index * dim_;
+        } else if (data_type_ == DataTypes::DATA_TYPE_INT8) {
+            return dataset->GetInt8Vectors() + index * dim_;
         } else if (data_type_ == DataTypes::DATA_TYPE_SPARSE) {
             return dataset->GetSparseVectors() + index;
         }
@@ -229,11 +253,23 @@ private:
         return ret;
     }
 
+    // take an inner id reclaimed from the removed points, false if there is none
+    bool
+    reuse_removed_inner_id(InnerIdType& inner_id);
+
     std::vector<int64_t>
     build_by_odescent(const DatasetPtr& data);
 
+    // inserts the rows [begin, end) of data, the codes of the next batch are encoded while
+    // the current batch is linked into the graph
+    std::vector<int64_t>
+    add_rows(const DatasetPtr& data, int64_t begin, int64_t end);
+
+    void
+    encode_one_point(const void* data, InnerIdType inner_id);
+
     void
-    add_one_point(const void* data, int level, InnerIdType id);
+    link_one_point(const void* data, int level, InnerIdType inner_id);
 
     bool
     graph_add_one(const void* data, int level, InnerIdType inner_id);
@@ -241,9 +277,27 @@ private:
     void
     resize(uint64_t new_size);
 
+    void
+    resize_tombstones(uint64_t new_size);
+
     GraphInterfacePtr
     generate_one_route_graph();
 
+    void
+    replicate_route_graphs();
+
+    // the pool of the ParallelSearch workers, created on the first parallel search
+    SafeThreadPool*
+    get_search_pool() const;
+
+    // packs the route graphs for read-only search, only called once the index is immutable
+    static void
+    freeze_route_graphs(const Vector<GraphInterfacePtr>& route_graphs);
+
+    // the route graphs of the numa node the calling thread runs on
+    [[nodiscard]] const Vector<GraphInterfacePtr>&
+    search_route_graphs() const;
+
     template <InnerSearchMode mode = InnerSearchMode::KNN_SEARCH>
     DistHeapPtr
     search_one_graph(const void* query,
@@ -259,6 +313,47 @@ private:
                      InnerSearchParam& inner_search_param,
                      IteratorFilterContext* iter_ctx) const;
 
+    // hides the removed points from the results, returns filter itself if there is none
+    [[nodiscard]] FilterPtr
+    wrap_tombstone_filter(const FilterPtr& filter) const;
+
+    // throws for an int8 index, whose codes cannot be compared with a float query
+    void
+    check_float_query_supported() const;
+
+    // scans the ids passing both filters with the basic codes, the best topk are returned
+    DistHeapPtr
+    brute_force_search(const void* query,
+                       const FilterPtr& filter,
+                       const Filter* attr_filter,
+                       int64_t topk,
+                       Allocator* allocator,
+                       SearchStatistics* stats) const;
+
+    // the route descent, planned bottom search and reorder of one query, keeps the best k
+    DistHeapPtr
+    search_one_query(const void* raw_query,
+                     const SearchRequest& request,
+                     const HGraphSearchParameters& params,
+                     int64_t k,
+                     Allocator* search_allocator) const;
+
+    // lays the results of the queries out as rows of k, @see Index::SearchWithRequest
+    DatasetPtr
+    batch_search(const SearchRequest& request,
+                 const HGraphSearchParameters& params,
+                 int64_t k,
+                 Allocator* search_allocator) const;
+
+    // searches the queries together with BasicSearcher::BatchSearch, without filters nor
+    // adaptive or parallel search, keeps the best k of each
+    std::vector<DistHeapPtr>
+    interleaved_search(const SearchRequest& request,
+                       const HGraphSearchParameters& params,
+                       const std::vector<const void*>& queries,
+                       int64_t k,
+                       Allocator* search_allocator) const;
+
 private:
     // since v0.15
     JsonType
@@ -280,16 +375,50 @@ private:
     void
     deserialize_basic_info_v0_14(StreamReader& reader);
 
+private:
+    void
+    repair_removed_points();
+
+    void
+    repair_removed_point(InnerIdType inner_id, UnorderedSet<InnerIdType>& affected_ids);
+
+    void
+    reset_removed_entry_point();
+
+    void
+    compact_removed_points(const Vector<InnerIdType>& removed_ids,
+                           const UnorderedSet<InnerIdType>& affected_ids);
+
+    void
+    wait_for_removal_repair() const;
+
 private:
     void
     reorder(const void* query,
             const FlattenInterfacePtr& flatten,
             DistHeapPtr& candidate_heap,
-            int64_t k) const;
+            int64_t k,
+            const UnorderedMap<InnerIdType, float>* exact_dists = nullptr) const;
+
+    // lets a search of a co-located bottom graph record the precise distances of the nodes it
+    // expands, which the reorder then takes instead of reading their codes
+    void
+    bind_colocated_codes(InnerSearchParam& search_param,
+                         UnorderedMap<InnerIdType, float>& exact_dists) const;
 
     void
     elp_optimize();
 
+    void
+    report_build_progress(const char* stage, uint64_t finished, uint64_t total) const;
+
+    // the whole index, trained but still empty ones included, for the build checkpoints
+    [[nodiscard]] Binary
+    serialize_build_checkpoint() const;
+
+    void
+    deserialize_build_checkpoint(const Binary& binary);
+
 private:
     void
     analyze_quantizer(JsonType& stats,
@@ -335,14 +464,29 @@ private:
 
     uint64_t total_count_{0};
 
-    std::shared_ptr<VisitedListPool> pool_{nullptr};
+    AdaptiveVisitedListPoolPtr pool_{nullptr};
+    VisitedListMode visited_list_mode_{VisitedListMode::AUTO};
+    std::shared_ptr<ConcurrentVisitedListPool> parallel_pool_{nullptr};
 
     mutable std::shared_mutex global_mutex_;
     mutable MutexArrayPtr neighbors_mutex_;
     mutable std::shared_mutex add_mutex_;
 
     std::shared_ptr<SafeThreadPool> build_pool_{nullptr};
+    // the workers of ParallelSearch, apart from build_pool_ so searches never queue behind a build,
+    // sized by Options::num_threads_search() when the first parallel search creates it
+    mutable std::once_flag search_pool_flag_;
+    mutable std::shared_ptr<SafeThreadPool> search_pool_{nullptr};
+    mutable int64_t search_pool_size_{0};
     uint64_t build_thread_count_{100};
+    uint64_t build_batch_size_{100000};
+    uint64_t build_checkpoint_interval_{10};
+
+    BuildProgressCallback build_progress_callback_{nullptr};
+
+    // the vectors of Add are encoded and linked in batches of this size
+    static constexpr uint64_t BUILD_PIPELINE_BATCH_SIZE = 1024;
+    static constexpr uint64_t BUILD_ENCODE_CHUNK_SIZE = 64;
 
     std::atomic<InnerIdType> max_capacity_{0};
 
@@ -357,8 +501,37 @@ private:
     UnorderedSet<InnerIdType> deleted_ids_;
     std::atomic<int64_t> delete_count_{0};
 
+    // Remove only marks the tombstone, the graph repair of the removed points runs in
+    // batches on build_pool_ (inline without a pool), one repair task at a time. The
+    // repaired points are compacted once they exceed remove_compaction_ratio_ of the
+    // index, and their inner ids are reused by Add. The compaction only rewrites the points
+    // whose lists the repair touched, the stale edges elsewhere are hidden by the versions
+    // of the graph.
+    // The searches read the tombstones, the entry point and route_graphs_ under the shared
+    // global_mutex_; resize swaps the tombstones and the repair moves the entry point under
+    // the exclusive one. The tombstones are written under label_lookup_mutex_, which the
+    // resize of Add holds as well.
+    Vector<std::atomic<bool>> tombstones_;
+    mutable std::mutex remove_mutex_;
+    Vector<InnerIdType> pending_repair_ids_;
+    Vector<InnerIdType> repaired_ids_;
+    UnorderedSet<InnerIdType> repair_affected_ids_;
+    Vector<InnerIdType> reclaimed_ids_;
+    bool repair_running_{false};
+    std::shared_future<void> repair_future_;
+    std::atomic<int64_t> reclaimed_count_{0};
+    float remove_compaction_ratio_{0.1F};
+
+    static constexpr uint64_t REMOVE_REPAIR_BATCH_SIZE = 64;
+
     std::shared_ptr<Optimizer<BasicSearcher>> optimizer_;
 
     AttrInvertedInterfacePtr attr_filter_index_{nullptr};
+
+    // the copies of route_graphs_ per numa node, only built for an immutable index
+    std::vector<Vector<GraphInterfacePtr>> numa_route_graphs_;
+
+    // the searches which requested statistics, reported by GetStats
+    mutable SearchStatisticsCollector search_statistics_;
 };
 }  // namespace vsag
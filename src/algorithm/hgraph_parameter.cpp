@@ -84,20 +84,33 @@ HGraphParameter::FromJson(const JsonType& json) {
         if (graph_storage_type_str == GRAPH_STORAGE_TYPE_COMPRESSED) {
             graph_storage_type = GraphStorageTypes::GRAPH_STORAGE_TYPE_COMPRESSED;
         }
+        if (graph_storage_type_str == GRAPH_STORAGE_TYPE_COLOCATED) {
+            graph_storage_type = GraphStorageTypes::GRAPH_STORAGE_TYPE_COLOCATED;
+        }
 
         if (graph_storage_type_str != GRAPH_STORAGE_TYPE_COMPRESSED &&
-            graph_storage_type_str != GRAPH_STORAGE_TYPE_FLAT) {
+            graph_storage_type_str != GRAPH_STORAGE_TYPE_FLAT &&
+            graph_storage_type_str != GRAPH_STORAGE_TYPE_COLOCATED) {
             throw VsagException(
                 ErrorType::INVALID_ARGUMENT,
                 fmt::format("invalid graph_storage_type: {}", graph_storage_type_str.dump()));
         }
     }
+    if (graph_storage_type == GraphStorageTypes::GRAPH_STORAGE_TYPE_COLOCATED) {
+        // the nodes carry the precise codes, which only a dense index with reorder has
+        CHECK_ARGUMENT(use_reorder and data_type != DataTypes::DATA_TYPE_SPARSE,
+                       fmt::format("{} {} requires {} and dense vectors",
+                                   GRAPH_STORAGE_TYPE_KEY,
+                                   GRAPH_STORAGE_TYPE_COLOCATED,
+                                   HGRAPH_USE_REORDER_KEY));
+    }
     this->bottom_graph_param =
         GraphInterfaceParameter::GetGraphParameterByJson(graph_storage_type, graph_json);
 
     hierarchical_graph_param = std::make_shared<SparseGraphDatacellParameter>();
     hierarchical_graph_param->max_degree_ = this->bottom_graph_param->max_degree_ / 2;
-    if (graph_storage_type == GraphStorageTypes::GRAPH_STORAGE_TYPE_FLAT) {
+    if (graph_storage_type == GraphStorageTypes::GRAPH_STORAGE_TYPE_FLAT or
+        graph_storage_type == GraphStorageTypes::GRAPH_STORAGE_TYPE_COLOCATED) {
         auto graph_param =
             std::dynamic_pointer_cast<GraphDataCellParameter>(this->bottom_graph_param);
         if (graph_param != nullptr) {
@@ -118,6 +131,16 @@ HGraphParameter::FromJson(const JsonType& json) {
         if (build_params.contains(BUILD_THREAD_COUNT)) {
             this->build_thread_count = build_params[BUILD_THREAD_COUNT];
         }
+        if (build_params.contains(BUILD_BATCH_SIZE)) {
+            this->build_batch_size = build_params[BUILD_BATCH_SIZE];
+            CHECK_ARGUMENT(this->build_batch_size > 0,
+                           fmt::format("{} must be greater than 0", BUILD_BATCH_SIZE));
+        }
+        if (build_params.contains(BUILD_CHECKPOINT_INTERVAL)) {
+            this->build_checkpoint_interval = build_params[BUILD_CHECKPOINT_INTERVAL];
+            CHECK_ARGUMENT(this->build_checkpoint_interval > 0,
+                           fmt::format("{} must be greater than 0", BUILD_CHECKPOINT_INTERVAL));
+        }
     }
 
     if (graph_json.contains(GRAPH_TYPE_KEY)) {
@@ -136,6 +159,30 @@ HGraphParameter::FromJson(const JsonType& json) {
     if (json.contains(SUPPORT_DUPLICATE)) {
         this->support_duplicate = json[SUPPORT_DUPLICATE];
     }
+    if (json.contains(REMOVE_COMPACTION_RATIO_KEY)) {
+        this->remove_compaction_ratio = json[REMOVE_COMPACTION_RATIO_KEY];
+        CHECK_ARGUMENT(
+            0.0F <= this->remove_compaction_ratio and this->remove_compaction_ratio <= 1.0F,
+            fmt::format("{}({}) must in range[0, 1]",
+                        REMOVE_COMPACTION_RATIO_KEY,
+                        this->remove_compaction_ratio));
+    }
+    if (json.contains(VISITED_LIST_TYPE_KEY)) {
+        const std::string visited_list_type = json[VISITED_LIST_TYPE_KEY];
+        if (visited_list_type == VISITED_LIST_TYPE_AUTO) {
+            this->visited_list_mode = VisitedListMode::AUTO;
+        } else if (visited_list_type == VISITED_LIST_TYPE_DENSE) {
+            this->visited_list_mode = VisitedListMode::DENSE;
+        } else if (visited_list_type == VISITED_LIST_TYPE_SPARSE) {
+            this->visited_list_mode = VisitedListMode::SPARSE;
+        } else if (visited_list_type == VISITED_LIST_TYPE_HASH) {
+            this->visited_list_mode = VisitedListMode::HASH;
+        } else {
+            throw VsagException(
+                ErrorType::INVALID_ARGUMENT,
+                fmt::format("invalid {}: {}", VISITED_LIST_TYPE_KEY, visited_list_type));
+        }
+    }
 }
 
 JsonType
@@ -153,8 +200,16 @@ HGraphParameter::ToJson() const {
 
     json[BUILD_PARAMS_KEY][BUILD_EF_CONSTRUCTION] = this->ef_construction;
     json[BUILD_PARAMS_KEY][BUILD_THREAD_COUNT] = this->build_thread_count;
+    json[BUILD_PARAMS_KEY][BUILD_BATCH_SIZE] = this->build_batch_size;
+    json[BUILD_PARAMS_KEY][BUILD_CHECKPOINT_INTERVAL] = this->build_checkpoint_interval;
     json[HGRAPH_EXTRA_INFO_KEY] = this->extra_info_param->ToJson();
     json[SUPPORT_DUPLICATE] = this->support_duplicate;
+    json[REMOVE_COMPACTION_RATIO_KEY] = this->remove_compaction_ratio;
+    static const char* const visited_list_types[] = {VISITED_LIST_TYPE_AUTO,
+                                                     VISITED_LIST_TYPE_DENSE,
+                                                     VISITED_LIST_TYPE_SPARSE,
+                                                     VISITED_LIST_TYPE_HASH};
+    json[VISITED_LIST_TYPE_KEY] = visited_list_types[static_cast<int>(this->visited_list_mode)];
     json[HGRAPH_STORE_RAW_VECTOR] = this->store_raw_vector;
     json[USE_ATTRIBUTE_FILTER_KEY] = this->use_attribute_filter;
     return json;
@@ -225,6 +280,42 @@ HGraphSearchParameters::FromJson(const std::string& json_string) {
         obj.enable_time_record = true;
     }
 
+    if (params[INDEX_TYPE_HGRAPH].contains(HGRAPH_SEARCH_PARALLELISM)) {
+        obj.parallel_search_thread_count = params[INDEX_TYPE_HGRAPH][HGRAPH_SEARCH_PARALLELISM];
+        CHECK_ARGUMENT(obj.parallel_search_thread_count >= 1,
+                       fmt::format("{} must be at least 1", HGRAPH_SEARCH_PARALLELISM));
+    }
+
+    if (params[INDEX_TYPE_HGRAPH].contains(HGRAPH_SEARCH_EARLY_STOP_PATIENCE)) {
+        obj.early_stop_patience = params[INDEX_TYPE_HGRAPH][HGRAPH_SEARCH_EARLY_STOP_PATIENCE];
+    }
+    if (params[INDEX_TYPE_HGRAPH].contains(HGRAPH_SEARCH_EARLY_STOP_DISTANCE_RATIO)) {
+        obj.early_stop_distance_ratio =
+            params[INDEX_TYPE_HGRAPH][HGRAPH_SEARCH_EARLY_STOP_DISTANCE_RATIO];
+        CHECK_ARGUMENT(obj.early_stop_distance_ratio == 0 or obj.early_stop_distance_ratio >= 1,
+                       fmt::format("{} must be 0 (disabled) or at least 1",
+                                   HGRAPH_SEARCH_EARLY_STOP_DISTANCE_RATIO));
+    }
+    if (params[INDEX_TYPE_HGRAPH].contains(HGRAPH_SEARCH_MAX_EF)) {
+        obj.max_ef_search = params[INDEX_TYPE_HGRAPH][HGRAPH_SEARCH_MAX_EF];
+    }
+    if (params[INDEX_TYPE_HGRAPH].contains(HGRAPH_SEARCH_FILTER_PLAN)) {
+        const std::string filter_plan = params[INDEX_TYPE_HGRAPH][HGRAPH_SEARCH_FILTER_PLAN];
+        if (filter_plan == FILTER_PLAN_AUTO) {
+            obj.filter_plan = FilteredSearchPlan::AUTO;
+        } else if (filter_plan == FILTER_PLAN_GRAPH) {
+            obj.filter_plan = FilteredSearchPlan::GRAPH;
+        } else if (filter_plan == FILTER_PLAN_TWO_HOP) {
+            obj.filter_plan = FilteredSearchPlan::TWO_HOP;
+        } else if (filter_plan == FILTER_PLAN_BRUTE_FORCE) {
+            obj.filter_plan = FilteredSearchPlan::BRUTE_FORCE;
+        } else {
+            throw VsagException(
+                ErrorType::INVALID_ARGUMENT,
+                fmt::format("invalid {}: {}", HGRAPH_SEARCH_FILTER_PLAN, filter_plan));
+        }
+    }
+
     return obj;
 }
 }  // namespace vsag
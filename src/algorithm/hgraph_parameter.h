@@ -20,8 +20,10 @@
 #include "data_cell/graph_interface_parameter.h"
 #include "data_cell/sparse_graph_datacell_parameter.h"
 #include "data_type.h"
+#include "impl/filtered_search_planner.h"
 #include "impl/odescent_graph_parameter.h"
 #include "parameter.h"
+#include "utils/visited_list.h"
 #include "vsag/constants.h"
 
 namespace vsag {
@@ -60,9 +62,18 @@ public:
     bool use_attribute_filter{false};
     uint64_t ef_construction{400};
     uint64_t build_thread_count{100};
+    // the count of vectors inserted by one ContinueBuild call
+    uint64_t build_batch_size{100000};
+    uint64_t build_checkpoint_interval{10};
 
     bool support_duplicate{false};
 
+    // the removed points are compacted and their inner ids are reused once they exceed
+    // this ratio of the index, 0 means never
+    float remove_compaction_ratio{0.1F};
+
+    VisitedListMode visited_list_mode{VisitedListMode::AUTO};
+
     DataTypes data_type{DataTypes::DATA_TYPE_FLOAT};
 
     std::string name;
@@ -81,6 +92,11 @@ public:
     bool use_extra_info_filter{false};
     bool enable_time_record{false};
     double timeout_ms{std::numeric_limits<double>::max()};
+    int64_t parallel_search_thread_count{1};
+    uint32_t early_stop_patience{0};
+    float early_stop_distance_ratio{0.0F};
+    int64_t max_ef_search{0};
+    FilteredSearchPlan filter_plan{FilteredSearchPlan::AUTO};
 
 private:
     HGraphSearchParameters() = default;
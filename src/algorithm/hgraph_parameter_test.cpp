@@ -158,3 +158,21 @@ TEST_CASE("HGraph Parameters CheckCompatibility", "[ut][HGraphParameter][CheckCo
         "different use attribute filter", use_attribute_filter, true, false, false)
     TEST_COMPATIBILITY_CASE("different support duplicate", support_duplicate, true, false, false)
 }
+
+TEST_CASE("HGraph Parameters Remove Compaction Ratio", "[ut][HGraphParameter]") {
+    HGraphDefaultParam default_param;
+    auto json = vsag::JsonType::parse(generate_hgraph_param(default_param));
+    auto param = std::make_shared<vsag::HGraphParameter>();
+    param->FromJson(json);
+    REQUIRE(param->remove_compaction_ratio == 0.1F);
+
+    json["remove_compaction_ratio"] = 0.25F;
+    param->FromJson(json);
+    REQUIRE(param->remove_compaction_ratio == 0.25F);
+    REQUIRE(param->ToJson()["remove_compaction_ratio"] == 0.25F);
+
+    json["remove_compaction_ratio"] = 1.5F;
+    REQUIRE_THROWS(param->FromJson(json));
+    json["remove_compaction_ratio"] = -0.1F;
+    REQUIRE_THROWS(param->FromJson(json));
+}
@@ -234,6 +234,21 @@ InnerIndexInterface::Deserialize(std::istream& in_stream) {
     }
 }
 
+void
+InnerIndexInterface::DeserializeWithMMap(const std::string& file_path) {
+    CHECK_SELF_EMPTY;
+
+    std::string time_record_name = this->GetName() + " DeserializeWithMMap";
+    SlowTaskTimer t(time_record_name);
+    try {
+        MMapStreamReader reader(file_path);
+        this->Deserialize(reader);
+        return;
+    } catch (const std::bad_alloc& e) {
+        throw VsagException(ErrorType::READ_ERROR, "failed to Deserialize: ", e.what());
+    }
+}
+
 uint64_t
 InnerIndexInterface::CalSerializeSize() const {
     auto cal_size_func = [](uint64_t cursor, uint64_t size, void* buf) { return; };
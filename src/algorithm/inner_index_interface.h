@@ -172,6 +172,12 @@ public:
                             "Index doesn't support ContinueBuild");
     }
 
+    virtual void
+    SetBuildProgressCallback(BuildProgressCallback callback) {
+        throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION,
+                            "Index doesn't support SetBuildProgressCallback");
+    }
+
     virtual bool
     Remove(int64_t id) {
         throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION, "Index doesn't support Remove");
@@ -237,6 +243,12 @@ public:
                             "Index doesn't support GetMinAndMaxId");
     }
 
+    virtual void
+    WarmUp(const DatasetPtr& queries, int64_t k, const std::string& parameters) {
+        throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION,
+                            "Index doesn't support WarmUp");
+    }
+
     virtual void
     GetExtraInfoByIds(const int64_t* ids, int64_t count, char* extra_infos) const {
         throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION,
@@ -278,6 +290,9 @@ public:
     virtual void
     Deserialize(std::istream& in_stream);
 
+    virtual void
+    DeserializeWithMMap(const std::string& file_path);
+
     virtual uint64_t
     CalSerializeSize() const;
 
@@ -15,6 +15,8 @@
 
 #include "ivf.h"
 
+#include <algorithm>
+#include <atomic>
 #include <set>
 
 #include "attr/argparse.h"
@@ -33,6 +35,7 @@
 
 namespace vsag {
 static constexpr const int64_t MAX_TRAIN_SIZE = 65536L;
+static constexpr const int64_t CLASSIFY_CHUNK_SIZE = 4096L;
 static constexpr const char* IVF_PARAMS_TEMPLATE =
     R"(
     {
@@ -200,17 +203,31 @@ IVF::CheckAndMappingExternalParam(const JsonType& external_param,
         },
     };
 
-    if (common_param.data_type_ == DataTypes::DATA_TYPE_INT8) {
-        throw VsagException(ErrorType::INVALID_ARGUMENT,
-                            fmt::format("IVF not support {} datatype", DATATYPE_INT8));
-    }
-
     std::string str = format_map(IVF_PARAMS_TEMPLATE, DEFAULT_MAP);
     auto inner_json = JsonType::parse(str);
     mapping_external_param_to_inner(external_param, external_mapping, inner_json);
 
     auto ivf_parameter = std::make_shared<IVFParameter>();
     ivf_parameter->FromJson(inner_json);
+    if (common_param.data_type_ == DataTypes::DATA_TYPE_INT8) {
+        auto base_name = ivf_parameter->bucket_param->quantizer_parameter->GetTypeName();
+        CHECK_ARGUMENT(base_name == QUANTIZATION_TYPE_VALUE_INT8,
+                       fmt::format("IVF with {} datatype requires {} base quantization, got {}",
+                                   DATATYPE_INT8,
+                                   QUANTIZATION_TYPE_VALUE_INT8,
+                                   base_name));
+        CHECK_ARGUMENT(not ivf_parameter->bucket_param->use_residual_,
+                       fmt::format("IVF with {} datatype not support residual", DATATYPE_INT8));
+        if (ivf_parameter->use_reorder) {
+            auto precise_name = ivf_parameter->flatten_param->quantizer_parameter->GetTypeName();
+            CHECK_ARGUMENT(
+                precise_name == QUANTIZATION_TYPE_VALUE_INT8,
+                fmt::format("IVF with {} datatype requires {} precise quantization, got {}",
+                            DATATYPE_INT8,
+                            QUANTIZATION_TYPE_VALUE_INT8,
+                            precise_name));
+        }
+    }
 
     return ivf_parameter;
 }
@@ -278,7 +295,8 @@ IVF::InitFeatures() {
     });
 
     auto name = this->bucket_->GetQuantizerName();
-    if (name != QUANTIZATION_TYPE_VALUE_FP32 and name != QUANTIZATION_TYPE_VALUE_BF16) {
+    if (name != QUANTIZATION_TYPE_VALUE_FP32 and name != QUANTIZATION_TYPE_VALUE_BF16 and
+        name != QUANTIZATION_TYPE_VALUE_INT8) {
         this->index_feature_list_->SetFeature(IndexFeature::NEED_TRAIN);
     } else {
         this->index_feature_list_->SetFeatures({
@@ -311,11 +329,22 @@ IVF::Train(const DatasetPtr& data) {
     if (this->is_trained_) {
         return;
     }
-    partition_strategy_->Train(data);
-    const auto* data_ptr = data->GetFloat32Vectors();
-    Vector<float> train_data_buffer(allocator_);
     auto num_element = std::min(data->GetNumElements(), MAX_TRAIN_SIZE);
+    if (data_type_ == DataTypes::DATA_TYPE_INT8) {
+        Vector<float> train_vectors(allocator_);
+        auto train_data = Dataset::Make();
+        train_data->NumElements(num_element)
+            ->Dim(dim_)
+            ->Float32Vectors(this->get_float_data(data, 0, num_element, train_vectors))
+            ->Owner(false);
+        partition_strategy_->Train(train_data);
+    } else {
+        partition_strategy_->Train(data);
+    }
+    const void* train_ptr = get_data(data);
+    Vector<float> train_data_buffer(allocator_);
     if (use_residual_) {
+        const auto* data_ptr = data->GetFloat32Vectors();
         train_data_buffer.resize(num_element * dim_);
         if (metric_ == MetricType::METRIC_TYPE_COSINE) {
             for (int i = 0; i < num_element; ++i) {
@@ -331,11 +360,11 @@ IVF::Train(const DatasetPtr& data) {
                 train_data_buffer[i * dim_ + j] = data_ptr[i * dim_ + j] - centroid[j];
             }
         }
-        data_ptr = train_data_buffer.data();
+        train_ptr = train_data_buffer.data();
     }
-    this->bucket_->Train(data_ptr, num_element);
+    this->bucket_->Train(train_ptr, num_element);
     if (use_reorder_) {
-        this->reorder_codes_->Train(data->GetFloat32Vectors(), data->GetNumElements());
+        this->reorder_codes_->Train(get_data(data), data->GetNumElements());
     }
     this->is_trained_ = true;
 }
@@ -349,16 +378,14 @@ IVF::Add(const DatasetPtr& base) {
     this->bucket_->Unpack();
     auto num_element = base->GetNumElements();
     const auto* ids = base->GetIds();
-    const auto* vectors = base->GetFloat32Vectors();
     const auto* attr_sets = base->GetAttributeSets();
-    auto buckets = partition_strategy_->ClassifyDatas(vectors, num_element, buckets_per_data_);
+    auto buckets = this->classify_datas(base);
 
     int64_t current_num;
     {
         std::lock_guard lock(label_lookup_mutex_);
         if (use_reorder_) {
-            this->reorder_codes_->BatchInsertVector(base->GetFloat32Vectors(),
-                                                    base->GetNumElements());
+            this->reorder_codes_->BatchInsertVector(get_data(base), base->GetNumElements());
         }
         for (int64_t i = 0; i < num_element; ++i) {
             this->label_table_->Insert(i + total_elements_, ids[i]);
@@ -372,16 +399,17 @@ IVF::Add(const DatasetPtr& base) {
         Vector<float> residual_data(dim_, allocator_);
         Vector<float> centroid(dim_, allocator_);
         for (int64_t j = 0; j < buckets_per_data_; ++j) {
-            const auto* data_ptr = vectors + i * dim_;
+            const auto* data_ptr = get_data(base, i);
             auto idx = i * buckets_per_data_ + j;
             InnerIdType offset_id;
             if (use_residual_) {
+                const auto* float_ptr = static_cast<const float*>(data_ptr);
                 partition_strategy_->GetCentroid(buckets[idx], centroid);
                 if (metric_ == MetricType::METRIC_TYPE_COSINE) {
-                    Normalize(data_ptr, normalize_data.data(), dim_);
-                    data_ptr = normalize_data.data();
+                    Normalize(float_ptr, normalize_data.data(), dim_);
+                    float_ptr = normalize_data.data();
                 }
-                FP32Sub(data_ptr, centroid.data(), residual_data.data(), dim_);
+                FP32Sub(float_ptr, centroid.data(), residual_data.data(), dim_);
                 offset_id = bucket_->InsertVector(residual_data.data(),
                                                   buckets[idx],
                                                   idx + current_num * buckets_per_data_,
@@ -429,7 +457,7 @@ IVF::KnnSearch(const DatasetPtr& query,
     }
     auto search_result = this->search<KNN_SEARCH>(query, param);
     if (use_reorder_) {
-        return reorder(k, search_result, query->GetFloat32Vectors());
+        return reorder(k, search_result, get_data(query));
     }
     auto count = static_cast<const int64_t>(search_result->Size());
     auto [dataset_results, dists, labels] = create_fast_dataset(count, allocator_);
@@ -458,7 +486,7 @@ IVF::RangeSearch(const DatasetPtr& query,
     auto search_result = this->search<RANGE_SEARCH>(query, param);
     if (use_reorder_) {
         int64_t k = (limited_size > 0) ? limited_size : static_cast<int64_t>(search_result->Size());
-        return reorder(k, search_result, query->GetFloat32Vectors());
+        return reorder(k, search_result, get_data(query));
     }
     auto count = static_cast<const int64_t>(search_result->Size());
     auto [dataset_results, dists, labels] = create_fast_dataset(count, allocator_);
@@ -646,9 +674,10 @@ IVF::create_search_param(const std::string& parameters, const FilterPtr& filter)
 }
 
 DatasetPtr
-IVF::reorder(int64_t topk, DistHeapPtr& input, const float* query) const {
+IVF::reorder(int64_t topk, DistHeapPtr& input, const void* query) const {
     auto [dataset_results, dists, labels] = create_fast_dataset(topk, allocator_);
-    auto reorder_heap = Reorder::ReorderByFlatten(input, reorder_codes_, query, allocator_, topk);
+    auto reorder_heap = Reorder::ReorderByFlatten(
+        input, reorder_codes_, static_cast<const float*>(query), allocator_, topk);
     auto size = static_cast<int64_t>(reorder_heap->Size());
     for (int64_t j = size - 1; j >= 0; --j) {
         dists[j] = reorder_heap->Top().first;
@@ -658,6 +687,42 @@ IVF::reorder(int64_t topk, DistHeapPtr& input, const float* query) const {
     return std::move(dataset_results);
 }
 
+const float*
+IVF::get_float_data(const DatasetPtr& dataset,
+                    int64_t start,
+                    int64_t count,
+                    Vector<float>& buffer) const {
+    if (data_type_ != DataTypes::DATA_TYPE_INT8) {
+        return dataset->GetFloat32Vectors() + start * dim_;
+    }
+    const auto* vectors = dataset->GetInt8Vectors() + start * dim_;
+    buffer.resize(count * dim_);
+    for (int64_t i = 0; i < count * dim_; ++i) {
+        buffer[i] = static_cast<float>(vectors[i]);
+    }
+    return buffer.data();
+}
+
+Vector<BucketIdType>
+IVF::classify_datas(const DatasetPtr& dataset) const {
+    auto num_element = dataset->GetNumElements();
+    if (data_type_ != DataTypes::DATA_TYPE_INT8) {
+        return partition_strategy_->ClassifyDatas(
+            dataset->GetFloat32Vectors(), num_element, buckets_per_data_);
+    }
+    // widen the int8 vectors chunk by chunk, a float copy of the whole base is never built
+    Vector<BucketIdType> buckets(allocator_);
+    buckets.reserve(num_element * buckets_per_data_);
+    Vector<float> chunk_vectors(allocator_);
+    for (int64_t start = 0; start < num_element; start += CLASSIFY_CHUNK_SIZE) {
+        auto count = std::min(CLASSIFY_CHUNK_SIZE, num_element - start);
+        auto chunk_buckets = partition_strategy_->ClassifyDatas(
+            this->get_float_data(dataset, start, count, chunk_vectors), count, buckets_per_data_);
+        buckets.insert(buckets.end(), chunk_buckets.begin(), chunk_buckets.end());
+    }
+    return buckets;
+}
+
 InnerIndexPtr
 IVF::ExportModel(const IndexCommonParam& param) const {
     auto index = std::make_shared<IVF>(this->create_param_ptr_, param);
@@ -673,16 +738,18 @@ IVF::ExportModel(const IndexCommonParam& param) const {
 template <InnerSearchMode mode>
 DistHeapPtr
 IVF::search(const DatasetPtr& query, const InnerSearchParam& param) const {
-    const auto* query_data = query->GetFloat32Vectors();
+    Vector<float> float_query(allocator_);
+    const auto* query_data = this->get_float_data(query, 0, 1, float_query);
     Vector<float> normalize_data(dim_, allocator_);
     if (use_residual_ && metric_ == MetricType::METRIC_TYPE_COSINE) {
         Normalize(query_data, normalize_data.data(), dim_);
         query_data = normalize_data.data();
     }
     auto candidate_buckets = partition_strategy_->ClassifyDatasForSearch(query_data, 1, param);
-    auto computer = bucket_->FactoryComputer(query_data);
+    // the int8 codes are computed against the int8 query, not its float copy
+    auto computer = bucket_->FactoryComputer(
+        data_type_ == DataTypes::DATA_TYPE_INT8 ? get_data(query) : query_data);
 
-    auto cur_heap_top = std::numeric_limits<float>::max();
     int64_t topk = param.topk;
     if constexpr (mode == RANGE_SEARCH) {
         topk = param.range_search_limit_size;
@@ -703,64 +770,92 @@ IVF::search(const DatasetPtr& query, const InnerSearchParam& param) const {
     DistHeapPtr search_result = nullptr;
     const auto& ft = param.is_inner_id_allowed;
 
-    auto bucket_count = candidate_buckets.size();
+    // The candidate buckets are cut into chunks of at most SCAN_CHUNK_SIZE codes, kept in
+    // the order of the candidates. The threads claim the chunks one by one, so a skewed
+    // bucket is shared by all the threads instead of pinning the one it was assigned to.
+    struct ScanChunk {
+        BucketIdType bucket_id;
+        InnerIdType start;
+        InnerIdType count;
+    };
+    Vector<ScanChunk> chunks(allocator_);
+    for (auto bucket_id : candidate_buckets) {
+        if (bucket_id == -1) {
+            break;
+        }
+        auto bucket_size = bucket_->GetBucketSize(bucket_id);
+        for (InnerIdType start = 0; start < bucket_size; start += SCAN_CHUNK_SIZE) {
+            chunks.push_back({bucket_id, start, std::min(SCAN_CHUNK_SIZE, bucket_size - start)});
+        }
+    }
+
     auto search_thread_count = param.parallel_search_thread_count;
-    if (this->thread_pool_ == nullptr) {
+    // a search on a pool thread waits for its sub-tasks, scan inline to not starve the pool
+    if (this->thread_pool_ == nullptr or SafeThreadPool::InWorkerThread()) {
         search_thread_count = 1;
     }
+    search_thread_count =
+        std::max(int64_t{1}, std::min(search_thread_count, static_cast<int64_t>(chunks.size())));
     std::vector<DistHeapPtr> heaps(search_thread_count);
 
+    std::atomic<uint64_t> next_chunk{0};
+    // the smallest heap top of all the threads, no result can be worse than it
+    std::atomic<float> shared_heap_top{std::numeric_limits<float>::max()};
+
     auto search_func = [&](int64_t thread_id) -> void {
         heaps[thread_id] = DistanceHeap::MakeInstanceBySize<true, false>(this->allocator_, topk);
         auto& heap = heaps[thread_id];
+        auto cur_heap_top = std::numeric_limits<float>::max();
         Vector<float> centroid(dim_, allocator_);
-        Vector<float> dist(allocator_);
-        for (uint64_t i = 0; i < bucket_count; ++i) {
+        Vector<float> dist(SCAN_CHUNK_SIZE, allocator_);
+        BucketIdType cur_bucket_id = -1;
+        auto ip_distance = 0.0F;
+        Filter* attr_ft = nullptr;
+        while (true) {
             if (param.time_cost != nullptr and param.time_cost->CheckOvertime()) {
                 break;
             }
-            if (i % search_thread_count != thread_id) {
-                continue;
-            }
-            auto bucket_id = candidate_buckets[i];
-            if (bucket_id == -1) {
+            auto chunk_id = next_chunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk_id >= chunks.size()) {
                 break;
             }
-            auto bucket_size = bucket_->GetBucketSize(bucket_id);
-            const auto* ids = bucket_->GetInnerIds(bucket_id);
-            if (bucket_size > dist.size()) {
-                dist.resize(bucket_size);
-            }
-            auto ip_distance = 0.0F;
-
-            if (use_residual_) {
-                partition_strategy_->GetCentroid(bucket_id, centroid);
-                ip_distance = FP32ComputeIP(query_data, centroid.data(), dim_);
-                if (metric_ == MetricType::METRIC_TYPE_L2SQR) {
-                    ip_distance *= 2;
+            const auto& chunk = chunks[chunk_id];
+            auto bucket_id = chunk.bucket_id;
+            if (bucket_id != cur_bucket_id) {
+                cur_bucket_id = bucket_id;
+                ip_distance = 0.0F;
+                if (use_residual_) {
+                    partition_strategy_->GetCentroid(bucket_id, centroid);
+                    ip_distance = FP32ComputeIP(query_data, centroid.data(), dim_);
+                    if (metric_ == MetricType::METRIC_TYPE_L2SQR) {
+                        ip_distance *= 2;
+                    }
+                }
+                attr_ft = nullptr;
+                if (param.executors.size() > thread_id and param.executors[thread_id] != nullptr) {
+                    param.executors[thread_id]->Clear();
+                    attr_ft = param.executors[thread_id]->Run(bucket_id);
                 }
             }
+            const auto* ids = bucket_->GetInnerIds(bucket_id) + chunk.start;
+            bucket_->ScanBucketById(dist.data(), computer, bucket_id, chunk.start, chunk.count);
 
-            bucket_->ScanBucketById(dist.data(), computer, bucket_id);
-            Filter* attr_ft = nullptr;
-            if (param.executors.size() > thread_id and param.executors[thread_id] != nullptr) {
-                param.executors[thread_id]->Clear();
-                attr_ft = param.executors[thread_id]->Run(bucket_id);
-            }
-            for (int j = 0; j < bucket_size; ++j) {
+            auto threshold =
+                std::min(cur_heap_top, shared_heap_top.load(std::memory_order_relaxed));
+            for (InnerIdType j = 0; j < chunk.count; ++j) {
                 auto origin_id = ids[j] / buckets_per_data_;
-                if (attr_ft != nullptr and not attr_ft->CheckValid(j)) {
+                if (attr_ft != nullptr and not attr_ft->CheckValid(chunk.start + j)) {
                     continue;
                 }
                 if (ft == nullptr or ft->CheckValid(origin_id)) {
                     dist[j] -= ip_distance;
 
                     if constexpr (mode == KNN_SEARCH) {
-                        if (heap->Size() < topk or dist[j] < cur_heap_top) {
+                        if (dist[j] < threshold) {
                             heap->Push(dist[j], ids[j]);
                         }
                     } else if constexpr (mode == RANGE_SEARCH) {
-                        if (dist[j] <= param.radius + THRESHOLD_ERROR and dist[j] < cur_heap_top) {
+                        if (dist[j] <= param.radius + THRESHOLD_ERROR and dist[j] < threshold) {
                             heap->Push(dist[j], ids[j]);
                         }
                     }
@@ -769,9 +864,14 @@ IVF::search(const DatasetPtr& query, const InnerSearchParam& param) const {
                     }
                     if (not heap->Empty() and heap->Size() == topk) {
                         cur_heap_top = heap->Top().first;
+                        threshold = std::min(threshold, cur_heap_top);
                     }
                 }
             }
+            auto published = shared_heap_top.load(std::memory_order_relaxed);
+            while (cur_heap_top < published and
+                   not shared_heap_top.compare_exchange_weak(published, cur_heap_top)) {
+            }
         }
     };
     std::vector<std::future<void>> futures;
@@ -789,14 +889,31 @@ IVF::search(const DatasetPtr& query, const InnerSearchParam& param) const {
         for (auto& future : futures) {
             future.get();
         }
-        search_result = DistanceHeap::MakeInstanceBySize<true, true>(this->allocator_, topk);
+        // select the best topk of all the heaps at once instead of a push per record,
+        // the records above the shared heap top can not be in the result
+        auto final_heap_top = shared_heap_top.load();
+        Vector<DistanceHeap::DistanceRecord> records(allocator_);
         for (auto& heap : heaps) {
             auto size = heap->Size();
             const auto* data = heap->GetData();
             for (int i = 0; i < size; ++i) {
-                search_result->Push(data[i]);
+                if (data[i].first <= final_heap_top) {
+                    records.emplace_back(data[i]);
+                }
             }
         }
+        if (records.size() > static_cast<uint64_t>(topk)) {
+            std::nth_element(
+                records.begin(),
+                records.begin() + topk,
+                records.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+            records.resize(topk);
+        }
+        search_result = DistanceHeap::MakeInstanceBySize<true, true>(this->allocator_, topk);
+        for (const auto& record : records) {
+            search_result->Push(record);
+        }
     }
 
     // Deduplicate ids when buckets_per_data_ > 1
@@ -900,6 +1017,7 @@ IVF::SearchWithRequest(const SearchRequest& request) const {
     auto param = this->create_search_param(request.params_str_, request.filter_);
     param.search_mode = KNN_SEARCH;
     param.topk = request.topk_;
+    param.BindStopCondition(request);
     if (use_reorder_) {
         param.topk = static_cast<int64_t>(param.factor * static_cast<float>(request.topk_));
     }
@@ -916,7 +1034,7 @@ IVF::SearchWithRequest(const SearchRequest& request) const {
     }
     auto search_result = this->search<KNN_SEARCH>(query, param);
     if (use_reorder_) {
-        return reorder(request.topk_, search_result, query->GetFloat32Vectors());
+        return reorder(request.topk_, search_result, get_data(query));
     }
     auto count = static_cast<const int64_t>(search_result->Size());
     auto [dataset_results, dists, labels] = create_fast_dataset(count, allocator_);
@@ -121,7 +121,30 @@ private:
     search(const DatasetPtr& query, const InnerSearchParam& param) const;
 
     DatasetPtr
-    reorder(int64_t topk, DistHeapPtr& input, const float* query) const;
+    reorder(int64_t topk, DistHeapPtr& input, const void* query) const;
+
+    const void*
+    get_data(const DatasetPtr& dataset, uint32_t index = 0) const {
+        if (data_type_ == DataTypes::DATA_TYPE_INT8) {
+            return dataset->GetInt8Vectors() + static_cast<uint64_t>(index) * dim_;
+        }
+        return dataset->GetFloat32Vectors() + static_cast<uint64_t>(index) * dim_;
+    }
+
+    /**
+     * @brief Returns count vectors from start as float, int8 vectors are widened into buffer.
+     *
+     * The partition strategy and its centroids always work on float, so only the vectors
+     * handed to it are converted, the buckets and the reorder codes keep the int8 vectors.
+     */
+    const float*
+    get_float_data(const DatasetPtr& dataset,
+                   int64_t start,
+                   int64_t count,
+                   Vector<float>& buffer) const;
+
+    Vector<BucketIdType>
+    classify_datas(const DatasetPtr& dataset) const;
 
     void
     merge_one_unit(const MergeUnit& unit);
@@ -158,5 +181,8 @@ private:
     Vector<uint64_t> location_map_;
 
     static const uint64_t LOCATION_SPLIT_BIT = 32;
+
+    // the largest slice of a bucket scanned as one task in the parallel search
+    static constexpr InnerIdType SCAN_CHUNK_SIZE = 1024;
 };
 }  // namespace vsag
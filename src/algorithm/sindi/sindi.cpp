@@ -33,6 +33,7 @@ SINDI::SINDI(const SINDIParameterPtr& param, const IndexCommonParam& common_para
       use_reorder_(param->use_reorder),
       window_size_(param->window_size),
       doc_retain_ratio_(1.0F - param->doc_prune_ratio),
+      use_term_quantization_(param->use_term_quantization),
       window_term_list_(common_param.allocator_.get()) {
     if (use_reorder_) {
         SparseIndexParameterPtr rerank_param = std::make_shared<SparseIndexParameters>();
@@ -54,8 +55,8 @@ SINDI::Add(const DatasetPtr& base) {
     // adjust window
     int64_t final_add_window = ceil_int(cur_element_count_ + data_num, window_size_);
     while (window_term_list_.size() < final_add_window) {
-        window_term_list_.emplace_back(
-            std::make_shared<SparseTermDataCell>(doc_retain_ratio_, allocator_));
+        window_term_list_.emplace_back(std::make_shared<SparseTermDataCell>(
+            doc_retain_ratio_, allocator_, use_term_quantization_));
     }
 
     // add process
@@ -69,6 +70,10 @@ SINDI::Add(const DatasetPtr& base) {
         window_term_list_[cur_window]->InsertVector(sparse_vector, inner_id);
 
         cur_element_count_++;
+        // a full window never takes another vector, so its weights can be compressed
+        if (cur_element_count_ % window_size_ == 0) {
+            window_term_list_[cur_window]->Seal();
+        }
     }
     // high precision part
     if (use_reorder_) {
@@ -136,8 +141,18 @@ SINDI::search_impl(const SparseTermComputerPtr& computer,
         auto window_start_id = cur * window_size_;
         auto term_list = this->window_term_list_[cur];
 
-        // compute
-        term_list->Query(dists.data(), computer);
+        // compute, a full heap or the radius bounds the docs worth scoring in this window
+        float dist_threshold = std::numeric_limits<float>::max();
+        if (computer->use_block_max_) {
+            if constexpr (mode == KNN_SEARCH) {
+                if (heap.size() >= inner_param.ef) {
+                    dist_threshold = heap.top().first;
+                }
+            } else {
+                dist_threshold = inner_param.radius - 1;
+            }
+        }
+        term_list->Query(dists.data(), computer, dist_threshold);
 
         // insert heap
         if (inner_param.is_inner_id_allowed) {
@@ -298,9 +313,15 @@ SINDI::Deserialize(StreamReader& reader) {
     uint32_t window_term_list_size = 0;
     StreamReader::ReadObj(reader, window_term_list_size);
     window_term_list_.resize(window_term_list_size);
-    for (auto& window : window_term_list_) {
-        window = std::make_shared<SparseTermDataCell>(doc_retain_ratio_, allocator_);
+    for (uint32_t i = 0; i < window_term_list_size; ++i) {
+        auto& window = window_term_list_[i];
+        window = std::make_shared<SparseTermDataCell>(
+            doc_retain_ratio_, allocator_, use_term_quantization_);
         window->Deserialize(reader);
+        // the block bounds are not serialized, they are rebuilt for every full window
+        if ((i + 1) * static_cast<int64_t>(window_size_) <= cur_element_count_) {
+            window->Seal();
+        }
     }
 
     label_table_->Deserialize(reader);
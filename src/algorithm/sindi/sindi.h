@@ -105,6 +105,8 @@ private:
 
     float doc_retain_ratio_{0};
 
+    bool use_term_quantization_{false};
+
     std::shared_ptr<SparseIndex> rerank_flat_index_{nullptr};
 };
 
@@ -38,6 +38,16 @@ SINDIParameter::FromJson(const JsonType& json) {
     } else {
         window_size = DEFAULT_WINDOW_SIZE;
     }
+
+    if (json.contains(SPARSE_TERM_QUANTIZATION_TYPE)) {
+        const std::string type = json[SPARSE_TERM_QUANTIZATION_TYPE];
+        CHECK_ARGUMENT(
+            type == QUANTIZATION_TYPE_VALUE_FP32 or type == QUANTIZATION_TYPE_VALUE_SQ8,
+            fmt::format("invalid {}: {}", SPARSE_TERM_QUANTIZATION_TYPE, type));
+        use_term_quantization = (type == QUANTIZATION_TYPE_VALUE_SQ8);
+    } else {
+        use_term_quantization = DEFAULT_USE_TERM_QUANTIZATION;
+    }
 }
 
 JsonType
@@ -46,6 +56,8 @@ SINDIParameter::ToJson() const {
     json[SPARSE_DOC_PRUNE_RATIO] = doc_prune_ratio;
     json[SPARSE_USE_REORDER] = use_reorder;
     json[SPARSE_WINDOW_SIZE] = window_size;
+    json[SPARSE_TERM_QUANTIZATION_TYPE] =
+        use_term_quantization ? QUANTIZATION_TYPE_VALUE_SQ8 : QUANTIZATION_TYPE_VALUE_FP32;
 
     return json;
 }
@@ -70,6 +82,12 @@ SINDISearchParameter::FromJson(const JsonType& json) {
     } else {
         n_candidate = DEFAULT_N_CANDIDATE;
     }
+
+    if (json[INDEX_SINDI].contains(SPARSE_USE_BLOCK_MAX)) {
+        use_block_max = json[INDEX_SINDI][SPARSE_USE_BLOCK_MAX];
+    } else {
+        use_block_max = DEFAULT_USE_BLOCK_MAX;
+    }
 }
 JsonType
 SINDISearchParameter::ToJson() const {
@@ -78,6 +96,7 @@ SINDISearchParameter::ToJson() const {
     json[INDEX_SINDI][SPARSE_QUERY_PRUNE_RATIO] = query_prune_ratio;
     json[INDEX_SINDI][SPARSE_N_CANDIDATE] = n_candidate;
     json[INDEX_SINDI][SPARSE_TERM_PRUNE_RATIO] = term_prune_ratio;
+    json[INDEX_SINDI][SPARSE_USE_BLOCK_MAX] = use_block_max;
     return json;
 }
 
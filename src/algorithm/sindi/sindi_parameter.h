@@ -26,6 +26,8 @@ static constexpr float DEFAULT_QUERY_PRUNE_RATIO = 0.0F;
 static constexpr float DEFAULT_DOC_PRUNE_RATIO = 0.0F;
 static constexpr float DEFAULT_TERM_PRUNE_RATIO = 0.0F;
 static constexpr uint32_t DEFAULT_N_CANDIDATE = 0;
+static constexpr bool DEFAULT_USE_TERM_QUANTIZATION = false;
+static constexpr bool DEFAULT_USE_BLOCK_MAX = false;
 
 struct SINDIParameter : public Parameter {
 public:
@@ -43,6 +45,9 @@ public:
     bool use_reorder{false};
 
     float doc_prune_ratio{0};
+
+    // the term weights of full windows are stored as sq8 codes instead of fp32
+    bool use_term_quantization{false};
 };
 
 using SINDIParameterPtr = std::shared_ptr<SINDIParameter>;
@@ -64,6 +69,9 @@ public:
     // data cell
     float query_prune_ratio{0};
     float term_prune_ratio{0};
+
+    // skip the posting blocks of full windows whose score bound cannot enter the candidates
+    bool use_block_max{false};
 };
 
 }  // namespace vsag
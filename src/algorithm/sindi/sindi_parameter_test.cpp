@@ -44,6 +44,7 @@ struct SINDIDefaultParam {
     bool use_reorder = true;
     float doc_prune_ratio = 0.8F;
     int window_size = 66666;
+    std::string term_quantization_type = "fp32";
 };
 
 std::string
@@ -52,6 +53,7 @@ generate_sindi_param(const SINDIDefaultParam& param) {
     json["use_reorder"] = param.use_reorder;
     json["doc_prune_ratio"] = param.doc_prune_ratio;
     json["window_size"] = param.window_size;
+    json["term_quantization_type"] = param.term_quantization_type;
     return json.dump();
 }
 
@@ -64,6 +66,7 @@ TEST_CASE("SINDI Index Parameters Test", "[ut][SINDIParameter]") {
     REQUIRE(param->use_reorder == true);
     REQUIRE(std::abs(param->doc_prune_ratio - 0.8) < 1e-3);
     REQUIRE(param->window_size == 66666);
+    REQUIRE(param->use_term_quantization == false);
 
     vsag::ParameterTest::TestToJson(param);
 
@@ -83,4 +86,6 @@ TEST_CASE("SINDI Index Parameters Compatibility Test", "[ut][SINDIParameter]") {
     TEST_COMPATIBILITY_CASE("use_reorder compatibility", use_reorder, true, false, false);
     TEST_COMPATIBILITY_CASE("doc_prune_ratio compatibility", doc_prune_ratio, 0.8F, 0.9F, false);
     TEST_COMPATIBILITY_CASE("window_size compatibility", window_size, 66666, 77777, false);
+    TEST_COMPATIBILITY_CASE(
+        "term_quantization_type compatibility", term_quantization_type, "fp32", "sq8", false);
 }
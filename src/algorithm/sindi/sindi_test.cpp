@@ -17,6 +17,8 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
+#include <numeric>
+#include <set>
 
 #include "fixtures.h"
 #include "impl/allocator/safe_allocator.h"
@@ -176,3 +178,112 @@ TEST_CASE("SINDI Basic Test", "[ut][SINDI]") {
         delete[] item.ids_;
     }
 }
+
+TEST_CASE("SINDI Term Quantization Test", "[ut][SINDI]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+
+    uint32_t num_base = 1000;
+    uint32_t num_query = 100;
+    int64_t k = 10;
+    std::vector<int64_t> ids(num_base);
+    std::iota(ids.begin(), ids.end(), 0);
+    auto sv_base = fixtures::GenerateSparseVectors(num_base, 128, 30000, 0, 10, 114);
+    auto base = vsag::Dataset::Make();
+    base->NumElements(num_base)->SparseVectors(sv_base.data())->Ids(ids.data())->Owner(false);
+
+    // three full windows are sealed into sq8 codes, the last one keeps fp32 weights
+    auto param_json = vsag::JsonType::parse(R"({
+        "use_reorder": true,
+        "doc_prune_ratio": 0.0,
+        "window_size": 300,
+        "term_quantization_type": "sq8"
+    })");
+    auto index_param = std::make_shared<vsag::SINDIParameter>();
+    index_param->FromJson(param_json);
+    REQUIRE(index_param->use_term_quantization);
+    auto index = std::make_unique<SINDI>(index_param, common_param);
+    auto another_index = std::make_unique<SINDI>(index_param, common_param);
+    index->Build(base);
+    test_serializion(*index, *another_index);
+
+    std::string search_param_str = R"({"sindi": {"n_candidate": 50}})";
+    auto query = vsag::Dataset::Make();
+    for (int i = 0; i < num_query; ++i) {
+        query->NumElements(1)->SparseVectors(sv_base.data() + i)->Owner(false);
+        auto result = index->KnnSearch(query, k, search_param_str, nullptr);
+        REQUIRE(result->GetIds()[0] == ids[i]);
+        auto another_result = another_index->KnnSearch(query, k, search_param_str, nullptr);
+        for (int j = 0; j < k; j++) {
+            REQUIRE(result->GetIds()[j] == another_result->GetIds()[j]);
+        }
+    }
+
+    for (auto& item : sv_base) {
+        delete[] item.vals_;
+        delete[] item.ids_;
+    }
+}
+
+TEST_CASE("SINDI Block Max Test", "[ut][SINDI]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+
+    uint32_t num_base = 1000;
+    uint32_t num_query = 50;
+    int64_t k = 10;
+    float radius = 0.5;
+    auto quantization_type = GENERATE("fp32", "sq8");
+    std::vector<int64_t> ids(num_base);
+    std::iota(ids.begin(), ids.end(), 0);
+    auto sv_base = fixtures::GenerateSparseVectors(num_base, 128, 30000, 0, 1, 114);
+    auto base = vsag::Dataset::Make();
+    base->NumElements(num_base)->SparseVectors(sv_base.data())->Ids(ids.data())->Owner(false);
+
+    // nine full windows hold the block bounds, the last one is scored exhaustively
+    auto param_json = vsag::JsonType::parse(fmt::format(R"({{
+        "use_reorder": false,
+        "doc_prune_ratio": 0.0,
+        "window_size": 110,
+        "term_quantization_type": "{}"
+    }})",
+                                                        quantization_type));
+    auto index_param = std::make_shared<vsag::SINDIParameter>();
+    index_param->FromJson(param_json);
+    auto index = std::make_unique<SINDI>(index_param, common_param);
+    auto another_index = std::make_unique<SINDI>(index_param, common_param);
+    index->Build(base);
+    test_serializion(*index, *another_index);
+
+    std::string exhaustive_param_str = R"({"sindi": {"n_candidate": 20}})";
+    std::string block_max_param_str = R"({"sindi": {"n_candidate": 20, "use_block_max": true}})";
+    auto query = vsag::Dataset::Make();
+    for (int i = 0; i < num_query; ++i) {
+        query->NumElements(1)->SparseVectors(sv_base.data() + i)->Owner(false);
+        auto expected = index->KnnSearch(query, k, exhaustive_param_str, nullptr);
+        auto result = index->KnnSearch(query, k, block_max_param_str, nullptr);
+        auto another_result = another_index->KnnSearch(query, k, block_max_param_str, nullptr);
+        REQUIRE(result->GetDim() == expected->GetDim());
+        for (int j = 0; j < expected->GetDim(); j++) {
+            REQUIRE(std::abs(result->GetDistances()[j] - expected->GetDistances()[j]) < 1e-5);
+            REQUIRE(std::abs(another_result->GetDistances()[j] - expected->GetDistances()[j]) <
+                    1e-5);
+        }
+
+        auto expected_range = index->RangeSearch(query, radius, exhaustive_param_str, nullptr);
+        auto range_result = index->RangeSearch(query, radius, block_max_param_str, nullptr);
+        REQUIRE(range_result->GetDim() == expected_range->GetDim());
+        std::set<int64_t> expected_ids(expected_range->GetIds(),
+                                       expected_range->GetIds() + expected_range->GetDim());
+        for (int j = 0; j < range_result->GetDim(); j++) {
+            REQUIRE(expected_ids.count(range_result->GetIds()[j]) == 1);
+        }
+    }
+
+    for (auto& item : sv_base) {
+        delete[] item.vals_;
+        delete[] item.ids_;
+    }
+}
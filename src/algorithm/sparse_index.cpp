@@ -15,6 +15,8 @@
 
 #include "sparse_index.h"
 
+#include <cmath>
+
 #include "impl/heap/standard_heap.h"
 #include "utils/util_functions.h"
 
@@ -46,6 +48,21 @@ get_distance(uint32_t len1,
     return 1 - sum;
 }
 
+// the bound is kept this much (relatively) below the distance it is compared with, so that a
+// rounding of the norms never skips a vector which would be taken
+static constexpr float DISTANCE_BOUND_SLACK = 1e-5F;
+
+static std::pair<float, float>
+get_query_norms(const Vector<float>& sorted_vals) {
+    float l2_norm = 0.0F;
+    float max_abs = 0.0F;
+    for (auto val : sorted_vals) {
+        l2_norm += val * val;
+        max_abs = std::max(max_abs, std::abs(val));
+    }
+    return {std::sqrt(l2_norm), max_abs};
+}
+
 ParamPtr
 SparseIndex::CheckAndMappingExternalParam(const JsonType& external_param,
                                           const IndexCommonParam& common_param) {
@@ -104,6 +121,7 @@ SparseIndex::Add(const DatasetPtr& base) {
             std::memcpy(data, vector.ids_, vector.len_ * sizeof(uint32_t));
             std::memcpy(data + vector.len_, vector.vals_, vector.len_ * sizeof(float));
         }
+        update_norm(i + cur_element_count_);
     }
     cur_element_count_ += data_num;
     return {};
@@ -119,7 +137,13 @@ SparseIndex::KnnSearch(const DatasetPtr& query,
     auto results = std::make_shared<StandardHeap<true, false>>(allocator_, -1);
 
     auto [sorted_ids, sorted_vals] = sort_sparse_vector(sparse_vectors[0]);
+    auto [query_l2_norm, query_max_abs] = get_query_norms(sorted_vals);
     for (int j = 0; j < cur_element_count_; ++j) {
+        // a vector whose bound is above the k-th distance would be pushed and popped at once
+        if (results->Size() == k and
+            get_distance_bound(query_l2_norm, query_max_abs, j) > results->Top().first) {
+            continue;
+        }
         auto distance = CalDistanceByIdUnsafe(sorted_ids, sorted_vals, j);
         auto label = label_table_->GetLabelById(j);
         if (not filter || filter->CheckValid(label)) {
@@ -143,7 +167,11 @@ SparseIndex::RangeSearch(const DatasetPtr& query,
     CHECK_ARGUMENT(query->GetNumElements() == 1, "num of query should be 1");
     auto results = std::make_shared<StandardHeap<true, false>>(allocator_, -1);
     auto [sorted_ids, sorted_vals] = sort_sparse_vector(sparse_vectors[0]);
+    auto [query_l2_norm, query_max_abs] = get_query_norms(sorted_vals);
     for (int j = 0; j < cur_element_count_; ++j) {
+        if (get_distance_bound(query_l2_norm, query_max_abs, j) > radius + 2e-6) {
+            continue;
+        }
         auto distance = CalDistanceByIdUnsafe(sorted_ids, sorted_vals, j);
         auto label = label_table_->GetLabelById(j);
         if ((not filter || filter->CheckValid(label)) && distance <= radius + 2e-6) {
@@ -188,4 +216,27 @@ SparseIndex::CalDistanceByIdUnsafe(Vector<uint32_t>& sorted_ids,
                         (float*)(datas_[inner_id] + 1 + datas_[inner_id][0]));
 }
 
+void
+SparseIndex::update_norm(InnerIdType inner_id) {
+    auto len = datas_[inner_id][0];
+    const auto* vals = (float*)(datas_[inner_id] + 1 + len);
+    float l2_norm = 0.0F;
+    float l1_norm = 0.0F;
+    for (uint32_t i = 0; i < len; ++i) {
+        l2_norm += vals[i] * vals[i];
+        l1_norm += std::abs(vals[i]);
+    }
+    norms_[inner_id] = {std::sqrt(l2_norm), l1_norm};
+}
+
+float
+SparseIndex::get_distance_bound(float query_l2_norm,
+                                float query_max_abs,
+                                InnerIdType inner_id) const {
+    // |<q, d>| <= |q|_2 * |d|_2 (Cauchy-Schwarz) and |<q, d>| <= max|q_i| * |d|_1
+    const auto& [l2_norm, l1_norm] = norms_[inner_id];
+    auto max_ip = std::min(query_l2_norm * l2_norm, query_max_abs * l1_norm);
+    return 1 - max_ip * (1.0F + DISTANCE_BOUND_SLACK) - DISTANCE_BOUND_SLACK;
+}
+
 }  // namespace vsag
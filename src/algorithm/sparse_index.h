@@ -31,6 +31,7 @@ public:
     explicit SparseIndex(const SparseIndexParameterPtr& param, const IndexCommonParam& common_param)
         : InnerIndexInterface(param, common_param),
           datas_(common_param.allocator_.get()),
+          norms_(common_param.allocator_.get()),
           need_sort_(param->need_sort) {
     }
 
@@ -96,6 +97,10 @@ public:
             datas_[i][0] = len;
             reader.Read((char*)(datas_[i] + 1), 2 * len * sizeof(uint32_t));
         }
+        norms_.resize(cur_element_count_);
+        for (int i = 0; i < cur_element_count_; ++i) {
+            update_norm(i);
+        }
         label_table_->Deserialize(reader);
     }
 
@@ -132,11 +137,22 @@ private:
             return;
         }
         datas_.resize(new_capacity);
+        norms_.resize(new_capacity);
         max_capacity_ = new_capacity;
     }
 
+    void
+    update_norm(InnerIdType inner_id);
+
+    [[nodiscard]] float
+    get_distance_bound(float query_l2_norm, float query_max_abs, InnerIdType inner_id) const;
+
 private:
     Vector<uint32_t*> datas_;
+
+    // the l2 and l1 norms of each vector, which bound its inner product with any query
+    Vector<std::pair<float, float>> norms_;
+
     bool need_sort_;
     int64_t cur_element_count_{0};
     int64_t max_capacity_{0};
@@ -97,6 +97,7 @@ deserialize_map(StreamReader& reader,
 
 void
 AttrValueMap::Deserialize(StreamReader& reader) {
+    this->range_index_.reset();
     deserialize_map(reader, int64_to_bitset_, allocator_, bitset_type_);
     deserialize_map(reader, int32_to_bitset_, allocator_, bitset_type_);
     deserialize_map(reader, int16_to_bitset_, allocator_, bitset_type_);
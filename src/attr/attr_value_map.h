@@ -15,7 +15,9 @@
 
 #pragma once
 #include <memory>
+#include <mutex>
 
+#include "bit_sliced_index.h"
 #include "impl/allocator/safe_allocator.h"
 #include "multi_bitset_manager.h"
 #include "storage/stream_reader.h"
@@ -44,6 +46,12 @@ public:
             map[value] = new MultiBitsetManager(allocator_, 1, this->bitset_type_);
         }
         map[value]->InsertValue(bucket_id, inner_id, true);
+        if constexpr (std::is_integral_v<T>) {
+            if (this->range_index_ != nullptr) {
+                this->range_index_->Insert(
+                    BitSlicedIndex::EncodeValue(value), inner_id, bucket_id);
+            }
+        }
     }
 
     template <class T>
@@ -57,6 +65,39 @@ public:
         return iter->second;
     }
 
+    /**
+     * @brief Ors the ids of bucket_id whose value satisfies (value op bound) into result.
+     *
+     * The first call builds a bit sliced index from the map, which later inserts and erases keep
+     * up to date. Fields holding several values per id fall back to scanning the map.
+     */
+    template <class T>
+    void
+    GetBitsetByRange(T bound,
+                     ComparisonOperator op,
+                     BucketIdType bucket_id,
+                     ComputableBitset* result) {
+        static_assert(std::is_integral_v<T>, "range query requires an integer field");
+        const auto* range_index = this->get_range_index<T>();
+        if (range_index->IsExact()) {
+            range_index->Query(BitSlicedIndex::EncodeValue(bound), op, bucket_id, result);
+            return;
+        }
+        for (const auto& [key, manager] : this->get_map_by_type<T>()) {
+            bool matched = (op == ComparisonOperator::GT and key > bound) or
+                           (op == ComparisonOperator::GE and key >= bound) or
+                           (op == ComparisonOperator::LT and key < bound) or
+                           (op == ComparisonOperator::LE and key <= bound);
+            if (not matched or manager == nullptr) {
+                continue;
+            }
+            auto* bitset = manager->GetOneBitset(bucket_id);
+            if (bitset != nullptr) {
+                result->Or(bitset);
+            }
+        }
+    }
+
     template <class T>
     void
     Erase(InnerIdType inner_id, BucketIdType bucket_id = 0) {
@@ -69,6 +110,9 @@ public:
                 }
             }
         }
+        if (this->range_index_ != nullptr) {
+            this->range_index_->Erase(inner_id, bucket_id);
+        }
     }
 
     template <class T>
@@ -89,6 +133,9 @@ public:
                 }
             }
         }
+        if (this->range_index_ != nullptr) {
+            this->range_index_->Erase(inner_id, bucket_id);
+        }
     }
 
     void
@@ -98,6 +145,30 @@ public:
     Deserialize(StreamReader& reader);
 
 private:
+    template <class T>
+    const BitSlicedIndex*
+    get_range_index() {
+        std::lock_guard lock(this->range_index_mutex_);
+        if (this->range_index_ == nullptr) {
+            auto range_index =
+                std::make_unique<BitSlicedIndex>(allocator_, sizeof(T) * 8, this->bitset_type_);
+            for (const auto& [key, manager] : this->get_map_by_type<T>()) {
+                if (manager == nullptr) {
+                    continue;
+                }
+                auto code = BitSlicedIndex::EncodeValue(key);
+                for (uint64_t bucket_id = 0; bucket_id < manager->GetCount(); ++bucket_id) {
+                    const auto* bitset = manager->GetOneBitset(bucket_id);
+                    if (bitset != nullptr) {
+                        range_index->InsertBitset(code, *bitset, bucket_id);
+                    }
+                }
+            }
+            this->range_index_ = std::move(range_index);
+        }
+        return this->range_index_.get();
+    }
+
     template <class T>
     UnorderedMap<T, MultiBitsetManager*>&
     get_map_by_type() {
@@ -136,5 +207,10 @@ private:
     Allocator* const allocator_{nullptr};
 
     const ComputableBitsetType bitset_type_{ComputableBitsetType::SparseBitset};
+
+    /// built by the first range query, null until then
+    BitSlicedIndexPtr range_index_{nullptr};
+
+    std::mutex range_index_mutex_;
 };
 }  // namespace vsag
@@ -75,3 +75,32 @@ TEST_CASE("AttrValueMap Basic Test", "[ut][AttrValueMap]") {
     TestAttrValueMap<uint8_t>();
     TestAttrValueMap<std::string>();
 }
+
+TEST_CASE("AttrValueMap Range Test", "[ut][AttrValueMap]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto type = GENERATE(ComputableBitsetType::SparseBitset, ComputableBitsetType::FastBitset);
+    AttrValueMap map(allocator.get(), type);
+    for (InnerIdType id = 0; id < 100; ++id) {
+        map.Insert(static_cast<int16_t>(id - 50), id);
+    }
+
+    auto check = [&](ComparisonOperator op, int16_t bound, uint64_t expected_count) {
+        auto result = ComputableBitset::MakeInstance(type, allocator.get());
+        map.GetBitsetByRange(bound, op, 0, result.get());
+        REQUIRE(result->Count() == expected_count);
+    };
+    check(ComparisonOperator::GT, 10, 39);
+    check(ComparisonOperator::GE, -50, 100);
+    check(ComparisonOperator::LT, -49, 1);
+
+    // updates after the range index is built are visible to later queries
+    map.Erase<int16_t>(0);
+    map.Insert(static_cast<int16_t>(40), 0);
+    check(ComparisonOperator::GT, 10, 40);
+    check(ComparisonOperator::LE, -49, 1);
+
+    // a multi-valued id switches to scanning the value map
+    map.Insert(static_cast<int16_t>(-100), 1);
+    check(ComparisonOperator::LT, -60, 1);
+    check(ComparisonOperator::GT, 10, 40);
+}
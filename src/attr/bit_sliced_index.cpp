@@ -0,0 +1,157 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "bit_sliced_index.h"
+
+#include "vsag_exception.h"
+
+namespace vsag {
+
+static ComputableBitset*
+get_or_create_bitset(MultiBitsetManager* manager, BucketIdType bucket_id) {
+    auto* bitset = manager->GetOneBitset(bucket_id);
+    if (bitset == nullptr) {
+        manager->InsertValue(bucket_id, 0, false);
+        bitset = manager->GetOneBitset(bucket_id);
+    }
+    return bitset;
+}
+
+BitSlicedIndex::BitSlicedIndex(Allocator* allocator,
+                               uint32_t bit_width,
+                               ComputableBitsetType bitset_type)
+    : allocator_(allocator), bit_width_(bit_width), bitset_type_(bitset_type) {
+    if (bit_width == 0 or bit_width > 64) {
+        throw VsagException(ErrorType::INTERNAL_ERROR, "invalid bit width for bit sliced index");
+    }
+    this->exist_ = std::make_unique<MultiBitsetManager>(allocator, 1, bitset_type);
+    this->slices_.reserve(bit_width);
+    for (uint32_t i = 0; i < bit_width; ++i) {
+        this->slices_.emplace_back(
+            std::make_unique<MultiBitsetManager>(allocator, 1, bitset_type));
+    }
+}
+
+void
+BitSlicedIndex::Insert(uint64_t code, InnerIdType inner_id, BucketIdType bucket_id) {
+    if (this->multi_value_) {
+        return;
+    }
+    auto* exist = this->exist_->GetOneBitset(bucket_id);
+    if (exist != nullptr and exist->Test(inner_id)) {
+        this->multi_value_ = true;
+        return;
+    }
+    this->exist_->InsertValue(bucket_id, inner_id, true);
+    for (uint32_t i = 0; i < bit_width_; ++i) {
+        if ((code >> i) & 1ULL) {
+            this->slices_[i]->InsertValue(bucket_id, inner_id, true);
+        }
+    }
+}
+
+void
+BitSlicedIndex::InsertBitset(uint64_t code, const ComputableBitset& ids, BucketIdType bucket_id) {
+    if (this->multi_value_) {
+        return;
+    }
+    auto* exist = get_or_create_bitset(this->exist_.get(), bucket_id);
+    auto overlap = this->copy_bitset(&ids);
+    overlap->And(*exist);
+    if (overlap->Count() > 0) {
+        this->multi_value_ = true;
+        return;
+    }
+    exist->Or(ids);
+    for (uint32_t i = 0; i < bit_width_; ++i) {
+        if ((code >> i) & 1ULL) {
+            get_or_create_bitset(this->slices_[i].get(), bucket_id)->Or(ids);
+        }
+    }
+}
+
+void
+BitSlicedIndex::Erase(InnerIdType inner_id, BucketIdType bucket_id) {
+    auto* exist = this->exist_->GetOneBitset(bucket_id);
+    if (exist == nullptr) {
+        return;
+    }
+    exist->Set(inner_id, false);
+    for (const auto& slice : this->slices_) {
+        auto* bitset = slice->GetOneBitset(bucket_id);
+        if (bitset != nullptr) {
+            bitset->Set(inner_id, false);
+        }
+    }
+}
+
+void
+BitSlicedIndex::Query(uint64_t code,
+                      ComparisonOperator op,
+                      BucketIdType bucket_id,
+                      ComputableBitset* result) const {
+    if (op == ComparisonOperator::EQ or op == ComparisonOperator::NE) {
+        throw VsagException(ErrorType::INTERNAL_ERROR, "bit sliced index only answers ranges");
+    }
+    const auto* exist = this->exist_->GetOneBitset(bucket_id);
+    if (exist == nullptr) {
+        return;
+    }
+    bool greater = (op == ComparisonOperator::GT or op == ComparisonOperator::GE);
+    bool with_equal = (op == ComparisonOperator::GE or op == ComparisonOperator::LE);
+
+    // walk the code from the highest bit, equal holds the ids whose prefix matches code so far;
+    // an id leaves equal at the first differing bit and is greater or less depending on it
+    auto equal = this->copy_bitset(exist);
+    auto branch = ComputableBitset::MakeInstance(bitset_type_, allocator_);
+    for (int64_t i = static_cast<int64_t>(bit_width_) - 1; i >= 0; --i) {
+        const auto* slice = this->slices_[i]->GetOneBitset(bucket_id);
+        if ((code >> i) & 1ULL) {
+            if (not greater) {
+                branch->Clear();
+                branch->Or(*equal);
+                if (slice != nullptr) {
+                    branch->AndNot(*slice);
+                }
+                result->Or(*branch);
+            }
+            if (slice == nullptr) {
+                equal->Clear();
+                break;
+            }
+            equal->And(*slice);
+        } else if (slice != nullptr) {
+            if (greater) {
+                branch->Clear();
+                branch->Or(*equal);
+                branch->And(*slice);
+                result->Or(*branch);
+            }
+            equal->AndNot(*slice);
+        }
+    }
+    if (with_equal) {
+        result->Or(*equal);
+    }
+}
+
+ComputableBitsetPtr
+BitSlicedIndex::copy_bitset(const ComputableBitset* source) const {
+    auto bitset = ComputableBitset::MakeInstance(bitset_type_, allocator_);
+    bitset->Or(*source);
+    return bitset;
+}
+
+}  // namespace vsag
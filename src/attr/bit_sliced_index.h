@@ -0,0 +1,119 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "expression.h"
+#include "multi_bitset_manager.h"
+#include "typing.h"
+
+namespace vsag {
+
+class BitSlicedIndex;
+using BitSlicedIndexPtr = std::unique_ptr<BitSlicedIndex>;
+
+/**
+ * @class BitSlicedIndex
+ * @brief Answers range predicates over one integer attribute field.
+ *
+ * Values are stored as order-preserving unsigned codes (see EncodeValue). Slice b holds the
+ * ids whose code has bit b set, so a comparison against a constant is resolved with a fixed
+ * number of bitset operations per code bit instead of one Or per distinct value in the range.
+ * The index is only exact when each id holds at most one value of the field; once an id with
+ * several values is seen, IsExact() turns false and callers must fall back to the value map.
+ */
+class BitSlicedIndex {
+public:
+    /**
+     * @brief Maps an integer value to an unsigned code with the same ordering.
+     *
+     * @tparam T The integer type of the attribute field.
+     * @param value The value to encode.
+     * @return The code, signed types have their sign bit flipped.
+     */
+    template <class T>
+    static uint64_t
+    EncodeValue(T value) {
+        using UnsignedType = std::make_unsigned_t<T>;
+        auto code = static_cast<uint64_t>(static_cast<UnsignedType>(value));
+        if constexpr (std::is_signed_v<T>) {
+            code ^= 1ULL << (sizeof(T) * 8 - 1);
+        }
+        return code;
+    }
+
+public:
+    BitSlicedIndex(Allocator* allocator, uint32_t bit_width, ComputableBitsetType bitset_type);
+
+    /**
+     * @brief Adds a (code, inner_id) pair in the given bucket.
+     */
+    void
+    Insert(uint64_t code, InnerIdType inner_id, BucketIdType bucket_id);
+
+    /**
+     * @brief Adds every id of a value bitset in the given bucket, used to build from a value map.
+     */
+    void
+    InsertBitset(uint64_t code, const ComputableBitset& ids, BucketIdType bucket_id);
+
+    /**
+     * @brief Removes inner_id from the given bucket.
+     */
+    void
+    Erase(InnerIdType inner_id, BucketIdType bucket_id);
+
+    /**
+     * @brief Ors the ids whose value satisfies (value op code) in the given bucket into result.
+     *
+     * @param code The encoded constant on the right side of the comparison.
+     * @param op One of GT, GE, LT and LE.
+     * @param bucket_id The bucket to query.
+     * @param result The bitset receiving matched ids, must share the bitset type of the index.
+     */
+    void
+    Query(uint64_t code,
+          ComparisonOperator op,
+          BucketIdType bucket_id,
+          ComputableBitset* result) const;
+
+    [[nodiscard]] bool
+    IsExact() const {
+        return not this->multi_value_;
+    }
+
+private:
+    ComputableBitsetPtr
+    copy_bitset(const ComputableBitset* source) const;
+
+private:
+    Allocator* const allocator_{nullptr};
+
+    const uint32_t bit_width_{0};
+
+    const ComputableBitsetType bitset_type_{ComputableBitsetType::FastBitset};
+
+    /// ids holding any value, per bucket
+    std::unique_ptr<MultiBitsetManager> exist_;
+
+    /// slices_[b] holds the ids whose code has bit b set, per bucket
+    std::vector<std::unique_ptr<MultiBitsetManager>> slices_;
+
+    bool multi_value_{false};
+};
+
+}  // namespace vsag
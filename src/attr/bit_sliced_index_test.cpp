@@ -0,0 +1,96 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "bit_sliced_index.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <random>
+
+#include "impl/allocator/safe_allocator.h"
+
+using namespace vsag;
+
+static bool
+compare(int32_t value, ComparisonOperator op, int32_t bound) {
+    switch (op) {
+        case ComparisonOperator::GT:
+            return value > bound;
+        case ComparisonOperator::GE:
+            return value >= bound;
+        case ComparisonOperator::LT:
+            return value < bound;
+        case ComparisonOperator::LE:
+            return value <= bound;
+        default:
+            return false;
+    }
+}
+
+TEST_CASE("BitSlicedIndex Range Query", "[ut][BitSlicedIndex]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto type = GENERATE(ComputableBitsetType::SparseBitset, ComputableBitsetType::FastBitset);
+    BitSlicedIndex index(allocator.get(), 32, type);
+
+    constexpr int64_t count = 500;
+    constexpr BucketIdType bucket_count = 2;
+    std::mt19937 gen(47);
+    std::uniform_int_distribution<int32_t> dist(-300, 300);
+    std::vector<int32_t> values(count);
+    for (int64_t i = 0; i < count; ++i) {
+        values[i] = dist(gen);
+        index.Insert(BitSlicedIndex::EncodeValue(values[i]), i, i % bucket_count);
+    }
+    REQUIRE(index.IsExact());
+
+    // erased ids must never match again
+    for (int64_t i = 0; i < count; i += 7) {
+        index.Erase(i, i % bucket_count);
+    }
+
+    const std::vector<ComparisonOperator> ops = {ComparisonOperator::GT,
+                                                 ComparisonOperator::GE,
+                                                 ComparisonOperator::LT,
+                                                 ComparisonOperator::LE};
+    const std::vector<int32_t> bounds = {-301, -300, -1, 0, 1, values[1], 300, 301};
+    for (auto op : ops) {
+        for (auto bound : bounds) {
+            for (BucketIdType bucket = 0; bucket < bucket_count; ++bucket) {
+                auto result = ComputableBitset::MakeInstance(type, allocator.get());
+                index.Query(BitSlicedIndex::EncodeValue(bound), op, bucket, result.get());
+                for (int64_t i = 0; i < count; ++i) {
+                    bool expected =
+                        i % bucket_count == bucket and i % 7 != 0 and compare(values[i], op, bound);
+                    REQUIRE(result->Test(i) == expected);
+                }
+            }
+        }
+    }
+    auto result = ComputableBitset::MakeInstance(type, allocator.get());
+    REQUIRE_THROWS(index.Query(0, ComparisonOperator::EQ, 0, result.get()));
+
+    // a second value for the same id makes the index inexact
+    index.Insert(BitSlicedIndex::EncodeValue(5), 1, 1);
+    REQUIRE_FALSE(index.IsExact());
+}
+
+TEST_CASE("BitSlicedIndex Encode Order", "[ut][BitSlicedIndex]") {
+    REQUIRE(BitSlicedIndex::EncodeValue<int8_t>(-128) < BitSlicedIndex::EncodeValue<int8_t>(-1));
+    REQUIRE(BitSlicedIndex::EncodeValue<int8_t>(-1) < BitSlicedIndex::EncodeValue<int8_t>(0));
+    REQUIRE(BitSlicedIndex::EncodeValue<int8_t>(127) == 255);
+    REQUIRE(BitSlicedIndex::EncodeValue<int64_t>(std::numeric_limits<int64_t>::min()) == 0);
+    REQUIRE(BitSlicedIndex::EncodeValue<uint64_t>(std::numeric_limits<uint64_t>::max()) ==
+            std::numeric_limits<uint64_t>::max());
+}
@@ -96,7 +96,14 @@ ComparisonExecutor::Clear() {
 Filter*
 ComparisonExecutor::Run(BucketIdType bucket_id) {
     if (this->op_ != ComparisonOperator::EQ and this->op_ != ComparisonOperator::NE) {
-        throw VsagException(ErrorType::INTERNAL_ERROR, "unsupported comparison operator");
+        if (this->filter_attribute_->GetValueType() == AttrValueType::STRING) {
+            throw VsagException(ErrorType::INTERNAL_ERROR, "unsupported comparison operator");
+        }
+        this->attr_index_->GetBitsetsByRange(
+            *this->filter_attribute_, this->op_, bucket_id, this->bitset_);
+        this->only_bitset_ = true;
+        WhiteListFilter::TryToUpdate(this->filter_, this->bitset_);
+        return this->filter_;
     }
 
     for (const auto* manager : managers_) {
@@ -116,6 +123,7 @@ ComparisonExecutor::Run(BucketIdType bucket_id) {
             WhiteListFilter::TryToUpdate(this->filter_, this->bitset_);
         } else {
             this->only_bitset_ = false;
+            delete this->filter_;
             this->filter_ = new BlackListFilter(this->bitset_);
         }
     }
@@ -128,7 +136,9 @@ ComparisonExecutor::Init() {
         this->bitset_ = ComputableBitset::MakeRawInstance(this->bitset_type_, this->allocator_);
         this->own_bitset_ = true;
     }
-    this->managers_ = this->attr_index_->GetBitsetsByAttr(*this->filter_attribute_);
+    if (this->op_ == ComparisonOperator::EQ or this->op_ == ComparisonOperator::NE) {
+        this->managers_ = this->attr_index_->GetBitsetsByAttr(*this->filter_attribute_);
+    }
 }
 
 }  // namespace vsag
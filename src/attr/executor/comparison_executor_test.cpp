@@ -15,6 +15,7 @@
 
 #include "comparison_executor.h"
 
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 
 #include "attr/argparse.h"
@@ -48,13 +49,21 @@ TestAttributeWithoutBucket(const std::string& name,
         REQUIRE(filter->CheckValid(index) == false);
 
         if constexpr (not std::is_same_v<std::string, T>) {
-            const std::vector<std::string> unsupported_ops = {" > ", " < ", " <= ", " >= "};
-            for (auto& op : unsupported_ops) {
+            // a multi-valued field matches a range when any of its values does
+            auto [min_iter, max_iter] = std::minmax_element(values.begin(), values.end());
+            const std::vector<std::pair<std::string, bool>> range_ops = {
+                {" > ", *max_iter > value},
+                {" < ", *min_iter < value},
+                {" <= ", true},
+                {" >= ", true},
+            };
+            for (const auto& [op, expected] : range_ops) {
                 query = CreateOtherString(name, value, op);
                 expr = AstParse(query);
                 executor = std::make_shared<ComparisonExecutor>(allocator, expr, sparse_attr_index);
                 executor->Init();
-                REQUIRE_THROWS(executor->Run());
+                filter = executor->Run();
+                REQUIRE(filter->CheckValid(index) == expected);
             }
         }
     }
@@ -189,13 +198,21 @@ TestAttributeWithBucket(const std::string& name,
         REQUIRE(filter->CheckValid(index) == false);
 
         if constexpr (not std::is_same_v<std::string, T>) {
-            const std::vector<std::string> unsupported_ops = {" > ", " < ", " <= ", " >= "};
-            for (auto& op : unsupported_ops) {
+            // a multi-valued field matches a range when any of its values does
+            auto [min_iter, max_iter] = std::minmax_element(values.begin(), values.end());
+            const std::vector<std::pair<std::string, bool>> range_ops = {
+                {" > ", *max_iter > value},
+                {" < ", *min_iter < value},
+                {" <= ", true},
+                {" >= ", true},
+            };
+            for (const auto& [op, expected] : range_ops) {
                 query = CreateOtherString(name, value, op);
                 expr = AstParse(query);
                 executor = std::make_shared<ComparisonExecutor>(allocator, expr, sparse_attr_index);
                 executor->Init();
-                REQUIRE_THROWS(executor->Run(index % 2));
+                filter = executor->Run(index % 2);
+                REQUIRE(filter->CheckValid(index) == expected);
             }
         }
     }
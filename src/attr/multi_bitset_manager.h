@@ -107,6 +107,14 @@ public:
     void
     Deserialize(lvalue_or_rvalue<StreamReader> reader);
 
+    /**
+     * @brief Returns the number of ids addressable by GetOneBitset.
+     */
+    uint64_t
+    GetCount() const {
+        return this->count_;
+    }
+
     ComputableBitsetType
     GetBitsetType() const {
         return this->bitset_type_;
@@ -149,18 +149,26 @@ const char* const HGRAPH_BUILD_EF_CONSTRUCTION = "ef_construction";
 const char* const HGRAPH_INIT_CAPACITY = "hgraph_init_capacity";
 const char* const HGRAPH_GRAPH_TYPE = "graph_type";
 const char* const HGRAPH_GRAPH_STORAGE_TYPE = "graph_storage_type";
+const char* const HGRAPH_GRAPH_IO_TYPE = "graph_io_type";
+const char* const HGRAPH_GRAPH_FILE_PATH = "graph_file_path";
+const char* const HGRAPH_GRAPH_SECTOR_SIZE = "graph_sector_size";
 const char* const HGRAPH_BUILD_THREAD_COUNT = "build_thread_count";
+const char* const HGRAPH_BUILD_BATCH_SIZE = "build_batch_size";
+const char* const HGRAPH_BUILD_CHECKPOINT_INTERVAL = "build_checkpoint_interval";
 const char* const HGRAPH_PRECISE_QUANTIZATION_TYPE = "precise_quantization_type";
 const char* const HGRAPH_BASE_IO_TYPE = "base_io_type";
 const char* const HGRAPH_BASE_PQ_DIM = "base_pq_dim";
 const char* const HGRAPH_BASE_FILE_PATH = "base_file_path";
 const char* const HGRAPH_PRECISE_IO_TYPE = "precise_io_type";
 const char* const HGRAPH_PRECISE_FILE_PATH = "precise_file_path";
+const char* const HGRAPH_PRECISE_CACHE_SIZE = "precise_cache_size";
 const char* const HGRAPH_PARAMETER_EF_RUNTIME = "ef_search";
 const char* const HGRAPH_EXTRA_INFO_SIZE = "extra_info_size";
 const char* const HGRAPH_SUPPORT_DUPLICATE = "support_duplicate";
 const char* const HGRAPH_USE_EXTRA_INFO_FILTER = "use_extra_info_filter";
 const char* const HGRAPH_STORE_RAW_VECTOR = "store_raw_vector";
+const char* const HGRAPH_VISITED_LIST_TYPE = "visited_list_type";
+const char* const HGRAPH_REMOVE_COMPACTION_RATIO = "remove_compaction_ratio";
 
 const char* const BRUTE_FORCE_QUANTIZATION_TYPE = "quantization_type";
 const char* const BRUTE_FORCE_IO_TYPE = "io_type";
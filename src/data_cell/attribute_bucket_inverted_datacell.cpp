@@ -133,6 +133,20 @@ get_bitsets_by_type(const ValueMapPtr& value_map,
     }
 }
 
+template <class T>
+static void
+get_bitsets_by_range(const ValueMapPtr& value_map,
+                     const Attribute* attr,
+                     ComparisonOperator op,
+                     BucketIdType bucket_id,
+                     ComputableBitset* result) {
+    auto* attr_value = dynamic_cast<const AttributeValue<T>*>(attr);
+    if (attr_value == nullptr or attr_value->GetValue().size() != 1) {
+        throw VsagException(ErrorType::INTERNAL_ERROR, "Invalid attribute type");
+    }
+    value_map->GetBitsetByRange(attr_value->GetValue()[0], op, bucket_id, result);
+}
+
 void
 AttributeBucketInvertedDataCell::Insert(const AttributeSet& attr_set,
                                         InnerIdType inner_id,
@@ -187,6 +201,39 @@ AttributeBucketInvertedDataCell::GetBitsetsByAttr(const Attribute& attr) {
     return std::move(bitsets);
 }
 
+void
+AttributeBucketInvertedDataCell::GetBitsetsByRange(const Attribute& attr,
+                                                   ComparisonOperator op,
+                                                   BucketIdType bucket_id,
+                                                   ComputableBitset* result) {
+    std::shared_lock lock(this->global_mutex_);
+    auto iter = field_2_value_map_.find(attr.name_);
+    if (iter == field_2_value_map_.end()) {
+        return;
+    }
+    const auto& value_map = iter->second;
+    auto value_type = attr.GetValueType();
+    if (value_type == AttrValueType::INT32) {
+        get_bitsets_by_range<int32_t>(value_map, &attr, op, bucket_id, result);
+    } else if (value_type == AttrValueType::INT64) {
+        get_bitsets_by_range<int64_t>(value_map, &attr, op, bucket_id, result);
+    } else if (value_type == AttrValueType::INT16) {
+        get_bitsets_by_range<int16_t>(value_map, &attr, op, bucket_id, result);
+    } else if (value_type == AttrValueType::INT8) {
+        get_bitsets_by_range<int8_t>(value_map, &attr, op, bucket_id, result);
+    } else if (value_type == AttrValueType::UINT32) {
+        get_bitsets_by_range<uint32_t>(value_map, &attr, op, bucket_id, result);
+    } else if (value_type == AttrValueType::UINT64) {
+        get_bitsets_by_range<uint64_t>(value_map, &attr, op, bucket_id, result);
+    } else if (value_type == AttrValueType::UINT16) {
+        get_bitsets_by_range<uint16_t>(value_map, &attr, op, bucket_id, result);
+    } else if (value_type == AttrValueType::UINT8) {
+        get_bitsets_by_range<uint8_t>(value_map, &attr, op, bucket_id, result);
+    } else {
+        throw VsagException(ErrorType::INTERNAL_ERROR, "Unsupported value type for range");
+    }
+}
+
 void
 AttributeBucketInvertedDataCell::Serialize(StreamWriter& writer) {
     AttributeInvertedInterface::Serialize(writer);
@@ -38,6 +38,12 @@ public:
     std::vector<const MultiBitsetManager*>
     GetBitsetsByAttr(const Attribute& attr) override;
 
+    void
+    GetBitsetsByRange(const Attribute& attr,
+                      ComparisonOperator op,
+                      BucketIdType bucket_id,
+                      ComputableBitset* result) override;
+
     void
     UpdateBitsetsByAttr(const AttributeSet& attributes,
                         const InnerIdType offset_id,
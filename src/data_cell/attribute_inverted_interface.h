@@ -18,6 +18,7 @@
 #include <memory>
 
 #include "attr/attr_type_schema.h"
+#include "attr/expression.h"
 #include "attr/multi_bitset_manager.h"
 #include "storage/stream_reader.h"
 #include "storage/stream_writer.h"
@@ -51,6 +52,16 @@ public:
     virtual std::vector<const MultiBitsetManager*>
     GetBitsetsByAttr(const Attribute& attr) = 0;
 
+    /**
+     * @brief Ors the ids of bucket_id matching (field op value) into result, where attr carries
+     *        the field name and a single integer value, and op is one of GT, GE, LT and LE.
+     */
+    virtual void
+    GetBitsetsByRange(const Attribute& attr,
+                      ComparisonOperator op,
+                      BucketIdType bucket_id,
+                      ComputableBitset* result) = 0;
+
     virtual void
     UpdateBitsetsByAttr(const AttributeSet& attributes,
                         const InnerIdType offset_id,
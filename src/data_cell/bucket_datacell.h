@@ -38,7 +38,18 @@ public:
                    const ComputerInterfacePtr& computer,
                    const BucketIdType& bucket_id) override {
         auto comp = std::static_pointer_cast<Computer<QuantTmpl>>(computer);
-        return this->scan_bucket_by_id(result_dists, comp, bucket_id);
+        return this->scan_bucket_by_id(
+            result_dists, comp, bucket_id, 0, std::numeric_limits<InnerIdType>::max());
+    }
+
+    void
+    ScanBucketById(float* result_dists,
+                   const ComputerInterfacePtr& computer,
+                   const BucketIdType& bucket_id,
+                   InnerIdType start,
+                   InnerIdType count) override {
+        auto comp = std::static_pointer_cast<Computer<QuantTmpl>>(computer);
+        return this->scan_bucket_by_id(result_dists, comp, bucket_id, start, count);
     }
 
     float
@@ -126,7 +137,9 @@ private:
     inline void
     scan_bucket_by_id(float* result_dists,
                       const std::shared_ptr<Computer<QuantTmpl>>& computer,
-                      const BucketIdType& bucket_id);
+                      const BucketIdType& bucket_id,
+                      InnerIdType start,
+                      InnerIdType count);
 
     inline float
     query_one_by_id(const std::shared_ptr<Computer<QuantTmpl>>& computer,
@@ -212,20 +225,35 @@ void
 BucketDataCell<QuantTmpl, IOTmpl>::scan_bucket_by_id(
     float* result_dists,
     const std::shared_ptr<Computer<QuantTmpl>>& computer,
-    const BucketIdType& bucket_id) {
+    const BucketIdType& bucket_id,
+    InnerIdType start,
+    InnerIdType count) {
     if (bucket_id >= this->bucket_count_ or bucket_id < 0) {
         throw VsagException(ErrorType::INTERNAL_ERROR, "visited invalid bucket id");
     }
     std::shared_lock lock(this->bucket_mutexes_[bucket_id]);
+    // the fastscan codes are packed by blocks of scan_block_size
     constexpr InnerIdType scan_block_size = 32;
-    InnerIdType offset = 0;
+    if (start % scan_block_size != 0) {
+        throw VsagException(
+            ErrorType::INTERNAL_ERROR,
+            fmt::format("scan start({}) must be aligned to {}", start, scan_block_size));
+    }
     this->check_valid_bucket_id(bucket_id);
-    auto data_count = this->bucket_sizes_[bucket_id];
+    auto bucket_size = this->bucket_sizes_[bucket_id];
+    if (start >= bucket_size) {
+        return;
+    }
+    auto data_count = std::min(count, bucket_size - start);
+    auto total_count = data_count;
+    InnerIdType offset = 0;
     while (data_count > 0) {
         auto compute_count = std::min(data_count, scan_block_size);
         bool need_release = false;
         const auto* codes = this->datas_[bucket_id]->Read(
-            code_size_ * compute_count, offset * code_size_, need_release);
+            code_size_ * compute_count,
+            static_cast<uint64_t>(start + offset) * code_size_,
+            need_release);
         computer->ScanBatchDists(compute_count, codes, result_dists + offset);
         if (need_release) {
             this->datas_[bucket_id]->Release(codes);
@@ -234,7 +262,7 @@ BucketDataCell<QuantTmpl, IOTmpl>::scan_bucket_by_id(
         offset += compute_count;
     }
     if (use_residual_ && this->quantizer_->Metric() == MetricType::METRIC_TYPE_L2SQR) {
-        FP32Sub(result_dists, residual_bias_[bucket_id].data(), result_dists, offset);
+        FP32Sub(result_dists, residual_bias_[bucket_id].data() + start, result_dists, total_count);
     }
 }
 
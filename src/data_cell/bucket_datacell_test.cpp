@@ -84,10 +84,19 @@ BucketInterfaceTest::BasicTest(int64_t dim, uint64_t base_count, float error) {
                 auto point_dist = bucket_->QueryOneById(computer, bucket_id, j);
                 REQUIRE(point_dist == dist[j]);
             }
+            // Test ScanBucketById over a range, the count is clamped to the bucket size
+            if (bucket_size > 32) {
+                std::vector<float> range_dists(bucket_size - 32);
+                bucket_->ScanBucketById(range_dists.data(), computer, bucket_id, 32, bucket_size);
+                for (int64_t j = 32; j < bucket_size; ++j) {
+                    REQUIRE(range_dists[j - 32] == dist[j]);
+                }
+            }
             dist += bucket_size;
         }
         // exceptions
         REQUIRE_THROWS(bucket_->ScanBucketById(dist, computer, bucket_count * 2));
+        REQUIRE_THROWS(bucket_->ScanBucketById(dist, computer, 0, 1, 1));
         REQUIRE_THROWS(bucket_->QueryOneById(computer, bucket_count * 2, 0));
         REQUIRE_THROWS(bucket_->QueryOneById(computer, 0, 10000));
     }
@@ -47,6 +47,9 @@ make_instance(const BucketDataCellParamPtr& param, const IndexCommonParam& commo
     if (quantization_string == QUANTIZATION_TYPE_VALUE_FP32) {
         return make_instance<FP32Quantizer<metric>, IOTemp>(param, common_param);
     }
+    if (quantization_string == QUANTIZATION_TYPE_VALUE_INT8) {
+        return make_instance<INT8Quantizer<metric>, IOTemp>(param, common_param);
+    }
     if (quantization_string == QUANTIZATION_TYPE_VALUE_SQ4) {
         return make_instance<SQ4Quantizer<metric>, IOTemp>(param, common_param);
     }
@@ -41,6 +41,14 @@ public:
                    const ComputerInterfacePtr& computer,
                    const BucketIdType& bucket_id) = 0;
 
+    // scan the codes [start, start + count) of a bucket, start must be a multiple of 32
+    virtual void
+    ScanBucketById(float* result_dists,
+                   const ComputerInterfacePtr& computer,
+                   const BucketIdType& bucket_id,
+                   InnerIdType start,
+                   InnerIdType count) = 0;
+
     virtual float
     QueryOneById(const ComputerInterfacePtr& computer,
                  const BucketIdType& bucket_id,
@@ -0,0 +1,222 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "code_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "vsag_exception.h"
+
+namespace vsag {
+
+static constexpr uint64_t MAX_SHARD_COUNT = 16;
+static constexpr InnerIdType INVALID_SLOT_ID = std::numeric_limits<InnerIdType>::max();
+static constexpr uint8_t MAX_FREQUENCY = 15;
+// the counters are halved after this many lookups per slot, so old popularity fades out
+static constexpr uint64_t FREQUENCY_AGING_FACTOR = 10;
+
+static uint64_t
+hash_id(InnerIdType id) {
+    return (static_cast<uint64_t>(id) + 1) * 0x9E3779B97F4A7C15ULL;
+}
+
+CodeCache::CodeCache(uint64_t capacity, uint32_t code_size, Allocator* allocator)
+    : allocator_(allocator), capacity_(capacity), code_size_(code_size) {
+    if (capacity == 0 or code_size == 0) {
+        throw VsagException(ErrorType::INVALID_ARGUMENT,
+                            "code cache requires a positive capacity and code size");
+    }
+    auto shard_count = std::min(MAX_SHARD_COUNT, capacity);
+    this->shards_.reserve(shard_count);
+    for (uint64_t i = 0; i < shard_count; ++i) {
+        auto slot_count = capacity / shard_count + (i < capacity % shard_count ? 1 : 0);
+        auto shard = std::make_unique<Shard>(allocator);
+        shard->slot_ids.resize(slot_count, INVALID_SLOT_ID);
+        shard->referenced.resize(slot_count, 0);
+        shard->slot_of.reserve(slot_count);
+        shard->codes = static_cast<uint8_t*>(allocator->Allocate(slot_count * code_size));
+        uint64_t frequency_size = 64;
+        while (frequency_size < slot_count * 4) {
+            frequency_size <<= 1;
+        }
+        shard->frequency.resize(frequency_size, 0);
+        shard->versions.resize(frequency_size, 0);
+        this->shards_.emplace_back(std::move(shard));
+    }
+}
+
+CodeCache::~CodeCache() {
+    for (auto& shard : this->shards_) {
+        this->allocator_->Deallocate(shard->codes);
+        shard->codes = nullptr;
+    }
+}
+
+bool
+CodeCache::Get(InnerIdType id, uint8_t* codes, uint32_t* version) {
+    auto& shard = this->shard_of(id);
+    std::lock_guard lock(shard.mutex);
+    this->record(shard, id);
+    auto iter = shard.slot_of.find(id);
+    if (iter == shard.slot_of.end()) {
+        this->miss_count_.fetch_add(1, std::memory_order_relaxed);
+        if (version != nullptr) {
+            *version = this->version_of(shard, id);
+        }
+        return false;
+    }
+    auto slot = iter->second;
+    shard.referenced[slot] = 1;
+    std::memcpy(codes, shard.codes + static_cast<uint64_t>(slot) * code_size_, code_size_);
+    this->hit_count_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+uint32_t
+CodeCache::Version(InnerIdType id) {
+    auto& shard = this->shard_of(id);
+    std::lock_guard lock(shard.mutex);
+    return this->version_of(shard, id);
+}
+
+void
+CodeCache::Put(InnerIdType id, const uint8_t* codes, uint32_t version) {
+    auto& shard = this->shard_of(id);
+    std::lock_guard lock(shard.mutex);
+    if (this->version_of(shard, id) != version) {
+        return;
+    }
+    this->insert(shard, id, codes, false);
+}
+
+void
+CodeCache::Pin(InnerIdType id, const uint8_t* codes, uint32_t version) {
+    auto& shard = this->shard_of(id);
+    std::lock_guard lock(shard.mutex);
+    this->record(shard, id);
+    if (this->version_of(shard, id) != version) {
+        return;
+    }
+    this->insert(shard, id, codes, true);
+}
+
+void
+CodeCache::Erase(InnerIdType id) {
+    auto& shard = this->shard_of(id);
+    std::lock_guard lock(shard.mutex);
+    // the code being read by a search before this erase is stale, its put is rejected
+    shard.versions[hash_id(id) & (shard.versions.size() - 1)]++;
+    auto iter = shard.slot_of.find(id);
+    if (iter == shard.slot_of.end()) {
+        return;
+    }
+    // the freed slot is the first one the hand takes on its next sweep
+    shard.slot_ids[iter->second] = INVALID_SLOT_ID;
+    shard.referenced[iter->second] = 0;
+    shard.slot_of.erase(iter);
+    shard.used--;
+}
+
+void
+CodeCache::Clear() {
+    for (auto& shard : this->shards_) {
+        std::lock_guard lock(shard->mutex);
+        shard->slot_of.clear();
+        std::fill(shard->slot_ids.begin(), shard->slot_ids.end(), INVALID_SLOT_ID);
+        std::fill(shard->referenced.begin(), shard->referenced.end(), 0);
+        std::fill(shard->frequency.begin(), shard->frequency.end(), 0);
+        shard->used = 0;
+        shard->hand = 0;
+        shard->recorded = 0;
+    }
+}
+
+uint64_t
+CodeCache::Size() const {
+    uint64_t size = 0;
+    for (const auto& shard : this->shards_) {
+        std::lock_guard lock(shard->mutex);
+        size += shard->used;
+    }
+    return size;
+}
+
+void
+CodeCache::record(Shard& shard, InnerIdType id) const {
+    auto& counter = shard.frequency[hash_id(id) & (shard.frequency.size() - 1)];
+    if (counter < MAX_FREQUENCY) {
+        ++counter;
+    }
+    if (++shard.recorded >= shard.slot_ids.size() * FREQUENCY_AGING_FACTOR) {
+        for (auto& value : shard.frequency) {
+            value >>= 1;
+        }
+        shard.recorded = 0;
+    }
+}
+
+uint8_t
+CodeCache::estimate(const Shard& shard, InnerIdType id) const {
+    return shard.frequency[hash_id(id) & (shard.frequency.size() - 1)];
+}
+
+uint32_t
+CodeCache::version_of(const Shard& shard, InnerIdType id) const {
+    return shard.versions[hash_id(id) & (shard.versions.size() - 1)];
+}
+
+void
+CodeCache::insert(Shard& shard, InnerIdType id, const uint8_t* codes, bool force) {
+    auto iter = shard.slot_of.find(id);
+    if (iter != shard.slot_of.end()) {
+        std::memcpy(
+            shard.codes + static_cast<uint64_t>(iter->second) * code_size_, codes, code_size_);
+        return;
+    }
+    auto slot_count = static_cast<uint32_t>(shard.slot_ids.size());
+    uint32_t slot = 0;
+    while (true) {
+        slot = shard.hand;
+        shard.hand = (shard.hand + 1) % slot_count;
+        if (shard.slot_ids[slot] == INVALID_SLOT_ID) {
+            break;
+        }
+        // a full shard always holds a slot without a reference bit after one sweep
+        if (shard.used == slot_count and shard.referenced[slot] != 0) {
+            shard.referenced[slot] = 0;
+            continue;
+        }
+        if (shard.used < slot_count) {
+            continue;
+        }
+        auto victim = shard.slot_ids[slot];
+        if (not force and this->estimate(shard, id) <= this->estimate(shard, victim)) {
+            return;
+        }
+        shard.slot_of.erase(victim);
+        shard.slot_ids[slot] = INVALID_SLOT_ID;
+        shard.used--;
+        break;
+    }
+    shard.slot_ids[slot] = id;
+    shard.referenced[slot] = 0;
+    shard.slot_of[id] = slot;
+    shard.used++;
+    std::memcpy(shard.codes + static_cast<uint64_t>(slot) * code_size_, codes, code_size_);
+}
+
+}  // namespace vsag
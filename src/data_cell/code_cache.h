@@ -0,0 +1,172 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "typing.h"
+#include "vsag/allocator.h"
+
+namespace vsag {
+
+class CodeCache;
+using CodeCachePtr = std::unique_ptr<CodeCache>;
+
+/**
+ * @class CodeCache
+ * @brief A fixed size in-memory cache of the codes of a non-memory flatten datacell.
+ *
+ * The slots are split into shards by id, each shard has its own mutex, slots and CLOCK hand.
+ * A hit sets the reference bit of its slot and the hand clears the bits while looking for a
+ * victim, so a slot survives as long as it is hit once per sweep. Every lookup, hit or miss,
+ * also counts the id in a small frequency sketch which is halved periodically; when a shard is
+ * full a missed code is only admitted if its id is more frequent than the victim's, so a scan
+ * of cold ids does not flush the hot ones.
+ *
+ * Each id also has a version, bumped by Erase. A code read from the io is offered with the
+ * version taken before the read, and dropped if the id was rewritten in the meantime.
+ */
+class CodeCache {
+public:
+    /**
+     * @param capacity The count of codes held at most.
+     * @param code_size The size in bytes of one code.
+     * @param allocator The allocator of the slots.
+     */
+    CodeCache(uint64_t capacity, uint32_t code_size, Allocator* allocator);
+
+    ~CodeCache();
+
+    CodeCache(const CodeCache&) = delete;
+    CodeCache&
+    operator=(const CodeCache&) = delete;
+
+    /**
+     * @brief Copies the code of id into codes and returns true if it is cached, otherwise
+     * stores the version of id into version if it is not nullptr.
+     */
+    bool
+    Get(InnerIdType id, uint8_t* codes, uint32_t* version = nullptr);
+
+    /**
+     * @brief The version of id, taken before reading its code from the io.
+     */
+    [[nodiscard]] uint32_t
+    Version(InnerIdType id);
+
+    /**
+     * @brief Offers the code of id, it is kept if version is still the version of id and there
+     * is a free slot or it wins the admission.
+     */
+    void
+    Put(InnerIdType id, const uint8_t* codes, uint32_t version);
+
+    /**
+     * @brief Loads the code of id regardless of the admission, used to warm up the cache. The
+     * code is dropped as well if version is no longer the version of id.
+     */
+    void
+    Pin(InnerIdType id, const uint8_t* codes, uint32_t version);
+
+    /**
+     * @brief Drops the code of id and bumps its version, called before and after the code is
+     * overwritten.
+     */
+    void
+    Erase(InnerIdType id);
+
+    void
+    Clear();
+
+    [[nodiscard]] uint64_t
+    Capacity() const {
+        return this->capacity_;
+    }
+
+    [[nodiscard]] uint64_t
+    Size() const;
+
+    [[nodiscard]] uint64_t
+    HitCount() const {
+        return this->hit_count_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t
+    MissCount() const {
+        return this->miss_count_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Shard {
+        explicit Shard(Allocator* allocator)
+            : slot_of(allocator),
+              slot_ids(allocator),
+              referenced(allocator),
+              frequency(allocator),
+              versions(allocator) {
+        }
+
+        std::mutex mutex;
+        UnorderedMap<InnerIdType, uint32_t> slot_of;
+        Vector<InnerIdType> slot_ids;
+        Vector<uint8_t> referenced;
+        uint8_t* codes{nullptr};
+        uint32_t used{0};
+        uint32_t hand{0};
+
+        // 4 bit saturating counters indexed by a hash of the id
+        Vector<uint8_t> frequency;
+        uint64_t recorded{0};
+
+        // the versions indexed by the same hash, ids sharing one only reject more puts
+        Vector<uint32_t> versions;
+    };
+
+    Shard&
+    shard_of(InnerIdType id) {
+        return *this->shards_[id % this->shards_.size()];
+    }
+
+    void
+    record(Shard& shard, InnerIdType id) const;
+
+    [[nodiscard]] uint8_t
+    estimate(const Shard& shard, InnerIdType id) const;
+
+    [[nodiscard]] uint32_t
+    version_of(const Shard& shard, InnerIdType id) const;
+
+    void
+    insert(Shard& shard, InnerIdType id, const uint8_t* codes, bool force);
+
+private:
+    Allocator* const allocator_{nullptr};
+
+    const uint64_t capacity_{0};
+
+    const uint32_t code_size_{0};
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+
+    std::atomic<uint64_t> hit_count_{0};
+
+    std::atomic<uint64_t> miss_count_{0};
+};
+
+}  // namespace vsag
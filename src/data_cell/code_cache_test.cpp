@@ -0,0 +1,139 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "code_cache.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "impl/allocator/safe_allocator.h"
+#include "vsag_exception.h"
+
+using namespace vsag;
+
+static std::vector<uint8_t>
+make_code(InnerIdType id, uint32_t code_size) {
+    return std::vector<uint8_t>(code_size, static_cast<uint8_t>(id * 7 + 1));
+}
+
+TEST_CASE("CodeCache Get & Put", "[ut][CodeCache]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    constexpr uint32_t code_size = 16;
+    CodeCache cache(64, code_size, allocator.get());
+    REQUIRE(cache.Capacity() == 64);
+
+    std::vector<uint8_t> codes(code_size);
+    for (InnerIdType id = 0; id < 64; ++id) {
+        REQUIRE_FALSE(cache.Get(id, codes.data()));
+        cache.Put(id, make_code(id, code_size).data(), cache.Version(id));
+    }
+    REQUIRE(cache.Size() == 64);
+    for (InnerIdType id = 0; id < 64; ++id) {
+        REQUIRE(cache.Get(id, codes.data()));
+        REQUIRE(codes == make_code(id, code_size));
+    }
+    REQUIRE(cache.HitCount() == 64);
+    REQUIRE(cache.MissCount() == 64);
+
+    // a cached code is overwritten in place
+    cache.Put(3, make_code(4, code_size).data(), cache.Version(3));
+    REQUIRE(cache.Get(3, codes.data()));
+    REQUIRE(codes == make_code(4, code_size));
+    REQUIRE(cache.Size() == 64);
+
+    cache.Erase(3);
+    REQUIRE_FALSE(cache.Get(3, codes.data()));
+    REQUIRE(cache.Size() == 63);
+    cache.Clear();
+    REQUIRE(cache.Size() == 0);
+
+    REQUIRE_THROWS_AS(CodeCache(0, code_size, allocator.get()), VsagException);
+    REQUIRE_THROWS_AS(CodeCache(64, 0, allocator.get()), VsagException);
+}
+
+TEST_CASE("CodeCache Eviction & Admission", "[ut][CodeCache]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    constexpr uint32_t code_size = 8;
+    std::vector<uint8_t> codes(code_size);
+
+    SECTION("clock gives referenced slots a second chance") {
+        // 16 shards of 2 slots, the ids 0, 16 and 32 share the first shard
+        CodeCache cache(32, code_size, allocator.get());
+        cache.Put(0, make_code(0, code_size).data(), cache.Version(0));
+        cache.Put(16, make_code(16, code_size).data(), cache.Version(16));
+        REQUIRE(cache.Get(0, codes.data()));
+        REQUIRE_FALSE(cache.Get(32, codes.data()));
+        cache.Put(32, make_code(32, code_size).data(), cache.Version(32));
+        REQUIRE(cache.Get(0, codes.data()));
+        REQUIRE(cache.Get(32, codes.data()));
+        REQUIRE_FALSE(cache.Get(16, codes.data()));
+    }
+
+    SECTION("a missed id replaces the victim only if it is more frequent") {
+        // 4 shards of 1 slot, the ids 1 and 5 share the second shard
+        CodeCache cache(4, code_size, allocator.get());
+        cache.Put(1, make_code(1, code_size).data(), cache.Version(1));
+        REQUIRE(cache.Get(1, codes.data()));
+        REQUIRE_FALSE(cache.Get(5, codes.data()));
+        cache.Put(5, make_code(5, code_size).data(), cache.Version(5));
+        REQUIRE(cache.Get(1, codes.data()));
+
+        REQUIRE_FALSE(cache.Get(5, codes.data()));
+        REQUIRE_FALSE(cache.Get(5, codes.data()));
+        cache.Put(5, make_code(5, code_size).data(), cache.Version(5));
+        REQUIRE(cache.Get(5, codes.data()));
+        REQUIRE(codes == make_code(5, code_size));
+        REQUIRE_FALSE(cache.Get(1, codes.data()));
+    }
+
+    SECTION("pin bypasses the admission") {
+        CodeCache cache(4, code_size, allocator.get());
+        cache.Put(2, make_code(2, code_size).data(), cache.Version(2));
+        for (int i = 0; i < 3; ++i) {
+            REQUIRE(cache.Get(2, codes.data()));
+        }
+        cache.Pin(6, make_code(6, code_size).data(), cache.Version(6));
+        REQUIRE(cache.Get(6, codes.data()));
+        REQUIRE(codes == make_code(6, code_size));
+        REQUIRE(cache.Size() == 1);
+    }
+}
+
+TEST_CASE("CodeCache Stale Put", "[ut][CodeCache]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    constexpr uint32_t code_size = 8;
+    CodeCache cache(16, code_size, allocator.get());
+    std::vector<uint8_t> codes(code_size);
+
+    // a search misses and reads the old code, then the code is rewritten before its put
+    uint32_t version = 0;
+    REQUIRE_FALSE(cache.Get(7, codes.data(), &version));
+    cache.Erase(7);
+    cache.Put(7, make_code(1, code_size).data(), version);
+    REQUIRE_FALSE(cache.Get(7, codes.data()));
+    cache.Pin(7, make_code(1, code_size).data(), version);
+    REQUIRE_FALSE(cache.Get(7, codes.data()));
+
+    // a read which started after the rewrite is cached
+    REQUIRE_FALSE(cache.Get(7, codes.data(), &version));
+    cache.Put(7, make_code(2, code_size).data(), version);
+    REQUIRE(cache.Get(7, codes.data()));
+    REQUIRE(codes == make_code(2, code_size));
+
+    // the erase drops the cached code as well
+    cache.Erase(7);
+    REQUIRE_FALSE(cache.Get(7, codes.data()));
+    REQUIRE(cache.Version(7) != version);
+}
@@ -0,0 +1,449 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstring>
+#include <memory>
+
+#include "byte_buffer.h"
+#include "colocated_datacell_parameter.h"
+#include "graph_interface.h"
+#include "index/index_common_param.h"
+#include "io/basic_io.h"
+
+namespace vsag {
+
+/**
+ * @class ColocatedDataCell
+ * @brief A flat graph whose nodes keep their codes next to their adjacency lists.
+ *
+ * Each node is one fixed size record: the neighbor count, max_degree neighbor ids, then the
+ * code of the node. Records are packed into sectors the way the DiskANN disk layout does:
+ * several records share a sector when they fit and never straddle a sector boundary, a record
+ * larger than a sector starts on its own sector. On a disk IO one hop of a search is then a
+ * single read by GetNeighborsAndCodes or ReadNodes, which returns both the neighbors to expand
+ * and the code to compute the exact distance of the node with, instead of one read per
+ * datacell.
+ */
+template <typename IOTmpl>
+class ColocatedDataCell : public GraphInterface {
+public:
+    ColocatedDataCell(const GraphInterfaceParamPtr& graph_param,
+                      const IndexCommonParam& common_param);
+
+    ColocatedDataCell(const ColocatedDataCellParamPtr& graph_param,
+                      const IndexCommonParam& common_param);
+
+    void
+    InsertNeighborsById(InnerIdType id, const Vector<InnerIdType>& neighbor_ids) override;
+
+    void
+    DeleteNeighborsById(InnerIdType id) override;
+
+    [[nodiscard]] uint32_t
+    GetNeighborSize(InnerIdType id) const override;
+
+    void
+    GetNeighbors(InnerIdType id, Vector<InnerIdType>& neighbor_ids) const override;
+
+    void
+    Resize(InnerIdType new_size) override;
+
+    /****
+     * prefetch neighbors of a base point with id
+     * @param id of base point
+     * @param neighbor_i index of neighbor, 0 for neighbor size, 1 for first neighbor
+     */
+    void
+    Prefetch(InnerIdType id, uint32_t neighbor_i) override {
+        io_->Prefetch(this->node_offset(id) + neighbor_i * sizeof(InnerIdType));
+    }
+
+    void
+    Serialize(StreamWriter& writer) override;
+
+    void
+    Deserialize(StreamReader& reader) override;
+
+    [[nodiscard]] bool
+    InMemory() const override {
+        return IOTmpl::InMemory;
+    }
+
+    void
+    MergeOther(GraphInterfacePtr other, uint64_t bias) override;
+
+    [[nodiscard]] uint32_t
+    ColocatedCodeSize() const override {
+        return this->code_size_;
+    }
+
+    /**
+     * @brief Writes the code stored next to the adjacency list of id.
+     */
+    void
+    InsertCodes(InnerIdType id, const uint8_t* codes) override;
+
+    /**
+     * @brief Reads the live neighbors and the code of id with a single read of its record.
+     */
+    void
+    GetNeighborsAndCodes(InnerIdType id,
+                         Vector<InnerIdType>& neighbor_ids,
+                         uint8_t* codes) const override;
+
+    /**
+     * @brief Reads the code of id, a partial read of its record.
+     */
+    void
+    GetCodesById(InnerIdType id, uint8_t* codes) const;
+
+    /**
+     * @brief Reads the whole records of count nodes, one read per node in a single batch.
+     *
+     * @param ids The ids of the nodes.
+     * @param count The count of ids.
+     * @param records The output, count * NodeSize() bytes, parsed by ParseNode.
+     */
+    void
+    ReadNodes(const InnerIdType* ids, uint64_t count, uint8_t* records) const;
+
+    /**
+     * @brief Decodes a record returned by ReadNodes.
+     *
+     * @param record The record of one node.
+     * @param neighbor_ids The live neighbors of the node.
+     * @return The code of the node, pointing into record.
+     */
+    const uint8_t*
+    ParseNode(const uint8_t* record, Vector<InnerIdType>& neighbor_ids) const;
+
+    [[nodiscard]] uint32_t
+    NodeSize() const {
+        return this->node_size_;
+    }
+
+    [[nodiscard]] uint32_t
+    CodeSize() const {
+        return this->code_size_;
+    }
+
+private:
+    [[nodiscard]] uint64_t
+    node_offset(InnerIdType id) const {
+        if (nodes_per_sector_ > 0) {
+            return static_cast<uint64_t>(id / nodes_per_sector_) * sector_size_ +
+                   static_cast<uint64_t>(id % nodes_per_sector_) * node_size_;
+        }
+        return static_cast<uint64_t>(id) * sectors_per_node_ * sector_size_;
+    }
+
+    void
+    init_layout();
+
+    void
+    update_total_count(InnerIdType id) {
+        InnerIdType current = total_count_.load();
+        while (current < id + 1 && !total_count_.compare_exchange_weak(current, id + 1)) {
+        }
+    }
+
+private:
+    std::shared_ptr<BasicIO<IOTmpl>> io_{nullptr};
+
+    Vector<uint8_t> node_versions_;
+
+    bool is_support_delete_{true};
+    uint32_t remove_flag_bit_{8};
+    uint32_t id_bit_{24};
+    uint32_t remove_flag_mask_{0x00ffffff};
+
+    uint32_t code_size_{0};
+    uint32_t sector_size_{4096};
+
+    // the neighbor count, max_degree ids and the code, rounded up to 4 bytes
+    uint32_t node_size_{0};
+    // 0 when a node does not fit in a sector, it takes sectors_per_node_ sectors then
+    uint32_t nodes_per_sector_{0};
+    uint32_t sectors_per_node_{1};
+};
+
+template <typename IOTmpl>
+ColocatedDataCell<IOTmpl>::ColocatedDataCell(const ColocatedDataCellParamPtr& param,
+                                             const IndexCommonParam& common_param)
+    : node_versions_(common_param.allocator_.get()) {
+    this->io_ = std::make_shared<IOTmpl>(param->io_parameter_, common_param);
+    this->allocator_ = common_param.allocator_.get();
+    this->maximum_degree_ = param->max_degree_;
+    this->max_capacity_ = param->init_max_capacity_;
+    this->is_support_delete_ = param->support_remove_;
+    this->remove_flag_bit_ = param->remove_flag_bit_;
+    this->id_bit_ = sizeof(InnerIdType) * 8 - this->remove_flag_bit_;
+    this->remove_flag_mask_ = (1 << this->id_bit_) - 1;
+    this->code_size_ = param->code_size_;
+    this->sector_size_ = param->sector_size_;
+    this->init_layout();
+    if (this->is_support_delete_) {
+        node_versions_.resize(max_capacity_);
+    }
+}
+
+template <typename IOTmpl>
+ColocatedDataCell<IOTmpl>::ColocatedDataCell(const GraphInterfaceParamPtr& param,
+                                             const IndexCommonParam& common_param)
+    : ColocatedDataCell<IOTmpl>(std::dynamic_pointer_cast<ColocatedDataCellParameter>(param),
+                                common_param) {
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::init_layout() {
+    auto node_size = sizeof(uint32_t) + this->maximum_degree_ * sizeof(InnerIdType) + code_size_;
+    this->node_size_ = static_cast<uint32_t>((node_size + 3) / 4 * 4);
+    if (this->node_size_ <= this->sector_size_) {
+        this->nodes_per_sector_ = this->sector_size_ / this->node_size_;
+        this->sectors_per_node_ = 1;
+    } else {
+        this->nodes_per_sector_ = 0;
+        this->sectors_per_node_ = (this->node_size_ + this->sector_size_ - 1) / this->sector_size_;
+    }
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::InsertNeighborsById(InnerIdType id,
+                                               const Vector<InnerIdType>& neighbor_ids) {
+    if (neighbor_ids.size() > this->maximum_degree_) {
+        throw std::invalid_argument(fmt::format(
+            "insert neighbors count {} more than {}", neighbor_ids.size(), this->maximum_degree_));
+    }
+    this->update_total_count(id);
+    auto start = this->node_offset(id);
+    auto neighbor_count = static_cast<uint32_t>(neighbor_ids.size());
+    this->io_->Write((uint8_t*)(&neighbor_count), sizeof(neighbor_count), start);
+    start += sizeof(neighbor_count);
+    if (is_support_delete_) {
+        Vector<InnerIdType> versioned_ids(neighbor_count, 0, this->allocator_);
+        for (uint32_t i = 0; i < neighbor_count; ++i) {
+            auto neighbor_id = neighbor_ids[i];
+            versioned_ids[i] = neighbor_id | (node_versions_[neighbor_id] << id_bit_);
+        }
+        this->io_->Write((uint8_t*)(versioned_ids.data()),
+                         static_cast<uint64_t>(neighbor_count) * sizeof(InnerIdType),
+                         start);
+    } else {
+        this->io_->Write((uint8_t*)(neighbor_ids.data()),
+                         static_cast<uint64_t>(neighbor_count) * sizeof(InnerIdType),
+                         start);
+    }
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::InsertCodes(InnerIdType id, const uint8_t* codes) {
+    // only linked nodes are counted, the code of a point is written before its neighbors
+    auto start = this->node_offset(id) + sizeof(uint32_t) +
+                 static_cast<uint64_t>(this->maximum_degree_) * sizeof(InnerIdType);
+    this->io_->Write(codes, code_size_, start);
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::GetCodesById(InnerIdType id, uint8_t* codes) const {
+    auto start = this->node_offset(id) + sizeof(uint32_t) +
+                 static_cast<uint64_t>(this->maximum_degree_) * sizeof(InnerIdType);
+    this->io_->Read(code_size_, start, codes);
+}
+
+template <typename IOTmpl>
+uint32_t
+ColocatedDataCell<IOTmpl>::GetNeighborSize(InnerIdType id) const {
+    uint32_t neighbor_count = 0;
+    this->io_->Read(sizeof(neighbor_count), this->node_offset(id), (uint8_t*)(&neighbor_count));
+    return neighbor_count;
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::GetNeighbors(InnerIdType id, Vector<InnerIdType>& neighbor_ids) const {
+    // the adjacency part of the record is read at once, the count is known after the read
+    auto adjacency_size = sizeof(uint32_t) + this->maximum_degree_ * sizeof(InnerIdType);
+    ByteBuffer buffer(adjacency_size, this->allocator_);
+    std::memset(buffer.data, 0, sizeof(uint32_t));
+    this->io_->Read(adjacency_size, this->node_offset(id), buffer.data);
+    this->ParseNode(buffer.data, neighbor_ids);
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::GetNeighborsAndCodes(InnerIdType id,
+                                                Vector<InnerIdType>& neighbor_ids,
+                                                uint8_t* codes) const {
+    ByteBuffer record(node_size_, this->allocator_);
+    std::memset(record.data, 0, sizeof(uint32_t));
+    this->io_->Read(node_size_, this->node_offset(id), record.data);
+    const auto* node_codes = this->ParseNode(record.data, neighbor_ids);
+    std::memcpy(codes, node_codes, code_size_);
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::ReadNodes(const InnerIdType* ids,
+                                     uint64_t count,
+                                     uint8_t* records) const {
+    if (count == 1) {
+        this->io_->Read(node_size_, this->node_offset(ids[0]), records);
+        return;
+    }
+    Vector<uint64_t> sizes(count, node_size_, this->allocator_);
+    Vector<uint64_t> offsets(count, this->allocator_);
+    for (uint64_t i = 0; i < count; ++i) {
+        offsets[i] = this->node_offset(ids[i]);
+    }
+    this->io_->MultiRead(records, sizes.data(), offsets.data(), count);
+}
+
+template <typename IOTmpl>
+const uint8_t*
+ColocatedDataCell<IOTmpl>::ParseNode(const uint8_t* record,
+                                     Vector<InnerIdType>& neighbor_ids) const {
+    uint32_t neighbor_count = 0;
+    std::memcpy(&neighbor_count, record, sizeof(neighbor_count));
+    neighbor_count = std::min(neighbor_count, this->maximum_degree_);
+    const auto* ids = record + sizeof(uint32_t);
+    neighbor_ids.resize(neighbor_count);
+    std::memcpy(neighbor_ids.data(), ids, neighbor_count * sizeof(InnerIdType));
+    if (is_support_delete_) {
+        uint32_t live_count = 0;
+        for (uint32_t i = 0; i < neighbor_count; ++i) {
+            uint8_t neighbor_version = neighbor_ids[i] >> id_bit_;
+            InnerIdType neighbor_id = neighbor_ids[i] & remove_flag_mask_;
+            if (node_versions_[neighbor_id] == neighbor_version) {
+                neighbor_ids[live_count++] = neighbor_id;
+            }
+        }
+        neighbor_ids.resize(live_count);
+    }
+    return ids + static_cast<uint64_t>(this->maximum_degree_) * sizeof(InnerIdType);
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::Resize(InnerIdType new_size) {
+    if (new_size < this->max_capacity_) {
+        return;
+    }
+    if (is_support_delete_) {
+        if (new_size > remove_flag_mask_) {
+            // remove_flag_mask_ exactly matches the maximum size of the graph in dynamic mode.
+            throw VsagException(ErrorType::INTERNAL_ERROR,
+                                fmt::format("the size of graph is limit ({})", remove_flag_mask_));
+        }
+        node_versions_.resize(new_size);
+    }
+    this->max_capacity_ = new_size;
+    // the last sector is allocated whole, so a read of any record stays in the io
+    uint64_t io_size = this->node_offset(new_size - 1) +
+                       static_cast<uint64_t>(this->sectors_per_node_) * this->sector_size_;
+    uint8_t end_flag =
+        127;  // the value is meaningless, only to occupy the position for io allocate
+    this->io_->Write(&end_flag, 1, io_size);
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::Serialize(StreamWriter& writer) {
+    GraphInterface::Serialize(writer);
+    this->io_->Serialize(writer);
+    StreamWriter::WriteObj(writer, this->code_size_);
+    StreamWriter::WriteObj(writer, this->sector_size_);
+    if (is_support_delete_) {
+        StreamWriter::WriteVector(writer, node_versions_);
+    }
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::Deserialize(StreamReader& reader) {
+    GraphInterface::Deserialize(reader);
+    this->io_->Deserialize(reader);
+    StreamReader::ReadObj(reader, this->code_size_);
+    StreamReader::ReadObj(reader, this->sector_size_);
+    this->init_layout();
+    if (is_support_delete_) {
+        StreamReader::ReadVector(reader, node_versions_);
+    }
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::DeleteNeighborsById(InnerIdType id) {
+    if (not is_support_delete_) {
+        throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION,
+                            "disable delete in colocated datacell");
+    }
+    if (id >= node_versions_.size()) {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            fmt::format("remove point {} not exist in ColocatedDataCell", id));
+    }
+    if (node_versions_[id] + 1 == 0) {
+        throw VsagException(
+            ErrorType::INTERNAL_ERROR,
+            "remove point too many times in ColocatedDataCell, please rebuild index");
+    }
+    node_versions_[id]++;
+}
+
+template <typename IOTmpl>
+void
+ColocatedDataCell<IOTmpl>::MergeOther(GraphInterfacePtr other, uint64_t bias) {
+    auto other_graph = std::dynamic_pointer_cast<ColocatedDataCell<IOTmpl>>(other);
+    if (!other_graph) {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            "ColocatedDataCell can only merge with ColocatedDataCell");
+    }
+    if (this->node_size_ != other_graph->node_size_ or
+        this->maximum_degree_ != other_graph->maximum_degree_) {
+        throw VsagException(
+            ErrorType::INTERNAL_ERROR,
+            fmt::format("ColocatedDataCell layout mismatch: degree {} vs {}, node size {} vs {}",
+                        this->maximum_degree_,
+                        other_graph->maximum_degree_,
+                        this->node_size_,
+                        other_graph->node_size_));
+    }
+    InnerIdType other_count = other_graph->total_count_;
+    if (is_support_delete_) {
+        for (InnerIdType i = 0; i < other_count; ++i) {
+            node_versions_[i + bias] = other_graph->node_versions_[i];
+        }
+    }
+    Vector<InnerIdType> neighbor_ids(allocator_);
+    ByteBuffer codes(code_size_ + 1, allocator_);
+    for (InnerIdType i = 0; i < other_count; ++i) {
+        other_graph->GetNeighbors(i, neighbor_ids);
+        for (auto& neighbor_id : neighbor_ids) {
+            neighbor_id += bias;
+        }
+        this->InsertNeighborsById(i + bias, neighbor_ids);
+        if (code_size_ > 0) {
+            other_graph->GetCodesById(i, codes.data);
+            this->InsertCodes(i + bias, codes.data);
+        }
+    }
+}
+
+}  // namespace vsag
@@ -0,0 +1,74 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "colocated_datacell_parameter.h"
+
+#include <fmt/format.h>
+
+#include "inner_string_params.h"
+#include "logger.h"
+
+namespace vsag {
+
+void
+ColocatedDataCellParameter::FromJson(const JsonType& json) {
+    GraphDataCellParameter::FromJson(json);
+    if (json.contains(GRAPH_PARAM_SECTOR_SIZE)) {
+        this->sector_size_ = json[GRAPH_PARAM_SECTOR_SIZE];
+    }
+    if (json.contains(GRAPH_PARAM_CODE_SIZE)) {
+        this->code_size_ = json[GRAPH_PARAM_CODE_SIZE];
+    }
+    CHECK_ARGUMENT(this->sector_size_ > 0 and (this->sector_size_ & (this->sector_size_ - 1)) == 0,
+                   fmt::format("{} must be a power of 2, got {}",
+                               GRAPH_PARAM_SECTOR_SIZE,
+                               this->sector_size_));
+}
+
+JsonType
+ColocatedDataCellParameter::ToJson() const {
+    auto json = GraphDataCellParameter::ToJson();
+    json[GRAPH_STORAGE_TYPE_KEY] = GRAPH_STORAGE_TYPE_COLOCATED;
+    json[GRAPH_PARAM_SECTOR_SIZE] = this->sector_size_;
+    json[GRAPH_PARAM_CODE_SIZE] = this->code_size_;
+    return json;
+}
+
+bool
+ColocatedDataCellParameter::CheckCompatibility(const ParamPtr& other) const {
+    auto graph_param = std::dynamic_pointer_cast<ColocatedDataCellParameter>(other);
+    if (not graph_param) {
+        logger::error(
+            "ColocatedDataCellParameter::CheckCompatibility: other parameter is not a "
+            "ColocatedDataCellParameter");
+        return false;
+    }
+    if (not GraphDataCellParameter::CheckCompatibility(other)) {
+        return false;
+    }
+    if (sector_size_ != graph_param->sector_size_ or code_size_ != graph_param->code_size_) {
+        logger::error(
+            "ColocatedDataCellParameter::CheckCompatibility: node layout mismatch: sector {} vs "
+            "{}, code size {} vs {}",
+            sector_size_,
+            graph_param->sector_size_,
+            code_size_,
+            graph_param->code_size_);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace vsag
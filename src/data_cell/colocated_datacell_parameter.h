@@ -0,0 +1,50 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "graph_datacell_parameter.h"
+
+namespace vsag {
+
+/**
+ * @brief Parameter of ColocatedDataCell, a flat graph whose nodes also carry their codes.
+ *
+ * code_size is the size of the code stored next to each adjacency list, it is usually
+ * filled by the owner from its quantizer rather than by the user.
+ */
+class ColocatedDataCellParameter : public GraphDataCellParameter {
+public:
+    ColocatedDataCellParameter()
+        : GraphDataCellParameter(GraphStorageTypes::GRAPH_STORAGE_TYPE_COLOCATED) {
+    }
+
+    void
+    FromJson(const JsonType& json) override;
+
+    JsonType
+    ToJson() const override;
+
+    bool
+    CheckCompatibility(const vsag::ParamPtr& other) const override;
+
+public:
+    uint32_t sector_size_{4096};
+
+    uint32_t code_size_{0};
+};
+
+using ColocatedDataCellParamPtr = std::shared_ptr<ColocatedDataCellParameter>;
+}  // namespace vsag
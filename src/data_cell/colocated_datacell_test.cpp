@@ -0,0 +1,156 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "colocated_datacell.h"
+
+#include <fmt/format.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "graph_interface_test.h"
+#include "impl/allocator/safe_allocator.h"
+#include "io/memory_io.h"
+#include "storage/serialization_template_test.h"
+
+using namespace vsag;
+
+static GraphInterfaceParamPtr
+make_colocated_param(const std::string& io_type,
+                     uint64_t max_degree,
+                     uint32_t code_size,
+                     bool support_remove) {
+    constexpr const char* graph_param_temp =
+        R"(
+        {{
+            "io_params": {{
+                "type": "{}"
+            }},
+            "max_degree": {},
+            "code_size": {},
+            "support_remove": {}
+        }}
+        )";
+    auto param_str =
+        fmt::format(graph_param_temp, io_type, max_degree, code_size, support_remove);
+    return GraphInterfaceParameter::GetGraphParameterByJson(
+        GraphStorageTypes::GRAPH_STORAGE_TYPE_COLOCATED, JsonType::parse(param_str));
+}
+
+TEST_CASE("ColocatedDataCell Basic Test", "[ut][ColocatedDataCell]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto max_degree = GENERATE(5, 32, 64);
+    auto io_type = GENERATE("memory_io", "block_memory_io");
+    auto is_support_delete = GENERATE(true, false);
+    auto count = GENERATE(1000, 2000);
+
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    auto graph_param = make_colocated_param(io_type, max_degree, 128, is_support_delete);
+    REQUIRE(graph_param->graph_storage_type_ == GraphStorageTypes::GRAPH_STORAGE_TYPE_COLOCATED);
+    REQUIRE(graph_param->ToJson()[GRAPH_STORAGE_TYPE_KEY] == GRAPH_STORAGE_TYPE_COLOCATED);
+
+    auto graph = GraphInterface::MakeInstance(graph_param, common_param);
+    GraphInterfaceTest test(graph);
+    auto other = GraphInterface::MakeInstance(graph_param, common_param);
+    test.BasicTest(10000, count, other, is_support_delete);
+}
+
+TEST_CASE("ColocatedDataCell Merge Test", "[ut][ColocatedDataCell]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto max_degree = GENERATE(5, 32);
+    auto is_support_delete = GENERATE(true, false);
+
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    auto graph_param = make_colocated_param("block_memory_io", max_degree, 16, is_support_delete);
+    auto graph = GraphInterface::MakeInstance(graph_param, common_param);
+    GraphInterfaceTest test(graph);
+    auto other = GraphInterface::MakeInstance(graph_param, common_param);
+    test.MergeTest(other, 1000);
+}
+
+TEST_CASE("ColocatedDataCell Node Layout", "[ut][ColocatedDataCell]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    // a record of 4 + 32 * 4 + 100 bytes shares its sector, one of 4 + 32 * 4 + 5000 does not
+    auto code_size = GENERATE(100, 5000);
+    auto is_support_delete = GENERATE(true, false);
+    uint32_t max_degree = 32;
+    InnerIdType count = 200;
+
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    auto graph_param = std::dynamic_pointer_cast<ColocatedDataCellParameter>(
+        make_colocated_param("memory_io", max_degree, code_size, is_support_delete));
+    ColocatedDataCell<MemoryIO> graph(graph_param, common_param);
+    graph.Resize(count);
+    REQUIRE(graph.CodeSize() == code_size);
+    REQUIRE(graph.ColocatedCodeSize() == code_size);
+    REQUIRE(graph.NodeSize() % 4 == 0);
+    REQUIRE(graph.NodeSize() >= sizeof(uint32_t) + max_degree * sizeof(InnerIdType) + code_size);
+
+    std::vector<std::vector<InnerIdType>> lists(count);
+    std::vector<uint8_t> codes(static_cast<uint64_t>(count) * code_size);
+    Vector<InnerIdType> neighbors(allocator.get());
+    for (InnerIdType id = 0; id < count; ++id) {
+        neighbors.resize(id % max_degree + 1);
+        for (uint64_t i = 0; i < neighbors.size(); ++i) {
+            neighbors[i] = (id + i * 7 + 1) % count;
+        }
+        lists[id].assign(neighbors.begin(), neighbors.end());
+        for (uint32_t j = 0; j < code_size; ++j) {
+            codes[id * code_size + j] = static_cast<uint8_t>(id * 31 + j);
+        }
+        // codes and neighbors are written independently and do not overwrite each other
+        graph.InsertCodes(id, codes.data() + id * code_size);
+        graph.InsertNeighborsById(id, neighbors);
+    }
+
+    auto check = [&](ColocatedDataCell<MemoryIO>& target) {
+        std::vector<InnerIdType> ids = {0, 1, count / 2, count - 1};
+        std::vector<uint8_t> records(ids.size() * target.NodeSize());
+        target.ReadNodes(ids.data(), ids.size(), records.data());
+        std::vector<uint8_t> code(code_size);
+        for (uint64_t i = 0; i < ids.size(); ++i) {
+            auto id = ids[i];
+            const auto* node_code =
+                target.ParseNode(records.data() + i * target.NodeSize(), neighbors);
+            REQUIRE(std::vector<InnerIdType>(neighbors.begin(), neighbors.end()) == lists[id]);
+            REQUIRE(memcmp(node_code, codes.data() + id * code_size, code_size) == 0);
+            target.GetCodesById(id, code.data());
+            REQUIRE(memcmp(code.data(), codes.data() + id * code_size, code_size) == 0);
+            std::fill(code.begin(), code.end(), 0);
+            target.GetNeighborsAndCodes(id, neighbors, code.data());
+            REQUIRE(std::vector<InnerIdType>(neighbors.begin(), neighbors.end()) == lists[id]);
+            REQUIRE(memcmp(code.data(), codes.data() + id * code_size, code_size) == 0);
+            REQUIRE(target.GetNeighborSize(id) == lists[id].size());
+        }
+    };
+    check(graph);
+
+    ColocatedDataCell<MemoryIO> other(graph_param, common_param);
+    test_serializion(graph, other);
+    REQUIRE(other.NodeSize() == graph.NodeSize());
+    check(other);
+
+    if (is_support_delete) {
+        graph.DeleteNeighborsById(1);
+        InnerIdType id = 0;
+        std::vector<uint8_t> record(graph.NodeSize());
+        graph.ReadNodes(&id, 1, record.data());
+        graph.ParseNode(record.data(), neighbors);
+        REQUIRE(std::find(neighbors.begin(), neighbors.end(), 1) == neighbors.end());
+    }
+}
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 
@@ -54,6 +55,25 @@ public:
         return this->factory_computer((const float*)query);
     }
 
+    void
+    QueryMulti(float* result_dists,
+               const ComputerInterfacePtr* computers,
+               const InnerIdType* idx,
+               const uint32_t* computer_idx,
+               InnerIdType count,
+               Allocator* allocator = nullptr) override {
+        this->query_multi(result_dists, computers, idx, computer_idx, count);
+    }
+
+    void
+    QueryCodes(float* result_dists,
+               const ComputerInterfacePtr& computer,
+               const uint8_t* codes,
+               InnerIdType count) override {
+        auto comp = std::static_pointer_cast<Computer<QuantTmpl>>(computer);
+        comp->ScanBatchDists(count, codes, result_dists);
+    }
+
     float
     ComputePairVectors(InnerIdType id1, InnerIdType id2) override;
 
@@ -146,6 +166,20 @@ public:
         this->io_->InitIO(io_param);
     }
 
+    void
+    InitCache(uint64_t memory_size) override {
+        this->cache_memory_size_ = memory_size;
+        this->reset_cache();
+    }
+
+    void
+    WarmUp(const InnerIdType* ids, InnerIdType count) override;
+
+    [[nodiscard]] const CodeCache*
+    GetCache() const override {
+        return this->cache_.get();
+    }
+
 public:
     std::shared_ptr<Quantizer<QuantTmpl>> quantizer_{nullptr};
     std::shared_ptr<BasicIO<IOTmpl>> io_{nullptr};
@@ -153,6 +187,28 @@ public:
     Allocator* const allocator_{nullptr};
 
 private:
+    // hot codes of a non-memory io, nullptr when the cache is disabled
+    CodeCachePtr cache_{nullptr};
+    uint64_t cache_memory_size_{0};
+
+    void
+    reset_cache() {
+        this->cache_.reset();
+        if constexpr (not IOTmpl::InMemory) {
+            if (this->code_size_ > 0 and this->cache_memory_size_ >= this->code_size_) {
+                this->cache_ = std::make_unique<CodeCache>(
+                    this->cache_memory_size_ / this->code_size_, this->code_size_, allocator_);
+            }
+        }
+    }
+
+    inline void
+    query_with_cache(float* result_dists,
+                     const std::shared_ptr<Computer<QuantTmpl>>& computer,
+                     const InnerIdType* idx,
+                     InnerIdType id_count,
+                     Allocator* allocator);
+
     inline void
     query(float* result_dists,
           const std::shared_ptr<Computer<QuantTmpl>>& computer,
@@ -160,6 +216,13 @@ private:
           InnerIdType id_count,
           Allocator* allocator);
 
+    inline void
+    query_multi(float* result_dists,
+                const ComputerInterfacePtr* computers,
+                const InnerIdType* idx,
+                const uint32_t* computer_idx,
+                InnerIdType count);
+
     ComputerInterfacePtr
     factory_computer(const float* query) {
         auto computer = this->quantizer_->FactoryComputer();
@@ -205,8 +268,16 @@ FlattenDataCell<QuantTmpl, IOTmpl>::InsertVector(const void* vector, InnerIdType
     }
     ByteBuffer codes(static_cast<uint64_t>(code_size_), allocator_);
     quantizer_->EncodeOne((const float*)vector, codes.data);
+    // the first erase stops the hits on the old code, the second one rejects the puts of the
+    // searches which read the old code while it was being overwritten
+    if (this->cache_ != nullptr) {
+        this->cache_->Erase(idx);
+    }
     io_->Write(
         codes.data, code_size_, static_cast<uint64_t>(idx) * static_cast<uint64_t>(code_size_));
+    if (this->cache_ != nullptr) {
+        this->cache_->Erase(idx);
+    }
 }
 
 template <typename QuantTmpl, typename IOTmpl>
@@ -266,6 +337,10 @@ FlattenDataCell<QuantTmpl, IOTmpl>::query(float* result_dists,
                             this->prefetch_depth_code_ * 64);
     }
     if constexpr (not IOTmpl::InMemory) {
+        if (this->cache_ != nullptr) {
+            this->query_with_cache(result_dists, computer, idx, id_count, search_alloc);
+            return;
+        }
         if (id_count > 1) {
             ByteBuffer codes(id_count * this->code_size_, search_alloc);
             Vector<uint64_t> sizes(id_count, this->code_size_, search_alloc);
@@ -273,6 +348,28 @@ FlattenDataCell<QuantTmpl, IOTmpl>::query(float* result_dists,
             for (int64_t i = 0; i < id_count; ++i) {
                 offsets[i] = static_cast<uint64_t>(idx[i]) * this->code_size_;
             }
+            if constexpr (IOTmpl::SupportAsyncMultiRead()) {
+                // reads of the next chunk are in flight while the current chunk is scored
+                constexpr InnerIdType async_read_chunk = 32;
+                auto submit = [&](InnerIdType begin) {
+                    auto count = std::min(async_read_chunk, id_count - begin);
+                    return this->io_->SubmitMultiRead(codes.data + begin * this->code_size_,
+                                                      sizes.data() + begin,
+                                                      offsets.data() + begin,
+                                                      count);
+                };
+                auto ticket = submit(0);
+                for (InnerIdType begin = 0; begin < id_count; begin += async_read_chunk) {
+                    auto count = std::min(async_read_chunk, id_count - begin);
+                    this->io_->WaitMultiRead(ticket);
+                    if (begin + count < id_count) {
+                        ticket = submit(begin + count);
+                    }
+                    computer->ScanBatchDists(
+                        count, codes.data + begin * this->code_size_, result_dists + begin);
+                }
+                return;
+            }
             this->io_->MultiRead(codes.data, sizes.data(), offsets.data(), id_count);
             computer->ScanBatchDists(id_count, codes.data, result_dists);
             return;
@@ -280,9 +377,13 @@ FlattenDataCell<QuantTmpl, IOTmpl>::query(float* result_dists,
     }
 
     memset(result_dists, 0, sizeof(float) * id_count);
+    constexpr int64_t max_batch_size = 16;
+    const uint8_t* batch_codes[max_batch_size];
+    bool batch_release[max_batch_size];
     int64_t i = 0;
-    for (; i + 3 < id_count; i += 4) {
-        for (int64_t j = 0; j < 4; ++j) {
+    // widest kernel first: 16-way and 8-way batches keep the query in registers across codes
+    auto compute_batch = [&](int64_t batch_size) {
+        for (int64_t j = 0; j < batch_size; ++j) {
             if (i + j + this->prefetch_stride_code_ < id_count) {
                 this->io_->Prefetch(
                     static_cast<uint64_t>(idx[i + j + this->prefetch_stride_code_]) *
@@ -290,35 +391,39 @@ FlattenDataCell<QuantTmpl, IOTmpl>::query(float* result_dists,
                     this->prefetch_depth_code_ * 64);
             }
         }
-        bool release1 = false;
-        const auto* codes1 = this->GetCodesById(idx[i], release1);
-        bool release2 = false;
-        const auto* codes2 = this->GetCodesById(idx[i + 1], release2);
-        bool release3 = false;
-        const auto* codes3 = this->GetCodesById(idx[i + 2], release3);
-        bool release4 = false;
-        const auto* codes4 = this->GetCodesById(idx[i + 3], release4);
-        computer->ComputeDistsBatch4(codes1,
-                                     codes2,
-                                     codes3,
-                                     codes4,
-                                     result_dists[i],
-                                     result_dists[i + 1],
-                                     result_dists[i + 2],
-                                     result_dists[i + 3]);
-
-        if (release1) {
-            this->io_->Release(codes1);
+        for (int64_t j = 0; j < batch_size; ++j) {
+            batch_release[j] = false;
+            batch_codes[j] = this->GetCodesById(idx[i + j], batch_release[j]);
         }
-        if (release2) {
-            this->io_->Release(codes2);
-        }
-        if (release3) {
-            this->io_->Release(codes3);
+        if (batch_size == 16) {
+            computer->ComputeDistsBatch16(batch_codes, result_dists + i);
+        } else if (batch_size == 8) {
+            computer->ComputeDistsBatch8(batch_codes, result_dists + i);
+        } else {
+            computer->ComputeDistsBatch4(batch_codes[0],
+                                         batch_codes[1],
+                                         batch_codes[2],
+                                         batch_codes[3],
+                                         result_dists[i],
+                                         result_dists[i + 1],
+                                         result_dists[i + 2],
+                                         result_dists[i + 3]);
         }
-        if (release4) {
-            this->io_->Release(codes4);
+        for (int64_t j = 0; j < batch_size; ++j) {
+            if (batch_release[j]) {
+                this->io_->Release(batch_codes[j]);
+            }
         }
+        i += batch_size;
+    };
+    while (i + 15 < id_count) {
+        compute_batch(16);
+    }
+    if (i + 7 < id_count) {
+        compute_batch(8);
+    }
+    while (i + 3 < id_count) {
+        compute_batch(4);
     }
     for (; i < id_count; ++i) {
         bool release = false;
@@ -330,6 +435,141 @@ FlattenDataCell<QuantTmpl, IOTmpl>::query(float* result_dists,
     }
 }
 
+template <typename QuantTmpl, typename IOTmpl>
+void
+FlattenDataCell<QuantTmpl, IOTmpl>::query_with_cache(
+    float* result_dists,
+    const std::shared_ptr<Computer<QuantTmpl>>& computer,
+    const InnerIdType* idx,
+    InnerIdType id_count,
+    Allocator* allocator) {
+    // the hit codes are packed at the front, the missed ones keep the version of their id
+    ByteBuffer codes(static_cast<uint64_t>(id_count) * this->code_size_, allocator);
+    Vector<InnerIdType> hits(allocator);
+    Vector<InnerIdType> missed(allocator);
+    Vector<uint32_t> versions(allocator);
+    for (InnerIdType i = 0; i < id_count; ++i) {
+        uint32_t version = 0;
+        auto* dest = codes.data + static_cast<uint64_t>(hits.size()) * code_size_;
+        if (this->cache_->Get(idx[i], dest, &version)) {
+            hits.emplace_back(i);
+        } else {
+            missed.emplace_back(i);
+            versions.emplace_back(version);
+        }
+    }
+    if (missed.empty()) {
+        computer->ScanBatchDists(id_count, codes.data, result_dists);
+        return;
+    }
+
+    // only the missed codes are read, and offered to the cache with the versions taken before
+    auto missed_count = static_cast<InnerIdType>(missed.size());
+    ByteBuffer missed_codes(static_cast<uint64_t>(missed_count) * code_size_, allocator);
+    Vector<uint64_t> sizes(missed_count, this->code_size_, allocator);
+    Vector<uint64_t> offsets(missed_count, 0, allocator);
+    for (InnerIdType j = 0; j < missed_count; ++j) {
+        offsets[j] = static_cast<uint64_t>(idx[missed[j]]) * code_size_;
+    }
+    Vector<float> dists(std::max(hits.size(), missed.size()), allocator);
+    auto score_hits = [&]() {
+        auto hit_count = static_cast<InnerIdType>(hits.size());
+        if (hit_count == 0) {
+            return;
+        }
+        computer->ScanBatchDists(hit_count, codes.data, dists.data());
+        for (InnerIdType j = 0; j < hit_count; ++j) {
+            result_dists[hits[j]] = dists[j];
+        }
+    };
+    auto score_missed = [&](InnerIdType begin, InnerIdType count) {
+        const auto* chunk_codes = missed_codes.data + static_cast<uint64_t>(begin) * code_size_;
+        computer->ScanBatchDists(count, chunk_codes, dists.data());
+        for (InnerIdType j = 0; j < count; ++j) {
+            result_dists[missed[begin + j]] = dists[j];
+            this->cache_->Put(idx[missed[begin + j]],
+                              chunk_codes + static_cast<uint64_t>(j) * code_size_,
+                              versions[begin + j]);
+        }
+    };
+    if constexpr (IOTmpl::SupportAsyncMultiRead()) {
+        // the hits and then each chunk are scored while the reads of the next chunk are in flight
+        constexpr InnerIdType async_read_chunk = 32;
+        auto submit = [&](InnerIdType begin) {
+            auto count = std::min(async_read_chunk, missed_count - begin);
+            return this->io_->SubmitMultiRead(
+                missed_codes.data + static_cast<uint64_t>(begin) * code_size_,
+                sizes.data() + begin,
+                offsets.data() + begin,
+                count);
+        };
+        auto ticket = submit(0);
+        score_hits();
+        for (InnerIdType begin = 0; begin < missed_count; begin += async_read_chunk) {
+            auto count = std::min(async_read_chunk, missed_count - begin);
+            this->io_->WaitMultiRead(ticket);
+            if (begin + count < missed_count) {
+                ticket = submit(begin + count);
+            }
+            score_missed(begin, count);
+        }
+        return;
+    }
+    this->io_->MultiRead(missed_codes.data, sizes.data(), offsets.data(), missed_count);
+    score_hits();
+    score_missed(0, missed_count);
+}
+
+template <typename QuantTmpl, typename IOTmpl>
+void
+FlattenDataCell<QuantTmpl, IOTmpl>::WarmUp(const InnerIdType* ids, InnerIdType count) {
+    if (this->cache_ == nullptr) {
+        return;
+    }
+    ByteBuffer codes(static_cast<uint64_t>(code_size_), allocator_);
+    for (InnerIdType i = 0; i < count; ++i) {
+        if (ids[i] >= this->total_count_) {
+            continue;
+        }
+        auto version = this->cache_->Version(ids[i]);
+        this->GetCodesById(ids[i], codes.data);
+        this->cache_->Pin(ids[i], codes.data, version);
+    }
+}
+
+template <typename QuantTmpl, typename IOTmpl>
+void
+FlattenDataCell<QuantTmpl, IOTmpl>::query_multi(float* result_dists,
+                                                const ComputerInterfacePtr* computers,
+                                                const InnerIdType* idx,
+                                                const uint32_t* computer_idx,
+                                                InnerIdType count) {
+    InnerIdType i = 0;
+    InnerIdType prefetch_i = 0;
+    while (i < count) {
+        // prefetch the codes of the next distinct ids
+        while (prefetch_i < count and prefetch_i < i + this->prefetch_stride_code_) {
+            if (prefetch_i == 0 or idx[prefetch_i] != idx[prefetch_i - 1]) {
+                this->io_->Prefetch(
+                    static_cast<uint64_t>(idx[prefetch_i]) * static_cast<uint64_t>(code_size_),
+                    this->prefetch_depth_code_ * 64);
+            }
+            ++prefetch_i;
+        }
+        auto cur_id = idx[i];
+        bool release = false;
+        const auto* codes = this->GetCodesById(cur_id, release);
+        do {
+            auto* computer = static_cast<Computer<QuantTmpl>*>(computers[computer_idx[i]].get());
+            computer->ComputeDist(codes, result_dists + i);
+            ++i;
+        } while (i < count and idx[i] == cur_id);
+        if (release) {
+            this->io_->Release(codes);
+        }
+    }
+}
+
 template <typename QuantTmpl, typename IOTmpl>
 float
 FlattenDataCell<QuantTmpl, IOTmpl>::ComputePairVectors(InnerIdType id1, InnerIdType id2) {
@@ -375,6 +615,8 @@ FlattenDataCell<QuantTmpl, IOTmpl>::Deserialize(lvalue_or_rvalue<StreamReader> r
     FlattenInterface::Deserialize(reader);
     this->io_->Deserialize(reader);
     this->quantizer_->Deserialize(reader);
+    // the code size may differ from the one the cache was made for
+    this->reset_cache();
 }
 
 template <typename QuantTmpl, typename IOTmpl>
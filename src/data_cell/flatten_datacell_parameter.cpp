@@ -36,6 +36,9 @@ FlattenDataCellParameter::FromJson(const JsonType& json) {
         fmt::format("flatten interface parameters must contains {}", QUANTIZATION_PARAMS_KEY));
     this->quantizer_parameter =
         QuantizerParameter::GetQuantizerParameterByJson(json[QUANTIZATION_PARAMS_KEY]);
+    if (json.contains(FLATTEN_CACHE_SIZE_KEY)) {
+        this->cache_size = json[FLATTEN_CACHE_SIZE_KEY];
+    }
     this->name = FLATTEN_DATA_CELL;
 }
 
@@ -44,6 +47,9 @@ FlattenDataCellParameter::ToJson() const {
     JsonType json;
     json[IO_PARAMS_KEY] = this->io_parameter->ToJson();
     json[QUANTIZATION_PARAMS_KEY] = this->quantizer_parameter->ToJson();
+    if (this->cache_size > 0) {
+        json[FLATTEN_CACHE_SIZE_KEY] = this->cache_size;
+    }
     return json;
 }
 bool
@@ -73,3 +73,65 @@ TEST_CASE("FlattenDataCell Basic Test", "[ut][FlattenDataCell] ") {
         }
     }
 }
+
+TEST_CASE("FlattenDataCell Code Cache Test", "[ut][FlattenDataCell]") {
+    fixtures::TempDir dir("flatten_code_cache");
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto dim = 32;
+    uint64_t count = 1000;
+    constexpr const char* param_temp =
+        R"(
+        {{
+            "io_params": {{
+                "type": "buffer_io",
+                "file_path": "{}"
+            }},
+            "quantization_params": {{
+                "type": "fp32"
+            }},
+            "cache_size": {}
+        }}
+        )";
+    // a tenth of the codes fit in the cache, so the queries mix hits and misses
+    auto cache_size = dim * sizeof(float) * count / 10;
+    auto param_str = fmt::format(param_temp, dir.GenerateRandomFile(), cache_size);
+    auto param = std::make_shared<FlattenDataCellParameter>();
+    param->FromJson(JsonType::parse(param_str));
+    REQUIRE(param->cache_size == cache_size);
+    REQUIRE(param->ToJson()["cache_size"] == cache_size);
+
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    common_param.dim_ = dim;
+    common_param.metric_ = MetricType::METRIC_TYPE_L2SQR;
+    auto flatten = FlattenInterface::MakeInstance(param, common_param);
+    const auto* cache = flatten->GetCache();
+    REQUIRE(cache != nullptr);
+    REQUIRE(cache->Capacity() == count / 10);
+
+    FlattenInterfaceTest test(flatten, common_param.metric_);
+    test.BasicTest(dim, count, 1e-5);
+    REQUIRE(cache->Size() > 0);
+    REQUIRE(cache->Size() <= cache->Capacity());
+    REQUIRE(cache->HitCount() + cache->MissCount() > 0);
+
+    std::vector<InnerIdType> hot_ids = {0, 1, 2, 3};
+    flatten->WarmUp(hot_ids.data(), hot_ids.size());
+    std::vector<uint8_t> cached(flatten->code_size_);
+    std::vector<uint8_t> stored(flatten->code_size_);
+    auto* mutable_cache = const_cast<CodeCache*>(cache);
+    for (auto id : hot_ids) {
+        REQUIRE(mutable_cache->Get(id, cached.data()));
+        flatten->GetCodesById(id, stored.data());
+        REQUIRE(cached == stored);
+    }
+
+    // a rewritten code leaves the cache, and the search which misses it caches the new code
+    auto new_vector = fixtures::generate_vectors(1, dim, false, 7);
+    flatten->InsertVector(new_vector.data(), 0);
+    REQUIRE_FALSE(mutable_cache->Get(0, cached.data()));
+    flatten->WarmUp(hot_ids.data(), 1);
+    REQUIRE(mutable_cache->Get(0, cached.data()));
+    flatten->GetCodesById(0, stored.data());
+    REQUIRE(cached == stored);
+}
@@ -33,8 +33,10 @@ make_instance(const FlattenInterfaceParamPtr& param, const IndexCommonParam& com
             quantizer_param, io_param, common_param);
     }
     if (param->name == FLATTEN_DATA_CELL) {
-        return std::make_shared<FlattenDataCell<QuantTemp, IOTemp>>(
+        auto flatten = std::make_shared<FlattenDataCell<QuantTemp, IOTemp>>(
             quantizer_param, io_param, common_param);
+        flatten->InitCache(param->cache_size);
+        return flatten;
     }
     return nullptr;
 }
@@ -49,6 +51,9 @@ make_instance(const FlattenInterfaceParamPtr& param, const IndexCommonParam& com
     if (quantization_string == QUANTIZATION_TYPE_VALUE_FP32) {
         return make_instance<FP32Quantizer<metric>, IOTemp>(param, common_param);
     }
+    if (quantization_string == QUANTIZATION_TYPE_VALUE_INT8) {
+        return make_instance<INT8Quantizer<metric>, IOTemp>(param, common_param);
+    }
     if (quantization_string == QUANTIZATION_TYPE_VALUE_SQ4) {
         return make_instance<SQ4Quantizer<metric>, IOTemp>(param, common_param);
     }
@@ -111,6 +116,14 @@ FlattenInterface::MakeInstance(const FlattenInterfaceParamPtr& param,
     if (io_type_name == IO_TYPE_VALUE_ASYNC_IO) {
         return make_instance<AsyncIO>(param, common_param);
     }
+    if (io_type_name == IO_TYPE_VALUE_IO_URING_IO) {
+#if defined(ENABLE_LIBURING)
+        return make_instance<IOUringIO>(param, common_param);
+#else
+        throw VsagException(ErrorType::UNSUPPORTED_INDEX_OPERATION,
+                            "io_uring_io requires vsag built with ENABLE_LIBURING");
+#endif
+    }
     if (io_type_name == IO_TYPE_VALUE_MMAP_IO) {
         return make_instance<MMapIO>(param, common_param);
     }
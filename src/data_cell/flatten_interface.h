@@ -18,6 +18,7 @@
 #include <shared_mutex>
 #include <string>
 
+#include "code_cache.h"
 #include "flatten_datacell_parameter.h"
 #include "flatten_interface_parameter.h"
 #include "impl/runtime_parameter.h"
@@ -51,6 +52,31 @@ public:
     virtual ComputerInterfacePtr
     FactoryComputer(const void* query) = 0;
 
+    // compute the distance of each (idx[i], computers[computer_idx[i]]) pair, the pairs sharing
+    // the same id are expected to be adjacent so that their codes are read only once
+    virtual void
+    QueryMulti(float* result_dists,
+               const ComputerInterfacePtr* computers,
+               const InnerIdType* idx,
+               const uint32_t* computer_idx,
+               InnerIdType count,
+               Allocator* allocator = nullptr) {
+        for (InnerIdType i = 0; i < count; ++i) {
+            this->Query(result_dists + i, computers[computer_idx[i]], idx + i, 1, allocator);
+        }
+    }
+
+    // compute the distances of count codes which were encoded by this cell but are stored
+    // elsewhere, e.g. the copies kept next to the adjacency lists of a co-located graph
+    virtual void
+    QueryCodes(float* result_dists,
+               const ComputerInterfacePtr& computer,
+               const uint8_t* codes,
+               InnerIdType count) {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            "QueryCodes not implemented in FlattenInterface");
+    }
+
     virtual void
     Train(const void* data, uint64_t count) = 0;
 
@@ -78,6 +104,21 @@ public:
     virtual void
     ExportModel(const FlattenInterfacePtr& other) const = 0;
 
+    // keep up to memory_size bytes of hot codes in memory, ignored when the codes are in memory
+    virtual void
+    InitCache(uint64_t memory_size) {
+    }
+
+    // load the codes of ids into the cache regardless of their access frequency
+    virtual void
+    WarmUp(const InnerIdType* ids, InnerIdType count) {
+    }
+
+    [[nodiscard]] virtual const CodeCache*
+    GetCache() const {
+        return nullptr;
+    }
+
     virtual void
     InitIO(const IOParamPtr& io_param) {
         throw VsagException(ErrorType::INTERNAL_ERROR,
@@ -31,6 +31,9 @@ public:
     IOParamPtr io_parameter{nullptr};
 
     std::string name;
+
+    // the bytes of codes cached in memory when the io is not in memory, 0 disables the cache
+    uint64_t cache_size{0};
 };
 
 using FlattenInterfaceParamPtr = std::shared_ptr<FlattenInterfaceParameter>;
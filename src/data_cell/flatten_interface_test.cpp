@@ -56,6 +56,17 @@ FlattenInterfaceTest::BasicTest(int64_t dim, uint64_t base_count, float error) {
         }
     }
 
+    // codes copied out of the cell are scored as the stored ones
+    std::vector<uint8_t> codes(flatten_->code_size_ * 2);
+    flatten_->GetCodesById(idx[0], codes.data());
+    flatten_->GetCodesById(idx[1], codes.data() + flatten_->code_size_);
+    std::vector<float> code_dists(2);
+    auto computer = flatten_->FactoryComputer(queries.data());
+    flatten_->Query(dists.data(), computer, idx.data(), 2);
+    flatten_->QueryCodes(code_dists.data(), computer, codes.data(), 2);
+    REQUIRE(std::abs(code_dists[0] - dists[0]) < error);
+    REQUIRE(std::abs(code_dists[1] - dists[1]) < error);
+
     for (int64_t i = 0; i < query_count; ++i) {
         auto idx1 = random() % base_count;
         auto idx2 = random() % base_count;
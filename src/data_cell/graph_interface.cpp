@@ -15,6 +15,7 @@
 
 #include "graph_interface.h"
 
+#include "colocated_datacell.h"
 #include "compressed_graph_datacell.h"
 #include "graph_datacell.h"
 #include "io/io_headers.h"
@@ -22,6 +23,29 @@
 
 namespace vsag {
 
+static GraphInterfacePtr
+make_colocated_instance(const GraphInterfaceParamPtr& graph_param,
+                        const IndexCommonParam& common_param) {
+    auto io_string = std::dynamic_pointer_cast<ColocatedDataCellParameter>(graph_param)
+                         ->io_parameter_->GetTypeName();
+    if (io_string == IO_TYPE_VALUE_BLOCK_MEMORY_IO) {
+        return std::make_shared<ColocatedDataCell<MemoryBlockIO>>(graph_param, common_param);
+    }
+    if (io_string == IO_TYPE_VALUE_MEMORY_IO) {
+        return std::make_shared<ColocatedDataCell<MemoryIO>>(graph_param, common_param);
+    }
+    if (io_string == IO_TYPE_VALUE_BUFFER_IO) {
+        return std::make_shared<ColocatedDataCell<BufferIO>>(graph_param, common_param);
+    }
+    if (io_string == IO_TYPE_VALUE_ASYNC_IO) {
+        return std::make_shared<ColocatedDataCell<AsyncIO>>(graph_param, common_param);
+    }
+    if (io_string == IO_TYPE_VALUE_MMAP_IO) {
+        return std::make_shared<ColocatedDataCell<MMapIO>>(graph_param, common_param);
+    }
+    return nullptr;
+}
+
 GraphInterfacePtr
 GraphInterface::MakeInstance(const GraphInterfaceParamPtr& graph_param,
                              const IndexCommonParam& common_param) {
@@ -30,6 +54,8 @@ GraphInterface::MakeInstance(const GraphInterfaceParamPtr& graph_param,
             return std::make_shared<SparseGraphDataCell>(graph_param, common_param);
         case GraphStorageTypes::GRAPH_STORAGE_TYPE_COMPRESSED:
             return std::make_shared<CompressedGraphDataCell>(graph_param, common_param);
+        case GraphStorageTypes::GRAPH_STORAGE_TYPE_COLOCATED:
+            return make_colocated_instance(graph_param, common_param);
         case GraphStorageTypes::GRAPH_STORAGE_TYPE_FLAT:
             auto io_string = std::dynamic_pointer_cast<GraphDataCellParameter>(graph_param)
                                  ->io_parameter_->GetTypeName();
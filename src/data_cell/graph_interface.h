@@ -75,6 +75,27 @@ public:
                             "GetIds in GraphInterface is not implemented");
     }
 
+    // the size of the code kept next to each adjacency list, 0 for a graph without codes
+    [[nodiscard]] virtual uint32_t
+    ColocatedCodeSize() const {
+        return 0;
+    }
+
+    virtual void
+    InsertCodes(InnerIdType id, const uint8_t* codes) {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            "InsertCodes in GraphInterface is not implemented");
+    }
+
+    // reads the neighbors and the code of id together, one io for a co-located graph
+    virtual void
+    GetNeighborsAndCodes(InnerIdType id,
+                         Vector<InnerIdType>& neighbor_ids,
+                         uint8_t* codes) const {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            "GetNeighborsAndCodes in GraphInterface is not implemented");
+    }
+
 public:
     virtual void
     Serialize(StreamWriter& writer) {
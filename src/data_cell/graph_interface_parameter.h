@@ -25,7 +25,8 @@ using GraphInterfaceParamPtr = std::shared_ptr<GraphInterfaceParameter>;
 enum class GraphStorageTypes {
     GRAPH_STORAGE_TYPE_FLAT = 0,
     GRAPH_STORAGE_TYPE_COMPRESSED = 1,
-    GRAPH_STORAGE_TYPE_SPARSE = 2
+    GRAPH_STORAGE_TYPE_SPARSE = 2,
+    GRAPH_STORAGE_TYPE_COLOCATED = 3
 };
 
 class GraphInterfaceParameter : public Parameter {
@@ -15,16 +15,25 @@
 
 #include "sparse_graph_datacell.h"
 
+#include <limits>
+
+#include "prefetch.h"
 #include "sparse_graph_datacell_parameter.h"
 
 namespace vsag {
 
+static constexpr uint32_t INVALID_SLOT = std::numeric_limits<uint32_t>::max();
+
 SparseGraphDataCell::SparseGraphDataCell(const SparseGraphDatacellParamPtr& graph_param,
                                          Allocator* allocator)
     : allocator_(allocator),
       neighbors_(allocator),
       node_version_(allocator),
-      is_support_delete_(graph_param->support_delete_) {
+      is_support_delete_(graph_param->support_delete_),
+      slot_table_(allocator),
+      offsets_(allocator),
+      flat_neighbors_(allocator),
+      raw_sizes_(allocator) {
     this->maximum_degree_ = graph_param->max_degree_;
     this->remove_flag_bit_ = graph_param->remove_flag_bit_;
     this->id_bit_ = sizeof(InnerIdType) * 8 - this->remove_flag_bit_;
@@ -50,6 +59,7 @@ SparseGraphDataCell::InsertNeighborsById(InnerIdType id, const Vector<InnerIdTyp
     }
     auto size = std::min(this->maximum_degree_, (uint32_t)(neighbor_ids.size()));
     std::unique_lock<std::shared_mutex> wlock(this->neighbors_map_mutex_);
+    this->thaw();
     this->max_capacity_ = std::max(this->max_capacity_, id + 1);
     auto iter = this->neighbors_.find(id);
     if (iter == this->neighbors_.end()) {
@@ -81,6 +91,16 @@ SparseGraphDataCell::InsertNeighborsById(InnerIdType id, const Vector<InnerIdTyp
 uint32_t
 SparseGraphDataCell::GetNeighborSize(InnerIdType id) const {
     std::shared_lock<std::shared_mutex> rlock(this->neighbors_map_mutex_);
+    if (this->frozen_.load(std::memory_order_relaxed)) {
+        auto slot = this->find_slot(id);
+        if (slot == INVALID_SLOT) {
+            return 0;
+        }
+        if (is_support_delete_) {
+            return raw_sizes_[slot];
+        }
+        return static_cast<uint32_t>(offsets_[slot + 1] - offsets_[slot]);
+    }
     auto iter = this->neighbors_.find(id);
     if (iter != this->neighbors_.end()) {
         return iter->second->size();
@@ -90,6 +110,14 @@ SparseGraphDataCell::GetNeighborSize(InnerIdType id) const {
 void
 SparseGraphDataCell::GetNeighbors(InnerIdType id, Vector<InnerIdType>& neighbor_ids) const {
     std::shared_lock<std::shared_mutex> rlock(this->neighbors_map_mutex_);
+    if (this->frozen_.load(std::memory_order_relaxed)) {
+        auto slot = this->find_slot(id);
+        if (slot != INVALID_SLOT) {
+            neighbor_ids.assign(flat_neighbors_.begin() + offsets_[slot],
+                                flat_neighbors_.begin() + offsets_[slot + 1]);
+        }
+        return;
+    }
     auto iter = this->neighbors_.find(id);
     if (iter != this->neighbors_.end()) {
         const auto& ngbrs = iter->second;
@@ -158,6 +186,7 @@ void
 SparseGraphDataCell::DeleteNeighborsById(vsag::InnerIdType id) {
     if (is_support_delete_) {
         std::unique_lock<std::shared_mutex> wlock(this->neighbors_map_mutex_);
+        this->thaw();
         auto iter = node_version_.find(id);
         if (iter != node_version_.end()) {
             if (iter->second + 1 == 0) {
@@ -187,14 +216,14 @@ SparseGraphDataCell::MergeOther(GraphInterfacePtr other, uint64_t bias) {
                                         other_graph->maximum_degree_));
     }
     Vector<InnerIdType> neighbor_ids(allocator_);
-    for (const auto& item : other_graph->neighbors_) {
-        auto id = item.first;
+    for (const auto& id : other_graph->GetIds()) {
         other_graph->GetNeighbors(id, neighbor_ids);
         for (auto& neighbor_id : neighbor_ids) {
             neighbor_id += bias;
         }
         this->InsertNeighborsById(id + bias, neighbor_ids);
         if (is_support_delete_) {
+            std::unique_lock<std::shared_mutex> wlock(this->neighbors_map_mutex_);
             this->node_version_[id + bias] = 0;
         }
     }
@@ -202,11 +231,118 @@ SparseGraphDataCell::MergeOther(GraphInterfacePtr other, uint64_t bias) {
 
 Vector<InnerIdType>
 SparseGraphDataCell::GetIds() const {
+    std::shared_lock<std::shared_mutex> rlock(this->neighbors_map_mutex_);
     Vector<InnerIdType> ids(allocator_);
+    ids.reserve(neighbors_.size());
     for (const auto& item : neighbors_) {
         ids.push_back(item.first);
     }
     return ids;
 }
 
+void
+SparseGraphDataCell::Prefetch(InnerIdType id, uint32_t neighbor_i) {
+    if (not this->frozen_.load(std::memory_order_acquire)) {
+        return;
+    }
+    // a prefetch is only a hint, it never waits for a writer
+    if (not this->neighbors_map_mutex_.try_lock_shared()) {
+        return;
+    }
+    if (this->frozen_.load(std::memory_order_relaxed)) {
+        auto slot = this->find_slot(id);
+        if (slot != INVALID_SLOT) {
+            auto begin = offsets_[slot] + std::max(neighbor_i, 1U) - 1;
+            auto end = offsets_[slot + 1];
+            if (begin < end) {
+                PrefetchLines(flat_neighbors_.data() + begin, (end - begin) * sizeof(InnerIdType));
+            }
+        }
+    }
+    this->neighbors_map_mutex_.unlock_shared();
+}
+
+void
+SparseGraphDataCell::Freeze() {
+    std::unique_lock<std::shared_mutex> wlock(this->neighbors_map_mutex_);
+    this->freeze();
+}
+
+void
+SparseGraphDataCell::freeze() {
+    auto list_count = neighbors_.size();
+    // a power of two table at most half full, indexed by the high bits of a fibonacci hash
+    uint64_t table_size = 2;
+    uint32_t table_bits = 1;
+    while (table_size < list_count * 2) {
+        table_size <<= 1;
+        ++table_bits;
+    }
+    this->slot_shift_ = 64 - table_bits;
+    this->slot_table_.assign(table_size, SlotEntry{0, INVALID_SLOT});
+    this->offsets_.resize(list_count + 1);
+    this->flat_neighbors_.clear();
+    uint64_t neighbor_count = 0;
+    for (const auto& item : neighbors_) {
+        neighbor_count += item.second->size();
+    }
+    this->flat_neighbors_.reserve(neighbor_count);
+    if (is_support_delete_) {
+        this->raw_sizes_.resize(list_count);
+    }
+
+    uint32_t slot = 0;
+    this->offsets_[0] = 0;
+    for (const auto& item : neighbors_) {
+        auto pos = (static_cast<uint64_t>(item.first) * 0x9E3779B97F4A7C15ULL) >> slot_shift_;
+        while (slot_table_[pos].slot != INVALID_SLOT) {
+            pos = (pos + 1) & (table_size - 1);
+        }
+        slot_table_[pos] = SlotEntry{item.first, slot};
+        if (is_support_delete_) {
+            this->raw_sizes_[slot] = static_cast<uint32_t>(item.second->size());
+        }
+        for (const auto& neighbor_id : *item.second) {
+            if (not is_support_delete_) {
+                flat_neighbors_.push_back(neighbor_id);
+                continue;
+            }
+            // removals thaw the graph, so the versions checked here hold until the next write
+            uint8_t cur_version = neighbor_id >> id_bit_;
+            InnerIdType real_id = neighbor_id & remove_flag_mask_;
+            auto version = node_version_.find(real_id);
+            if (version != node_version_.end() and version->second == cur_version) {
+                flat_neighbors_.push_back(real_id);
+            }
+        }
+        this->offsets_[++slot] = flat_neighbors_.size();
+    }
+    this->frozen_.store(true, std::memory_order_release);
+}
+
+void
+SparseGraphDataCell::thaw() {
+    if (not this->frozen_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    this->frozen_.store(false, std::memory_order_release);
+    Vector<SlotEntry>(allocator_).swap(this->slot_table_);
+    Vector<uint64_t>(allocator_).swap(this->offsets_);
+    Vector<InnerIdType>(allocator_).swap(this->flat_neighbors_);
+    Vector<uint32_t>(allocator_).swap(this->raw_sizes_);
+}
+
+uint32_t
+SparseGraphDataCell::find_slot(InnerIdType id) const {
+    auto mask = slot_table_.size() - 1;
+    auto pos = (static_cast<uint64_t>(id) * 0x9E3779B97F4A7C15ULL) >> slot_shift_;
+    while (true) {
+        const auto& entry = slot_table_[pos];
+        if (entry.slot == INVALID_SLOT or entry.id == id) {
+            return entry.slot;
+        }
+        pos = (pos + 1) & mask;
+    }
+}
+
 }  // namespace vsag
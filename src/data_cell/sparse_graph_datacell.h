@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <shared_mutex>
 
 #include "graph_interface.h"
@@ -54,9 +55,7 @@ public:
      * @param neighbor_i index of neighbor, 0 for neighbor size, 1 for first neighbor
      */
     void
-    Prefetch(InnerIdType id, uint32_t neighbor_i) override {
-        // TODO(LHT): implement
-    }
+    Prefetch(InnerIdType id, uint32_t neighbor_i) override;
 
     void
     Serialize(StreamWriter& writer) override;
@@ -70,6 +69,37 @@ public:
     Vector<InnerIdType>
     GetIds() const override;
 
+    /****
+     * packs the neighbor lists into a compact CSR layout for read-mostly search
+     *
+     * the lists are copied into one flat array, found through an open addressing table of
+     * (id, slot) pairs and an offset array, so reading a list is a couple of array loads instead
+     * of a hash node and a pointer chase; stale neighbors of removed nodes are dropped while
+     * packing. the map stays the source of truth: any later write discards the packed copy.
+     */
+    void
+    Freeze();
+
+    [[nodiscard]] bool
+    IsFrozen() const {
+        return this->frozen_.load(std::memory_order_acquire);
+    }
+
+private:
+    struct SlotEntry {
+        InnerIdType id;
+        uint32_t slot;
+    };
+
+    void
+    freeze();
+
+    void
+    thaw();
+
+    [[nodiscard]] uint32_t
+    find_slot(InnerIdType id) const;
+
 private:
     uint32_t code_line_size_{0};
     Allocator* const allocator_{nullptr};
@@ -81,6 +111,15 @@ private:
     uint32_t id_bit_{24};
     uint32_t remove_flag_mask_{0x00ffffff};
     UnorderedMap<InnerIdType, uint8_t> node_version_;
+
+    // the packed copy of neighbors_, only valid while frozen_ is set
+    std::atomic<bool> frozen_{false};
+    Vector<SlotEntry> slot_table_;
+    uint32_t slot_shift_{0};
+    Vector<uint64_t> offsets_;
+    Vector<InnerIdType> flat_neighbors_;
+    // slot -> list size before dropping stale neighbors, GetNeighborSize reports it as the map does
+    Vector<uint32_t> raw_sizes_;
 };
 
 }  // namespace vsag
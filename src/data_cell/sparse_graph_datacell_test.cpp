@@ -89,3 +89,68 @@ TEST_CASE("SparseGraphDataCell Merge Test", "[ut][SparseGraphDataCell]") {
     auto other = GraphInterface::MakeInstance(graph_param, common_param);
     test.MergeTest(other, count);
 }
+
+TEST_CASE("SparseGraphDataCell Freeze Test", "[ut][SparseGraphDataCell]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto is_support_delete = GENERATE(true, false);
+    uint32_t max_degree = 16;
+    InnerIdType count = 500;
+
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    auto graph_param = std::make_shared<SparseGraphDatacellParameter>();
+    graph_param->max_degree_ = max_degree;
+    graph_param->support_delete_ = is_support_delete;
+    auto graph = std::make_shared<SparseGraphDataCell>(graph_param, common_param);
+
+    // only every third id owns a list, as in an upper level of a hierarchical graph
+    std::mt19937 rng(47);
+    Vector<InnerIdType> neighbors(allocator.get());
+    for (InnerIdType id = 0; id < count; id += 3) {
+        neighbors.resize(rng() % max_degree);
+        for (auto& neighbor : neighbors) {
+            neighbor = (rng() % (count / 3)) * 3;
+        }
+        graph->InsertNeighborsById(id, neighbors);
+    }
+
+    auto snapshot = [&]() {
+        // the last entry of each list is the size reported by GetNeighborSize
+        std::vector<std::vector<InnerIdType>> lists(count);
+        Vector<InnerIdType> result(allocator.get());
+        for (InnerIdType id = 0; id < count; ++id) {
+            result.clear();
+            graph->GetNeighbors(id, result);
+            REQUIRE(graph->GetNeighborSize(id) >= result.size());
+            lists[id].assign(result.begin(), result.end());
+            lists[id].push_back(graph->GetNeighborSize(id));
+        }
+        return lists;
+    };
+
+    auto expected = snapshot();
+    graph->Freeze();
+    REQUIRE(graph->IsFrozen());
+    REQUIRE(snapshot() == expected);
+    graph->Prefetch(0, 0);
+    graph->Prefetch(1, 1);
+    graph->Prefetch(count - 1, max_degree);
+
+    // a write switches back to the map and the next freeze packs the new list
+    neighbors.assign({3, 6, 9});
+    graph->InsertNeighborsById(0, neighbors);
+    REQUIRE_FALSE(graph->IsFrozen());
+    expected = snapshot();
+    graph->Freeze();
+    REQUIRE(snapshot() == expected);
+
+    if (is_support_delete) {
+        graph->DeleteNeighborsById(6);
+        REQUIRE_FALSE(graph->IsFrozen());
+        expected = snapshot();
+        graph->Freeze();
+        auto frozen = snapshot();
+        REQUIRE(frozen == expected);
+        REQUIRE(std::find(frozen[0].begin(), frozen[0].end() - 1, 6) == frozen[0].end() - 1);
+    }
+}
@@ -15,10 +15,25 @@
 
 #include "sparse_term_datacell.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include "vsag_exception.h"
+
 namespace vsag {
 
+// the bound of a block is kept this much (relatively) below the threshold, so that a different
+// summation order of the same weights never prunes a doc that would enter the results
+static constexpr float BLOCK_BOUND_SLACK = 1e-5F;
+
 void
-SparseTermDataCell::Query(float* global_dists, const SparseTermComputerPtr& computer) const {
+SparseTermDataCell::Query(float* global_dists,
+                          const SparseTermComputerPtr& computer,
+                          float dist_threshold) const {
+    if (sealed_ and dist_threshold < 0 and block_count_ > 0) {
+        block_max_query(global_dists, computer, dist_threshold);
+        return;
+    }
     while (computer->HasNextTerm()) {
         auto it = computer->NextTermIter();
         auto term = computer->GetTerm(it);
@@ -29,17 +44,100 @@ SparseTermDataCell::Query(float* global_dists, const SparseTermComputerPtr& comp
                 continue;
             }
             __builtin_prefetch(term_ids_[next_term].data(), 0, 3);
-            __builtin_prefetch(term_datas_[next_term].data(), 0, 3);
+            if (quantized_) {
+                __builtin_prefetch(term_codes_[next_term].data(), 0, 3);
+            } else {
+                __builtin_prefetch(term_datas_[next_term].data(), 0, 3);
+            }
         }
         if (term >= term_ids_.size()) {
             continue;
         }
-        computer->ScanForAccumulate(it,
-                                    term_ids_[term].data(),
-                                    term_datas_[term].data(),
-                                    static_cast<uint32_t>(static_cast<float>(term_sizes_[term]) *
-                                                          computer->term_retain_ratio_),
-                                    global_dists);
+        auto term_count = static_cast<uint32_t>(static_cast<float>(term_sizes_[term]) *
+                                                computer->term_retain_ratio_);
+        if (quantized_) {
+            computer->ScanForAccumulateSQ8(it,
+                                           term_ids_[term].data(),
+                                           term_codes_[term].data(),
+                                           term_lower_bounds_[term],
+                                           term_diffs_[term],
+                                           term_count,
+                                           global_dists);
+        } else {
+            computer->ScanForAccumulate(
+                it, term_ids_[term].data(), term_datas_[term].data(), term_count, global_dists);
+        }
+    }
+    computer->ResetTerm();
+}
+
+void
+SparseTermDataCell::block_max_query(float* global_dists,
+                                    const SparseTermComputerPtr& computer,
+                                    float dist_threshold) const {
+    // a doc takes query_val * weight from each term it holds and 0 from the others, so the sum
+    // of min(0, query_val * weight) over the terms bounds the distance of every doc of a block
+    Vector<float> block_bounds(block_count_, 0.0F, allocator_);
+    for (uint32_t it = 0; it < computer->pruned_len_; ++it) {
+        auto term = computer->GetTerm(it);
+        if (term >= term_blocks_.size()) {
+            continue;
+        }
+        auto query_val = computer->GetValue(it);
+        for (const auto& block : term_blocks_[term]) {
+            block_bounds[block.block_id] += std::min(
+                {0.0F, query_val * block.max_weight, query_val * block.min_weight});
+        }
+    }
+
+    auto prune_bound = dist_threshold * (1.0F - BLOCK_BOUND_SLACK);
+    Vector<uint8_t> skipped(block_count_, 0, allocator_);
+    bool any_skipped = false;
+    for (uint32_t i = 0; i < block_count_; ++i) {
+        if (block_bounds[i] > prune_bound) {
+            skipped[i] = 1;
+            any_skipped = true;
+        }
+    }
+    if (not any_skipped) {
+        Query(global_dists, computer);
+        return;
+    }
+
+    // the docs of skipped blocks are left at 0 and InsertHeap drops them as any doc above the
+    // heap top, which is below 0 here
+    while (computer->HasNextTerm()) {
+        auto it = computer->NextTermIter();
+        auto term = computer->GetTerm(it);
+        if (term >= term_ids_.size()) {
+            continue;
+        }
+        auto term_count = static_cast<uint32_t>(static_cast<float>(term_sizes_[term]) *
+                                                computer->term_retain_ratio_);
+        const auto& blocks = term_blocks_[term];
+        for (uint64_t i = 0; i < blocks.size() and blocks[i].begin < term_count; ++i) {
+            if (skipped[blocks[i].block_id] != 0) {
+                continue;
+            }
+            auto begin = blocks[i].begin;
+            auto end = i + 1 < blocks.size() ? std::min(blocks[i + 1].begin, term_count)
+                                             : term_count;
+            if (quantized_) {
+                computer->ScanForAccumulateSQ8(it,
+                                               term_ids_[term].data() + begin,
+                                               term_codes_[term].data() + begin,
+                                               term_lower_bounds_[term],
+                                               term_diffs_[term],
+                                               end - begin,
+                                               global_dists);
+            } else {
+                computer->ScanForAccumulate(it,
+                                            term_ids_[term].data() + begin,
+                                            term_datas_[term].data() + begin,
+                                            end - begin,
+                                            global_dists);
+            }
+        }
     }
     computer->ResetTerm();
 }
@@ -138,6 +236,9 @@ SparseTermDataCell::DocPrune(Vector<std::pair<uint32_t, float>>& sorted_base) co
 
 void
 SparseTermDataCell::InsertVector(const SparseVector& sparse_base, uint32_t base_id) {
+    if (sealed_) {
+        throw VsagException(ErrorType::INTERNAL_ERROR, "insert into a sealed sparse term list");
+    }
     // resize term
     uint32_t max_term_id = 0;
     for (auto i = 0; i < sparse_base.len_; i++) {
@@ -156,6 +257,12 @@ SparseTermDataCell::InsertVector(const SparseVector& sparse_base, uint32_t base_
     for (auto& item : sorted_base) {
         auto term = item.first;
         auto val = item.second;
+        // a term repeated in one vector is merged, the ids of one term list stay distinct as
+        // the vectorized accumulation requires
+        if (not term_ids_[term].empty() and term_ids_[term].back() == base_id) {
+            term_datas_[term].back() += val;
+            continue;
+        }
         term_ids_[term].push_back(base_id);
         term_datas_[term].push_back(val);
         term_sizes_[term] += 1;
@@ -173,14 +280,83 @@ SparseTermDataCell::ResizeTermList(InnerIdType new_term_capacity) {
     term_sizes_.resize(term_capacity_, 0);
 }
 
+void
+SparseTermDataCell::Seal() {
+    if (sealed_) {
+        return;
+    }
+    if (use_quantization_ and not quantized_) {
+        term_codes_.resize(term_capacity_, Vector<uint8_t>(allocator_));
+        term_lower_bounds_.resize(term_capacity_, 0);
+        term_diffs_.resize(term_capacity_, 0);
+        for (uint32_t term = 0; term < term_capacity_; ++term) {
+            const auto& datas = term_datas_[term];
+            auto& codes = term_codes_[term];
+            codes.resize(datas.size());
+            if (datas.empty()) {
+                continue;
+            }
+            auto [min_iter, max_iter] = std::minmax_element(datas.begin(), datas.end());
+            float lower_bound = *min_iter;
+            float diff = *max_iter - *min_iter;
+            for (uint64_t i = 0; i < datas.size(); ++i) {
+                float normalized = diff > 0 ? (datas[i] - lower_bound) / diff : 0.0F;
+                codes[i] = static_cast<uint8_t>(std::lround(normalized * 255.0F));
+            }
+            term_lower_bounds_[term] = lower_bound;
+            term_diffs_[term] = diff;
+            Vector<float>(allocator_).swap(term_datas_[term]);
+        }
+        quantized_ = true;
+    }
+    build_blocks();
+    sealed_ = true;
+}
+
+void
+SparseTermDataCell::build_blocks() {
+    // the bounds are taken from the weights as they are accumulated, i.e. the decoded sq8 ones
+    term_blocks_.assign(term_capacity_, Vector<PostingBlock>(allocator_));
+    uint32_t max_id = 0;
+    bool has_posting = false;
+    for (uint32_t term = 0; term < term_capacity_; ++term) {
+        const auto& ids = term_ids_[term];
+        auto& blocks = term_blocks_[term];
+        for (uint32_t i = 0; i < ids.size(); ++i) {
+            auto block_id = ids[i] / POSTING_BLOCK_SIZE;
+            auto weight = get_weight(term, i);
+            if (blocks.empty() or blocks.back().block_id != block_id) {
+                blocks.push_back({block_id, i, weight, weight});
+            } else {
+                blocks.back().max_weight = std::max(blocks.back().max_weight, weight);
+                blocks.back().min_weight = std::min(blocks.back().min_weight, weight);
+            }
+            max_id = std::max(max_id, ids[i]);
+            has_posting = true;
+        }
+    }
+    block_count_ = has_posting ? max_id / POSTING_BLOCK_SIZE + 1 : 0;
+}
+
 void
 SparseTermDataCell::Serialize(StreamWriter& writer) const {
     StreamWriter::WriteObj(writer, term_capacity_);
+    if (use_quantization_) {
+        StreamWriter::WriteObj(writer, quantized_);
+    }
     for (auto i = 0; i < term_capacity_; i++) {
         StreamWriter::WriteVector(writer, term_ids_[i]);
-        StreamWriter::WriteVector(writer, term_datas_[i]);
+        if (quantized_) {
+            StreamWriter::WriteVector(writer, term_codes_[i]);
+        } else {
+            StreamWriter::WriteVector(writer, term_datas_[i]);
+        }
     }
     StreamWriter::WriteVector(writer, term_sizes_);
+    if (quantized_) {
+        StreamWriter::WriteVector(writer, term_lower_bounds_);
+        StreamWriter::WriteVector(writer, term_diffs_);
+    }
 }
 
 void
@@ -188,11 +364,25 @@ SparseTermDataCell::Deserialize(StreamReader& reader) {
     uint32_t term_capacity;
     StreamReader::ReadObj(reader, term_capacity);
     ResizeTermList(term_capacity);
+    if (use_quantization_) {
+        StreamReader::ReadObj(reader, quantized_);
+    }
+    if (quantized_) {
+        term_codes_.resize(term_capacity_, Vector<uint8_t>(allocator_));
+    }
     for (auto i = 0; i < term_capacity_; i++) {
         StreamReader::ReadVector(reader, term_ids_[i]);
-        StreamReader::ReadVector(reader, term_datas_[i]);
+        if (quantized_) {
+            StreamReader::ReadVector(reader, term_codes_[i]);
+        } else {
+            StreamReader::ReadVector(reader, term_datas_[i]);
+        }
     }
     StreamReader::ReadVector(reader, term_sizes_);
+    if (quantized_) {
+        StreamReader::ReadVector(reader, term_lower_bounds_);
+        StreamReader::ReadVector(reader, term_diffs_);
+    }
 }
 
 template void
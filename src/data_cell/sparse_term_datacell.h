@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include "algorithm/sindi/sindi_parameter.h"
 #include "impl/basic_searcher.h"
 #include "quantization/sparse_quantization//sparse_term_computer.h"
@@ -27,16 +29,32 @@ class SparseTermDataCell {
 public:
     SparseTermDataCell() = default;
 
-    SparseTermDataCell(float doc_prune_ratio, Allocator* allocator)
+    SparseTermDataCell(float doc_prune_ratio, Allocator* allocator, bool use_quantization = false)
         : doc_prune_ratio_(doc_prune_ratio),
+          use_quantization_(use_quantization),
           allocator_(allocator),
           term_ids_(0, Vector<uint32_t>(allocator), allocator),
           term_datas_(0, Vector<float>(allocator), allocator),
-          term_sizes_(allocator) {
+          term_sizes_(allocator),
+          term_codes_(0, Vector<uint8_t>(allocator), allocator),
+          term_lower_bounds_(allocator),
+          term_diffs_(allocator),
+          term_blocks_(0, Vector<PostingBlock>(allocator), allocator) {
     }
 
+    /**
+     * @brief Accumulates the negative inner products of the query with the docs of this cell.
+     *
+     * @param global_dists The distances indexed by the id in this cell.
+     * @param computer The query.
+     * @param dist_threshold Once the cell is sealed, the docs of a block whose lower bound of
+     *        distance exceeds this threshold are skipped and left at 0, which is exact as long
+     *        as the threshold is negative and no skipped doc may enter the results.
+     */
     void
-    Query(float* global_dists, const SparseTermComputerPtr& computer) const;
+    Query(float* global_dists,
+          const SparseTermComputerPtr& computer,
+          float dist_threshold = std::numeric_limits<float>::max()) const;
 
     template <InnerSearchMode mode = InnerSearchMode::KNN_SEARCH,
               InnerSearchType type = InnerSearchType::PURE>
@@ -56,15 +74,60 @@ public:
     void
     ResizeTermList(InnerIdType new_term_capacity);
 
+    /**
+     * @brief Builds the block bounds of every term list, no vector can be inserted afterwards.
+     *        With quantization the term weights are also encoded into sq8 codes with a range
+     *        per term and the fp32 weights are released.
+     */
+    void
+    Seal();
+
     void
     Serialize(StreamWriter& writer) const;
 
     void
     Deserialize(StreamReader& reader);
 
+private:
+    void
+    block_max_query(float* global_dists,
+                    const SparseTermComputerPtr& computer,
+                    float dist_threshold) const;
+
+    void
+    build_blocks();
+
+    [[nodiscard]] float
+    get_weight(uint32_t term, uint32_t index) const {
+        if (quantized_) {
+            return term_lower_bounds_[term] +
+                   static_cast<float>(term_codes_[term][index]) * term_diffs_[term] / 255.0F;
+        }
+        return term_datas_[term][index];
+    }
+
 public:
+    // the docs of one window are grouped by id into blocks of this size for the score bounds
+    static constexpr uint32_t POSTING_BLOCK_SIZE = 256;
+
+    // the postings of one term list that fall into one doc block
+    struct PostingBlock {
+        uint32_t block_id{0};
+        uint32_t begin{0};
+        float max_weight{0};
+        float min_weight{0};
+    };
+
     float doc_prune_ratio_{0};
 
+    bool use_quantization_{false};
+
+    // no vector can be inserted and the block bounds are built
+    bool sealed_{false};
+
+    // the weights are held in term_codes_ instead of term_datas_
+    bool quantized_{false};
+
     uint32_t term_capacity_{0};
 
     Vector<Vector<uint32_t>> term_ids_;
@@ -73,6 +136,18 @@ public:
 
     Vector<uint32_t> term_sizes_;
 
+    // the weight of term_codes_[t][i] is term_lower_bounds_[t] + code * term_diffs_[t] / 255
+    Vector<Vector<uint8_t>> term_codes_;
+
+    Vector<float> term_lower_bounds_;
+
+    Vector<float> term_diffs_;
+
+    // the blocks of each term list in id order, built by Seal() and not serialized
+    Vector<Vector<PostingBlock>> term_blocks_;
+
+    uint32_t block_count_{0};
+
     Allocator* const allocator_{nullptr};
 };
 
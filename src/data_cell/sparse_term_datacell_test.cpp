@@ -140,6 +140,48 @@ TEST_CASE("SparseTermDatacell Basic Test", "[ut][SparseTermDatacell]") {
             REQUIRE(std::abs(dists[i] - 0) < 1e-3);
         }
     }
+    SECTION("test query with block bounds") {
+        data_cell->Seal();
+        REQUIRE(data_cell->sealed_);
+        REQUIRE_FALSE(data_cell->quantized_);
+        REQUIRE(data_cell->block_count_ == 1);
+        REQUIRE_THROWS(data_cell->InsertVector(sparse_vectors[0], count_base));
+
+        // the single block is bounded by -(5 + 6 + ... + 18) = -161, the max weight of each term
+        std::vector<float> dists(count_base, 0);
+        data_cell->Query(dists.data(), computer, -100);
+        for (auto i = 0; i < dists.size(); i++) {
+            REQUIRE(std::abs(dists[i] + exp_dists[i]) < 1e-3);
+        }
+        std::fill(dists.begin(), dists.end(), 0);
+        data_cell->Query(dists.data(), computer, -200);
+        for (auto i = 0; i < dists.size(); i++) {
+            REQUIRE(dists[i] == 0);
+        }
+    }
+
+    SECTION("test query with quantized term weights") {
+        auto quantized_cell =
+            std::make_shared<SparseTermDataCell>(doc_prune_ratio, allocator.get(), true);
+        for (auto i = 0; i < count_base; i++) {
+            quantized_cell->InsertVector(sparse_vectors[i], i);
+        }
+        quantized_cell->Seal();
+        REQUIRE(quantized_cell->sealed_);
+        REQUIRE(quantized_cell->quantized_);
+        REQUIRE_THROWS(quantized_cell->InsertVector(sparse_vectors[0], count_base));
+        for (auto i = 0; i < quantized_cell->term_capacity_; i++) {
+            REQUIRE(quantized_cell->term_codes_[i].size() == exp_size[i]);
+            REQUIRE(quantized_cell->term_datas_[i].empty());
+        }
+        // each term weight is off by at most half a quantization step of its range
+        std::vector<float> dists(count_base, 0);
+        quantized_cell->Query(dists.data(), computer);
+        for (auto i = 0; i < dists.size(); i++) {
+            REQUIRE(std::abs(dists[i] + exp_dists[i]) < 0.1);
+        }
+    }
+
     // clean
     for (auto& item : sparse_vectors) {
         delete[] item.vals_;
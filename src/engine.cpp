@@ -33,6 +33,7 @@
 #include "index/hnsw_zparameters.h"
 #include "index/index_common_param.h"
 #include "index/index_impl.h"
+#include "numa_thread_pool.h"
 #include "resource_owner_wrapper.h"
 #include "safe_thread_pool.h"
 #include "typing.h"
@@ -178,6 +179,16 @@ Engine::CreateThreadPool(uint32_t num_threads) {
     return std::make_shared<DefaultThreadPool>(num_threads);
 }
 
+tl::expected<std::shared_ptr<ThreadPool>, Error>
+Engine::CreateNumaThreadPool(uint32_t num_threads_per_node) {
+    if (num_threads_per_node <= 0 || num_threads_per_node > 512) {
+        LOG_ERROR_AND_RETURNS(ErrorType::INVALID_ARGUMENT,
+                              "failed to create numa thread pool: invalid number of threads:",
+                              std::to_string(num_threads_per_node));
+    }
+    return std::make_shared<NumaThreadPool>(num_threads_per_node);
+}
+
 }  // namespace vsag
 
 // NOLINTEND(readability-else-after-return )
@@ -15,17 +15,46 @@
 
 #include "basic_searcher.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <limits>
+#include <mutex>
+#include <numeric>
 
 #include "impl/heap/standard_heap.h"
+#include "inner_string_params.h"
 #include "utils/linear_congruential_generator.h"
 
 namespace vsag {
 
+// hops with fewer unvisited neighbors are computed in one go, without cross-hop prefetching
+static constexpr uint32_t CROSS_HOP_PREFETCH_MIN_COUNT = 16;
+
 BasicSearcher::BasicSearcher(const IndexCommonParam& common_param, MutexArrayPtr mutex_array)
     : allocator_(common_param.allocator_.get()), mutex_array_(std::move(mutex_array)) {
 }
 
+void
+BasicSearcher::get_neighbors(const GraphInterfacePtr& graph,
+                             InnerIdType id,
+                             Vector<InnerIdType>& neighbors,
+                             uint8_t* node_codes) const {
+    auto read = [&]() {
+        if (node_codes != nullptr) {
+            graph->GetNeighborsAndCodes(id, neighbors, node_codes);
+        } else {
+            graph->GetNeighbors(id, neighbors);
+        }
+    };
+    if (this->mutex_array_ != nullptr) {
+        SharedLock lock(this->mutex_array_, id);
+        read();
+    } else {
+        read();
+    }
+}
+
 uint32_t
 BasicSearcher::visit(const GraphInterfacePtr& graph,
                      const VisitedListPtr& vl,
@@ -34,15 +63,14 @@ BasicSearcher::visit(const GraphInterfacePtr& graph,
                      float skip_ratio,
                      Vector<InnerIdType>& to_be_visited_rid,
                      Vector<InnerIdType>& to_be_visited_id,
-                     Vector<InnerIdType>& neighbors) const {
+                     Vector<InnerIdType>& neighbors,
+                     uint8_t* node_codes,
+                     bool neighbors_ready) const {
     LinearCongruentialGenerator generator;
     uint32_t count_no_visited = 0;
 
-    if (this->mutex_array_ != nullptr) {
-        SharedLock lock(this->mutex_array_, current_node_pair.second);
-        graph->GetNeighbors(current_node_pair.second, neighbors);
-    } else {
-        graph->GetNeighbors(current_node_pair.second, neighbors);
+    if (not neighbors_ready) {
+        get_neighbors(graph, current_node_pair.second, neighbors, node_codes);
     }
 
     float skip_threshold =
@@ -67,6 +95,119 @@ BasicSearcher::visit(const GraphInterfacePtr& graph,
     return count_no_visited;
 }
 
+uint32_t
+BasicSearcher::visit_two_hop(const GraphInterfacePtr& graph,
+                             const VisitedListPtr& vl,
+                             const std::pair<float, uint64_t>& current_node_pair,
+                             const Filter* filter,
+                             const Filter* attr_filter,
+                             Vector<InnerIdType>& to_be_visited_rid,
+                             Vector<InnerIdType>& to_be_visited_id,
+                             Vector<InnerIdType>& neighbors,
+                             Vector<InnerIdType>& second_neighbors,
+                             uint8_t* node_codes,
+                             bool neighbors_ready) const {
+    auto check_func = [filter, attr_filter](InnerIdType id) {
+        return (filter == nullptr or filter->CheckValid(id)) and
+               (attr_filter == nullptr or attr_filter->CheckValid(id));
+    };
+
+    auto capacity = static_cast<uint32_t>(to_be_visited_id.size());
+    uint32_t count_no_visited = 0;
+    if (not neighbors_ready) {
+        get_neighbors(graph, current_node_pair.second, neighbors, node_codes);
+    }
+
+    // the direct neighbors come first, they are the closest to the current node
+    for (uint32_t i = 0; i < neighbors.size(); i++) {
+        if (i + prefetch_stride_visit_ < neighbors.size()) {
+            vl->Prefetch(neighbors[i + prefetch_stride_visit_]);
+        }
+        if (vl->Get(neighbors[i]) or not check_func(neighbors[i])) {
+            continue;
+        }
+        vl->Set(neighbors[i]);
+        to_be_visited_rid[count_no_visited] = i;
+        to_be_visited_id[count_no_visited] = neighbors[i];
+        count_no_visited++;
+    }
+
+    // a rejected neighbor is marked visited without computing its distance, its allowed
+    // neighbors fill the remaining slots
+    for (uint32_t i = 0; i < neighbors.size(); i++) {
+        if (vl->Get(neighbors[i])) {
+            continue;
+        }
+        vl->Set(neighbors[i]);
+        if (count_no_visited >= capacity) {
+            continue;
+        }
+        get_neighbors(graph, neighbors[i], second_neighbors);
+        for (const auto& second_id : second_neighbors) {
+            if (count_no_visited >= capacity) {
+                break;
+            }
+            if (vl->Get(second_id) or not check_func(second_id)) {
+                continue;
+            }
+            vl->Set(second_id);
+            to_be_visited_rid[count_no_visited] = i;
+            to_be_visited_id[count_no_visited] = second_id;
+            count_no_visited++;
+        }
+    }
+    return count_no_visited;
+}
+
+uint32_t
+BasicSearcher::CrossHopSplitSize(uint32_t count_no_visited) {
+    if (count_no_visited < CROSS_HOP_PREFETCH_MIN_COUNT) {
+        return 0;
+    }
+    return (count_no_visited / 2) & ~7U;
+}
+
+int64_t
+BasicSearcher::query_with_cross_hop_prefetch(const GraphInterfacePtr& graph,
+                                             const FlattenInterfacePtr& flatten,
+                                             const VisitedListPtr& vl,
+                                             const ComputerInterfacePtr& computer,
+                                             const DistanceHeap& candidate_set,
+                                             const Vector<InnerIdType>& to_be_visited_id,
+                                             uint32_t count_no_visited,
+                                             Vector<InnerIdType>& next_neighbors,
+                                             Vector<float>& line_dists,
+                                             Allocator* alloc) const {
+    // small hops and out-of-memory codes (read in one batched io) gain nothing from the split,
+    // and a co-located graph reads the codes of the next hop together with its neighbors
+    uint32_t half = CrossHopSplitSize(count_no_visited);
+    if (half == 0 or candidate_set.Empty() or not flatten->InMemory() or
+        graph->ColocatedCodeSize() > 0) {
+        flatten->Query(
+            line_dists.data(), computer, to_be_visited_id.data(), count_no_visited, alloc);
+        return -1;
+    }
+
+    flatten->Query(line_dists.data(), computer, to_be_visited_id.data(), half, alloc);
+
+    // the best remaining candidate is most likely the next hop, its neighbors are visited
+    // right after this hop, so their codes are loaded while the second half is computed
+    auto next_id = static_cast<InnerIdType>(candidate_set.Top().second);
+    get_neighbors(graph, next_id, next_neighbors);
+    for (const auto& neighbor : next_neighbors) {
+        if (not vl->Get(neighbor)) {
+            flatten->Prefetch(neighbor);
+        }
+    }
+
+    flatten->Query(line_dists.data() + half,
+                   computer,
+                   to_be_visited_id.data() + half,
+                   count_no_visited - half,
+                   alloc);
+    return next_id;
+}
+
 DistHeapPtr
 BasicSearcher::Search(const GraphInterfacePtr& graph,
                       const FlattenInterfacePtr& flatten,
@@ -92,6 +233,464 @@ BasicSearcher::Search(const GraphInterfacePtr& graph,
     return this->search_impl<KNN_SEARCH>(graph, flatten, vl, query, inner_search_param, iter_ctx);
 }
 
+std::vector<DistHeapPtr>
+BasicSearcher::BatchSearch(const GraphInterfacePtr& graph,
+                           const FlattenInterfacePtr& flatten,
+                           const std::vector<VisitedListPtr>& vls,
+                           const std::vector<const void*>& queries,
+                           const std::vector<InnerIdType>& eps,
+                           const InnerSearchParam& inner_search_param,
+                           const LabelTablePtr& label_table) const {
+    Allocator* alloc =
+        inner_search_param.search_alloc == nullptr ? allocator_ : inner_search_param.search_alloc;
+    auto query_count = static_cast<uint32_t>(queries.size());
+    std::vector<DistHeapPtr> top_candidates(query_count);
+    std::vector<DistHeapPtr> candidate_sets(query_count);
+    for (uint32_t q = 0; q < query_count; ++q) {
+        top_candidates[q] = std::make_shared<StandardHeap<true, false>>(alloc, -1);
+        candidate_sets[q] = std::make_shared<StandardHeap<true, false>>(alloc, -1);
+    }
+
+    if (not graph or not flatten or query_count == 0) {
+        return top_candidates;
+    }
+    CHECK_ARGUMENT(vls.size() == query_count and eps.size() == query_count,
+                   "the count of visited lists and entry points must equal to the query count");
+
+    auto is_id_allowed = inner_search_param.is_inner_id_allowed;
+    auto ef = inner_search_param.ef;
+
+    Filter* attr_ft = nullptr;
+    if (not inner_search_param.executors.empty() and inner_search_param.executors[0] != nullptr) {
+        inner_search_param.executors[0]->Clear();
+        attr_ft = inner_search_param.executors[0]->Run();
+    }
+
+    auto check_func = [&is_id_allowed, &attr_ft](InnerIdType id) {
+        return (is_id_allowed == nullptr or is_id_allowed->CheckValid(id)) and
+               (attr_ft == nullptr or attr_ft->CheckValid(id));
+    };
+
+    float skip_threshold = 0.0F;
+    if (is_id_allowed != nullptr and is_id_allowed->ValidRatio() != 1.0F) {
+        skip_threshold = 1 - ((1 - is_id_allowed->ValidRatio()) * inner_search_param.skip_ratio);
+    }
+
+    Vector<ComputerInterfacePtr> computers(alloc);
+    computers.reserve(query_count);
+    for (const auto* query : queries) {
+        computers.emplace_back(flatten->FactoryComputer(query));
+    }
+    Vector<float> lower_bounds(query_count, std::numeric_limits<float>::max(), alloc);
+    auto* stats = inner_search_param.statistics;
+    SearchStageTimer stage_timer(stats);
+    uint64_t filter_rejections = 0;
+
+    // (node, query) pairs waiting for distance computation, kept in the order of a single-query
+    // search, and the permutation which groups them by node to share the code fetches
+    Vector<InnerIdType> pair_ids(alloc);
+    Vector<uint32_t> pair_queries(alloc);
+    Vector<uint32_t> pair_order(alloc);
+    Vector<InnerIdType> sorted_ids(alloc);
+    Vector<uint32_t> sorted_queries(alloc);
+    Vector<float> sorted_dists(alloc);
+    Vector<float> pair_dists(alloc);
+
+    auto compute_pairs = [&]() {
+        stage_timer.Start();
+        auto pair_count = static_cast<uint32_t>(pair_ids.size());
+        pair_order.resize(pair_count);
+        std::iota(pair_order.begin(), pair_order.end(), 0);
+        std::stable_sort(pair_order.begin(), pair_order.end(), [&](uint32_t a, uint32_t b) {
+            return pair_ids[a] < pair_ids[b];
+        });
+        sorted_ids.resize(pair_count);
+        sorted_queries.resize(pair_count);
+        sorted_dists.resize(pair_count);
+        for (uint32_t i = 0; i < pair_count; ++i) {
+            sorted_ids[i] = pair_ids[pair_order[i]];
+            sorted_queries[i] = pair_queries[pair_order[i]];
+        }
+        if (stats != nullptr) {
+            stats->dist_cmp += pair_count;
+        }
+        flatten->QueryMulti(sorted_dists.data(),
+                            computers.data(),
+                            sorted_ids.data(),
+                            sorted_queries.data(),
+                            pair_count,
+                            alloc);
+        pair_dists.resize(pair_count);
+        for (uint32_t i = 0; i < pair_count; ++i) {
+            pair_dists[pair_order[i]] = sorted_dists[i];
+        }
+        stage_timer.Stop(&SearchStatistics::distance_time_ms);
+    };
+
+    for (uint32_t q = 0; q < query_count; ++q) {
+        pair_ids.emplace_back(eps[q]);
+        pair_queries.emplace_back(q);
+    }
+    compute_pairs();
+    for (uint32_t q = 0; q < query_count; ++q) {
+        auto ep = eps[q];
+        if (check_func(ep)) {
+            top_candidates[q]->Push(pair_dists[q], ep);
+            lower_bounds[q] = top_candidates[q]->Top().first;
+        } else {
+            filter_rejections++;
+        }
+        candidate_sets[q]->Push(-pair_dists[q], ep);
+        vls[q]->Set(ep);
+    }
+
+    // the node expanded by each active query in this round, sorted to read each list only once
+    Vector<std::pair<InnerIdType, uint32_t>> expand_nodes(alloc);
+    expand_nodes.reserve(query_count);
+    Vector<InnerIdType> neighbors(graph->MaximumDegree(), alloc);
+
+    while (true) {
+        if (inner_search_param.time_cost != nullptr and
+            inner_search_param.time_cost->CheckOvertime()) {
+            break;
+        }
+
+        expand_nodes.clear();
+        for (uint32_t q = 0; q < query_count; ++q) {
+            auto& candidate_set = candidate_sets[q];
+            if (candidate_set->Empty()) {
+                continue;
+            }
+            auto current_node_pair = candidate_set->Top();
+            if ((-current_node_pair.first) > lower_bounds[q] &&
+                top_candidates[q]->Size() == ef) {
+                continue;
+            }
+            candidate_set->Pop();
+            if (not candidate_set->Empty()) {
+                graph->Prefetch(candidate_set->Top().second, 0);
+            }
+            expand_nodes.emplace_back(current_node_pair.second, q);
+        }
+        if (expand_nodes.empty()) {
+            break;
+        }
+        std::sort(expand_nodes.begin(), expand_nodes.end());
+        if (stats != nullptr) {
+            stats->hops += expand_nodes.size();
+        }
+
+        stage_timer.Start();
+        pair_ids.clear();
+        pair_queries.clear();
+        for (uint64_t i = 0; i < expand_nodes.size(); ++i) {
+            auto node = expand_nodes[i].first;
+            if (i == 0 or expand_nodes[i - 1].first != node) {
+                if (this->mutex_array_ != nullptr) {
+                    SharedLock lock(this->mutex_array_, node);
+                    graph->GetNeighbors(node, neighbors);
+                } else {
+                    graph->GetNeighbors(node, neighbors);
+                }
+            }
+            auto q = expand_nodes[i].second;
+            const auto& vl = vls[q];
+            LinearCongruentialGenerator generator;
+            uint32_t count_no_visited = 0;
+            for (uint32_t j = 0; j < neighbors.size(); ++j) {
+                if (j + prefetch_stride_visit_ < neighbors.size()) {
+                    vl->Prefetch(neighbors[j + prefetch_stride_visit_]);
+                }
+                if (not vl->Get(neighbors[j])) {
+                    if (not is_id_allowed || count_no_visited == 0 ||
+                        generator.NextFloat() > skip_threshold ||
+                        is_id_allowed->CheckValid(neighbors[j])) {
+                        pair_ids.emplace_back(neighbors[j]);
+                        pair_queries.emplace_back(q);
+                        count_no_visited++;
+                    }
+                    vl->Set(neighbors[j]);
+                }
+            }
+        }
+        stage_timer.Stop(&SearchStatistics::graph_time_ms);
+        compute_pairs();
+
+        for (uint64_t i = 0; i < pair_ids.size(); ++i) {
+            auto q = pair_queries[i];
+            auto id = pair_ids[i];
+            auto dist = pair_dists[i];
+            auto& top_candidate = top_candidates[q];
+            if (top_candidate->Size() < ef || lower_bounds[q] > dist) {
+                candidate_sets[q]->Push(-dist, id);
+                if (check_func(id)) {
+                    top_candidate->Push(dist, id);
+                } else {
+                    filter_rejections++;
+                }
+                if (inner_search_param.consider_duplicate and label_table != nullptr and
+                    label_table->CompressDuplicateData()) {
+                    const auto& duplicate_ids = label_table->GetDuplicateId(id);
+                    for (const auto& item : duplicate_ids) {
+                        if (check_func(item)) {
+                            top_candidate->Push(dist, item);
+                        }
+                    }
+                }
+                if (top_candidate->Size() > ef) {
+                    top_candidate->Pop();
+                }
+                if (not top_candidate->Empty()) {
+                    lower_bounds[q] = top_candidate->Top().first;
+                }
+            }
+        }
+    }
+
+    if (stats != nullptr) {
+        stats->filter_rejections += filter_rejections;
+    }
+    for (auto& top_candidate : top_candidates) {
+        while (top_candidate->Size() > inner_search_param.topk) {
+            top_candidate->Pop();
+        }
+    }
+    return top_candidates;
+}
+
+namespace {
+// the state shared by all the workers of one ParallelSearch, it is held by shared_ptr because a
+// worker which is scheduled after the search finished still touches finished and running
+struct ParallelSearchContext {
+    std::mutex mutex;
+    // signalled under mutex when candidates are merged, the search finishes or a worker leaves
+    std::condition_variable cv;
+    DistHeapPtr top_candidates{nullptr};
+    DistHeapPtr candidate_set{nullptr};
+    float lower_bound{std::numeric_limits<float>::max()};
+    // the count of nodes popped from candidate_set and not merged back yet
+    uint32_t in_flight{0};
+    std::atomic<bool> finished{false};
+    std::atomic<uint32_t> running{0};
+};
+}  // namespace
+
+DistHeapPtr
+BasicSearcher::ParallelSearch(const GraphInterfacePtr& graph,
+                              const FlattenInterfacePtr& flatten,
+                              const ConcurrentVisitedListPtr& vl,
+                              const void* query,
+                              const InnerSearchParam& inner_search_param,
+                              SafeThreadPool* thread_pool,
+                              const LabelTablePtr& label_table) const {
+    Allocator* alloc =
+        inner_search_param.search_alloc == nullptr ? allocator_ : inner_search_param.search_alloc;
+    auto ctx = std::make_shared<ParallelSearchContext>();
+    ctx->top_candidates = std::make_shared<StandardHeap<true, false>>(alloc, -1);
+    ctx->candidate_set = std::make_shared<StandardHeap<true, false>>(alloc, -1);
+
+    if (not graph or not flatten) {
+        return ctx->top_candidates;
+    }
+
+    auto is_id_allowed = inner_search_param.is_inner_id_allowed;
+    auto ep = inner_search_param.ep;
+    auto ef = inner_search_param.ef;
+
+    Filter* attr_ft = nullptr;
+    if (not inner_search_param.executors.empty() and inner_search_param.executors[0] != nullptr) {
+        inner_search_param.executors[0]->Clear();
+        attr_ft = inner_search_param.executors[0]->Run();
+    }
+
+    auto check_func = [&is_id_allowed, &attr_ft](InnerIdType id) {
+        return (is_id_allowed == nullptr or is_id_allowed->CheckValid(id)) and
+               (attr_ft == nullptr or attr_ft->CheckValid(id));
+    };
+
+    float skip_threshold = 0.0F;
+    if (is_id_allowed != nullptr and is_id_allowed->ValidRatio() != 1.0F) {
+        skip_threshold = 1 - ((1 - is_id_allowed->ValidRatio()) * inner_search_param.skip_ratio);
+    }
+
+    float dist = 0.0F;
+    auto computer = flatten->FactoryComputer(query);
+    flatten->Query(&dist, computer, &ep, 1, alloc);
+    // the workers add their counters under ctx->mutex
+    auto* stats = inner_search_param.statistics;
+    if (stats != nullptr) {
+        stats->dist_cmp++;
+    }
+    if (check_func(ep)) {
+        ctx->top_candidates->Push(dist, ep);
+        ctx->lower_bound = ctx->top_candidates->Top().first;
+    } else if (stats != nullptr) {
+        stats->filter_rejections++;
+    }
+    ctx->candidate_set->Push(-dist, ep);
+    (void)vl->TestAndSet(ep);
+
+    // the buffers of the workers are allocated by allocator_, the search allocator is not
+    // required to be thread safe
+    auto run_worker = [&](const ComputerInterfacePtr& worker_computer) {
+        Vector<InnerIdType> neighbors(graph->MaximumDegree(), allocator_);
+        Vector<InnerIdType> to_be_visited_id(graph->MaximumDegree(), allocator_);
+        Vector<float> line_dists(graph->MaximumDegree(), allocator_);
+        LinearCongruentialGenerator generator;
+
+        while (not ctx->finished.load()) {
+            std::pair<float, InnerIdType> current_node_pair;
+            {
+                std::unique_lock<std::mutex> lock(ctx->mutex);
+                const auto& candidate_set = ctx->candidate_set;
+                auto exhausted = [&]() {
+                    return candidate_set->Empty() or
+                           ((-candidate_set->Top().first) > ctx->lower_bound and
+                            ctx->top_candidates->Size() == ef);
+                };
+                // the nodes in flight may still bring closer candidates, wait for their merge
+                while (not ctx->finished.load() and exhausted() and ctx->in_flight > 0) {
+                    ctx->cv.wait(lock);
+                }
+                if (ctx->finished.load()) {
+                    break;
+                }
+                if (exhausted()) {
+                    ctx->finished.store(true);
+                    ctx->cv.notify_all();
+                    break;
+                }
+                current_node_pair = candidate_set->Top();
+                candidate_set->Pop();
+                ctx->in_flight++;
+            }
+
+            if (inner_search_param.time_cost != nullptr and
+                inner_search_param.time_cost->CheckOvertime()) {
+                std::lock_guard<std::mutex> lock(ctx->mutex);
+                ctx->in_flight--;
+                ctx->finished.store(true);
+                ctx->cv.notify_all();
+                break;
+            }
+
+            if (this->mutex_array_ != nullptr) {
+                SharedLock lock(this->mutex_array_, current_node_pair.second);
+                graph->GetNeighbors(current_node_pair.second, neighbors);
+            } else {
+                graph->GetNeighbors(current_node_pair.second, neighbors);
+            }
+
+            uint32_t count_no_visited = 0;
+            for (uint32_t i = 0; i < neighbors.size(); i++) {
+                if (i + prefetch_stride_visit_ < neighbors.size()) {
+                    vl->Prefetch(neighbors[i + prefetch_stride_visit_]);
+                }
+                if (not vl->TestAndSet(neighbors[i])) {
+                    if (not is_id_allowed || count_no_visited == 0 ||
+                        generator.NextFloat() > skip_threshold ||
+                        is_id_allowed->CheckValid(neighbors[i])) {
+                        to_be_visited_id[count_no_visited] = neighbors[i];
+                        count_no_visited++;
+                    }
+                }
+            }
+
+            flatten->Query(line_dists.data(),
+                           worker_computer,
+                           to_be_visited_id.data(),
+                           count_no_visited,
+                           allocator_);
+
+            std::lock_guard<std::mutex> lock(ctx->mutex);
+            auto& top_candidates = ctx->top_candidates;
+            if (stats != nullptr) {
+                stats->hops++;
+                stats->dist_cmp += count_no_visited;
+            }
+            for (uint32_t i = 0; i < count_no_visited; i++) {
+                auto id_dist = line_dists[i];
+                auto id = to_be_visited_id[i];
+                if (top_candidates->Size() < ef || ctx->lower_bound > id_dist) {
+                    ctx->candidate_set->Push(-id_dist, id);
+                    if (check_func(id)) {
+                        top_candidates->Push(id_dist, id);
+                    } else if (stats != nullptr) {
+                        stats->filter_rejections++;
+                    }
+                    if (inner_search_param.consider_duplicate and label_table != nullptr and
+                        label_table->CompressDuplicateData()) {
+                        const auto& duplicate_ids = label_table->GetDuplicateId(id);
+                        for (const auto& item : duplicate_ids) {
+                            if (check_func(item)) {
+                                top_candidates->Push(id_dist, item);
+                            }
+                        }
+                    }
+                    if (top_candidates->Size() > ef) {
+                        top_candidates->Pop();
+                    }
+                    if (not top_candidates->Empty()) {
+                        ctx->lower_bound = top_candidates->Top().first;
+                    }
+                }
+            }
+            ctx->in_flight--;
+            ctx->cv.notify_all();
+        }
+    };
+
+    auto stop_search = [](const std::shared_ptr<ParallelSearchContext>& context) {
+        std::lock_guard<std::mutex> lock(context->mutex);
+        context->finished.store(true);
+        context->cv.notify_all();
+    };
+    auto worker_count = inner_search_param.parallel_search_thread_count;
+    if (thread_pool != nullptr) {
+        for (int64_t i = 1; i < worker_count; ++i) {
+            // a worker registers itself in running before checking finished, so the caller
+            // which waits running to be zero never leaves the search while a worker reads it
+            thread_pool->Enqueue([ctx, &run_worker, &flatten, query, stop_search]() {
+                ctx->running.fetch_add(1);
+                auto leave = [&ctx]() {
+                    std::lock_guard<std::mutex> lock(ctx->mutex);
+                    ctx->running.fetch_sub(1);
+                    ctx->cv.notify_all();
+                };
+                if (not ctx->finished.load()) {
+                    try {
+                        run_worker(flatten->FactoryComputer(query));
+                    } catch (...) {
+                        stop_search(ctx);
+                        leave();
+                        throw;
+                    }
+                }
+                leave();
+            });
+        }
+    }
+
+    auto wait_workers = [&ctx]() {
+        std::unique_lock<std::mutex> lock(ctx->mutex);
+        ctx->cv.wait(lock, [&ctx]() { return ctx->running.load() == 0; });
+    };
+    try {
+        run_worker(computer);
+    } catch (...) {
+        stop_search(ctx);
+        wait_workers();
+        throw;
+    }
+    wait_workers();
+
+    auto& top_candidates = ctx->top_candidates;
+    while (top_candidates->Size() > inner_search_param.topk) {
+        top_candidates->Pop();
+    }
+    return top_candidates;
+}
+
 template <InnerSearchMode mode>
 DistHeapPtr
 BasicSearcher::search_impl(const GraphInterfacePtr& graph,
@@ -125,7 +724,9 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
     Vector<InnerIdType> to_be_visited_rid(graph->MaximumDegree(), alloc);
     Vector<InnerIdType> to_be_visited_id(graph->MaximumDegree(), alloc);
     Vector<InnerIdType> neighbors(graph->MaximumDegree(), alloc);
+    Vector<InnerIdType> next_neighbors(graph->MaximumDegree(), alloc);
     Vector<float> line_dists(graph->MaximumDegree(), alloc);
+    int64_t prefetched_id = -1;
 
     if (!iter_ctx->IsFirstUsed()) {
         if (iter_ctx->Empty()) {
@@ -173,6 +774,11 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
             graph->Prefetch(candidate_set->Top().second, 0);
         }
 
+        // the list read while the last hop was computed is reused when that hop is taken
+        bool neighbors_ready = static_cast<int64_t>(current_node_pair.second) == prefetched_id;
+        if (neighbors_ready) {
+            neighbors.swap(next_neighbors);
+        }
         count_no_visited = visit(graph,
                                  vl,
                                  current_node_pair,
@@ -180,12 +786,22 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
                                  inner_search_param.skip_ratio,
                                  to_be_visited_rid,
                                  to_be_visited_id,
-                                 neighbors);
+                                 neighbors,
+                                 nullptr,
+                                 neighbors_ready);
 
         dist_cmp += count_no_visited;
 
-        flatten->Query(
-            line_dists.data(), computer, to_be_visited_id.data(), count_no_visited, alloc);
+        prefetched_id = query_with_cross_hop_prefetch(graph,
+                                                      flatten,
+                                                      vl,
+                                                      computer,
+                                                      *candidate_set,
+                                                      to_be_visited_id,
+                                                      count_no_visited,
+                                                      next_neighbors,
+                                                      line_dists,
+                                                      alloc);
 
         for (uint32_t i = 0; i < count_no_visited; i++) {
             dist = line_dists[i];
@@ -260,11 +876,15 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
     auto lower_bound = std::numeric_limits<float>::max();
 
     uint32_t hops = 0;
-    uint32_t dist_cmp = 0;
+    uint32_t dist_cmp = 1;
+    uint32_t filter_rejections = 0;
     uint32_t count_no_visited = 0;
+    auto* stats = inner_search_param.statistics;
+    SearchStageTimer stage_timer(stats);
     Vector<InnerIdType> to_be_visited_rid(graph->MaximumDegree(), alloc);
     Vector<InnerIdType> to_be_visited_id(graph->MaximumDegree(), alloc);
     Vector<InnerIdType> neighbors(graph->MaximumDegree(), alloc);
+    Vector<InnerIdType> next_neighbors(graph->MaximumDegree(), alloc);
     Vector<float> line_dists(graph->MaximumDegree(), alloc);
 
     Filter* attr_ft = nullptr;
@@ -278,10 +898,53 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
                (attr_ft == nullptr or attr_ft->CheckValid(id));
     };
 
+    // a co-located graph returns the code of the expanded node in the read of its neighbors
+    auto* colocated_flatten = inner_search_param.colocated_flatten;
+    auto* exact_dists = inner_search_param.exact_dists;
+    ComputerInterfacePtr colocated_computer = nullptr;
+    Vector<uint8_t> node_codes(alloc);
+    if (colocated_flatten != nullptr and exact_dists != nullptr and
+        graph->ColocatedCodeSize() > 0) {
+        colocated_computer = colocated_flatten->FactoryComputer(query);
+        node_codes.resize(graph->ColocatedCodeSize());
+    }
+    auto* node_codes_ptr = colocated_computer != nullptr ? node_codes.data() : nullptr;
+    int64_t prefetched_id = -1;
+
+    // adaptive ef, best_dists is a max-heap of the best early_stop_k distances found so far
+    bool adaptive = mode == KNN_SEARCH and inner_search_param.early_stop_patience > 0;
+    auto patience = inner_search_param.early_stop_patience;
+    auto max_ef = std::max(ef, inner_search_param.max_ef);
+    auto watch_k = static_cast<uint64_t>(inner_search_param.early_stop_k > 0
+                                             ? inner_search_param.early_stop_k
+                                             : std::max(inner_search_param.topk, int64_t(1)));
+    Vector<float> best_dists(alloc);
+    uint32_t stale_hops = 0;
+    bool improved = false;
+    auto record_dist = [&](float new_dist) {
+        if (best_dists.size() < watch_k) {
+            best_dists.emplace_back(new_dist);
+            std::push_heap(best_dists.begin(), best_dists.end());
+            improved = true;
+        } else if (new_dist < best_dists.front()) {
+            std::pop_heap(best_dists.begin(), best_dists.end());
+            best_dists.back() = new_dist;
+            std::push_heap(best_dists.begin(), best_dists.end());
+            improved = true;
+        }
+    };
+
+    stage_timer.Start();
     flatten->Query(&dist, computer, &ep, 1, alloc);
+    stage_timer.Stop(&SearchStatistics::distance_time_ms);
     if (check_func(ep)) {
         top_candidates->Push(dist, ep);
         lower_bound = top_candidates->Top().first;
+        if (adaptive) {
+            record_dist(dist);
+        }
+    } else {
+        filter_rejections++;
     }
     if constexpr (mode == InnerSearchMode::RANGE_SEARCH) {
         if (dist > inner_search_param.radius and not top_candidates->Empty()) {
@@ -295,7 +958,6 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
     vl->Set(ep);
 
     while (not candidate_set->Empty()) {
-        hops++;
         auto current_node_pair = candidate_set->Top();
 
         if (inner_search_param.time_cost != nullptr and
@@ -304,30 +966,89 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
         }
 
         if constexpr (mode == InnerSearchMode::KNN_SEARCH) {
+            if (adaptive and best_dists.size() == watch_k) {
+                if (stale_hops >= patience) {
+                    break;
+                }
+                if (inner_search_param.early_stop_distance_ratio > 0 and
+                    best_dists.front() > 0 and
+                    (-current_node_pair.first) >
+                        best_dists.front() * inner_search_param.early_stop_distance_ratio) {
+                    break;
+                }
+            }
             if ((-current_node_pair.first) > lower_bound && top_candidates->Size() == ef) {
-                break;
+                // only a query whose best results improved on the last hop is still converging,
+                // its search is widened; any other query stops at the fixed-ef condition
+                if (adaptive and stale_hops == 0 and ef < max_ef) {
+                    ef = std::min(ef * 2, max_ef);
+                } else {
+                    break;
+                }
             }
         }
         candidate_set->Pop();
+        hops++;
 
         if (not candidate_set->Empty()) {
             graph->Prefetch(candidate_set->Top().second, 0);
         }
 
-        count_no_visited = visit(graph,
-                                 vl,
-                                 current_node_pair,
-                                 inner_search_param.is_inner_id_allowed,
-                                 inner_search_param.skip_ratio,
-                                 to_be_visited_rid,
-                                 to_be_visited_id,
-                                 neighbors);
+        stage_timer.Start();
+        // the list read while the last hop was computed is reused when that hop is taken, a
+        // co-located graph never splits a hop as it reads the node code with the neighbors
+        bool neighbors_ready = static_cast<int64_t>(current_node_pair.second) == prefetched_id;
+        if (neighbors_ready) {
+            neighbors.swap(next_neighbors);
+        }
+        if (inner_search_param.two_hop_expansion) {
+            count_no_visited = visit_two_hop(graph,
+                                             vl,
+                                             current_node_pair,
+                                             is_id_allowed.get(),
+                                             attr_ft,
+                                             to_be_visited_rid,
+                                             to_be_visited_id,
+                                             neighbors,
+                                             next_neighbors,
+                                             node_codes_ptr,
+                                             neighbors_ready);
+        } else {
+            count_no_visited = visit(graph,
+                                     vl,
+                                     current_node_pair,
+                                     inner_search_param.is_inner_id_allowed,
+                                     inner_search_param.skip_ratio,
+                                     to_be_visited_rid,
+                                     to_be_visited_id,
+                                     neighbors,
+                                     node_codes_ptr,
+                                     neighbors_ready);
+        }
+        stage_timer.Stop(&SearchStatistics::graph_time_ms);
+
+        if (colocated_computer != nullptr) {
+            float exact_dist = 0.0F;
+            colocated_flatten->QueryCodes(&exact_dist, colocated_computer, node_codes.data(), 1);
+            (*exact_dists)[static_cast<InnerIdType>(current_node_pair.second)] = exact_dist;
+        }
 
         dist_cmp += count_no_visited;
 
-        flatten->Query(
-            line_dists.data(), computer, to_be_visited_id.data(), count_no_visited, alloc);
+        stage_timer.Start();
+        prefetched_id = query_with_cross_hop_prefetch(graph,
+                                                      flatten,
+                                                      vl,
+                                                      computer,
+                                                      *candidate_set,
+                                                      to_be_visited_id,
+                                                      count_no_visited,
+                                                      next_neighbors,
+                                                      line_dists,
+                                                      alloc);
+        stage_timer.Stop(&SearchStatistics::distance_time_ms);
 
+        improved = false;
         for (uint32_t i = 0; i < count_no_visited; i++) {
             dist = line_dists[i];
             if (dist < THRESHOLD_ERROR) {
@@ -339,6 +1060,11 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
                 //                flatten->Prefetch(candidate_set->Top().second);
                 if (check_func(to_be_visited_id[i])) {
                     top_candidates->Push(dist, to_be_visited_id[i]);
+                    if (adaptive) {
+                        record_dist(dist);
+                    }
+                } else {
+                    filter_rejections++;
                 }
                 if (inner_search_param.consider_duplicate and label_table != nullptr and
                     label_table->CompressDuplicateData()) {
@@ -361,6 +1087,13 @@ BasicSearcher::search_impl(const GraphInterfacePtr& graph,
                 }
             }
         }
+        stale_hops = improved ? 0 : stale_hops + 1;
+    }
+
+    if (stats != nullptr) {
+        stats->hops += hops;
+        stats->dist_cmp += dist_cmp;
+        stats->filter_rejections += filter_rejections;
     }
 
     if constexpr (mode == KNN_SEARCH) {
@@ -421,12 +1154,18 @@ BasicSearcher::MockRun() const {
         mock_flatten_->GetCodesById(i, codes.data());
 
         Vector<float> raw_data(mock_dim_, allocator_);
-        mock_flatten_->Decode(codes.data(), raw_data.data());
+        const void* query = raw_data.data();
+        if (mock_flatten_->GetQuantizerName() == QUANTIZATION_TYPE_VALUE_INT8) {
+            // an int8 code is the raw int8 vector itself
+            query = codes.data();
+        } else {
+            mock_flatten_->Decode(codes.data(), raw_data.data());
+        }
         auto vl = mock_vl_pool_->TakeOne();
 
         // mock run
         auto st = std::chrono::high_resolution_clock::now();
-        Search(mock_graph_, mock_flatten_, vl, raw_data.data(), mock_inner_search_param_);
+        Search(mock_graph_, mock_flatten_, vl, query, mock_inner_search_param_);
         auto ed = std::chrono::high_resolution_clock::now();
         time_cost += std::chrono::duration<double>(ed - st).count();
 
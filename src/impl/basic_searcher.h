@@ -23,6 +23,7 @@
 #include "index/iterator_filter.h"
 #include "inner_search_param.h"
 #include "lock_strategy.h"
+#include "safe_thread_pool.h"
 #include "utils/timer.h"
 #include "utils/visited_list.h"
 
@@ -53,6 +54,29 @@ public:
            const InnerSearchParam& inner_search_param,
            IteratorFilterContext* iter_ctx) const;
 
+    // search several queries on the same graph together, the neighbor lists and the codes
+    // fetched in one hop are shared by all queries which reach them, only for KNN_SEARCH
+    virtual std::vector<DistHeapPtr>
+    BatchSearch(const GraphInterfacePtr& graph,
+                const FlattenInterfacePtr& flatten,
+                const std::vector<VisitedListPtr>& vls,
+                const std::vector<const void*>& queries,
+                const std::vector<InnerIdType>& eps,
+                const InnerSearchParam& inner_search_param,
+                const LabelTablePtr& label_table = nullptr) const;
+
+    // search one query by parallel_search_thread_count workers, the caller is one of them and
+    // the others run on thread_pool, they expand the nodes of a shared candidate set one by one
+    // and merge the results into a shared top-k, only for KNN_SEARCH
+    virtual DistHeapPtr
+    ParallelSearch(const GraphInterfacePtr& graph,
+                   const FlattenInterfacePtr& flatten,
+                   const ConcurrentVisitedListPtr& vl,
+                   const void* query,
+                   const InnerSearchParam& inner_search_param,
+                   SafeThreadPool* thread_pool,
+                   const LabelTablePtr& label_table = nullptr) const;
+
     virtual bool
     SetRuntimeParameters(const UnorderedMap<std::string, float>& new_params);
 
@@ -70,7 +94,19 @@ public:
     void
     SetMutexArray(MutexArrayPtr new_mutex_array);
 
+    // the size of the first half of a hop computed before the next hop is prefetched, a
+    // multiple of 8 served by the wide batch kernels, 0 when the hop is computed in one go
+    static uint32_t
+    CrossHopSplitSize(uint32_t count_no_visited);
+
 private:
+    // reads the neighbors of id, and its co-located code into node_codes when not nullptr
+    void
+    get_neighbors(const GraphInterfacePtr& graph,
+                  InnerIdType id,
+                  Vector<InnerIdType>& neighbors,
+                  uint8_t* node_codes = nullptr) const;
+
     // rid means the neighbor's rank (e.g., the first neighbor's rid == 0)
     //  id means the neighbor's  id  (e.g., the first neighbor's  id == 12345)
     uint32_t
@@ -81,7 +117,39 @@ private:
           float skip_ratio,
           Vector<InnerIdType>& to_be_visited_rid,
           Vector<InnerIdType>& to_be_visited_id,
-          Vector<InnerIdType>& neighbors) const;
+          Vector<InnerIdType>& neighbors,
+          uint8_t* node_codes = nullptr,
+          bool neighbors_ready = false) const;
+
+    // as visit, but only the allowed neighbors are kept and a rejected neighbor contributes its
+    // allowed unvisited neighbors instead, at most graph->MaximumDegree() ids are returned
+    uint32_t
+    visit_two_hop(const GraphInterfacePtr& graph,
+                  const VisitedListPtr& vl,
+                  const std::pair<float, uint64_t>& current_node_pair,
+                  const Filter* filter,
+                  const Filter* attr_filter,
+                  Vector<InnerIdType>& to_be_visited_rid,
+                  Vector<InnerIdType>& to_be_visited_id,
+                  Vector<InnerIdType>& neighbors,
+                  Vector<InnerIdType>& second_neighbors,
+                  uint8_t* node_codes = nullptr,
+                  bool neighbors_ready = false) const;
+
+    // computes the distances of this hop in two halves and, between them, reads the adjacency
+    // list of the tentative next hop into next_neighbors and pulls its unvisited neighbor codes
+    // into cache; returns the id of that hop, whose visit reuses the list, or -1 without a split
+    int64_t
+    query_with_cross_hop_prefetch(const GraphInterfacePtr& graph,
+                                  const FlattenInterfacePtr& flatten,
+                                  const VisitedListPtr& vl,
+                                  const ComputerInterfacePtr& computer,
+                                  const DistanceHeap& candidate_set,
+                                  const Vector<InnerIdType>& to_be_visited_id,
+                                  uint32_t count_no_visited,
+                                  Vector<InnerIdType>& next_neighbors,
+                                  Vector<float>& line_dists,
+                                  Allocator* alloc) const;
 
     template <InnerSearchMode mode = KNN_SEARCH>
     DistHeapPtr
@@ -227,6 +227,16 @@ TEST_CASE("Search with HNSW", "[ut][BasicSearcher]") {
     params[3] = params[2];
     params[3].is_inner_id_allowed = f;
 
+    // every neighbor of the node expanded first is unvisited, the hops from the nodes with
+    // enough neighbors are split and the next hop reuses the list read in between
+    uint32_t split_nodes = 0;
+    for (InnerIdType id = 0; id < base_size; ++id) {
+        if (BasicSearcher::CrossHopSplitSize(graph_data_cell->GetNeighborSize(id)) > 0) {
+            ++split_nodes;
+        }
+    }
+    REQUIRE(split_nodes > 0);
+
     for (const auto& search_param : params) {
         exception_func(search_param);
         auto searcher = std::make_shared<BasicSearcher>(common);
@@ -276,6 +286,433 @@ TEST_CASE("Search with HNSW", "[ut][BasicSearcher]") {
     }
 }
 
+TEST_CASE("Cross Hop Prefetch Split", "[ut][BasicSearcher]") {
+    // hops below 16 unvisited neighbors are computed in one go
+    REQUIRE(BasicSearcher::CrossHopSplitSize(0) == 0);
+    REQUIRE(BasicSearcher::CrossHopSplitSize(15) == 0);
+    // the first half is a multiple of 8, 8 or 16 for the usual degrees
+    REQUIRE(BasicSearcher::CrossHopSplitSize(16) == 8);
+    REQUIRE(BasicSearcher::CrossHopSplitSize(31) == 8);
+    REQUIRE(BasicSearcher::CrossHopSplitSize(32) == 16);
+    REQUIRE(BasicSearcher::CrossHopSplitSize(47) == 16);
+    REQUIRE(BasicSearcher::CrossHopSplitSize(64) == 32);
+}
+
+TEST_CASE("Batch Search with HNSW", "[ut][BasicSearcher]") {
+    uint32_t base_size = 1000;
+    uint32_t query_size = 64;
+    uint64_t dim = 128;
+    uint32_t M = 32;
+    uint32_t ef_construction = 100;
+    uint32_t ef_search = 100;
+    InnerIdType fixed_entry_point_id = 0;
+    uint64_t DEFAULT_MAX_ELEMENT = 1;
+
+    auto base_vectors = fixtures::generate_vectors(base_size, dim, true);
+    std::vector<InnerIdType> ids(base_size);
+    std::iota(ids.begin(), ids.end(), 0);
+
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto space = std::make_shared<hnswlib::L2Space>(dim);
+    auto alg_hnsw =
+        std::make_shared<hnswlib::HierarchicalNSW>(space.get(),
+                                                   DEFAULT_MAX_ELEMENT,
+                                                   allocator.get(),
+                                                   M / 2,
+                                                   ef_construction,
+                                                   Options::Instance().block_size_limit());
+    alg_hnsw->init_memory_space();
+    for (int64_t i = 0; i < base_size; ++i) {
+        alg_hnsw->addPoint((const void*)(base_vectors.data() + i * dim), ids[i]);
+    }
+    auto graph_data_cell = std::make_shared<AdaptGraphDataCell>(alg_hnsw);
+
+    constexpr const char* param_temp = R"({{"type": "{}"}})";
+    auto fp32_param = QuantizerParameter::GetQuantizerParameterByJson(
+        JsonType::parse(fmt::format(param_temp, "fp32")));
+    auto io_param =
+        IOParameter::GetIOParameterByJson(JsonType::parse(fmt::format(param_temp, "memory_io")));
+    IndexCommonParam common;
+    common.dim_ = dim;
+    common.allocator_ = allocator;
+    common.metric_ = vsag::MetricType::METRIC_TYPE_L2SQR;
+    auto vector_data_cell = std::make_shared<
+        FlattenDataCell<FP32Quantizer<vsag::MetricType::METRIC_TYPE_L2SQR>, MemoryIO>>(
+        fp32_param, io_param, common);
+    vector_data_cell->Train(base_vectors.data(), base_size);
+    vector_data_cell->BatchInsertVector(base_vectors.data(), base_size, ids.data());
+
+    auto pool = std::make_shared<VisitedListPool>(
+        query_size, allocator.get(), vector_data_cell->TotalCount(), allocator.get());
+    auto searcher = std::make_shared<BasicSearcher>(common);
+
+    auto filter_func = [](LabelType id) -> bool { return id % 2 == 0; };
+    auto filter = GENERATE(0, 1);
+
+    InnerSearchParam search_param;
+    search_param.ef = ef_search;
+    search_param.topk = 10;
+    if (filter == 1) {
+        search_param.is_inner_id_allowed = std::make_shared<BlackListFilter>(filter_func);
+    }
+
+    std::vector<const void*> queries(query_size);
+    std::vector<InnerIdType> eps(query_size, fixed_entry_point_id);
+    std::vector<VisitedListPtr> vls(query_size);
+    for (uint32_t i = 0; i < query_size; ++i) {
+        queries[i] = base_vectors.data() + i * dim;
+        vls[i] = pool->TakeOne();
+    }
+    SearchStatistics batch_stats;
+    search_param.statistics = &batch_stats;
+    auto batch_results = searcher->BatchSearch(
+        graph_data_cell, vector_data_cell, vls, queries, eps, search_param);
+    for (auto& vl : vls) {
+        pool->ReturnOne(vl);
+    }
+    REQUIRE(batch_results.size() == query_size);
+
+    // batched search must visit exactly the same nodes as the per-query search
+    SearchStatistics stats;
+    search_param.statistics = &stats;
+    search_param.ep = fixed_entry_point_id;
+    for (uint32_t i = 0; i < query_size; ++i) {
+        auto vl = pool->TakeOne();
+        auto result = searcher->Search(
+            graph_data_cell, vector_data_cell, vl, queries[i], search_param);
+        pool->ReturnOne(vl);
+        auto& batch_result = batch_results[i];
+        REQUIRE(result->Size() == batch_result->Size());
+        while (not result->Empty()) {
+            REQUIRE(result->Top().second == batch_result->Top().second);
+            REQUIRE(result->Top().first == batch_result->Top().first);
+            result->Pop();
+            batch_result->Pop();
+        }
+    }
+    REQUIRE(stats.hops > 0);
+    REQUIRE(stats.hops == batch_stats.hops);
+    REQUIRE(stats.dist_cmp == batch_stats.dist_cmp);
+    REQUIRE(stats.filter_rejections == batch_stats.filter_rejections);
+    REQUIRE((filter == 0) == (stats.filter_rejections == 0));
+    REQUIRE(stats.io_count == 0);
+    search_param.statistics = nullptr;
+
+    // empty datacell returns empty heaps
+    auto empty_results =
+        searcher->BatchSearch(nullptr, vector_data_cell, vls, queries, eps, search_param);
+    REQUIRE(empty_results.size() == query_size);
+    for (const auto& empty_result : empty_results) {
+        REQUIRE(empty_result->Empty());
+    }
+}
+
+TEST_CASE("Parallel Search with HNSW", "[ut][BasicSearcher]") {
+    uint32_t base_size = 1000;
+    uint32_t query_size = 32;
+    uint64_t dim = 128;
+    uint32_t M = 32;
+    uint32_t ef_construction = 100;
+    uint32_t ef_search = 100;
+    int64_t topk = 10;
+    InnerIdType fixed_entry_point_id = 0;
+    uint64_t DEFAULT_MAX_ELEMENT = 1;
+
+    auto base_vectors = fixtures::generate_vectors(base_size, dim, true);
+    std::vector<InnerIdType> ids(base_size);
+    std::iota(ids.begin(), ids.end(), 0);
+
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto space = std::make_shared<hnswlib::L2Space>(dim);
+    auto alg_hnsw =
+        std::make_shared<hnswlib::HierarchicalNSW>(space.get(),
+                                                   DEFAULT_MAX_ELEMENT,
+                                                   allocator.get(),
+                                                   M / 2,
+                                                   ef_construction,
+                                                   Options::Instance().block_size_limit());
+    alg_hnsw->init_memory_space();
+    for (int64_t i = 0; i < base_size; ++i) {
+        alg_hnsw->addPoint((const void*)(base_vectors.data() + i * dim), ids[i]);
+    }
+    auto graph_data_cell = std::make_shared<AdaptGraphDataCell>(alg_hnsw);
+
+    constexpr const char* param_temp = R"({{"type": "{}"}})";
+    auto fp32_param = QuantizerParameter::GetQuantizerParameterByJson(
+        JsonType::parse(fmt::format(param_temp, "fp32")));
+    auto io_param =
+        IOParameter::GetIOParameterByJson(JsonType::parse(fmt::format(param_temp, "memory_io")));
+    IndexCommonParam common;
+    common.dim_ = dim;
+    common.allocator_ = allocator;
+    common.metric_ = vsag::MetricType::METRIC_TYPE_L2SQR;
+    auto vector_data_cell = std::make_shared<
+        FlattenDataCell<FP32Quantizer<vsag::MetricType::METRIC_TYPE_L2SQR>, MemoryIO>>(
+        fp32_param, io_param, common);
+    vector_data_cell->Train(base_vectors.data(), base_size);
+    vector_data_cell->BatchInsertVector(base_vectors.data(), base_size, ids.data());
+
+    auto pool = std::make_shared<VisitedListPool>(
+        1, allocator.get(), vector_data_cell->TotalCount(), allocator.get());
+    auto parallel_pool = std::make_shared<ConcurrentVisitedListPool>(
+        1, allocator.get(), vector_data_cell->TotalCount(), allocator.get());
+    auto thread_pool = SafeThreadPool::FactoryDefaultThreadPool();
+    thread_pool->SetPoolSize(4);
+    auto searcher = std::make_shared<BasicSearcher>(common);
+
+    auto filter_func = [](LabelType id) -> bool { return id % 2 == 0; };
+    auto filter = GENERATE(0, 1);
+    auto thread_count = GENERATE(1, 2, 4);
+
+    InnerSearchParam search_param;
+    search_param.ep = fixed_entry_point_id;
+    search_param.ef = ef_search;
+    search_param.topk = topk;
+    search_param.parallel_search_thread_count = thread_count;
+    if (filter == 1) {
+        search_param.is_inner_id_allowed = std::make_shared<BlackListFilter>(filter_func);
+    }
+
+    // the workers may expand the nodes in another order, so only the recall against the
+    // sequential search is checked
+    uint64_t correct = 0;
+    for (uint32_t i = 0; i < query_size; ++i) {
+        const auto* query = base_vectors.data() + i * dim;
+        auto vl = pool->TakeOne();
+        auto expected =
+            searcher->Search(graph_data_cell, vector_data_cell, vl, query, search_param);
+        pool->ReturnOne(vl);
+
+        auto parallel_vl = parallel_pool->TakeOne();
+        auto result = searcher->ParallelSearch(graph_data_cell,
+                                               vector_data_cell,
+                                               parallel_vl,
+                                               query,
+                                               search_param,
+                                               thread_pool.get());
+        parallel_pool->ReturnOne(parallel_vl);
+        REQUIRE(result->Size() == expected->Size());
+
+        std::unordered_set<InnerIdType> expected_ids;
+        while (not expected->Empty()) {
+            expected_ids.insert(expected->Top().second);
+            expected->Pop();
+        }
+        while (not result->Empty()) {
+            correct += expected_ids.count(result->Top().second);
+            result->Pop();
+        }
+    }
+    REQUIRE(static_cast<double>(correct) / static_cast<double>(query_size * topk) > 0.95);
+
+    // empty datacell returns empty heap
+    auto parallel_vl = parallel_pool->TakeOne();
+    auto empty_result = searcher->ParallelSearch(nullptr,
+                                                 vector_data_cell,
+                                                 parallel_vl,
+                                                 base_vectors.data(),
+                                                 search_param,
+                                                 thread_pool.get());
+    parallel_pool->ReturnOne(parallel_vl);
+    REQUIRE(empty_result->Empty());
+}
+
+TEST_CASE("Adaptive Ef Search with HNSW", "[ut][BasicSearcher]") {
+    uint32_t base_size = 1000;
+    uint32_t query_size = 64;
+    uint64_t dim = 128;
+    uint32_t M = 32;
+    uint32_t ef_construction = 100;
+    uint32_t ef_search = 100;
+    int64_t topk = 10;
+    InnerIdType fixed_entry_point_id = 0;
+    uint64_t DEFAULT_MAX_ELEMENT = 1;
+
+    auto base_vectors = fixtures::generate_vectors(base_size, dim, true);
+    std::vector<InnerIdType> ids(base_size);
+    std::iota(ids.begin(), ids.end(), 0);
+
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto space = std::make_shared<hnswlib::L2Space>(dim);
+    auto alg_hnsw =
+        std::make_shared<hnswlib::HierarchicalNSW>(space.get(),
+                                                   DEFAULT_MAX_ELEMENT,
+                                                   allocator.get(),
+                                                   M / 2,
+                                                   ef_construction,
+                                                   Options::Instance().block_size_limit());
+    alg_hnsw->init_memory_space();
+    for (int64_t i = 0; i < base_size; ++i) {
+        alg_hnsw->addPoint((const void*)(base_vectors.data() + i * dim), ids[i]);
+    }
+    auto graph_data_cell = std::make_shared<AdaptGraphDataCell>(alg_hnsw);
+
+    constexpr const char* param_temp = R"({{"type": "{}"}})";
+    auto fp32_param = QuantizerParameter::GetQuantizerParameterByJson(
+        JsonType::parse(fmt::format(param_temp, "fp32")));
+    auto io_param =
+        IOParameter::GetIOParameterByJson(JsonType::parse(fmt::format(param_temp, "memory_io")));
+    IndexCommonParam common;
+    common.dim_ = dim;
+    common.allocator_ = allocator;
+    common.metric_ = vsag::MetricType::METRIC_TYPE_L2SQR;
+    auto vector_data_cell = std::make_shared<
+        FlattenDataCell<FP32Quantizer<vsag::MetricType::METRIC_TYPE_L2SQR>, MemoryIO>>(
+        fp32_param, io_param, common);
+    vector_data_cell->Train(base_vectors.data(), base_size);
+    vector_data_cell->BatchInsertVector(base_vectors.data(), base_size, ids.data());
+
+    auto pool = std::make_shared<VisitedListPool>(
+        1, allocator.get(), vector_data_cell->TotalCount(), allocator.get());
+    auto searcher = std::make_shared<BasicSearcher>(common);
+
+    InnerSearchParam fixed_param;
+    fixed_param.ep = fixed_entry_point_id;
+    fixed_param.ef = ef_search;
+    fixed_param.topk = topk;
+
+    // a patience which never triggers and no room to widen ef keeps the fixed ef behavior
+    InnerSearchParam same_param;
+    same_param = fixed_param;
+    same_param.early_stop_patience = std::numeric_limits<uint32_t>::max();
+    same_param.max_ef = ef_search;
+
+    InnerSearchParam patience_param;
+    patience_param = fixed_param;
+    patience_param.early_stop_patience = 8;
+    patience_param.max_ef = ef_search * 4;
+
+    InnerSearchParam ratio_param;
+    ratio_param = fixed_param;
+    ratio_param.early_stop_patience = 8;
+    ratio_param.early_stop_distance_ratio = 1.5F;
+
+    auto search = [&](const void* query, const InnerSearchParam& param) {
+        auto vl = pool->TakeOne();
+        auto result = searcher->Search(graph_data_cell, vector_data_cell, vl, query, param);
+        pool->ReturnOne(vl);
+        std::vector<InnerIdType> result_ids;
+        while (not result->Empty()) {
+            result_ids.emplace_back(result->Top().second);
+            result->Pop();
+        }
+        return result_ids;
+    };
+
+    uint64_t patience_correct = 0;
+    uint64_t ratio_correct = 0;
+    for (uint32_t i = 0; i < query_size; ++i) {
+        const auto* query = base_vectors.data() + i * dim;
+        auto expected = search(query, fixed_param);
+        REQUIRE(search(query, same_param) == expected);
+
+        std::unordered_set<InnerIdType> expected_ids(expected.begin(), expected.end());
+        auto patience_result = search(query, patience_param);
+        REQUIRE(patience_result.size() == topk);
+        for (auto id : patience_result) {
+            patience_correct += expected_ids.count(id);
+        }
+        auto ratio_result = search(query, ratio_param);
+        REQUIRE(ratio_result.size() == topk);
+        for (auto id : ratio_result) {
+            ratio_correct += expected_ids.count(id);
+        }
+    }
+    auto total = static_cast<double>(query_size * topk);
+    REQUIRE(static_cast<double>(patience_correct) / total > 0.8);
+    REQUIRE(static_cast<double>(ratio_correct) / total > 0.8);
+}
+
+TEST_CASE("Two Hop Filtered Search with HNSW", "[ut][BasicSearcher]") {
+    uint32_t base_size = 1000;
+    uint32_t query_size = 32;
+    uint64_t dim = 128;
+    uint32_t M = 32;
+    uint32_t ef_construction = 100;
+    uint32_t ef_search = 100;
+    int64_t topk = 10;
+    InnerIdType fixed_entry_point_id = 0;
+    uint64_t DEFAULT_MAX_ELEMENT = 1;
+
+    auto base_vectors = fixtures::generate_vectors(base_size, dim, true);
+    std::vector<InnerIdType> ids(base_size);
+    std::iota(ids.begin(), ids.end(), 0);
+
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto space = std::make_shared<hnswlib::L2Space>(dim);
+    auto alg_hnsw =
+        std::make_shared<hnswlib::HierarchicalNSW>(space.get(),
+                                                   DEFAULT_MAX_ELEMENT,
+                                                   allocator.get(),
+                                                   M / 2,
+                                                   ef_construction,
+                                                   Options::Instance().block_size_limit());
+    alg_hnsw->init_memory_space();
+    for (int64_t i = 0; i < base_size; ++i) {
+        alg_hnsw->addPoint((const void*)(base_vectors.data() + i * dim), ids[i]);
+    }
+    auto graph_data_cell = std::make_shared<AdaptGraphDataCell>(alg_hnsw);
+
+    constexpr const char* param_temp = R"({{"type": "{}"}})";
+    auto fp32_param = QuantizerParameter::GetQuantizerParameterByJson(
+        JsonType::parse(fmt::format(param_temp, "fp32")));
+    auto io_param =
+        IOParameter::GetIOParameterByJson(JsonType::parse(fmt::format(param_temp, "memory_io")));
+    IndexCommonParam common;
+    common.dim_ = dim;
+    common.allocator_ = allocator;
+    common.metric_ = vsag::MetricType::METRIC_TYPE_L2SQR;
+    auto vector_data_cell = std::make_shared<
+        FlattenDataCell<FP32Quantizer<vsag::MetricType::METRIC_TYPE_L2SQR>, MemoryIO>>(
+        fp32_param, io_param, common);
+    vector_data_cell->Train(base_vectors.data(), base_size);
+    vector_data_cell->BatchInsertVector(base_vectors.data(), base_size, ids.data());
+
+    auto pool = std::make_shared<VisitedListPool>(
+        1, allocator.get(), vector_data_cell->TotalCount(), allocator.get());
+    auto searcher = std::make_shared<BasicSearcher>(common);
+
+    // 5% of the ids are allowed
+    auto filter_func = [](int64_t id) -> bool { return id % 20 == 0; };
+    InnerSearchParam search_param;
+    search_param.ep = fixed_entry_point_id;
+    search_param.ef = ef_search;
+    search_param.topk = topk;
+    search_param.is_inner_id_allowed = std::make_shared<WhiteListFilter>(filter_func);
+    search_param.two_hop_expansion = true;
+
+    uint64_t correct = 0;
+    for (uint32_t i = 0; i < query_size; ++i) {
+        const auto* query = base_vectors.data() + i * dim;
+        std::vector<std::pair<float, InnerIdType>> allowed;
+        for (InnerIdType id = 0; id < base_size; id += 20) {
+            float dist = 0;
+            for (uint64_t d = 0; d < dim; ++d) {
+                auto diff = query[d] - base_vectors[id * dim + d];
+                dist += diff * diff;
+            }
+            allowed.emplace_back(dist, id);
+        }
+        std::sort(allowed.begin(), allowed.end());
+        std::unordered_set<InnerIdType> expected_ids;
+        for (int64_t j = 0; j < topk; ++j) {
+            expected_ids.insert(allowed[j].second);
+        }
+
+        auto vl = pool->TakeOne();
+        auto result = searcher->Search(graph_data_cell, vector_data_cell, vl, query, search_param);
+        pool->ReturnOne(vl);
+        REQUIRE(result->Size() == topk);
+        while (not result->Empty()) {
+            auto id = result->Top().second;
+            REQUIRE(filter_func(id));
+            correct += expected_ids.count(id);
+            result->Pop();
+        }
+    }
+    REQUIRE(static_cast<double>(correct) / static_cast<double>(query_size * topk) > 0.8);
+}
+
 TEST_CASE("Optimize SQ4", "[ut][BasicOptimizer]") {
     // avoid too much slow task logs
     fixtures::logger::LoggerReplacer _;
@@ -70,6 +70,16 @@ public:
     virtual void
     Not() = 0;
 
+    /**
+     * @brief Clears every bit of the current bitset that is set in another bitset.
+     *
+     * @param another The bitset whose set bits are removed from the current bitset.
+     * @return void
+     * @note Unlike And after Not, the result does not depend on the extent of another.
+     */
+    virtual void
+    AndNot(const ComputableBitset& another) = 0;
+
     /**
      * @brief Performs a bitwise OR operation on the current computable bitset with another.
      *
@@ -200,6 +200,26 @@ FastBitset::Not() {
     this->fill_bit_ = !this->fill_bit_;
 }
 
+void
+FastBitset::AndNot(const ComputableBitset& another) {
+    const auto* fast_another = static_cast<const FastBitset*>(&another);
+    if (fast_another == nullptr) {
+        throw VsagException(ErrorType::INTERNAL_ERROR, "bitset not match");
+    }
+    auto other_size = fast_another->data_.size();
+    if (this->fill_bit_ and data_.size() < other_size) {
+        this->data_.resize(other_size, FILL_ONE);
+    }
+    auto min_size = std::min(data_.size(), other_size);
+    for (uint64_t i = 0; i < min_size; ++i) {
+        data_[i] &= ~fast_another->data_[i];
+    }
+    if (fast_another->fill_bit_) {
+        std::fill(data_.begin() + static_cast<int64_t>(min_size), data_.end(), 0);
+        this->fill_bit_ = false;
+    }
+}
+
 void
 FastBitset::Serialize(StreamWriter& writer) const {
     StreamWriter::WriteObj(writer, fill_bit_);
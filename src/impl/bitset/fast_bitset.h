@@ -61,6 +61,9 @@ public:
     void
     Not() override;
 
+    void
+    AndNot(const ComputableBitset& another) override;
+
     void
     Serialize(StreamWriter& writer) const override;
 
@@ -333,3 +333,39 @@ TEST_CASE("FastBitset Or operations", "[ut][FastBitset]") {
         }
     }
 }
+
+TEST_CASE("FastBitset AndNot operations", "[ut][FastBitset]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+
+    SECTION("andnot basic operator") {
+        auto [bitset1, values1] = GetRandomBitset(allocator.get(), 100, 10000);
+        auto [bitset2, values2] = GetRandomBitset(allocator.get(), 100, 5000);
+        bitset1->AndNot(*bitset2);
+        std::unordered_set<int> removed(values2.begin(), values2.end());
+        for (auto& v : values1) {
+            REQUIRE(bitset1->Test(v) == (removed.find(v) == removed.end()));
+        }
+        for (auto& v : values2) {
+            REQUIRE(bitset1->Test(v) == false);
+        }
+    }
+
+    SECTION("andnot with filled bitset") {
+        auto [bitset1, values1] = GetRandomBitset(allocator.get(), 100, 10000);
+        FastBitset bitset2(allocator.get());
+        bitset2.Set(10, true);
+        bitset2.Not();
+        bitset1->AndNot(bitset2);
+        REQUIRE(bitset1->Test(20000) == false);
+        for (auto& v : values1) {
+            REQUIRE(bitset1->Test(v) == (v == 10));
+        }
+
+        FastBitset bitset3(allocator.get());
+        bitset3.Not();
+        bitset3.AndNot(*bitset1);
+        REQUIRE(bitset3.Test(20000) == true);
+        REQUIRE(bitset3.Test(10) == not bitset1->Test(10));
+        REQUIRE(bitset3.Test(11) == true);
+    }
+}
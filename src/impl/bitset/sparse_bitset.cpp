@@ -87,6 +87,15 @@ SparseBitset::Not() {
     r_.flipClosed(r_.minimum(), r_.maximum());
 }
 
+void
+SparseBitset::AndNot(const ComputableBitset& another) {
+    const auto* another_ptr = reinterpret_cast<const SparseBitset*>(&another);
+    std::lock(mutex_, another_ptr->mutex_);
+    std::lock_guard<std::mutex> lock(mutex_, std::adopt_lock);
+    std::lock_guard<std::mutex> lock_other(another_ptr->mutex_, std::adopt_lock);
+    r_ -= another_ptr->r_;
+}
+
 void
 SparseBitset::Serialize(StreamWriter& writer) const {
     std::lock_guard<std::mutex> lock(mutex_);
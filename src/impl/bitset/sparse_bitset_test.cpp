@@ -143,6 +143,24 @@ TEST_CASE("SparseBitset And Test", "[ut][bitset]") {
     }
 }
 
+TEST_CASE("SparseBitset AndNot Test", "[ut][bitset]") {
+    SparseBitset bitset1;
+    SparseBitset bitset2;
+    bitset1.Set(100, true);
+    bitset1.Set(200, true);
+    bitset2.Set(200, true);
+    bitset2.Set(300, true);
+    bitset1.AndNot(bitset2);
+    REQUIRE(bitset1.Count() == 1);
+    REQUIRE(bitset1.Test(100));
+    REQUIRE_FALSE(bitset1.Test(200));
+    REQUIRE_FALSE(bitset1.Test(300));
+
+    SparseBitset empty;
+    bitset1.AndNot(empty);
+    REQUIRE(bitset1.Dump() == "{100}");
+}
+
 TEST_CASE("SparseBitset Bitwise Operations", "[ut][SparseBitset]") {
     auto allocator = SafeAllocator::FactoryDefaultAllocator();
 
@@ -18,4 +18,5 @@
 #include "black_list_filter.h"
 #include "extrainfo_wrapper_filter.h"
 #include "inner_id_wrapper_filter.h"
+#include "tombstone_filter.h"
 #include "white_list_filter.h"
@@ -0,0 +1,61 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+
+#include "typing.h"
+#include "vsag/filter.h"
+
+namespace vsag {
+
+/**
+ * @brief Hides the removed points (by inner id) from the search results.
+ *
+ * The removed points stay in the graph until their neighbors are repaired, so they are
+ * still traversed; only the results skip them. The wrapped filter works on inner ids too.
+ */
+class TombstoneFilter : public Filter {
+public:
+    TombstoneFilter(const FilterPtr& filter_impl, const Vector<std::atomic<bool>>& tombstones)
+        : filter_impl_(filter_impl), tombstones_(tombstones){};
+
+    [[nodiscard]] bool
+    CheckValid(int64_t inner_id) const override {
+        if (tombstones_[inner_id].load(std::memory_order_acquire)) {
+            return false;
+        }
+        return filter_impl_ == nullptr or filter_impl_->CheckValid(inner_id);
+    }
+
+    // the removed points are not counted, a low ratio would make the searcher skip
+    // the neighbors of valid points as well
+    [[nodiscard]] float
+    ValidRatio() const override {
+        return filter_impl_ == nullptr ? 1.0F : filter_impl_->ValidRatio();
+    }
+
+    [[nodiscard]] Distribution
+    FilterDistribution() const override {
+        return filter_impl_ == nullptr ? Distribution::NONE : filter_impl_->FilterDistribution();
+    }
+
+private:
+    const FilterPtr filter_impl_;
+    const Vector<std::atomic<bool>>& tombstones_;
+};
+
+}  // namespace vsag
@@ -0,0 +1,59 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tombstone_filter.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "black_list_filter.h"
+#include "impl/allocator/safe_allocator.h"
+
+using namespace vsag;
+
+TEST_CASE("TombstoneFilter Basic Test", "[ut][TombstoneFilter]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    int64_t max_count = 100;
+    Vector<std::atomic<bool>> tombstones(max_count,
+                                         AllocatorWrapper<std::atomic<bool>>(allocator.get()));
+    for (int64_t i = 0; i < max_count; i++) {
+        if (i % 5 == 0) {
+            tombstones[i].store(true);
+        }
+    }
+
+    SECTION("without inner filter") {
+        auto filter = std::make_shared<TombstoneFilter>(nullptr, tombstones);
+        for (int64_t i = 0; i < max_count; i++) {
+            REQUIRE(filter->CheckValid(i) == (i % 5 != 0));
+        }
+        REQUIRE(filter->ValidRatio() == 1.0F);
+        REQUIRE(filter->FilterDistribution() == Filter::Distribution::NONE);
+
+        tombstones[1].store(true);
+        REQUIRE_FALSE(filter->CheckValid(1));
+        tombstones[0].store(false);
+        REQUIRE(filter->CheckValid(0));
+    }
+
+    SECTION("with inner filter") {
+        auto func = [](int64_t id) -> bool { return id % 3 == 0; };
+        auto black = std::make_shared<BlackListFilter>(func);
+        auto filter = std::make_shared<TombstoneFilter>(black, tombstones);
+        for (int64_t i = 0; i < max_count; i++) {
+            REQUIRE(filter->CheckValid(i) == (i % 5 != 0 and i % 3 != 0));
+        }
+        REQUIRE(filter->ValidRatio() == black->ValidRatio());
+    }
+}
@@ -0,0 +1,80 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "filtered_search_planner.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vsag {
+
+float
+FilteredSearchPlanner::EstimateSelectivity(uint64_t total_count,
+                                           const Filter* filter,
+                                           const Filter* attr_filter) {
+    if (total_count == 0 or (filter == nullptr and attr_filter == nullptr)) {
+        return 1.0F;
+    }
+    auto sample_count = std::min(total_count, SAMPLE_SIZE);
+    auto stride = total_count / sample_count;
+    uint64_t passed = 0;
+    for (uint64_t i = 0; i < sample_count; ++i) {
+        auto id = static_cast<int64_t>(i * stride);
+        if ((filter == nullptr or filter->CheckValid(id)) and
+            (attr_filter == nullptr or attr_filter->CheckValid(id))) {
+            ++passed;
+        }
+    }
+    return static_cast<float>(passed) / static_cast<float>(sample_count);
+}
+
+FilteredSearchPlan
+FilteredSearchPlanner::Plan(FilteredSearchPlan mode, const FilteredSearchEstimate& estimate) {
+    if (mode != FilteredSearchPlan::AUTO) {
+        return mode;
+    }
+    auto total_count = static_cast<double>(estimate.total_count);
+    // a sample without any allowed id still leaves up to one id per sample stride
+    auto selectivity = std::max(static_cast<double>(estimate.selectivity),
+                                1.0 / static_cast<double>(SAMPLE_SIZE + 1));
+    auto graph_cost =
+        std::min(total_count,
+                 static_cast<double>(estimate.ef * estimate.max_degree) / selectivity);
+    auto scan_cost = selectivity * total_count + FILTER_CHECK_COST * total_count;
+    if (scan_cost <= graph_cost) {
+        return FilteredSearchPlan::BRUTE_FORCE;
+    }
+    if (estimate.selectivity < TWO_HOP_MAX_SELECTIVITY) {
+        return FilteredSearchPlan::TWO_HOP;
+    }
+    return FilteredSearchPlan::GRAPH;
+}
+
+uint64_t
+FilteredSearchPlanner::AdaptEf(uint64_t ef, uint64_t max_ef, float selectivity) {
+    if (max_ef <= ef or selectivity >= 1.0F) {
+        return ef;
+    }
+    if (selectivity <= 0.0F) {
+        return max_ef;
+    }
+    auto scaled = std::ceil(static_cast<double>(ef) / static_cast<double>(selectivity));
+    if (scaled >= static_cast<double>(max_ef)) {
+        return max_ef;
+    }
+    return std::max(ef, static_cast<uint64_t>(scaled));
+}
+
+}  // namespace vsag
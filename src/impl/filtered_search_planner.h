@@ -0,0 +1,93 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "typing.h"
+#include "vsag/filter.h"
+
+namespace vsag {
+
+enum class FilteredSearchPlan {
+    AUTO = 0,         // chosen per search by FilteredSearchPlanner
+    GRAPH = 1,        // the filters are checked inside the graph traversal
+    TWO_HOP = 2,      // as GRAPH, a rejected neighbor is replaced by its allowed neighbors
+    BRUTE_FORCE = 3,  // the allowed ids are scanned exhaustively with the flatten codes
+};
+
+// the inputs of one filtered search, selectivity is the estimated fraction of ids passing
+struct FilteredSearchEstimate {
+    uint64_t total_count{0};
+    float selectivity{1.0F};
+    uint64_t ef{0};
+    uint64_t max_degree{0};
+};
+
+/**
+ * @class FilteredSearchPlanner
+ * @brief Chooses how a filtered knn search runs from the estimated filter selectivity.
+ *
+ * A graph traversal computes about ef * degree distances when every id is allowed and that
+ * count divided by the selectivity when the filter rejects most of the visited ids, a scan of
+ * the allowed ids computes selectivity * total_count distances plus one filter check per id.
+ * The cheaper one is taken, and a graph traversal below TWO_HOP_MAX_SELECTIVITY expands the
+ * rejected neighbors so that the allowed subgraph stays connected.
+ */
+class FilteredSearchPlanner {
+public:
+    // the ids checked to estimate the selectivity of filters without a known valid ratio
+    static constexpr uint64_t SAMPLE_SIZE = 1024;
+
+    // below this selectivity the traversal expands the neighbors of rejected nodes
+    static constexpr float TWO_HOP_MAX_SELECTIVITY = 0.1F;
+
+    // the cost of one filter check relative to one distance computation
+    static constexpr float FILTER_CHECK_COST = 0.05F;
+
+    /**
+     * @brief Estimates the fraction of [0, total_count) passing both filters.
+     *
+     * The ids are sampled with a fixed stride so the estimate is deterministic, all of them
+     * are checked when there are no more than SAMPLE_SIZE.
+     *
+     * @param total_count The count of inner ids.
+     * @param filter The filter on inner ids, may be nullptr.
+     * @param attr_filter The filter built by the attribute executor, may be nullptr.
+     * @return The estimated selectivity in [0, 1].
+     */
+    static float
+    EstimateSelectivity(uint64_t total_count, const Filter* filter, const Filter* attr_filter);
+
+    /**
+     * @brief Resolves the plan of one search.
+     *
+     * @param mode The requested plan, anything but AUTO is returned as is.
+     * @param estimate The estimated shape of the search.
+     * @return One of GRAPH, TWO_HOP and BRUTE_FORCE.
+     */
+    static FilteredSearchPlan
+    Plan(FilteredSearchPlan mode, const FilteredSearchEstimate& estimate);
+
+    /**
+     * @brief Scales ef by the inverse selectivity so that ef allowed results can still be
+     *        collected, the result lies in [ef, max(ef, max_ef)].
+     */
+    static uint64_t
+    AdaptEf(uint64_t ef, uint64_t max_ef, float selectivity);
+};
+
+}  // namespace vsag
@@ -0,0 +1,79 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "filtered_search_planner.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace vsag;
+
+class ModuloFilter : public Filter {
+public:
+    explicit ModuloFilter(int64_t modulo) : modulo_(modulo) {
+    }
+
+    [[nodiscard]] bool
+    CheckValid(int64_t id) const override {
+        return id % modulo_ == 0;
+    }
+
+private:
+    int64_t modulo_{1};
+};
+
+TEST_CASE("FilteredSearchPlanner Estimate Selectivity", "[ut][FilteredSearchPlanner]") {
+    ModuloFilter half(2);
+    ModuloFilter tenth(10);
+    REQUIRE(FilteredSearchPlanner::EstimateSelectivity(1000, nullptr, nullptr) == 1.0F);
+    REQUIRE(FilteredSearchPlanner::EstimateSelectivity(0, &half, nullptr) == 1.0F);
+    REQUIRE(FilteredSearchPlanner::EstimateSelectivity(1000, &half, nullptr) == 0.5F);
+    REQUIRE(FilteredSearchPlanner::EstimateSelectivity(1000, &half, &tenth) == 0.1F);
+
+    // the stride sampling of a large index still lands on the allowed residues
+    auto selectivity = FilteredSearchPlanner::EstimateSelectivity(1000000, nullptr, &tenth);
+    REQUIRE(selectivity > 0.05F);
+    REQUIRE(selectivity < 0.25F);
+}
+
+TEST_CASE("FilteredSearchPlanner Plan", "[ut][FilteredSearchPlanner]") {
+    FilteredSearchEstimate estimate{
+        .total_count = 1000000, .selectivity = 1.0F, .ef = 100, .max_degree = 32};
+    REQUIRE(FilteredSearchPlanner::Plan(FilteredSearchPlan::AUTO, estimate) ==
+            FilteredSearchPlan::GRAPH);
+
+    estimate.selectivity = 0.05F;
+    REQUIRE(FilteredSearchPlanner::Plan(FilteredSearchPlan::AUTO, estimate) ==
+            FilteredSearchPlan::TWO_HOP);
+
+    estimate.selectivity = 0.0001F;
+    REQUIRE(FilteredSearchPlanner::Plan(FilteredSearchPlan::AUTO, estimate) ==
+            FilteredSearchPlan::BRUTE_FORCE);
+    REQUIRE(FilteredSearchPlanner::Plan(FilteredSearchPlan::GRAPH, estimate) ==
+            FilteredSearchPlan::GRAPH);
+
+    // a small index is cheaper to scan than to traverse
+    estimate.total_count = 1000;
+    estimate.selectivity = 0.5F;
+    REQUIRE(FilteredSearchPlanner::Plan(FilteredSearchPlan::AUTO, estimate) ==
+            FilteredSearchPlan::BRUTE_FORCE);
+}
+
+TEST_CASE("FilteredSearchPlanner Adapt Ef", "[ut][FilteredSearchPlanner]") {
+    REQUIRE(FilteredSearchPlanner::AdaptEf(100, 0, 0.01F) == 100);
+    REQUIRE(FilteredSearchPlanner::AdaptEf(100, 1000, 1.0F) == 100);
+    REQUIRE(FilteredSearchPlanner::AdaptEf(100, 1000, 0.5F) == 200);
+    REQUIRE(FilteredSearchPlanner::AdaptEf(100, 1000, 0.01F) == 1000);
+    REQUIRE(FilteredSearchPlanner::AdaptEf(100, 1000, 0.0F) == 1000);
+}
@@ -17,11 +17,14 @@
 
 #include "attr/executor/executor.h"
 #include "typing.h"
+#include "utils/search_statistics.h"
 #include "utils/timer.h"
 #include "vsag/filter.h"
 
 namespace vsag {
 
+class FlattenInterface;
+
 enum InnerSearchMode { KNN_SEARCH = 1, RANGE_SEARCH = 2 };
 
 enum InnerSearchType { PURE = 1, WITH_FILTER = 2 };
@@ -38,6 +41,27 @@ public:
     int range_search_limit_size{-1};
     int64_t parallel_search_thread_count{1};
 
+    // adaptive ef for knn search, disabled when early_stop_patience is 0
+    // stop after early_stop_patience hops without improving the best early_stop_k results,
+    // or when the nearest candidate is farther than early_stop_distance_ratio times the k-th
+    // result; when the fixed-ef condition fires right after a hop which improved the results,
+    // ef is doubled up to max_ef instead of stopping. Only BasicSearcher::Search applies it,
+    // BatchSearch and ParallelSearch keep the fixed ef
+    uint32_t early_stop_patience{0};
+    float early_stop_distance_ratio{0.0F};
+    int64_t early_stop_k{0};
+    uint64_t max_ef{0};
+
+    // a neighbor rejected by the filters is replaced by its allowed unvisited neighbors, which
+    // keeps the traversal connected when the filters allow only a few ids
+    bool two_hop_expansion{false};
+
+    // for a graph which keeps the codes of colocated_flatten next to its adjacency lists: the
+    // code of an expanded node comes with its neighbors, its exact distance is recorded in
+    // exact_dists, so the reorder of the expanded nodes reads no code again
+    FlattenInterface* colocated_flatten{nullptr};
+    UnorderedMap<InnerIdType, float>* exact_dists{nullptr};
+
     // for ivf
     int scan_bucket_size{1};
     float factor{2.0F};
@@ -50,6 +74,24 @@ public:
     // time record
     std::shared_ptr<Timer> time_cost{nullptr};
 
+    // per query counters, only filled when requested
+    SearchStatistics* statistics{nullptr};
+
+    // the search also stops at the deadline or on the cancel flag of the request, through the
+    // same checks as the time record
+    void
+    BindStopCondition(const SearchRequest& request) {
+        if (request.cancel_flag_ == nullptr and
+            request.deadline_ == std::chrono::steady_clock::time_point::max()) {
+            return;
+        }
+        if (time_cost == nullptr) {
+            time_cost = std::make_shared<Timer>();
+        }
+        time_cost->SetDeadline(request.deadline_);
+        time_cost->SetCancelFlag(request.cancel_flag_);
+    }
+
     InnerSearchParam&
     operator=(const InnerSearchParam& other) {
         if (this != &other) {
@@ -60,6 +102,12 @@ public:
             skip_ratio = other.skip_ratio;
             search_mode = other.search_mode;
             range_search_limit_size = other.range_search_limit_size;
+            parallel_search_thread_count = other.parallel_search_thread_count;
+            early_stop_patience = other.early_stop_patience;
+            early_stop_distance_ratio = other.early_stop_distance_ratio;
+            early_stop_k = other.early_stop_k;
+            max_ef = other.max_ef;
+            two_hop_expansion = other.two_hop_expansion;
             is_inner_id_allowed = other.is_inner_id_allowed;
             scan_bucket_size = other.scan_bucket_size;
             factor = other.factor;
@@ -18,18 +18,32 @@
 #include <cblas.h>
 #include <omp.h>
 
-#include <random>
-
 #include "algorithm/inner_index_interface.h"
-#include "byte_buffer.h"
 #include "diskann_logger.h"
 #include "impl/allocator/safe_allocator.h"
 #include "simd/fp32_simd.h"
 #include "utils/util_functions.h"
 
 namespace vsag {
-KMeansCluster::KMeansCluster(int32_t dim, Allocator* allocator, SafeThreadPoolPtr thread_pool)
-    : dim_(dim), allocator_(allocator), thread_pool_(std::move(thread_pool)) {
+
+static constexpr uint64_t TASK_BS = 1024;
+static constexpr uint64_t LABEL_BS = 64;
+
+static float
+safe_sqrt(float value) {
+    return std::sqrt(std::max(value, 0.0F));
+}
+
+KMeansCluster::KMeansCluster(int32_t dim,
+                             Allocator* allocator,
+                             SafeThreadPoolPtr thread_pool,
+                             uint64_t seed)
+    : dim_(dim),
+      allocator_(allocator),
+      thread_pool_(std::move(thread_pool)),
+      generator_(seed),
+      y_sqr_(allocator),
+      distances_(allocator) {
     if (thread_pool_ == nullptr) {
         this->thread_pool_ = SafeThreadPool::FactoryDefaultThreadPool();
     }
@@ -42,6 +56,19 @@ KMeansCluster::~KMeansCluster() {
     }
 }
 
+template <class Func>
+void
+KMeansCluster::parallel_for(uint64_t count, uint64_t block_size, const Func& func) {
+    std::vector<std::future<void>> futures;
+    for (uint64_t i = 0; i < count; i += block_size) {
+        futures.emplace_back(
+            thread_pool_->GeneralEnqueue(func, i, std::min(i + block_size, count)));
+    }
+    for (auto& future : futures) {
+        future.wait();
+    }
+}
+
 Vector<int>
 KMeansCluster::Run(uint32_t k,
                    const float* datas,
@@ -54,28 +81,20 @@ KMeansCluster::Run(uint32_t k,
         allocator_->Deallocate(k_centroids_);
         k_centroids_ = nullptr;
     }
-    uint64_t size = static_cast<uint64_t>(k) * static_cast<uint64_t>(dim_) * sizeof(float);
+    auto dim = static_cast<uint64_t>(dim_);
+    uint64_t size = static_cast<uint64_t>(k) * dim * sizeof(float);
     k_centroids_ = static_cast<float*>(allocator_->Allocate(size));
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
     std::uniform_int_distribution<uint64_t> dis(0, count - 1);
-    for (int i = 0; i < k; ++i) {
-        auto index = dis(gen);
-        for (int j = 0; j < dim_; ++j) {
-            k_centroids_[i * dim_ + j] = datas[index * dim_ + j];
-        }
+    for (uint64_t i = 0; i < k; ++i) {
+        auto index = dis(generator_);
+        std::copy(datas + index * dim, datas + (index + 1) * dim, k_centroids_ + i * dim);
     }
 
-    double total_err = std::numeric_limits<double>::max();
-    double last_err = std::numeric_limits<double>::max();
-    Vector<int32_t> labels(count, -1, this->allocator_);
-    std::vector<std::mutex> mutexes(k);
-    std::vector<std::future<void>> futures;
-    ByteBuffer y_sqr_buffer(static_cast<uint64_t>(k) * sizeof(float), allocator_);
-    ByteBuffer distances_buffer(static_cast<uint64_t>(k) * QUERY_BS * sizeof(float), allocator_);
-    auto* y_sqr = reinterpret_cast<float*>(y_sqr_buffer.data);
-    auto* distances = reinterpret_cast<float*>(distances_buffer.data);
+    if (k < THRESHOLD_FOR_HGRAPH) {
+        y_sqr_.resize(k);
+        distances_.resize(static_cast<uint64_t>(k) * std::min(QUERY_BS, count));
+    }
 
     logger::trace("KMeansCluster::Run k: {}, count: {}, iter: {}", k, count, iter);
     if (k < THRESHOLD_FOR_HGRAPH) {
@@ -84,115 +103,352 @@ KMeansCluster::Run(uint32_t k,
         logger::trace("KMeansCluster::Run use hgraph");
     }
 
+    double total_err = std::numeric_limits<double>::max();
+    Vector<int32_t> labels(count, -1, this->allocator_);
+    if (count >= mini_batch_min_count_) {
+        logger::trace("KMeansCluster::Run use mini batch");
+        this->run_mini_batch(k, datas, count, iter);
+        this->update_route_index(k);
+        total_err = this->find_nearest_one(datas, count, k, labels.data(), nullptr, nullptr);
+        if (err != nullptr) {
+            *err = total_err;
+        }
+        Vector<float>(allocator_).swap(distances_);
+        route_index_.reset();
+        return labels;
+    }
+
+    double last_err = std::numeric_limits<double>::max();
+    Vector<float> upper_bounds(count, 0.0F, allocator_);
+    Vector<float> lower_bounds(count, 0.0F, allocator_);
+    Vector<float> drifts(k, 0.0F, allocator_);
+    Vector<float> half_gaps(k, 0.0F, allocator_);
+    Vector<float> old_centroids(static_cast<uint64_t>(k) * dim, allocator_);
+    Vector<int> counts(k, 0, allocator_);
+    Vector<float> new_centroids(static_cast<uint64_t>(k) * dim, 0.0F, allocator_);
+
     for (int it = 0; it < iter; ++it) {
         logger::trace("[{}] KMeansCluster::Run iter: {}/{}, cur loss is {}",
                       get_current_time(),
                       it,
                       iter,
                       total_err);
-        if (k < THRESHOLD_FOR_HGRAPH) {
-            total_err = this->find_nearest_one_with_blas(datas, count, k, y_sqr, distances, labels);
+        this->update_route_index(k);
+        if (it == 0) {
+            total_err = this->find_nearest_one(
+                datas, count, k, labels.data(), upper_bounds.data(), lower_bounds.data());
         } else {
-            total_err = this->find_nearest_one_with_hgraph(datas, count, k, labels);
+            total_err = this->assign_with_bounds(
+                datas, count, k, drifts, half_gaps, labels, upper_bounds, lower_bounds);
         }
-        constexpr uint64_t bs = 1024;
-
-        Vector<int> counts(k, 0, allocator_);
-        Vector<float> new_centroids(static_cast<uint64_t>(k) * dim_, 0.0F, allocator_);
 
-        auto update_centroids_func = [&](uint64_t start, uint64_t end) {
-            omp_set_num_threads(1);
-            for (uint64_t i = start; i < end; ++i) {
-                uint32_t label = labels[i];
-                {
-                    std::lock_guard<std::mutex> lock(mutexes[label]);
-                    counts[label]++;
-                    cblas_saxpy(dim_,
-                                1.0F,
-                                datas + i * dim_,
-                                1,
-                                new_centroids.data() + label * static_cast<uint64_t>(dim_),
-                                1);
-                }
-            }
-        };
-        for (uint64_t i = 0; i < count; i += bs) {
-            futures.emplace_back(
-                thread_pool_->GeneralEnqueue(update_centroids_func, i, std::min(i + bs, count)));
-        }
-        for (auto& future : futures) {
-            future.wait();
-        }
-        futures.clear();
+        this->sum_by_label(datas, count, k, labels.data(), counts, new_centroids);
 
         if (it > 0 && use_mse_for_convergence &&
             std::fabs(last_err - total_err) / static_cast<double>(count) < threshold) {
             break;
         }
 
-        for (int j = 0; j < k; ++j) {
+        std::copy(k_centroids_, k_centroids_ + old_centroids.size(), old_centroids.data());
+        for (uint64_t j = 0; j < k; ++j) {
             if (counts[j] > 0) {
                 cblas_sscal(dim_,
                             1.0F / static_cast<float>(counts[j]),
-                            new_centroids.data() + j * static_cast<uint64_t>(dim_),
+                            new_centroids.data() + j * dim,
                             1);
-                std::copy(new_centroids.data() + j * static_cast<uint64_t>(dim_),
-                          new_centroids.data() + (j + 1) * static_cast<uint64_t>(dim_),
-                          k_centroids_ + j * static_cast<uint64_t>(dim_));
+                std::copy(new_centroids.data() + j * dim,
+                          new_centroids.data() + (j + 1) * dim,
+                          k_centroids_ + j * dim);
             } else {
-                auto index = dis(gen);
-                for (int s = 0; s < dim_; ++s) {
-                    k_centroids_[j * dim_ + s] = datas[index * dim_ + s];
-                }
+                auto index = dis(generator_);
+                std::copy(datas + index * dim, datas + (index + 1) * dim, k_centroids_ + j * dim);
             }
+            drifts[j] = safe_sqrt(
+                FP32ComputeL2Sqr(old_centroids.data() + j * dim, k_centroids_ + j * dim, dim));
         }
+        this->compute_half_gaps(k, half_gaps);
         last_err = total_err;
     }
     if (err != nullptr) {
         *err = total_err;
     }
+    Vector<float>(allocator_).swap(distances_);
+    route_index_.reset();
     return labels;
 }
 
+double
+KMeansCluster::assign_with_bounds(const float* datas,
+                                  uint64_t count,
+                                  uint64_t k,
+                                  const Vector<float>& drifts,
+                                  const Vector<float>& half_gaps,
+                                  Vector<int32_t>& labels,
+                                  Vector<float>& upper_bounds,
+                                  Vector<float>& lower_bounds) {
+    auto dim = static_cast<uint64_t>(dim_);
+    // a sample of the centroid with the largest drift is moved by the second largest one
+    uint64_t max_drift_id = 0;
+    float max_drift = 0.0F;
+    float second_drift = 0.0F;
+    for (uint64_t j = 0; j < k; ++j) {
+        if (drifts[j] > max_drift) {
+            second_drift = max_drift;
+            max_drift = drifts[j];
+            max_drift_id = j;
+        } else if (drifts[j] > second_drift) {
+            second_drift = drifts[j];
+        }
+    }
+
+    Vector<uint8_t> need_scan(count, 0, allocator_);
+    Vector<double> block_errors((count + TASK_BS - 1) / TASK_BS, 0.0, allocator_);
+    auto check_bounds_func = [&](uint64_t start, uint64_t end) -> void {
+        double block_error = 0.0;
+        for (uint64_t i = start; i < end; ++i) {
+            auto label = static_cast<uint64_t>(labels[i]);
+            auto dist_sqr = FP32ComputeL2Sqr(datas + i * dim, k_centroids_ + label * dim, dim);
+            upper_bounds[i] = safe_sqrt(dist_sqr);
+            if (lower_bounds[i] != std::numeric_limits<float>::max()) {
+                lower_bounds[i] -= (label == max_drift_id ? second_drift : max_drift);
+            }
+            if (upper_bounds[i] <= std::max(lower_bounds[i], half_gaps[label])) {
+                block_error += static_cast<double>(dist_sqr);
+            } else {
+                need_scan[i] = 1;
+            }
+        }
+        block_errors[start / TASK_BS] = block_error;
+    };
+    this->parallel_for(count, TASK_BS, check_bounds_func);
+
+    double error = 0.0;
+    for (auto block_error : block_errors) {
+        error += block_error;
+    }
+
+    // the samples left are compared with all centroids, gathered to keep the batched path
+    Vector<uint64_t> scan_ids(allocator_);
+    for (uint64_t i = 0; i < count; ++i) {
+        if (need_scan[i] != 0) {
+            scan_ids.emplace_back(i);
+        }
+    }
+    logger::trace("KMeansCluster::Run {} of {} samples are reassigned", scan_ids.size(), count);
+    uint64_t gather_count = std::min(QUERY_BS, static_cast<uint64_t>(scan_ids.size()));
+    Vector<float> gathered(gather_count * dim, allocator_);
+    Vector<int32_t> gathered_labels(gather_count, allocator_);
+    Vector<float> gathered_upper(gather_count, allocator_);
+    Vector<float> gathered_lower(gather_count, allocator_);
+    for (uint64_t i = 0; i < scan_ids.size(); i += QUERY_BS) {
+        auto cur_count = std::min(QUERY_BS, scan_ids.size() - i);
+        for (uint64_t j = 0; j < cur_count; ++j) {
+            auto id = scan_ids[i + j];
+            std::copy(datas + id * dim, datas + (id + 1) * dim, gathered.data() + j * dim);
+        }
+        auto cur_error = this->find_nearest_one(gathered.data(),
+                                                cur_count,
+                                                k,
+                                                gathered_labels.data(),
+                                                gathered_upper.data(),
+                                                gathered_lower.data());
+        error += cur_error * static_cast<double>(cur_count);
+        for (uint64_t j = 0; j < cur_count; ++j) {
+            auto id = scan_ids[i + j];
+            labels[id] = gathered_labels[j];
+            upper_bounds[id] = gathered_upper[j];
+            lower_bounds[id] = gathered_lower[j];
+        }
+    }
+    return error / static_cast<double>(count);
+}
+
+void
+KMeansCluster::sum_by_label(const float* datas,
+                            uint64_t count,
+                            uint64_t k,
+                            const int32_t* labels,
+                            Vector<int>& counts,
+                            Vector<float>& sums) {
+    auto dim = static_cast<uint64_t>(dim_);
+    std::fill(counts.begin(), counts.end(), 0);
+    std::fill(sums.begin(), sums.end(), 0.0F);
+    for (uint64_t i = 0; i < count; ++i) {
+        counts[labels[i]]++;
+    }
+    Vector<uint64_t> offsets(k + 1, 0, allocator_);
+    for (uint64_t j = 0; j < k; ++j) {
+        offsets[j + 1] = offsets[j] + counts[j];
+    }
+    Vector<uint64_t> order(count, allocator_);
+    {
+        Vector<uint64_t> cursors(offsets.begin(), offsets.end() - 1, allocator_);
+        for (uint64_t i = 0; i < count; ++i) {
+            order[cursors[labels[i]]++] = i;
+        }
+    }
+    auto sum_func = [&](uint64_t start, uint64_t end) -> void {
+        omp_set_num_threads(1);
+        for (uint64_t j = start; j < end; ++j) {
+            auto* sum = sums.data() + j * dim;
+            for (uint64_t p = offsets[j]; p < offsets[j + 1]; ++p) {
+                cblas_saxpy(dim_, 1.0F, datas + order[p] * dim, 1, sum, 1);
+            }
+        }
+    };
+    this->parallel_for(k, LABEL_BS, sum_func);
+}
+
+void
+KMeansCluster::run_mini_batch(uint32_t k, const float* datas, uint64_t count, int iter) {
+    auto dim = static_cast<uint64_t>(dim_);
+    auto batch_size = std::max(MINI_BATCH_MIN_SIZE, MINI_BATCH_SAMPLES_PER_CENTROID * k);
+    batch_size = std::min(batch_size, count);
+    std::uniform_int_distribution<uint64_t> dis(0, count - 1);
+
+    // the total count of samples seen by each centroid, its learning rate is the inverse
+    Vector<uint64_t> seen(k, 0, allocator_);
+    Vector<int> counts(k, 0, allocator_);
+    Vector<float> sums(static_cast<uint64_t>(k) * dim, 0.0F, allocator_);
+    Vector<int> batch_counts(k, 0, allocator_);
+    Vector<float> batch_sums(static_cast<uint64_t>(k) * dim, 0.0F, allocator_);
+    Vector<float> gathered(std::min(QUERY_BS, batch_size) * dim, allocator_);
+    Vector<int32_t> gathered_labels(std::min(QUERY_BS, batch_size), allocator_);
+
+    for (int it = 0; it < iter; ++it) {
+        logger::trace(
+            "[{}] KMeansCluster::Run mini batch iter: {}/{}", get_current_time(), it, iter);
+        std::fill(batch_counts.begin(), batch_counts.end(), 0);
+        std::fill(batch_sums.begin(), batch_sums.end(), 0.0F);
+        this->update_route_index(k);
+        // the batch is drawn and assigned against the same centroids, then applied at once
+        for (uint64_t i = 0; i < batch_size; i += QUERY_BS) {
+            auto cur_count = std::min(QUERY_BS, batch_size - i);
+            for (uint64_t j = 0; j < cur_count; ++j) {
+                auto id = dis(generator_);
+                std::copy(datas + id * dim, datas + (id + 1) * dim, gathered.data() + j * dim);
+            }
+            this->find_nearest_one(
+                gathered.data(), cur_count, k, gathered_labels.data(), nullptr, nullptr);
+            this->sum_by_label(gathered.data(), cur_count, k, gathered_labels.data(), counts, sums);
+            for (uint64_t j = 0; j < k; ++j) {
+                batch_counts[j] += counts[j];
+            }
+            cblas_saxpy(static_cast<blasint>(k * dim), 1.0F, sums.data(), 1, batch_sums.data(), 1);
+        }
+        for (uint64_t j = 0; j < k; ++j) {
+            if (batch_counts[j] == 0) {
+                continue;
+            }
+            seen[j] += batch_counts[j];
+            // c += (sum - n * c) / seen, i.e. each sample moves c by 1 / seen towards itself
+            auto rate = 1.0F / static_cast<float>(seen[j]);
+            auto* centroid = k_centroids_ + j * dim;
+            const auto* sum = batch_sums.data() + j * dim;
+            auto n = static_cast<float>(batch_counts[j]);
+            for (uint64_t d = 0; d < dim; ++d) {
+                centroid[d] += (sum[d] - n * centroid[d]) * rate;
+            }
+        }
+    }
+}
+
+void
+KMeansCluster::compute_half_gaps(uint64_t k, Vector<float>& half_gaps) {
+    // the pairwise pass costs k * k distances, only affordable along the blas assignment
+    if (k >= THRESHOLD_FOR_HGRAPH) {
+        std::fill(half_gaps.begin(), half_gaps.end(), 0.0F);
+        return;
+    }
+    auto dim = static_cast<uint64_t>(dim_);
+    auto gap_func = [&](uint64_t start, uint64_t end) -> void {
+        for (uint64_t i = start; i < end; ++i) {
+            float min_dist = std::numeric_limits<float>::max();
+            for (uint64_t j = 0; j < k; ++j) {
+                if (j == i) {
+                    continue;
+                }
+                min_dist = std::min(
+                    min_dist,
+                    FP32ComputeL2Sqr(k_centroids_ + i * dim, k_centroids_ + j * dim, dim));
+            }
+            half_gaps[i] =
+                min_dist == std::numeric_limits<float>::max() ? min_dist : safe_sqrt(min_dist) / 2;
+        }
+    };
+    this->parallel_for(k, LABEL_BS, gap_func);
+}
+
+void
+KMeansCluster::update_route_index(uint64_t k) {
+    if (k < THRESHOLD_FOR_HGRAPH) {
+        return;
+    }
+    IndexCommonParam param;
+    param.dim_ = dim_;
+    param.allocator_ = std::make_shared<SafeAllocator>(this->allocator_);
+    param.thread_pool_ = this->thread_pool_;
+    param.metric_ = MetricType::METRIC_TYPE_L2SQR;
+
+    route_index_ = InnerIndexInterface::FastCreateIndex("hgraph|32|fp32", param);
+    auto base = Dataset::Make();
+    Vector<int64_t> ids(k, allocator_);
+    std::iota(ids.begin(), ids.end(), 0);
+    base->Dim(dim_)
+        ->NumElements(static_cast<int64_t>(k))
+        ->Float32Vectors(this->k_centroids_)
+        ->Ids(ids.data())
+        ->Owner(false);
+    route_index_->Build(base);
+}
+
+double
+KMeansCluster::find_nearest_one(const float* query,
+                                uint64_t query_count,
+                                uint64_t k,
+                                int32_t* labels,
+                                float* nearest_dists,
+                                float* second_dists) {
+    if (k < THRESHOLD_FOR_HGRAPH) {
+        return this->find_nearest_one_with_blas(query,
+                                                query_count,
+                                                k,
+                                                y_sqr_.data(),
+                                                distances_.data(),
+                                                labels,
+                                                nearest_dists,
+                                                second_dists);
+    }
+    return this->find_nearest_one_with_hgraph(
+        query, query_count, k, labels, nearest_dists, second_dists);
+}
+
 double
 KMeansCluster::find_nearest_one_with_blas(const float* query,
                                           const uint64_t query_count,
                                           const uint64_t k,
                                           float* y_sqr,
                                           float* distances,
-                                          Vector<int32_t>& labels) {
-    double error = 0.0;
-    std::mutex error_mutex;
+                                          int32_t* labels,
+                                          float* nearest_dists,
+                                          float* second_dists) {
     if (k_centroids_ == nullptr) {
         throw VsagException(ErrorType::INTERNAL_ERROR, "k_centroids_ is nullptr");
     }
 
-    auto& thread_pool = this->thread_pool_;
-    auto bs = 1024;
-    std::vector<std::future<void>> futures;
-
-    auto wait_futures_and_clear = [&]() {
-        for (auto& future : futures) {
-            future.wait();
-        }
-        futures.clear();
-    };
-
     auto compute_ip_func = [&](uint64_t start, uint64_t end) -> void {
         for (uint64_t i = start; i < end; ++i) {
             y_sqr[i] = FP32ComputeIP(k_centroids_ + i * dim_, k_centroids_ + i * dim_, dim_);
         }
     };
-    for (uint64_t i = 0; i < static_cast<uint64_t>(k); i += bs) {
-        futures.emplace_back(thread_pool->GeneralEnqueue(
-            compute_ip_func, i, std::min(i + bs, static_cast<uint64_t>(k))));
-    }
-    wait_futures_and_clear();
+    this->parallel_for(k, TASK_BS, compute_ip_func);
 
+    double error = 0.0;
     for (uint64_t i = 0; i < query_count; i += QUERY_BS) {
         auto end = std::min(i + QUERY_BS, query_count);
         auto cur_query_count = end - i;
-        auto* cur_label = labels.data() + i;
+        auto* cur_label = labels + i;
+        const auto* cur_query = query + i * dim_;
 
         cblas_sgemm(CblasColMajor,
                     CblasTrans,
@@ -203,68 +459,73 @@ KMeansCluster::find_nearest_one_with_blas(const float* query,
                     -2.0F,
                     k_centroids_,
                     dim_,
-                    query + i * dim_,
+                    cur_query,
                     dim_,
                     0.0F,
                     distances,
                     static_cast<blasint>(k));
 
+        Vector<double> block_errors((cur_query_count + TASK_BS - 1) / TASK_BS, 0.0, allocator_);
         auto assign_labels_func = [&](uint64_t start, uint64_t end) -> void {
             omp_set_num_threads(1);
             double thread_local_error = 0.0;
-            for (uint64_t i = start; i < end; ++i) {
-                cblas_saxpy(static_cast<blasint>(k), 1.0, y_sqr, 1, distances + i * k, 1);
-                auto* min_elem = std::min_element(distances + i * k, distances + i * k + k);
-                auto x_sqr = FP32ComputeIP(query + i * dim_, query + i * dim_, dim_);
-                auto min_index = std::distance(distances + i * k, min_elem);
-                thread_local_error += static_cast<double>(*min_elem + x_sqr);
-                if (min_index != cur_label[i]) {
-                    cur_label[i] = static_cast<int>(min_index);
+            for (uint64_t j = start; j < end; ++j) {
+                auto* dists = distances + j * k;
+                cblas_saxpy(static_cast<blasint>(k), 1.0, y_sqr, 1, dists, 1);
+                auto x_sqr = FP32ComputeIP(cur_query + j * dim_, cur_query + j * dim_, dim_);
+                uint64_t min_index = 0;
+                float min_dist = std::numeric_limits<float>::max();
+                float second_dist = std::numeric_limits<float>::max();
+                for (uint64_t c = 0; c < k; ++c) {
+                    if (dists[c] < min_dist) {
+                        second_dist = min_dist;
+                        min_dist = dists[c];
+                        min_index = c;
+                    } else if (dists[c] < second_dist) {
+                        second_dist = dists[c];
+                    }
+                }
+                thread_local_error += static_cast<double>(min_dist + x_sqr);
+                cur_label[j] = static_cast<int32_t>(min_index);
+                if (nearest_dists != nullptr) {
+                    nearest_dists[i + j] = safe_sqrt(min_dist + x_sqr);
+                }
+                if (second_dists != nullptr) {
+                    second_dists[i + j] = second_dist == std::numeric_limits<float>::max()
+                                              ? second_dist
+                                              : safe_sqrt(second_dist + x_sqr);
                 }
             }
-            {
-                std::lock_guard<std::mutex> lock(error_mutex);
-                error += thread_local_error;
-            }
+            block_errors[start / TASK_BS] = thread_local_error;
         };
-        for (uint64_t j = 0; j < cur_query_count; j += bs) {
-            futures.emplace_back(thread_pool->GeneralEnqueue(
-                assign_labels_func, j, std::min(j + bs, cur_query_count)));
+        this->parallel_for(cur_query_count, TASK_BS, assign_labels_func);
+        for (auto block_error : block_errors) {
+            error += block_error;
         }
-        wait_futures_and_clear();
     }
-    return error / static_cast<float>(query_count);
+    return error / static_cast<double>(query_count);
 }
 
 double
 KMeansCluster::find_nearest_one_with_hgraph(const float* query,
                                             const uint64_t query_count,
                                             const uint64_t k,
-                                            Vector<int32_t>& labels) {
+                                            int32_t* labels,
+                                            float* nearest_dists,
+                                            float* second_dists) {
     if (k_centroids_ == nullptr) {
         throw VsagException(ErrorType::INTERNAL_ERROR, "k_centroids_ is nullptr");
     }
-    double error = 0.0;
-    std::mutex error_mutex;
 
-    IndexCommonParam param;
-    param.dim_ = dim_;
-    param.allocator_ = std::make_shared<SafeAllocator>(this->allocator_);
-    param.thread_pool_ = this->thread_pool_;
-    param.metric_ = MetricType::METRIC_TYPE_L2SQR;
-
-    auto hgraph = InnerIndexInterface::FastCreateIndex("hgraph|32|fp32", param);
-    auto base = Dataset::Make();
-    Vector<int64_t> ids(k, allocator_);
-    std::iota(ids.begin(), ids.end(), 0);
-    base->Dim(dim_)
-        ->NumElements(static_cast<int64_t>(k))
-        ->Float32Vectors(this->k_centroids_)
-        ->Ids(ids.data())
-        ->Owner(false);
-    hgraph->Build(base);
+    if (route_index_ == nullptr) {
+        throw VsagException(ErrorType::INTERNAL_ERROR, "route_index_ is nullptr");
+    }
+    auto& hgraph = route_index_;
     FilterPtr filter = nullptr;
     constexpr const char* search_param = R"({"hgraph":{"ef_search":10}})";
+    // the second result is approximate as well, so are the lower bounds taken from it
+    int64_t topk = second_dists != nullptr ? 2 : 1;
+    Vector<double> block_errors((query_count + TASK_BS - 1) / TASK_BS, 0.0, allocator_);
     auto func = [&](const uint64_t begin, const uint64_t end) -> void {
         double thread_local_error = 0.0;
         for (uint64_t j = begin; j < end; ++j) {
@@ -273,24 +534,25 @@ KMeansCluster::find_nearest_one_with_hgraph(const float* query,
                 ->Float32Vectors(query + j * this->dim_)
                 ->NumElements(1)
                 ->Dim(this->dim_);
-            auto ret = hgraph->KnnSearch(q, 1, search_param, filter);
+            auto ret = hgraph->KnnSearch(q, topk, search_param, filter);
             labels[j] = static_cast<int32_t>(ret->GetIds()[0]);
             thread_local_error += static_cast<double>(ret->GetDistances()[0]);
+            if (nearest_dists != nullptr) {
+                nearest_dists[j] = safe_sqrt(ret->GetDistances()[0]);
+            }
+            if (second_dists != nullptr) {
+                second_dists[j] = ret->GetDim() > 1 ? safe_sqrt(ret->GetDistances()[1])
+                                                    : std::numeric_limits<float>::max();
+            }
         }
-        {
-            std::lock_guard<std::mutex> lock(error_mutex);
-            error += thread_local_error;
-        }
+        block_errors[begin / TASK_BS] = thread_local_error;
     };
-    std::vector<std::future<void>> futures;
-    for (uint64_t i = 0; i < query_count; i += QUERY_BS) {
-        futures.emplace_back(
-            thread_pool_->GeneralEnqueue(func, i, std::min(i + QUERY_BS, query_count)));
-    }
-    for (auto& future : futures) {
-        future.wait();
+    this->parallel_for(query_count, TASK_BS, func);
+    double error = 0.0;
+    for (auto block_error : block_errors) {
+        error += block_error;
     }
-    return error / static_cast<float>(query_count);
+    return error / static_cast<double>(query_count);
 }
 
 }  // namespace vsag
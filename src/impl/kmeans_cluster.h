@@ -15,17 +15,35 @@
 
 #pragma once
 
+#include <random>
+
 #include "safe_thread_pool.h"
 #include "typing.h"
 #include "vsag/allocator.h"
 
 namespace vsag {
 
+class InnerIndexInterface;
+
+/**
+ * @class KMeansCluster
+ * @brief Lloyd's k-means on the thread pool, seeded so that a rerun gives the same centroids.
+ *
+ * After the first iteration each sample keeps an upper bound on the distance to its centroid
+ * and a lower bound on the distance to any other one (Hamerly), both moved by the centroid
+ * drifts. A sample is only compared with all centroids again when its exact distance to its
+ * centroid exceeds the lower bound and half the gap to the nearest other centroid. Samples of
+ * mini_batch_min_count_ or more are trained on random batches instead (Sculley's mini-batch
+ * k-means) and assigned once at the end.
+ */
 class KMeansCluster {
 public:
+    static constexpr uint64_t DEFAULT_SEED = 47;
+
     explicit KMeansCluster(int32_t dim,
                            Allocator* allocator,
-                           SafeThreadPoolPtr thread_pool = nullptr);
+                           SafeThreadPoolPtr thread_pool = nullptr,
+                           uint64_t seed = DEFAULT_SEED);
 
     ~KMeansCluster();
 
@@ -41,20 +59,78 @@ public:
 public:
     float* k_centroids_{nullptr};
 
+    // samples of this count or more are trained by mini batches
+    uint64_t mini_batch_min_count_{MINI_BATCH_MIN_COUNT};
+
 private:
+    /**
+     * @brief Assigns each query to its nearest centroid.
+     *
+     * @param nearest_dists If not nullptr, receives the distance (not squared) to the nearest.
+     * @param second_dists If not nullptr, receives the distance (not squared) to the second
+     *        nearest, or the max float when k is 1.
+     * @return The mean squared distance to the nearest centroid.
+     */
+    double
+    find_nearest_one(const float* query,
+                     uint64_t query_count,
+                     uint64_t k,
+                     int32_t* labels,
+                     float* nearest_dists,
+                     float* second_dists);
+
     double
     find_nearest_one_with_blas(const float* query,
                                const uint64_t query_count,
                                const uint64_t k,
                                float* y_sqr,
                                float* distances,
-                               Vector<int32_t>& labels);
+                               int32_t* labels,
+                               float* nearest_dists,
+                               float* second_dists);
+
+    // rebuilds the graph over the centroids used by find_nearest_one_with_hgraph
+    void
+    update_route_index(uint64_t k);
 
     double
     find_nearest_one_with_hgraph(const float* query,
                                  const uint64_t query_count,
                                  const uint64_t k,
-                                 Vector<int32_t>& labels);
+                                 int32_t* labels,
+                                 float* nearest_dists,
+                                 float* second_dists);
+
+    // reassigns the samples whose bounds no longer prove their label, returns the squared error
+    double
+    assign_with_bounds(const float* datas,
+                       uint64_t count,
+                       uint64_t k,
+                       const Vector<float>& drifts,
+                       const Vector<float>& half_gaps,
+                       Vector<int32_t>& labels,
+                       Vector<float>& upper_bounds,
+                       Vector<float>& lower_bounds);
+
+    // sums the samples of each label in sample order, so the result does not depend on threads
+    void
+    sum_by_label(const float* datas,
+                 uint64_t count,
+                 uint64_t k,
+                 const int32_t* labels,
+                 Vector<int>& counts,
+                 Vector<float>& sums);
+
+    void
+    run_mini_batch(uint32_t k, const float* datas, uint64_t count, int iter);
+
+    // half the distance from each centroid to its nearest other centroid
+    void
+    compute_half_gaps(uint64_t k, Vector<float>& half_gaps);
+
+    template <class Func>
+    void
+    parallel_for(uint64_t count, uint64_t block_size, const Func& func);
 
 private:
     Allocator* const allocator_{nullptr};
@@ -63,9 +139,24 @@ private:
 
     const int32_t dim_{0};
 
+    std::mt19937_64 generator_;
+
+    Vector<float> y_sqr_;
+
+    Vector<float> distances_;
+
+    std::shared_ptr<InnerIndexInterface> route_index_{nullptr};
+
     static constexpr uint64_t THRESHOLD_FOR_HGRAPH = 10000ULL;
 
     static constexpr uint64_t QUERY_BS = 65536ULL;
+
+    static constexpr uint64_t MINI_BATCH_MIN_COUNT = 1ULL << 22;
+
+    // a batch holds this many samples per centroid, and at least MINI_BATCH_MIN_SIZE
+    static constexpr uint64_t MINI_BATCH_SAMPLES_PER_CENTROID = 32ULL;
+
+    static constexpr uint64_t MINI_BATCH_MIN_SIZE = 1ULL << 20;
 };
 
 }  // namespace vsag
@@ -59,3 +59,47 @@ TEST_CASE("Kmeans Basic Test", "[ut][KMeansCluster]") {
         REQUIRE(new_labels[i] == labels[i]);
     }
 }
+
+TEST_CASE("Kmeans Deterministic Test", "[ut][KMeansCluster]") {
+    int32_t k = 20;
+    int32_t dim = 16;
+    uint64_t count = 5000;
+    auto datas = fixtures::generate_vectors(count, dim, false, 47);
+    auto allocator = vsag::SafeAllocator::FactoryDefaultAllocator();
+
+    // the same seed gives the same centroids whatever the scheduling of the threads
+    vsag::KMeansCluster cluster(dim, allocator.get(), nullptr, 2025);
+    vsag::KMeansCluster another_cluster(dim, allocator.get(), nullptr, 2025);
+    double err = 0;
+    double another_err = 0;
+    auto pos = cluster.Run(k, datas.data(), count, 25, &err);
+    auto another_pos = another_cluster.Run(k, datas.data(), count, 25, &another_err);
+    REQUIRE(err == another_err);
+    for (uint64_t i = 0; i < count; ++i) {
+        REQUIRE(pos[i] == another_pos[i]);
+    }
+    for (uint64_t i = 0; i < k * dim; ++i) {
+        REQUIRE(cluster.k_centroids_[i] == another_cluster.k_centroids_[i]);
+    }
+}
+
+TEST_CASE("Kmeans Mini Batch Test", "[ut][KMeansCluster]") {
+    std::vector<int> labels;
+    int32_t k = 10;
+    int32_t dim = 3;
+    uint64_t count = 2000;
+    auto datas = GenerateDataset(k, dim, count, labels);
+
+    auto allocator = vsag::SafeAllocator::FactoryDefaultAllocator();
+    vsag::KMeansCluster cluster(dim, allocator.get());
+    cluster.mini_batch_min_count_ = 0;
+    double err = std::numeric_limits<double>::max();
+    auto pos = cluster.Run(k, datas.data(), count, 25, &err);
+    REQUIRE(pos.size() == count);
+    REQUIRE(err >= 0);
+    REQUIRE(err < std::numeric_limits<double>::max());
+    for (uint64_t i = 0; i < count; ++i) {
+        REQUIRE(pos[i] >= 0);
+        REQUIRE(pos[i] < k);
+    }
+}
@@ -22,17 +22,36 @@ Reorder::ReorderByFlatten(const DistHeapPtr& input,
                           const FlattenInterfacePtr& flatten,
                           const float* query,
                           Allocator* allocator,
-                          int64_t topk) {
+                          int64_t topk,
+                          const UnorderedMap<InnerIdType, float>* exact_dists) {
     auto reorder_heap = DistanceHeap::MakeInstanceBySize<true, true>(allocator, topk);
-    auto computer = flatten->FactoryComputer(query);
     size_t candidate_size = input->Size();
     const auto* candidate_result = input->GetData();
-    Vector<InnerIdType> ids(candidate_size, allocator);
     Vector<float> dists(candidate_size, allocator);
+    Vector<InnerIdType> ids(allocator);
+    Vector<uint64_t> positions(allocator);
+    ids.reserve(candidate_size);
+    positions.reserve(candidate_size);
     for (int i = 0; i < candidate_size; ++i) {
-        ids[i] = candidate_result[i].second;
+        auto id = candidate_result[i].second;
+        if (exact_dists != nullptr) {
+            auto iter = exact_dists->find(id);
+            if (iter != exact_dists->end()) {
+                dists[i] = iter->second;
+                continue;
+            }
+        }
+        ids.emplace_back(id);
+        positions.emplace_back(i);
+    }
+    if (not ids.empty()) {
+        auto computer = flatten->FactoryComputer(query);
+        Vector<float> read_dists(ids.size(), allocator);
+        flatten->Query(read_dists.data(), computer, ids.data(), ids.size());
+        for (uint64_t j = 0; j < ids.size(); ++j) {
+            dists[positions[j]] = read_dists[j];
+        }
     }
-    flatten->Query(dists.data(), computer, ids.data(), candidate_size);
     for (int i = 0; i < candidate_size; ++i) {
         if (reorder_heap->Size() < topk || dists[i] < reorder_heap->Top().first) {
             reorder_heap->Push(dists[i], candidate_result[i].second);
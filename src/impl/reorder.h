@@ -23,11 +23,13 @@
 namespace vsag {
 class Reorder {
 public:
+    // the candidates found in exact_dists keep the recorded distance, their codes are not read
     static DistHeapPtr
     ReorderByFlatten(const DistHeapPtr& input,
                      const FlattenInterfacePtr& flatten,
                      const float* query,
                      Allocator* allocator,
-                     int64_t topk);
+                     int64_t topk,
+                     const UnorderedMap<InnerIdType, float>* exact_dists = nullptr);
 };
 }  // namespace vsag
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "algorithm/inner_index_interface.h"
 #include "common.h"
 #include "vsag/index.h"
@@ -81,6 +83,11 @@ public:
         SAFE_CALL(return this->inner_index_->ContinueBuild(base, binary_set));
     }
 
+    tl::expected<void, Error>
+    SetBuildProgressCallback(BuildProgressCallback callback) override {
+        SAFE_CALL(this->inner_index_->SetBuildProgressCallback(std::move(callback)));
+    }
+
     tl::expected<std::vector<int64_t>, Error>
     Add(const DatasetPtr& base) override {
         if (this->inner_index_->immutable_) {
@@ -155,6 +162,44 @@ public:
         SAFE_CALL(return this->inner_index_->SearchWithRequest(request));
     }
 
+    std::future<tl::expected<DatasetPtr, Error>>
+    SearchAsync(const SearchRequest& request) const override {
+        auto promise = std::make_shared<std::promise<tl::expected<DatasetPtr, Error>>>();
+        auto future = promise->get_future();
+        auto submitted =
+            this->SearchAsync(request, [promise](tl::expected<DatasetPtr, Error> result) {
+                promise->set_value(std::move(result));
+            });
+        if (not submitted.has_value()) {
+            promise->set_value(tl::unexpected(submitted.error()));
+        }
+        return future;
+    }
+
+    tl::expected<void, Error>
+    SearchAsync(const SearchRequest& request, SearchCallback callback) const override {
+        if (callback == nullptr) {
+            return tl::unexpected(Error(ErrorType::INVALID_ARGUMENT, "callback is nullptr"));
+        }
+        auto pool = this->get_search_pool();
+        // the task holds the inner index, so the index may be released before it runs; an
+        // error of the search reaches the callback, the pool only logs one of the callback
+        pool->Enqueue(
+            [inner_index = this->inner_index_, request, callback = std::move(callback)]() {
+                tl::expected<DatasetPtr, Error> result;
+                try {
+                    result = search_with_request(inner_index, request);
+                } catch (const std::exception& e) {
+                    result = tl::unexpected(Error(ErrorType::UNKNOWN_ERROR, e.what()));
+                } catch (...) {
+                    result = tl::unexpected(
+                        Error(ErrorType::UNKNOWN_ERROR, "unknown error in async search"));
+                }
+                callback(std::move(result));
+            });
+        return {};
+    }
+
     [[nodiscard]] tl::expected<DatasetPtr, Error>
     KnnSearch(const DatasetPtr& query,
               int64_t k,
@@ -314,6 +359,11 @@ public:
         SAFE_CALL(return this->inner_index_->GetMinAndMaxId());
     }
 
+    tl::expected<void, Error>
+    WarmUp(const DatasetPtr& queries, int64_t k, const std::string& parameters) override {
+        SAFE_CALL(this->inner_index_->WarmUp(queries, k, parameters));
+    }
+
     virtual tl::expected<DatasetPtr, Error>
     GetRawVectorByIds(const int64_t* ids, int64_t count) const override {
         if (not CheckFeature(IndexFeature::SUPPORT_GET_RAW_VECTOR_BY_IDS)) {
@@ -380,6 +430,11 @@ public:
         SAFE_CALL(this->inner_index_->Deserialize(in_stream));
     }
 
+    tl::expected<void, Error>
+    DeserializeWithMMap(const std::string& file_path) override {
+        SAFE_CALL(this->inner_index_->DeserializeWithMMap(file_path));
+    }
+
     [[nodiscard]] bool
     CheckFeature(IndexFeature feature) const override {
         return this->inner_index_->CheckFeature(feature);
@@ -436,6 +491,35 @@ public:
     }
 
 private:
+    static tl::expected<DatasetPtr, Error>
+    search_with_request(const InnerIndexPtr& inner_index, const SearchRequest& request) {
+        if (request.cancel_flag_ != nullptr and request.cancel_flag_->load()) {
+            return tl::unexpected(
+                Error(ErrorType::SEARCH_CANCELLED, "search is cancelled before it starts"));
+        }
+        if (std::chrono::steady_clock::now() > request.deadline_) {
+            return tl::unexpected(
+                Error(ErrorType::SEARCH_TIMEOUT, "search deadline passed before it starts"));
+        }
+        if (inner_index->GetNumElements() == 0) {
+            return DatasetImpl::MakeEmptyDataset();
+        }
+        SAFE_CALL(return inner_index->SearchWithRequest(request));
+    }
+
+    // the pool of the resource, or a pool created on the first async search without one
+    SafeThreadPoolPtr
+    get_search_pool() const {
+        if (this->common_param_.thread_pool_ != nullptr) {
+            return this->common_param_.thread_pool_;
+        }
+        std::call_once(this->search_pool_flag_, [this]() {
+            this->search_pool_ = std::make_shared<SafeThreadPool>(
+                new DefaultThreadPool(Options::Instance().num_threads_io()), true);
+        });
+        return this->search_pool_;
+    }
+
     tl::expected<InnerIndexPtr, Error>
     clone_inner_index() const {
         SAFE_CALL(return this->inner_index_->Clone(this->common_param_));
@@ -450,6 +534,10 @@ private:
     InnerIndexPtr inner_index_{nullptr};
 
     IndexCommonParam common_param_{};
+
+    mutable std::once_flag search_pool_flag_;
+
+    mutable SafeThreadPoolPtr search_pool_{nullptr};
 };
 
 }  // namespace vsag
@@ -19,6 +19,7 @@
 #include <sstream>
 
 #include "algorithm/hgraph.h"
+#include "fixtures.h"
 #include "vsag/engine.h"
 
 TEST_CASE("immutable index test", "[ut][index_impl]") {
@@ -91,3 +92,68 @@ TEST_CASE("immutable index test", "[ut][index_impl]") {
     REQUIRE_FALSE(result_merge.has_value());
     REQUIRE(result_merge.error().type == vsag::ErrorType::UNSUPPORTED_INDEX_OPERATION);
 }
+
+TEST_CASE("async search test", "[ut][index_impl]") {
+    int64_t dim = 128;
+    int64_t num_elements = 500;
+    int64_t k = 10;
+    vsag::IndexCommonParam common_param;
+    common_param.dim_ = dim;
+    common_param.data_type_ = vsag::DataTypes::DATA_TYPE_FLOAT;
+    common_param.metric_ = vsag::MetricType::METRIC_TYPE_L2SQR;
+    common_param.allocator_ = vsag::Engine::CreateDefaultAllocator();
+    auto hgraph_json = vsag::JsonType::parse(R"(
+        {
+            "base_quantization_type": "fp32",
+            "max_degree": 16,
+            "ef_construction": 100
+        }
+    )");
+    auto index = std::make_shared<vsag::IndexImpl<vsag::HGraph>>(hgraph_json, common_param);
+
+    auto [ids, vectors] = fixtures::generate_ids_and_vectors(num_elements, dim);
+    auto base = vsag::Dataset::Make();
+    base->NumElements(num_elements)
+        ->Dim(dim)
+        ->Ids(ids.data())
+        ->Float32Vectors(vectors.data())
+        ->Owner(false);
+    REQUIRE(index->Build(base).has_value());
+
+    auto query = vsag::Dataset::Make();
+    query->NumElements(1)->Dim(dim)->Float32Vectors(vectors.data())->Owner(false);
+    vsag::SearchRequest request;
+    request.query_ = query;
+    request.topk_ = k;
+    request.params_str_ = R"({"hgraph": {"ef_search": 100}})";
+    auto expected = index->SearchWithRequest(request);
+    REQUIRE(expected.has_value());
+
+    // the index has no thread pool from its resource, so the search runs on its own pool
+    auto result = index->SearchAsync(request).get();
+    REQUIRE(result.has_value());
+    REQUIRE(result.value()->GetDim() == k);
+    for (int64_t i = 0; i < k; ++i) {
+        REQUIRE(result.value()->GetIds()[i] == expected.value()->GetIds()[i]);
+    }
+
+    std::promise<int64_t> callback_promise;
+    auto callback = [&callback_promise](tl::expected<vsag::DatasetPtr, vsag::Error> r) {
+        callback_promise.set_value(r.has_value() ? r.value()->GetIds()[0] : -1);
+    };
+    REQUIRE(index->SearchAsync(request, callback).has_value());
+    REQUIRE(callback_promise.get_future().get() == expected.value()->GetIds()[0]);
+    REQUIRE_FALSE(index->SearchAsync(request, nullptr).has_value());
+
+    auto cancelled_request = request;
+    cancelled_request.cancel_flag_ = std::make_shared<std::atomic<bool>>(true);
+    auto cancelled = index->SearchAsync(cancelled_request).get();
+    REQUIRE_FALSE(cancelled.has_value());
+    REQUIRE(cancelled.error().type == vsag::ErrorType::SEARCH_CANCELLED);
+
+    auto expired_request = request;
+    expired_request.deadline_ = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+    auto expired = index->SearchAsync(expired_request).get();
+    REQUIRE_FALSE(expired.has_value());
+    REQUIRE(expired.error().type == vsag::ErrorType::SEARCH_TIMEOUT);
+}
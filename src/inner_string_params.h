@@ -36,6 +36,9 @@ const char* const HGRAPH_BASE_CODES_KEY = "base_codes";
 const char* const HGRAPH_PRECISE_CODES_KEY = "precise_codes";
 const char* const HGRAPH_EXTRA_INFO_KEY = "extra_info";
 
+// the bytes of the in-memory cache in front of a non-memory flatten datacell, 0 disables it
+const char* const FLATTEN_CACHE_SIZE_KEY = "cache_size";
+
 // IO param key
 const char* const IO_PARAMS_KEY = "io_params";
 // IO type
@@ -45,10 +48,21 @@ const char* const IO_TYPE_VALUE_BUFFER_IO = "buffer_io";
 const char* const IO_TYPE_VALUE_MMAP_IO = "mmap_io";
 const char* const IO_TYPE_VALUE_READER_IO = "reader_io";
 const char* const IO_TYPE_VALUE_ASYNC_IO = "async_io";
+const char* const IO_TYPE_VALUE_IO_URING_IO = "io_uring_io";
 const char* const IO_TYPE_VALUE_BLOCK_MEMORY_IO = "block_memory_io";
 const char* const BLOCK_IO_BLOCK_SIZE_KEY = "block_size";
+const char* const BLOCK_IO_NUMA_POLICY_KEY = "numa_policy";
+const char* const BLOCK_IO_NUMA_POLICY_NONE = "none";
+const char* const BLOCK_IO_NUMA_POLICY_INTERLEAVE = "interleave";
+const char* const BLOCK_IO_NUMA_POLICY_PARTITION = "partition";
 const char* const IO_FILE_PATH = "file_path";
 const char* const DEFAULT_FILE_PATH_VALUE = "./default_file_path";
+const char* const IO_URING_QUEUE_DEPTH_KEY = "queue_depth";
+const char* const IO_URING_REGISTERED_BUFFER_SIZE_KEY = "registered_buffer_size";
+const char* const IO_URING_SQ_POLL_KEY = "sq_poll";
+const char* const IO_URING_SQ_THREAD_IDLE_KEY = "sq_thread_idle_ms";
+const char* const IO_URING_LINK_SEQUENTIAL_READS_KEY = "link_sequential_reads";
+const char* const IO_URING_TIMEOUT_KEY = "timeout_ms";
 
 // quantization params key
 const char* const QUANTIZATION_PARAMS_KEY = "quantization_params";
@@ -59,6 +73,7 @@ const char* const QUANTIZATION_TYPE_VALUE_SQ8_UNIFORM = "sq8_uniform";
 const char* const QUANTIZATION_TYPE_VALUE_SQ4 = "sq4";
 const char* const QUANTIZATION_TYPE_VALUE_SQ4_UNIFORM = "sq4_uniform";
 const char* const QUANTIZATION_TYPE_VALUE_FP32 = "fp32";
+const char* const QUANTIZATION_TYPE_VALUE_INT8 = "int8";
 const char* const QUANTIZATION_TYPE_VALUE_FP16 = "fp16";
 const char* const QUANTIZATION_TYPE_VALUE_BF16 = "bf16";
 const char* const QUANTIZATION_TYPE_VALUE_PQ = "pq";
@@ -94,20 +109,27 @@ const char* const SPARSE_TERM_PRUNE_RATIO = "term_prune_ratio";
 const char* const SPARSE_WINDOW_SIZE = "window_size";
 const char* const SPARSE_USE_REORDER = "use_reorder";
 const char* const SPARSE_N_CANDIDATE = "n_candidate";
+const char* const SPARSE_TERM_QUANTIZATION_TYPE = "term_quantization_type";
+const char* const SPARSE_USE_BLOCK_MAX = "use_block_max";
 
 // graph param value
 const char* const GRAPH_PARAM_MAX_DEGREE = "max_degree";
 const char* const GRAPH_PARAM_INIT_MAX_CAPACITY = "init_capacity";
+const char* const GRAPH_PARAM_SECTOR_SIZE = "sector_size";
+const char* const GRAPH_PARAM_CODE_SIZE = "code_size";
 
 const char* const BUILD_PARAMS_KEY = "build_params";
 const char* const BUILD_THREAD_COUNT = "build_thread_count";
 const char* const BUILD_EF_CONSTRUCTION = "ef_construction";
+const char* const BUILD_BATCH_SIZE = "build_batch_size";
+const char* const BUILD_CHECKPOINT_INTERVAL = "build_checkpoint_interval";
 
 const char* const GRAPH_TYPE_KEY = "graph_type";
 
 const char* const GRAPH_STORAGE_TYPE_KEY = "graph_storage_type";
 const char* const GRAPH_STORAGE_TYPE_COMPRESSED = "compressed";
 const char* const GRAPH_STORAGE_TYPE_FLAT = "flat";
+const char* const GRAPH_STORAGE_TYPE_COLOCATED = "colocated";
 
 const char* const BUCKET_PARAMS_KEY = "buckets_params";
 const char* const BUCKET_PER_DATA_KEY = "buckets_per_data";
@@ -118,6 +140,15 @@ const char* const BUCKET_USE_RESIDUAL = "use_residual";
 const char* const IVF_SEARCH_PARAM_SCAN_BUCKETS_COUNT = "scan_buckets_count";
 const char* const IVF_SEARCH_PARAM_FACTOR = "factor";
 const char* const IVF_SEARCH_PARALLELISM = "parallelism";
+const char* const HGRAPH_SEARCH_PARALLELISM = "parallelism";
+const char* const HGRAPH_SEARCH_EARLY_STOP_PATIENCE = "early_stop_patience";
+const char* const HGRAPH_SEARCH_EARLY_STOP_DISTANCE_RATIO = "early_stop_distance_ratio";
+const char* const HGRAPH_SEARCH_MAX_EF = "max_ef_search";
+const char* const HGRAPH_SEARCH_FILTER_PLAN = "filter_plan";
+const char* const FILTER_PLAN_AUTO = "auto";
+const char* const FILTER_PLAN_GRAPH = "graph";
+const char* const FILTER_PLAN_TWO_HOP = "two_hop";
+const char* const FILTER_PLAN_BRUTE_FORCE = "brute_force";
 const char* const SEARCH_MAX_TIME_COST_MS = "timeout_ms";
 
 const char* const IVF_USE_REORDER_KEY = "use_reorder";
@@ -144,6 +175,12 @@ const char* const GRAPH_SUPPORT_REMOVE = "support_remove";
 const char* const REMOVE_FLAG_BIT = "remove_flag_bit";
 const char* const HOLD_MOLDS = "hold_molds";
 const char* const SUPPORT_DUPLICATE = "support_duplicate";
+const char* const REMOVE_COMPACTION_RATIO_KEY = "remove_compaction_ratio";
+const char* const VISITED_LIST_TYPE_KEY = "visited_list_type";
+const char* const VISITED_LIST_TYPE_AUTO = "auto";
+const char* const VISITED_LIST_TYPE_DENSE = "dense";
+const char* const VISITED_LIST_TYPE_SPARSE = "sparse";
+const char* const VISITED_LIST_TYPE_HASH = "hash";
 
 const char* const DATACELL_OFFSETS = "datacell_offsets";
 const char* const DATACELL_SIZES = "datacell_sizes";
@@ -162,15 +199,18 @@ const std::unordered_map<std::string, std::string> DEFAULT_MAP = {
     {"HGRAPH_BASE_CODES_KEY", HGRAPH_BASE_CODES_KEY},
     {"HGRAPH_PRECISE_CODES_KEY", HGRAPH_PRECISE_CODES_KEY},
     {"HGRAPH_SUPPORT_DUPLICATE", HGRAPH_SUPPORT_DUPLICATE},
+    {"REMOVE_COMPACTION_RATIO_KEY", REMOVE_COMPACTION_RATIO_KEY},
     {"IO_TYPE_KEY", IO_TYPE_KEY},
     {"IO_TYPE_VALUE_MEMORY_IO", IO_TYPE_VALUE_MEMORY_IO},
     {"IO_TYPE_VALUE_BLOCK_MEMORY_IO", IO_TYPE_VALUE_BLOCK_MEMORY_IO},
     {"IO_TYPE_VALUE_BUFFER_IO", IO_TYPE_VALUE_BUFFER_IO},
     {"IO_PARAMS_KEY", IO_PARAMS_KEY},
+    {"FLATTEN_CACHE_SIZE_KEY", FLATTEN_CACHE_SIZE_KEY},
     {"BLOCK_IO_BLOCK_SIZE_KEY", BLOCK_IO_BLOCK_SIZE_KEY},
     {"QUANTIZATION_TYPE_KEY", QUANTIZATION_TYPE_KEY},
     {"QUANTIZATION_TYPE_VALUE_SQ8", QUANTIZATION_TYPE_VALUE_SQ8},
     {"QUANTIZATION_TYPE_VALUE_FP32", QUANTIZATION_TYPE_VALUE_FP32},
+    {"QUANTIZATION_TYPE_VALUE_INT8", QUANTIZATION_TYPE_VALUE_INT8},
     {"QUANTIZATION_TYPE_VALUE_PQ", QUANTIZATION_TYPE_VALUE_PQ},
     {"QUANTIZATION_TYPE_VALUE_PQFS", QUANTIZATION_TYPE_VALUE_PQFS},
     {"QUANTIZATION_TYPE_VALUE_FP16", QUANTIZATION_TYPE_VALUE_FP16},
@@ -182,12 +222,17 @@ const std::unordered_map<std::string, std::string> DEFAULT_MAP = {
     {"GRAPH_STORAGE_TYPE_KEY", GRAPH_STORAGE_TYPE_KEY},
     {"GRAPH_STORAGE_TYPE_FLAT", GRAPH_STORAGE_TYPE_FLAT},
     {"GRAPH_STORAGE_TYPE_COMPRESSED", GRAPH_STORAGE_TYPE_COMPRESSED},
+    {"GRAPH_STORAGE_TYPE_COLOCATED", GRAPH_STORAGE_TYPE_COLOCATED},
     {"QUANTIZATION_PARAMS_KEY", QUANTIZATION_PARAMS_KEY},
     {"GRAPH_PARAM_MAX_DEGREE", GRAPH_PARAM_MAX_DEGREE},
     {"GRAPH_PARAM_INIT_MAX_CAPACITY", GRAPH_PARAM_INIT_MAX_CAPACITY},
+    {"GRAPH_PARAM_SECTOR_SIZE", GRAPH_PARAM_SECTOR_SIZE},
+    {"GRAPH_PARAM_CODE_SIZE", GRAPH_PARAM_CODE_SIZE},
     {"BUILD_PARAMS_KEY", BUILD_PARAMS_KEY},
     {"BUILD_THREAD_COUNT", BUILD_THREAD_COUNT},
     {"BUILD_EF_CONSTRUCTION", BUILD_EF_CONSTRUCTION},
+    {"BUILD_BATCH_SIZE", BUILD_BATCH_SIZE},
+    {"BUILD_CHECKPOINT_INTERVAL", BUILD_CHECKPOINT_INTERVAL},
     {"BUCKETS_COUNT_KEY", BUCKETS_COUNT_KEY},
     {"BUCKET_PARAMS_KEY", BUCKET_PARAMS_KEY},
     {"IO_FILE_PATH", IO_FILE_PATH},
@@ -215,7 +260,14 @@ const std::unordered_map<std::string, std::string> DEFAULT_MAP = {
     {"IVF_TRAIN_TYPE_KMEANS", IVF_TRAIN_TYPE_KMEANS},
     {"IVF_THREAD_COUNT_KEY", IVF_THREAD_COUNT_KEY},
     {"IVF_SEARCH_PARALLELISM", IVF_SEARCH_PARALLELISM},
+    {"HGRAPH_SEARCH_PARALLELISM", HGRAPH_SEARCH_PARALLELISM},
+    {"HGRAPH_SEARCH_EARLY_STOP_PATIENCE", HGRAPH_SEARCH_EARLY_STOP_PATIENCE},
+    {"HGRAPH_SEARCH_EARLY_STOP_DISTANCE_RATIO", HGRAPH_SEARCH_EARLY_STOP_DISTANCE_RATIO},
+    {"HGRAPH_SEARCH_MAX_EF", HGRAPH_SEARCH_MAX_EF},
+    {"HGRAPH_SEARCH_FILTER_PLAN", HGRAPH_SEARCH_FILTER_PLAN},
     {"HGRAPH_STORE_RAW_VECTOR", HGRAPH_STORE_RAW_VECTOR},
+    {"VISITED_LIST_TYPE_KEY", VISITED_LIST_TYPE_KEY},
+    {"VISITED_LIST_TYPE_AUTO", VISITED_LIST_TYPE_AUTO},
     {"GRAPH_SUPPORT_REMOVE", GRAPH_SUPPORT_REMOVE},
     {"REMOVE_FLAG_BIT", REMOVE_FLAG_BIT},
     {"HOLD_MOLDS", HOLD_MOLDS},
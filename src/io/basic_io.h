@@ -18,15 +18,21 @@
 #include <fmt/format.h>
 
 #include <cstdint>
+#include <numeric>
 
 #include "byte_buffer.h"
 #include "io_parameter.h"
 #include "storage/stream_reader.h"
 #include "storage/stream_writer.h"
 #include "utils/function_exists_check.h"
+#include "utils/search_statistics.h"
+#include "vsag/options.h"
 
 namespace vsag {
 
+/// Handle of a batched read submitted by SubmitMultiRead, 0 means already complete.
+using IOReadTicket = uint64_t;
+
 /**
  * @brief A template class for basic input/output operations.
  *
@@ -86,6 +92,10 @@ public:
     inline bool
     Read(uint64_t size, uint64_t offset, uint8_t* data) const {
         static_assert(has_ReadImpl<IOTmpl>::value);
+        if constexpr (not InMemory) {
+            IOStatisticsGuard guard(size, 1);
+            return cast().ReadImpl(size, offset, data);
+        }
         return cast().ReadImpl(size, offset, data);
     }
 
@@ -103,6 +113,10 @@ public:
     [[nodiscard]] inline const uint8_t*
     Read(uint64_t size, uint64_t offset, bool& need_release) const {
         static_assert(has_DirectReadImpl<IOTmpl>::value);
+        if constexpr (not InMemory) {
+            IOStatisticsGuard guard(size, 1);
+            return cast().DirectReadImpl(size, offset, need_release);
+        }
         return cast().DirectReadImpl(size, offset, need_release);  // TODO(LHT129): use IOReadObject
     }
 
@@ -121,9 +135,60 @@ public:
     inline bool
     MultiRead(uint8_t* datas, uint64_t* sizes, uint64_t* offsets, uint64_t count) const {
         static_assert(has_MultiReadImpl<IOTmpl>::value);
+        if constexpr (not InMemory) {
+            IOStatisticsGuard guard(std::accumulate(sizes, sizes + count, uint64_t(0)), count);
+            return cast().MultiReadImpl(datas, sizes, offsets, count);
+        }
         return cast().MultiReadImpl(datas, sizes, offsets, count);
     }
 
+    /**
+     * @brief Submits multiple reads without waiting for them to complete.
+     *
+     * If the IO object has a SubmitMultiReadImpl method, it is called.
+     * Otherwise, the reads are done synchronously by MultiRead and 0 is returned.
+     * The buffers must stay valid until WaitMultiRead returns for the ticket.
+     *
+     * @param datas A pointer to the buffer where the read data will be stored contiguously.
+     * @param sizes An array of sizes for each block of data to be read.
+     * @param offsets An array of offsets for each block of data to be read.
+     * @param count The number of blocks of data to be read.
+     * @return A ticket to pass to WaitMultiRead.
+     */
+    inline IOReadTicket
+    SubmitMultiRead(uint8_t* datas, uint64_t* sizes, uint64_t* offsets, uint64_t count) const {
+        if constexpr (has_SubmitMultiReadImpl<IOTmpl>::value) {
+            IOStatisticsGuard guard(std::accumulate(sizes, sizes + count, uint64_t(0)), count);
+            return cast().SubmitMultiReadImpl(datas, sizes, offsets, count);
+        } else {
+            this->MultiRead(datas, sizes, offsets, count);
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Waits until the reads of a SubmitMultiRead ticket complete.
+     *
+     * @param ticket The ticket returned by SubmitMultiRead.
+     * @return True if the read operation was successful, false otherwise.
+     */
+    inline bool
+    WaitMultiRead(IOReadTicket ticket) const {
+        if constexpr (has_WaitMultiReadImpl<IOTmpl>::value) {
+            IOStatisticsGuard guard(0, 0);
+            return cast().WaitMultiReadImpl(ticket);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks if SubmitMultiRead returns before the reads complete.
+     */
+    static constexpr bool
+    SupportAsyncMultiRead() {
+        return has_SubmitMultiReadImpl<IOTmpl>::value and has_WaitMultiReadImpl<IOTmpl>::value;
+    }
+
     /**
      * @brief Prefetches data from the IO object at a specified offset.
      *
@@ -147,7 +212,20 @@ public:
      */
     inline void
     Serialize(StreamWriter& writer) {
-        StreamWriter::WriteObj(writer, this->size_);
+        auto align_bit = Options::Instance().serialize_align_bit();
+        if (align_bit == 0) {
+            StreamWriter::WriteObj(writer, this->size_);
+        } else {
+            // flag the size and record the padding, so readers need no cursor arithmetic
+            uint64_t flagged_size = this->size_ | ALIGNED_PAYLOAD_FLAG;
+            StreamWriter::WriteObj(writer, flagged_size);
+            uint64_t align_size = 1ULL << align_bit;
+            uint64_t payload_start = writer.GetCursor() + sizeof(uint64_t);
+            uint64_t padding = (align_size - payload_start % align_size) % align_size;
+            StreamWriter::WriteObj(writer, padding);
+            std::vector<char> zeros(padding, 0);
+            writer.Write(zeros.data(), padding);
+        }
         ByteBuffer buffer(SERIALIZE_BUFFER_SIZE, this->allocator_);
         uint64_t offset = 0;
         while (offset < this->size_) {
@@ -167,6 +245,27 @@ public:
     Deserialize(StreamReader& reader) {
         uint64_t size = 0;
         StreamReader::ReadObj(reader, size);
+        if ((size & ALIGNED_PAYLOAD_FLAG) != 0) {
+            size &= ~ALIGNED_PAYLOAD_FLAG;
+            uint64_t padding = 0;
+            StreamReader::ReadObj(reader, padding);
+            reader.Seek(reader.GetCursor() + padding);
+        }
+        if constexpr (has_AttachImpl<IOTmpl>::value) {
+            if (size > 0 and reader.SupportDirectData()) {
+                auto data = reader.DirectData(size);
+                // aliasing needs at least element alignment, otherwise copy out of the mapping
+                if (reinterpret_cast<uintptr_t>(data.get()) % MIN_ATTACH_ALIGNMENT == 0) {
+                    cast().AttachImpl(data, size);
+                    return;
+                }
+                for (uint64_t offset = 0; offset < size; offset += SERIALIZE_BUFFER_SIZE) {
+                    auto cur_size = std::min(SERIALIZE_BUFFER_SIZE, size - offset);
+                    this->Write(data.get() + offset, cur_size, offset);
+                }
+                return;
+            }
+        }
         ByteBuffer buffer(SERIALIZE_BUFFER_SIZE, this->allocator_);
         uint64_t offset = 0;
         this->start_ = reader.GetCursor();
@@ -271,6 +370,16 @@ private:
      */
     constexpr static uint64_t SERIALIZE_BUFFER_SIZE = 1024 * 1024 * 2;
 
+    /**
+     * @brief Marks a serialized size that is followed by a padding length and padding bytes.
+     */
+    constexpr static uint64_t ALIGNED_PAYLOAD_FLAG = 1ULL << 63;
+
+    /**
+     * @brief The minimum alignment of mapped data that AttachImpl may alias.
+     */
+    constexpr static uint64_t MIN_ATTACH_ALIGNMENT = 8;
+
 private:
     /**
      * @brief Generates a struct to check if a class has a member function with a specific signature.
@@ -297,11 +406,22 @@ private:
                                  std::declval<uint64_t*>(),
                                  std::declval<uint64_t*>(),
                                  std::declval<uint64_t>())
+    GENERATE_HAS_MEMBER_FUNCTION(SubmitMultiReadImpl,
+                                 IOReadTicket,
+                                 std::declval<uint8_t*>(),
+                                 std::declval<uint64_t*>(),
+                                 std::declval<uint64_t*>(),
+                                 std::declval<uint64_t>())
+    GENERATE_HAS_MEMBER_FUNCTION(WaitMultiReadImpl, bool, std::declval<IOReadTicket>())
     GENERATE_HAS_MEMBER_FUNCTION(PrefetchImpl,
                                  void,
                                  std::declval<uint64_t>(),
                                  std::declval<uint64_t>())
     GENERATE_HAS_MEMBER_FUNCTION(ReleaseImpl, void, std::declval<const uint8_t*>())
     GENERATE_HAS_MEMBER_FUNCTION(InitIOImpl, void, std::declval<const IOParamPtr&>())
+    GENERATE_HAS_MEMBER_FUNCTION(AttachImpl,
+                                 void,
+                                 std::declval<const std::shared_ptr<const uint8_t>&>(),
+                                 std::declval<uint64_t>())
 };
 }  // namespace vsag
@@ -23,6 +23,7 @@
 #include "basic_io.h"
 #include "fixtures.h"
 #include "storage/serialization_template_test.h"
+#include "vsag/options.h"
 
 using namespace vsag;
 
@@ -94,6 +95,55 @@ TestSerializeAndDeserialize(BasicIO<T>& wio, BasicIO<T>& rio) {
     }
 }
 
+template <typename T>
+void
+TestDeserializeWithMMap(BasicIO<T>& wio, BasicIO<T>& rio, uint64_t align_bit) {
+    fixtures::TempDir dirname("TestDeserializeWithMMap");
+    auto path = dirname.GenerateRandomFile();
+    auto vecs = fixtures::GenTestItems(300, 128);
+    for (auto& item : vecs) {
+        wio.Write(item.data_, item.length_, item.start_);
+    }
+    {
+        Options::Instance().set_serialize_align_bit(align_bit);
+        std::ofstream out(path, std::ios::binary);
+        IOStreamWriter writer(out);
+        // an odd-sized prefix makes the payload misaligned unless it is padded
+        StreamWriter::WriteObj(writer, static_cast<uint8_t>(1));
+        wio.Serialize(writer);
+        Options::Instance().set_serialize_align_bit(0);
+    }
+    {
+        MMapStreamReader reader(path);
+        uint8_t prefix = 0;
+        StreamReader::ReadObj(reader, prefix);
+        rio.Deserialize(reader);
+    }
+    auto check = [&]() {
+        for (auto& item : vecs) {
+            std::vector<uint8_t> data(item.length_);
+            rio.Read(item.length_, item.start_, data.data());
+            REQUIRE(memcmp(data.data(), item.data_, item.length_) == 0);
+            bool need_release = false;
+            const auto* ptr = rio.Read(item.length_, item.start_, need_release);
+            REQUIRE(memcmp(ptr, item.data_, item.length_) == 0);
+            if (need_release) {
+                rio.Release(ptr);
+            }
+        }
+    };
+    check();
+
+    // the first write copies the data out of the read-only mapping
+    auto extra = fixtures::GenTestItems(1, 64);
+    auto offset = rio.size_;
+    rio.Write(extra[0].data_, extra[0].length_, offset);
+    check();
+    std::vector<uint8_t> data(extra[0].length_);
+    rio.Read(extra[0].length_, offset, data.data());
+    REQUIRE(memcmp(data.data(), extra[0].data_, extra[0].length_) == 0);
+}
+
 template <typename T>
 void
 TestDistIOWrongInit(Allocator* allocator) {
@@ -18,6 +18,9 @@
 #include "async_io.h"
 #include "basic_io.h"
 #include "buffer_io.h"
+#if defined(ENABLE_LIBURING)
+#include "iouring_io.h"
+#endif
 #include "memory_block_io.h"
 #include "memory_io.h"
 #include "mmap_io.h"
@@ -18,6 +18,7 @@
 #include "async_io_parameter.h"
 #include "buffer_io_parameter.h"
 #include "inner_string_params.h"
+#include "iouring_io_parameter.h"
 #include "memory_block_io_parameter.h"
 #include "memory_io_parameter.h"
 #include "mmap_io_parameter.h"
@@ -42,6 +43,9 @@ IOParameter::GetIOParameterByJson(const JsonType& json) {
         } else if (type_name == IO_TYPE_VALUE_ASYNC_IO) {
             io_ptr = std::make_shared<AsyncIOParameter>();
             io_ptr->FromJson(json);
+        } else if (type_name == IO_TYPE_VALUE_IO_URING_IO) {
+            io_ptr = std::make_shared<IOUringIOParameter>();
+            io_ptr->FromJson(json);
         } else if (type_name == IO_TYPE_VALUE_MMAP_IO) {
             io_ptr = std::make_shared<MMapIOParameter>();
             io_ptr->FromJson(json);
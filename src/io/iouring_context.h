@@ -0,0 +1,94 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+
+#pragma once
+
+#include <fmt/format.h>
+#include <liburing.h>
+#include <sys/uio.h>
+
+#include <cstring>
+
+#include "utils/resource_object.h"
+#include "utils/resource_object_pool.h"
+#include "vsag_exception.h"
+
+namespace vsag {
+/**
+ * @brief One io_uring instance bound to a single registered file.
+ *
+ * The file is registered at fixed index 0 so reads skip the per-request fd lookup, and an
+ * aligned buffer region is registered for read_fixed. If registering the buffer fails
+ * (e.g. RLIMIT_MEMLOCK), reads fall back to per-request heap buffers.
+ */
+class IOUringContext : public ResourceObject {
+public:
+    IOUringContext(int fd,
+                   uint32_t queue_depth,
+                   uint64_t registered_buffer_size,
+                   bool sq_poll,
+                   uint32_t sq_thread_idle_ms,
+                   uint64_t align_size)
+        : queue_depth_(queue_depth) {
+        struct io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        if (sq_poll) {
+            params.flags |= IORING_SETUP_SQPOLL;
+            params.sq_thread_idle = sq_thread_idle_ms;
+        }
+        auto ret = io_uring_queue_init_params(queue_depth, &ring_, &params);
+        if (ret < 0) {
+            throw VsagException(ErrorType::INTERNAL_ERROR,
+                                fmt::format("io_uring init error {}", strerror(-ret)));
+        }
+        ret = io_uring_register_files(&ring_, &fd, 1);
+        if (ret < 0) {
+            io_uring_queue_exit(&ring_);
+            throw VsagException(ErrorType::INTERNAL_ERROR,
+                                fmt::format("io_uring register file error {}", strerror(-ret)));
+        }
+        if (registered_buffer_size > 0) {
+            auto size = (registered_buffer_size + align_size - 1) / align_size * align_size;
+            buffer_ = static_cast<uint8_t*>(std::aligned_alloc(align_size, size));
+            struct iovec iov = {buffer_, size};
+            if (buffer_ != nullptr and io_uring_register_buffers(&ring_, &iov, 1) == 0) {
+                buffer_size_ = size;
+            } else {
+                free(buffer_);
+                buffer_ = nullptr;
+            }
+        }
+    }
+
+    ~IOUringContext() override {
+        io_uring_queue_exit(&ring_);
+        free(buffer_);
+    }
+
+    void
+    Reset() override{};
+
+public:
+    struct io_uring ring_;
+
+    uint32_t queue_depth_{0};
+
+    uint8_t* buffer_{nullptr};
+
+    uint64_t buffer_size_{0};
+};
+
+using IOUringContextPool = ResourceObjectPool<IOUringContext>;
+
+}  // namespace vsag
@@ -0,0 +1,428 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+
+#include "iouring_io.h"
+
+#include <chrono>
+#include <filesystem>
+#include <limits>
+
+#include "direct_io_object.h"
+#include "vsag/options.h"
+
+namespace vsag {
+
+// user_data of cancel requests, distinct from the request indexes and LIBURING_UDATA_TIMEOUT
+static constexpr uint64_t CANCEL_USER_DATA = std::numeric_limits<uint64_t>::max() - 1;
+
+struct IOUringPendingRead {
+    struct Request {
+        uint8_t* dest{nullptr};
+        uint64_t size{0};
+        uint8_t* buffer{nullptr};
+        uint64_t aligned_offset{0};
+        uint64_t aligned_size{0};
+        uint64_t inner_offset{0};
+        bool fixed_buffer{false};
+        bool done{false};
+    };
+
+    std::shared_ptr<IOUringContext> context{nullptr};
+
+    std::vector<Request> requests;
+
+    uint64_t submitted{0};
+
+    uint64_t completed{0};
+
+    uint64_t inflight{0};
+
+    uint64_t buffer_cursor{0};
+
+    bool failed{false};
+
+    std::chrono::steady_clock::time_point deadline;
+};
+
+IOUringIO::IOUringIO(std::string filename, const IOUringIOParameter& param, Allocator* allocator)
+    : BasicIO<IOUringIO>(allocator),
+      filepath_(std::move(filename)),
+      param_(param),
+      pending_reads_(allocator) {
+    this->exist_file_ = std::filesystem::exists(this->filepath_);
+    if (std::filesystem::is_directory(this->filepath_)) {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            fmt::format("{} is a directory", this->filepath_));
+    }
+    this->rfd_ = open(filepath_.c_str(), O_CREAT | O_RDWR | O_DIRECT, 0644);
+    if (this->rfd_ < 0) {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            fmt::format("open file {} error {}", this->filepath_, strerror(errno)));
+    }
+    this->wfd_ = open(filepath_.c_str(), O_CREAT | O_RDWR, 0644);
+    if (this->wfd_ < 0) {
+        close(this->rfd_);
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            fmt::format("open file {} error {}", this->filepath_, strerror(errno)));
+    }
+    uint64_t align_size = 1ULL << Options::Instance().direct_IO_object_align_bit();
+    try {
+        this->context_pool_ = std::make_unique<IOUringContextPool>(1,
+                                                                   allocator,
+                                                                   this->rfd_,
+                                                                   param_.queue_depth_,
+                                                                   param_.registered_buffer_size_,
+                                                                   param_.sq_poll_,
+                                                                   param_.sq_thread_idle_ms_,
+                                                                   align_size);
+    } catch (...) {
+        close(this->wfd_);
+        close(this->rfd_);
+        throw;
+    }
+}
+
+IOUringIO::IOUringIO(std::string filename, Allocator* allocator)
+    : IOUringIO(std::move(filename), IOUringIOParameter(), allocator) {
+}
+
+IOUringIO::IOUringIO(const IOUringIOParameterPtr& io_param, const IndexCommonParam& common_param)
+    : IOUringIO(io_param->path_, *io_param, common_param.allocator_.get()){};
+
+IOUringIO::IOUringIO(const IOParamPtr& param, const IndexCommonParam& common_param)
+    : IOUringIO(std::dynamic_pointer_cast<IOUringIOParameter>(param), common_param){};
+
+IOUringIO::~IOUringIO() {
+    for (const auto& item : this->pending_reads_) {
+        this->cancel_pending(*item.second);
+        this->finish_pending(*item.second);
+    }
+    this->context_pool_.reset();
+    close(this->wfd_);
+    close(this->rfd_);
+    // remove file
+    if (not this->exist_file_) {
+        std::filesystem::remove(this->filepath_);
+    }
+}
+
+void
+IOUringIO::WriteImpl(const uint8_t* data, uint64_t size, uint64_t offset) {
+    auto ret = pwrite64(this->wfd_, data, size, static_cast<int64_t>(offset));
+    if (ret != size) {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            fmt::format("write bytes {} less than {}", ret, size));
+    }
+    if (size + offset > this->size_) {
+        this->size_ = size + offset;
+    }
+    fsync(wfd_);
+}
+
+bool
+IOUringIO::ReadImpl(uint64_t size, uint64_t offset, uint8_t* data) const {
+    return this->MultiReadImpl(data, &size, &offset, 1);
+}
+
+const uint8_t*
+IOUringIO::DirectReadImpl(uint64_t size, uint64_t offset, bool& need_release) const {
+    need_release = true;
+    if (size == 0) {
+        return nullptr;
+    }
+    DirectIOObject obj(size, offset);
+    auto ret = pread64(this->rfd_, obj.align_data, obj.size, static_cast<int64_t>(obj.offset));
+    if (ret < 0) {
+        obj.Release();
+        throw VsagException(ErrorType::INTERNAL_ERROR, fmt::format("pread64 error {}", ret));
+    }
+    return obj.data;
+}
+
+void
+IOUringIO::ReleaseImpl(const uint8_t* data) {
+    auto* ptr = const_cast<uint8_t*>(data);
+    uint64_t align_bit = Options::Instance().direct_IO_object_align_bit();
+    auto raw = reinterpret_cast<uintptr_t>(ptr);
+    raw &= ~((1ULL << align_bit) - 1);
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    free(reinterpret_cast<void*>(raw));
+}
+
+bool
+IOUringIO::MultiReadImpl(uint8_t* datas, uint64_t* sizes, uint64_t* offsets, uint64_t count) const {
+    return this->WaitMultiReadImpl(this->SubmitMultiReadImpl(datas, sizes, offsets, count));
+}
+
+IOReadTicket
+IOUringIO::SubmitMultiReadImpl(uint8_t* datas,
+                               uint64_t* sizes,
+                               uint64_t* offsets,
+                               uint64_t count) const {
+    if (count == 0) {
+        return 0;
+    }
+    auto pending = std::make_shared<IOUringPendingRead>();
+    pending->context = this->context_pool_->TakeOne();
+    pending->deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(param_.timeout_ms_);
+    pending->requests.resize(count);
+
+    uint64_t align_bit = Options::Instance().direct_IO_object_align_bit();
+    uint64_t align_mask = (1ULL << align_bit) - 1;
+    uint8_t* cur_data = datas;
+    for (uint64_t i = 0; i < count; ++i) {
+        auto& request = pending->requests[i];
+        request.dest = cur_data;
+        request.size = sizes[i];
+        request.inner_offset = offsets[i] & align_mask;
+        request.aligned_offset = offsets[i] - request.inner_offset;
+        request.aligned_size = (request.inner_offset + sizes[i] + align_mask) & ~align_mask;
+        cur_data += sizes[i];
+        if (request.size == 0) {
+            request.done = true;
+            ++pending->completed;
+        }
+    }
+
+    try {
+        this->submit_pending(*pending);
+    } catch (...) {
+        this->cancel_pending(*pending);
+        this->finish_pending(*pending);
+        throw;
+    }
+    auto ticket = next_ticket_.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(this->pending_mutex_);
+    this->pending_reads_.emplace(ticket, std::move(pending));
+    return ticket;
+}
+
+bool
+IOUringIO::WaitMultiReadImpl(IOReadTicket ticket) const {
+    if (ticket == 0) {
+        return true;
+    }
+    std::shared_ptr<IOUringPendingRead> pending = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(this->pending_mutex_);
+        auto iter = this->pending_reads_.find(ticket);
+        if (iter == this->pending_reads_.end()) {
+            throw VsagException(ErrorType::INVALID_ARGUMENT,
+                                fmt::format("unknown io_uring read ticket {}", ticket));
+        }
+        pending = iter->second;
+        this->pending_reads_.erase(iter);
+    }
+
+    auto& ring = pending->context->ring_;
+    auto total = pending->requests.size();
+    while (pending->completed < total) {
+        if (pending->submitted < total) {
+            try {
+                this->submit_pending(*pending);
+            } catch (...) {
+                this->cancel_pending(*pending);
+                this->finish_pending(*pending);
+                throw;
+            }
+        }
+        struct io_uring_cqe* cqe = nullptr;
+        int ret = 0;
+        if (param_.timeout_ms_ == 0) {
+            ret = io_uring_wait_cqe(&ring, &cqe);
+        } else {
+            auto remain = pending->deadline - std::chrono::steady_clock::now();
+            auto remain_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remain).count();
+            if (remain_ns <= 0) {
+                ret = -ETIME;
+            } else {
+                struct __kernel_timespec ts;
+                ts.tv_sec = remain_ns / 1000000000;
+                ts.tv_nsec = remain_ns % 1000000000;
+                ret = io_uring_wait_cqe_timeout(&ring, &cqe, &ts);
+            }
+        }
+        if (ret == -EINTR) {
+            continue;
+        }
+        if (ret < 0) {
+            this->cancel_pending(*pending);
+            this->finish_pending(*pending);
+            if (ret == -ETIME) {
+                throw VsagException(
+                    ErrorType::INTERNAL_ERROR,
+                    fmt::format("io_uring read exceeds deadline {} ms", param_.timeout_ms_));
+            }
+            throw VsagException(ErrorType::INTERNAL_ERROR,
+                                fmt::format("io_uring wait error {}", strerror(-ret)));
+        }
+
+        // reap every ready completion in one pass
+        unsigned head = 0;
+        unsigned reaped = 0;
+        io_uring_for_each_cqe(&ring, head, cqe) {
+            ++reaped;
+            auto index = io_uring_cqe_get_data64(cqe);
+            if (index == CANCEL_USER_DATA) {
+                continue;
+            }
+            auto& request = pending->requests[index];
+            request.done = true;
+            --pending->inflight;
+            ++pending->completed;
+            if (cqe->res < 0 or
+                static_cast<uint64_t>(cqe->res) < request.inner_offset + request.size) {
+                pending->failed = true;
+            } else {
+                memcpy(request.dest, request.buffer + request.inner_offset, request.size);
+            }
+        }
+        io_uring_cq_advance(&ring, reaped);
+    }
+
+    bool failed = pending->failed;
+    this->finish_pending(*pending);
+    if (failed) {
+        throw VsagException(ErrorType::INTERNAL_ERROR, "io_uring read failed");
+    }
+    return true;
+}
+
+void
+IOUringIO::submit_pending(IOUringPendingRead& pending) const {
+    auto& context = *pending.context;
+    auto total = pending.requests.size();
+    uint64_t prepared = 0;
+    while (pending.submitted < total and pending.inflight + prepared < context.queue_depth_) {
+        auto index = pending.submitted;
+        auto& request = pending.requests[index];
+        if (request.done) {
+            ++pending.submitted;
+            continue;
+        }
+        request.fixed_buffer =
+            pending.buffer_cursor + request.aligned_size <= context.buffer_size_;
+        if (not request.fixed_buffer and request.buffer == nullptr) {
+            auto align_size = 1ULL << Options::Instance().direct_IO_object_align_bit();
+            request.buffer =
+                static_cast<uint8_t*>(std::aligned_alloc(align_size, request.aligned_size));
+            if (request.buffer == nullptr) {
+                throw VsagException(ErrorType::NO_ENOUGH_MEMORY,
+                                    "failed to alloc io_uring read buffer");
+            }
+        }
+        auto* sqe = io_uring_get_sqe(&context.ring_);
+        if (sqe == nullptr) {
+            break;
+        }
+        if (request.fixed_buffer) {
+            request.buffer = context.buffer_ + pending.buffer_cursor;
+            pending.buffer_cursor += request.aligned_size;
+            io_uring_prep_read_fixed(
+                sqe, 0, request.buffer, request.aligned_size, request.aligned_offset, 0);
+        } else {
+            io_uring_prep_read(
+                sqe, 0, request.buffer, request.aligned_size, request.aligned_offset);
+        }
+        unsigned flags = IOSQE_FIXED_FILE;
+        // a short read breaks the chain, so only link ranges that lie inside the written file
+        bool last_of_wave =
+            index + 1 == total or pending.inflight + prepared + 1 == context.queue_depth_;
+        if (param_.link_sequential_reads_ and not last_of_wave) {
+            const auto& next = pending.requests[index + 1];
+            auto end = request.aligned_offset + request.aligned_size;
+            if (not next.done and next.aligned_offset == end and end <= this->size_) {
+                flags |= IOSQE_IO_LINK;
+            }
+        }
+        io_uring_sqe_set_flags(sqe, flags);
+        io_uring_sqe_set_data64(sqe, index);
+        ++prepared;
+        ++pending.submitted;
+    }
+    if (prepared == 0) {
+        return;
+    }
+    auto ret = io_uring_submit(&context.ring_);
+    // prepared entries stay in the submission queue on failure and are flushed by the
+    // next submit, so they are tracked as in flight either way
+    pending.inflight += prepared;
+    if (ret < 0) {
+        throw VsagException(ErrorType::INTERNAL_ERROR,
+                            fmt::format("io_uring submit error {}", strerror(-ret)));
+    }
+}
+
+void
+IOUringIO::cancel_pending(IOUringPendingRead& pending) const {
+    auto& ring = pending.context->ring_;
+    uint64_t cancels = 0;
+    for (uint64_t i = 0; i < pending.submitted and cancels < pending.inflight; ++i) {
+        if (pending.requests[i].done or pending.requests[i].buffer == nullptr) {
+            continue;
+        }
+        auto* sqe = io_uring_get_sqe(&ring);
+        if (sqe == nullptr) {
+            io_uring_submit(&ring);
+            sqe = io_uring_get_sqe(&ring);
+            if (sqe == nullptr) {
+                break;
+            }
+        }
+        io_uring_prep_cancel64(sqe, i, 0);
+        io_uring_sqe_set_data64(sqe, CANCEL_USER_DATA);
+        ++cancels;
+    }
+    if (cancels > 0) {
+        io_uring_submit(&ring);
+    }
+    // the kernel may still write into the buffers until every read is reaped
+    while (pending.inflight > 0 or cancels > 0) {
+        struct io_uring_cqe* cqe = nullptr;
+        auto ret = io_uring_wait_cqe(&ring, &cqe);
+        if (ret == -EINTR) {
+            continue;
+        }
+        if (ret < 0) {
+            break;
+        }
+        auto index = io_uring_cqe_get_data64(cqe);
+        if (index == CANCEL_USER_DATA) {
+            --cancels;
+        } else {
+            pending.requests[index].done = true;
+            --pending.inflight;
+            ++pending.completed;
+        }
+        io_uring_cqe_seen(&ring, cqe);
+    }
+    pending.failed = true;
+}
+
+void
+IOUringIO::finish_pending(IOUringPendingRead& pending) const {
+    for (auto& request : pending.requests) {
+        if (request.buffer != nullptr and not request.fixed_buffer) {
+            free(request.buffer);
+        }
+        request.buffer = nullptr;
+    }
+    if (pending.context != nullptr) {
+        this->context_pool_->ReturnOne(pending.context);
+        pending.context = nullptr;
+    }
+}
+
+}  // namespace vsag
@@ -0,0 +1,102 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "basic_io.h"
+#include "index/index_common_param.h"
+#include "iouring_context.h"
+#include "iouring_io_parameter.h"
+
+namespace vsag {
+
+struct IOUringPendingRead;
+
+/**
+ * @brief File IO backed by io_uring, only compiled with ENABLE_LIBURING.
+ *
+ * Batched reads go through SubmitMultiRead/WaitMultiRead so the caller can score one batch
+ * while the next is in flight. Each wait is bounded by the configured deadline; reads still
+ * in flight at the deadline are cancelled and the wait throws.
+ */
+class IOUringIO : public BasicIO<IOUringIO> {
+public:
+    static constexpr bool InMemory = false;
+
+public:
+    explicit IOUringIO(std::string filename, Allocator* allocator);
+
+    explicit IOUringIO(const IOUringIOParameterPtr& io_param, const IndexCommonParam& common_param);
+
+    explicit IOUringIO(const IOParamPtr& param, const IndexCommonParam& common_param);
+
+    ~IOUringIO() override;
+
+public:
+    void
+    WriteImpl(const uint8_t* data, uint64_t size, uint64_t offset);
+
+    bool
+    ReadImpl(uint64_t size, uint64_t offset, uint8_t* data) const;
+
+    [[nodiscard]] const uint8_t*
+    DirectReadImpl(uint64_t size, uint64_t offset, bool& need_release) const;
+
+    static void
+    ReleaseImpl(const uint8_t* data);
+
+    bool
+    MultiReadImpl(uint8_t* datas, uint64_t* sizes, uint64_t* offsets, uint64_t count) const;
+
+    IOReadTicket
+    SubmitMultiReadImpl(uint8_t* datas, uint64_t* sizes, uint64_t* offsets, uint64_t count) const;
+
+    bool
+    WaitMultiReadImpl(IOReadTicket ticket) const;
+
+private:
+    IOUringIO(std::string filename, const IOUringIOParameter& param, Allocator* allocator);
+
+    void
+    submit_pending(IOUringPendingRead& pending) const;
+
+    void
+    cancel_pending(IOUringPendingRead& pending) const;
+
+    void
+    finish_pending(IOUringPendingRead& pending) const;
+
+private:
+    std::string filepath_{};
+
+    int rfd_{-1};
+
+    int wfd_{-1};
+
+    bool exist_file_{false};
+
+    IOUringIOParameter param_{};
+
+    std::unique_ptr<IOUringContextPool> context_pool_{nullptr};
+
+    mutable std::mutex pending_mutex_;
+
+    mutable UnorderedMap<IOReadTicket, std::shared_ptr<IOUringPendingRead>> pending_reads_;
+
+    mutable std::atomic<IOReadTicket> next_ticket_{1};
+};
+}  // namespace vsag
@@ -0,0 +1,71 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+
+#include "iouring_io_parameter.h"
+
+#include <fmt/format.h>
+
+#include "inner_string_params.h"
+
+namespace vsag {
+
+IOUringIOParameter::IOUringIOParameter() : IOParameter(IO_TYPE_VALUE_IO_URING_IO) {
+}
+
+IOUringIOParameter::IOUringIOParameter(const vsag::JsonType& json)
+    : IOParameter(IO_TYPE_VALUE_IO_URING_IO) {
+    this->FromJson(json);  // NOLINT(clang-analyzer-optin.cplusplus.VirtualCall)
+}
+
+void
+IOUringIOParameter::FromJson(const JsonType& json) {
+    CHECK_ARGUMENT(json.contains(IO_FILE_PATH), "miss file_path param in io_uring io type");
+    this->path_ = json[IO_FILE_PATH];
+    if (json.contains(IO_URING_QUEUE_DEPTH_KEY)) {
+        this->queue_depth_ = json[IO_URING_QUEUE_DEPTH_KEY];
+        CHECK_ARGUMENT(this->queue_depth_ >= 1 and this->queue_depth_ <= 4096,
+                       fmt::format("queue_depth({}) must be in range [1, 4096]",
+                                   this->queue_depth_));
+    }
+    if (json.contains(IO_URING_REGISTERED_BUFFER_SIZE_KEY)) {
+        this->registered_buffer_size_ = json[IO_URING_REGISTERED_BUFFER_SIZE_KEY];
+    }
+    if (json.contains(IO_URING_SQ_POLL_KEY)) {
+        this->sq_poll_ = json[IO_URING_SQ_POLL_KEY];
+    }
+    if (json.contains(IO_URING_SQ_THREAD_IDLE_KEY)) {
+        this->sq_thread_idle_ms_ = json[IO_URING_SQ_THREAD_IDLE_KEY];
+    }
+    if (json.contains(IO_URING_LINK_SEQUENTIAL_READS_KEY)) {
+        this->link_sequential_reads_ = json[IO_URING_LINK_SEQUENTIAL_READS_KEY];
+    }
+    if (json.contains(IO_URING_TIMEOUT_KEY)) {
+        this->timeout_ms_ = json[IO_URING_TIMEOUT_KEY];
+    }
+}
+
+JsonType
+IOUringIOParameter::ToJson() const {
+    JsonType json;
+    json[IO_TYPE_KEY] = IO_TYPE_VALUE_IO_URING_IO;
+    json[IO_FILE_PATH] = this->path_;
+    json[IO_URING_QUEUE_DEPTH_KEY] = this->queue_depth_;
+    json[IO_URING_REGISTERED_BUFFER_SIZE_KEY] = this->registered_buffer_size_;
+    json[IO_URING_SQ_POLL_KEY] = this->sq_poll_;
+    json[IO_URING_SQ_THREAD_IDLE_KEY] = this->sq_thread_idle_ms_;
+    json[IO_URING_LINK_SEQUENTIAL_READS_KEY] = this->link_sequential_reads_;
+    json[IO_URING_TIMEOUT_KEY] = this->timeout_ms_;
+    return json;
+}
+}  // namespace vsag
@@ -0,0 +1,55 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+
+#pragma once
+
+#include "io_parameter.h"
+
+namespace vsag {
+class IOUringIOParameter : public IOParameter {
+public:
+    IOUringIOParameter();
+
+    explicit IOUringIOParameter(const JsonType& json);
+
+    void
+    FromJson(const JsonType& json) override;
+
+    JsonType
+    ToJson() const override;
+
+public:
+    std::string path_{};
+
+    // entries of each submission queue, reads beyond this are submitted in waves
+    uint32_t queue_depth_{128};
+
+    // bytes registered per ring for read_fixed, 0 disables registered buffers
+    uint64_t registered_buffer_size_{1024 * 1024};
+
+    // let a kernel thread poll the submission queue instead of calling io_uring_enter
+    bool sq_poll_{false};
+
+    uint32_t sq_thread_idle_ms_{100};
+
+    // chain reads of adjacent ranges with IOSQE_IO_LINK
+    bool link_sequential_reads_{false};
+
+    // deadline of one batched read, 0 means wait forever
+    uint64_t timeout_ms_{1000};
+};
+
+using IOUringIOParameterPtr = std::shared_ptr<IOUringIOParameter>;
+
+}  // namespace vsag
@@ -0,0 +1,50 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+
+#include "iouring_io_parameter.h"
+
+#include <fmt/format.h>
+
+#include "fixtures.h"
+#include "parameter_test.h"
+
+using namespace vsag;
+
+TEST_CASE("IOUringIO Parameters Test", "[ut][IOUringIOParameters]") {
+    fixtures::TempDir dir("iouring_io");
+    auto path = dir.GenerateRandomFile();
+    constexpr const char* param_str = R"(
+        {{
+            "type": "io_uring_io",
+            "file_path": "{}",
+            "queue_depth": 64,
+            "registered_buffer_size": 65536,
+            "sq_poll": true,
+            "sq_thread_idle_ms": 50,
+            "link_sequential_reads": true,
+            "timeout_ms": 200
+        }}
+    )";
+    auto param_json = JsonType::parse(fmt::format(param_str, path));
+    auto param = std::make_shared<IOUringIOParameter>();
+    param->FromJson(param_json);
+    REQUIRE(param->queue_depth_ == 64);
+    REQUIRE(param->sq_poll_);
+    REQUIRE(param->timeout_ms_ == 200);
+    ParameterTest::TestToJson(param);
+
+    auto wrong_json =
+        JsonType::parse(fmt::format(R"({{"file_path": "{}", "queue_depth": 0}})", path));
+    REQUIRE_THROWS(param->FromJson(wrong_json));
+}
@@ -0,0 +1,114 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+
+#if defined(ENABLE_LIBURING)
+
+#include "iouring_io.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+#include "basic_io_test.h"
+#include "impl/allocator/safe_allocator.h"
+
+using namespace vsag;
+
+TEST_CASE("IOUringIO Read And Write", "[ut][IOUringIO]") {
+    fixtures::TempDir dir("iouring_io");
+    auto path = dir.GenerateRandomFile();
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    TestDistIOWrongInit<IOUringIO>(allocator.get());
+    auto io = std::make_unique<IOUringIO>(path, allocator.get());
+    TestBasicReadWrite(*io);
+
+    // read zero
+    bool need_release = false;
+    auto result = io->DirectReadImpl(0, 0, need_release);
+    REQUIRE(result == nullptr);
+
+    // in memory
+    REQUIRE(IOUringIO::InMemory == false);
+    REQUIRE(IOUringIO::SupportAsyncMultiRead());
+}
+
+TEST_CASE("IOUringIO Parameter", "[ut][IOUringIO]") {
+    fixtures::TempDir dir("iouring_io");
+    auto path = dir.GenerateRandomFile();
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    // a small queue and registered buffer force waves and heap buffer fallback
+    constexpr const char* param_str = R"(
+    {{
+        "type": "io_uring_io",
+        "file_path" : "{}",
+        "queue_depth": 16,
+        "registered_buffer_size": 4096,
+        "link_sequential_reads": true,
+        "timeout_ms": 10000
+    }}
+    )";
+    auto json = JsonType::parse(fmt::format(param_str, path));
+    auto io_param = IOParameter::GetIOParameterByJson(json);
+    IndexCommonParam common_param;
+    common_param.allocator_ = allocator;
+    auto io = std::make_unique<IOUringIO>(io_param, common_param);
+    TestBasicReadWrite(*io);
+}
+
+TEST_CASE("IOUringIO Submit And Wait", "[ut][IOUringIO]") {
+    fixtures::TempDir dir("iouring_io");
+    auto path = dir.GenerateRandomFile();
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    auto io = std::make_unique<IOUringIO>(path, allocator.get());
+    constexpr uint64_t count = 300;
+    constexpr uint64_t length = 37;
+    std::vector<uint8_t> data(count * length);
+    for (uint64_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    io->Write(data.data(), data.size(), 0);
+
+    // two batches in flight at once, waited in reverse order
+    std::vector<uint64_t> sizes(count, length);
+    std::vector<uint64_t> offsets(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        offsets[i] = (count - 1 - i) * length;
+    }
+    std::vector<uint8_t> first(count / 2 * length);
+    std::vector<uint8_t> second(count / 2 * length);
+    auto ticket1 = io->SubmitMultiRead(first.data(), sizes.data(), offsets.data(), count / 2);
+    auto ticket2 = io->SubmitMultiRead(
+        second.data(), sizes.data() + count / 2, offsets.data() + count / 2, count / 2);
+    REQUIRE(io->WaitMultiRead(ticket2));
+    REQUIRE(io->WaitMultiRead(ticket1));
+    for (uint64_t i = 0; i < count / 2; ++i) {
+        REQUIRE(memcmp(first.data() + i * length, data.data() + offsets[i], length) == 0);
+        REQUIRE(memcmp(second.data() + i * length,
+                       data.data() + offsets[i + count / 2],
+                       length) == 0);
+    }
+    REQUIRE(io->WaitMultiRead(io->SubmitMultiRead(nullptr, nullptr, nullptr, 0)));
+    REQUIRE_THROWS(io->WaitMultiRead(ticket1));
+}
+
+TEST_CASE("IOUringIO Serialize & Deserialize", "[ut][IOUringIO]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    fixtures::TempDir dir("iouring_io");
+    auto path1 = dir.GenerateRandomFile();
+    auto path2 = dir.GenerateRandomFile();
+    auto wio = std::make_unique<IOUringIO>(path1, allocator.get());
+    auto rio = std::make_unique<IOUringIO>(path2, allocator.get());
+    TestSerializeAndDeserialize(*wio, *rio);
+}
+
+#endif
@@ -22,6 +22,7 @@
 #include "index/index_common_param.h"
 #include "inner_string_params.h"
 #include "prefetch.h"
+#include "utils/numa.h"
 
 namespace vsag {
 
@@ -35,6 +36,7 @@ MemoryBlockIO::MemoryBlockIO(Allocator* allocator, uint64_t block_size)
 MemoryBlockIO::MemoryBlockIO(const MemoryBlockIOParamPtr& param,
                              const IndexCommonParam& common_param)
     : MemoryBlockIO(common_param.allocator_.get(), param->block_size_) {
+    this->numa_policy_ = param->numa_policy_;
 }
 
 MemoryBlockIO::MemoryBlockIO(const IOParamPtr& param, const IndexCommonParam& common_param)
@@ -42,6 +44,9 @@ MemoryBlockIO::MemoryBlockIO(const IOParamPtr& param, const IndexCommonParam& co
 }
 
 MemoryBlockIO::~MemoryBlockIO() {
+    if (attached_ != nullptr) {
+        return;
+    }
     for (auto* block : blocks_) {
         this->allocator_->Deallocate(block);
     }
@@ -49,6 +54,9 @@ MemoryBlockIO::~MemoryBlockIO() {
 
 void
 MemoryBlockIO::WriteImpl(const uint8_t* data, uint64_t size, uint64_t offset) {
+    if (attached_ != nullptr) {
+        this->detach();
+    }
     check_and_realloc(size + offset);
     uint64_t cur_size = 0;
     auto start_no = offset >> block_bit_;
@@ -120,6 +128,35 @@ MemoryBlockIO::PrefetchImpl(uint64_t offset, uint64_t cache_line) {
     PrefetchLines(get_data_ptr(offset), cache_line);
 }
 
+void
+MemoryBlockIO::AttachImpl(const std::shared_ptr<const uint8_t>& data, uint64_t size) {
+    if (attached_ == nullptr) {
+        for (auto* block : blocks_) {
+            this->allocator_->Deallocate(block);
+        }
+    }
+    // the attached data is contiguous, so block i simply starts at i * block_size_
+    const uint64_t block_count = (size + this->block_size_ - 1) >> block_bit_;
+    this->blocks_.resize(block_count);
+    auto* start = const_cast<uint8_t*>(data.get());
+    for (uint64_t i = 0; i < block_count; ++i) {
+        this->blocks_[i] = start + (i << block_bit_);
+    }
+    this->attached_ = data;
+    this->size_ = size;
+}
+
+void
+MemoryBlockIO::detach() {
+    for (uint64_t i = 0; i < blocks_.size(); ++i) {
+        auto* block = this->allocate_block(i);
+        auto offset = i << block_bit_;
+        memcpy(block, blocks_[i], std::min(block_size_, this->size_ - offset));
+        blocks_[i] = block;
+    }
+    attached_.reset();
+}
+
 void
 MemoryBlockIO::check_and_realloc(uint64_t size) {
     if (size <= (blocks_.size() << block_bit_)) {
@@ -129,11 +166,23 @@ MemoryBlockIO::check_and_realloc(uint64_t size) {
     auto cur_block_size = this->blocks_.size();
     this->blocks_.reserve(new_block_count);
     while (cur_block_size < new_block_count) {
-        this->blocks_.emplace_back((uint8_t*)(this->allocator_->Allocate(block_size_)));
+        this->blocks_.emplace_back(this->allocate_block(cur_block_size));
         ++cur_block_size;
     }
 }
 
+uint8_t*
+MemoryBlockIO::allocate_block(uint64_t block_no) {
+    auto* block = static_cast<uint8_t*>(this->allocator_->Allocate(block_size_));
+    // the policy only applies to the pages not touched yet, so it is set before any write
+    if (block != nullptr and this->numa_policy_ == BlockNumaPolicy::INTERLEAVE) {
+        InterleaveMemoryOnNumaNodes(block, block_size_);
+    } else if (block != nullptr and this->numa_policy_ == BlockNumaPolicy::PARTITION) {
+        BindMemoryToNumaNode(block, block_size_, block_no % NumaNodeCount());
+    }
+    return block;
+}
+
 static int
 countr_zero(uint64_t x) {
     if (x == 0) {
@@ -57,13 +57,22 @@ public:
     void
     PrefetchImpl(uint64_t offset, uint64_t cache_line = 64);
 
+    void
+    AttachImpl(const std::shared_ptr<const uint8_t>& data, uint64_t size);
+
 private:
+    void
+    detach();
+
     void
     update_by_block_size();
 
     void
     check_and_realloc(uint64_t size);
 
+    uint8_t*
+    allocate_block(uint64_t block_no);
+
     [[nodiscard]] const uint8_t*
     get_data_ptr(uint64_t offset) const {
         auto block_no = offset >> block_bit_;
@@ -88,5 +97,10 @@ private:
     uint64_t block_bit_{DEFAULT_BLOCK_BIT};
 
     uint64_t in_block_mask_ = (1 << DEFAULT_BLOCK_BIT) - 1;
+
+    BlockNumaPolicy numa_policy_{BlockNumaPolicy::NONE};
+
+    // when set, blocks_ point into this externally owned contiguous data
+    std::shared_ptr<const uint8_t> attached_{nullptr};
 };
 }  // namespace vsag
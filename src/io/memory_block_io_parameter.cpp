@@ -15,7 +15,10 @@
 
 #include "memory_block_io_parameter.h"
 
+#include <fmt/format.h>
+
 #include "inner_string_params.h"
+#include "vsag_exception.h"
 #include "vsag/options.h"
 
 namespace vsag {
@@ -32,12 +35,32 @@ void
 MemoryBlockIOParameter::FromJson(const JsonType& json) {
     auto block_size = Options::Instance().block_size_limit();
     this->block_size_ = NearestPowerOfTwo(block_size);
+    if (json.contains(BLOCK_IO_NUMA_POLICY_KEY)) {
+        std::string policy = json[BLOCK_IO_NUMA_POLICY_KEY];
+        if (policy == BLOCK_IO_NUMA_POLICY_NONE) {
+            this->numa_policy_ = BlockNumaPolicy::NONE;
+        } else if (policy == BLOCK_IO_NUMA_POLICY_INTERLEAVE) {
+            this->numa_policy_ = BlockNumaPolicy::INTERLEAVE;
+        } else if (policy == BLOCK_IO_NUMA_POLICY_PARTITION) {
+            this->numa_policy_ = BlockNumaPolicy::PARTITION;
+        } else {
+            throw VsagException(
+                ErrorType::INVALID_ARGUMENT,
+                fmt::format("numa_policy({}) must be one of none, interleave and partition",
+                            policy));
+        }
+    }
 }
 
 JsonType
 MemoryBlockIOParameter::ToJson() const {
     JsonType json;
     json[IO_TYPE_KEY] = IO_TYPE_VALUE_BLOCK_MEMORY_IO;
+    if (this->numa_policy_ == BlockNumaPolicy::INTERLEAVE) {
+        json[BLOCK_IO_NUMA_POLICY_KEY] = BLOCK_IO_NUMA_POLICY_INTERLEAVE;
+    } else if (this->numa_policy_ == BlockNumaPolicy::PARTITION) {
+        json[BLOCK_IO_NUMA_POLICY_KEY] = BLOCK_IO_NUMA_POLICY_PARTITION;
+    }
     return json;
 }
 
@@ -18,6 +18,14 @@
 #include "io_parameter.h"
 
 namespace vsag {
+
+// where the pages of the blocks are placed on a numa machine
+enum class BlockNumaPolicy {
+    NONE = 0,        // first touch, the node of the writing thread
+    INTERLEAVE = 1,  // the pages of every block are spread over all nodes
+    PARTITION = 2,   // block i is placed on node i % node_count
+};
+
 class MemoryBlockIOParameter : public IOParameter {
 public:
     MemoryBlockIOParameter();
@@ -35,6 +43,8 @@ public:
 
 public:
     uint64_t block_size_{};
+
+    BlockNumaPolicy numa_policy_{BlockNumaPolicy::NONE};
 };
 
 using MemoryBlockIOParamPtr = std::shared_ptr<MemoryBlockIOParameter>;
@@ -28,3 +28,18 @@ TEST_CASE("MemoryBlockIOParameter Test", "[ut][MemoryBlockIOParameter]") {
     param->FromJson(json);
     ParameterTest::TestToJson(param);
 }
+
+TEST_CASE("MemoryBlockIOParameter Numa Policy Test", "[ut][MemoryBlockIOParameter]") {
+    auto param = std::make_shared<MemoryBlockIOParameter>();
+    REQUIRE(param->numa_policy_ == BlockNumaPolicy::NONE);
+
+    param->FromJson(JsonType::parse(R"({"numa_policy": "interleave"})"));
+    REQUIRE(param->numa_policy_ == BlockNumaPolicy::INTERLEAVE);
+    ParameterTest::TestToJson(param);
+
+    param->FromJson(JsonType::parse(R"({"numa_policy": "partition"})"));
+    REQUIRE(param->numa_policy_ == BlockNumaPolicy::PARTITION);
+    ParameterTest::TestToJson(param);
+
+    REQUIRE_THROWS(param->FromJson(JsonType::parse(R"({"numa_policy": "local"})")));
+}
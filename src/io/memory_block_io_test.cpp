@@ -20,6 +20,7 @@
 
 #include "basic_io_test.h"
 #include "impl/allocator/safe_allocator.h"
+#include "index/index_common_param.h"
 
 using namespace vsag;
 
@@ -41,3 +42,26 @@ TEST_CASE("MemoryBlockIO Serialize and Deserialize Test", "[ut][MemoryBlockIO]")
         TestSerializeAndDeserialize(*wio, *rio);
     }
 }
+
+TEST_CASE("MemoryBlockIO Deserialize With MMap Test", "[ut][MemoryBlockIO]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    for (auto block_size : block_memory_io_block_sizes) {
+        for (uint64_t align_bit : {0, 6}) {
+            auto wio = std::make_unique<MemoryBlockIO>(allocator.get(), block_size);
+            auto rio = std::make_unique<MemoryBlockIO>(allocator.get(), block_size);
+            TestDeserializeWithMMap(*wio, *rio, align_bit);
+        }
+    }
+}
+
+TEST_CASE("MemoryBlockIO Numa Policy Test", "[ut][MemoryBlockIO]") {
+    IndexCommonParam common_param;
+    common_param.allocator_ = SafeAllocator::FactoryDefaultAllocator();
+    for (const auto* policy : {"none", "interleave", "partition"}) {
+        JsonType json;
+        json["numa_policy"] = policy;
+        auto param = std::make_shared<MemoryBlockIOParameter>(json);
+        auto io = std::make_unique<MemoryBlockIO>(param, common_param);
+        TestBasicReadWrite(*io);
+    }
+}
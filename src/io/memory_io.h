@@ -44,7 +44,9 @@ public:
     }
 
     ~MemoryIO() override {
-        this->allocator_->Deallocate(start_);
+        if (attached_ == nullptr) {
+            this->allocator_->Deallocate(start_);
+        }
     }
 
     inline void
@@ -62,7 +64,20 @@ public:
     inline void
     PrefetchImpl(uint64_t offset, uint64_t cache_line = 64);
 
+    inline void
+    AttachImpl(const std::shared_ptr<const uint8_t>& data, uint64_t size);
+
 private:
+    // copy attached data into owned memory before the first write
+    void
+    detach() {
+        auto* owned = static_cast<uint8_t*>(
+            this->allocator_->Allocate(std::max<uint64_t>(this->size_, 1)));
+        memcpy(owned, start_, this->size_);
+        start_ = owned;
+        attached_.reset();
+    }
+
     void
     check_and_realloc(uint64_t size) {
         if (size <= this->size_) {
@@ -74,10 +89,16 @@ private:
 
 private:
     uint8_t* start_{nullptr};
+
+    // keeps externally owned data (e.g. an mmapped index file) alive while start_ points into it
+    std::shared_ptr<const uint8_t> attached_{nullptr};
 };
 
 void
 MemoryIO::WriteImpl(const uint8_t* data, uint64_t size, uint64_t offset) {
+    if (attached_ != nullptr) {
+        this->detach();
+    }
     check_and_realloc(size + offset);
     memcpy(start_ + offset, data, size);
 }
@@ -112,4 +133,13 @@ void
 MemoryIO::PrefetchImpl(uint64_t offset, uint64_t cache_line) {
     PrefetchLines(this->start_ + offset, cache_line);
 }
+void
+MemoryIO::AttachImpl(const std::shared_ptr<const uint8_t>& data, uint64_t size) {
+    if (attached_ == nullptr) {
+        this->allocator_->Deallocate(start_);
+    }
+    attached_ = data;
+    start_ = const_cast<uint8_t*>(data.get());
+    this->size_ = size;
+}
 }  // namespace vsag
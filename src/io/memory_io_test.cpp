@@ -35,3 +35,12 @@ TEST_CASE("MemoryIO Serialize and Deserialize", "[ut][MemoryIO]") {
     auto rio = std::make_unique<MemoryIO>(allocator.get());
     TestSerializeAndDeserialize(*wio, *rio);
 }
+
+TEST_CASE("MemoryIO Deserialize With MMap Test", "[ut][MemoryIO]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    for (uint64_t align_bit : {0, 6}) {
+        auto wio = std::make_unique<MemoryIO>(allocator.get());
+        auto rio = std::make_unique<MemoryIO>(allocator.get());
+        TestDeserializeWithMMap(*wio, *rio, align_bit);
+    }
+}
@@ -0,0 +1,259 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+
+#include "label_remap.h"
+
+#include <algorithm>
+
+namespace vsag {
+
+// rehash once live entries and tombstones fill 3/4 of a table
+static constexpr uint64_t MAX_LOAD_NUMERATOR = 3;
+static constexpr uint64_t MAX_LOAD_DENOMINATOR = 4;
+
+static uint64_t
+next_power_of_two(uint64_t value) {
+    uint64_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+LabelRemap::LabelRemap(Allocator* allocator, uint32_t shard_bits)
+    : allocator_(allocator),
+      shard_bits_(std::clamp(shard_bits, 1U, 16U)),
+      shard_count_(1U << shard_bits_) {
+    this->shards_ = static_cast<Shard*>(allocator_->Allocate(sizeof(Shard) * shard_count_));
+    for (uint32_t s = 0; s < shard_count_; ++s) {
+        new (&shards_[s]) Shard();
+        shards_[s].table.store(this->allocate_table(MIN_SHARD_CAPACITY), std::memory_order_release);
+    }
+}
+
+LabelRemap::~LabelRemap() {
+    for (uint32_t s = 0; s < shard_count_; ++s) {
+        this->release_retired(shards_[s]);
+        this->free_table(shards_[s].table.load(std::memory_order_relaxed));
+        shards_[s].~Shard();
+    }
+    allocator_->Deallocate(this->shards_);
+}
+
+void
+LabelRemap::Insert(LabelType label, InnerIdType id) {
+    auto hash_value = hash(label);
+    auto& shard = this->shard_of(hash_value);
+    std::lock_guard lock(shard.mutex);
+    auto* table = shard.table.load(std::memory_order_relaxed);
+    if ((shard.occupied + 1) * MAX_LOAD_DENOMINATOR > table->capacity * MAX_LOAD_NUMERATOR) {
+        // double only when live entries fill half the table, otherwise the rehash just
+        // drops the tombstones left by Erase
+        auto capacity = table->capacity;
+        if ((shard.size + 1) * 2 > capacity) {
+            capacity *= 2;
+        }
+        this->rehash(shard, capacity);
+        table = shard.table.load(std::memory_order_relaxed);
+    }
+    auto mask = table->capacity - 1;
+    for (auto pos = hash_value & mask;; pos = (pos + 1) & mask) {
+        auto slot_id = table->ids[pos].load(std::memory_order_relaxed);
+        if (slot_id == EMPTY_ID) {
+            table->labels[pos].store(label, std::memory_order_relaxed);
+            // release publishes the label to readers that observe the id
+            table->ids[pos].store(id, std::memory_order_release);
+            ++shard.size;
+            ++shard.occupied;
+            return;
+        }
+        if (table->labels[pos].load(std::memory_order_relaxed) == label) {
+            if (slot_id == TOMBSTONE_ID) {
+                ++shard.size;
+            }
+            table->ids[pos].store(id, std::memory_order_release);
+            return;
+        }
+    }
+}
+
+bool
+LabelRemap::Erase(LabelType label) {
+    auto hash_value = hash(label);
+    auto& shard = this->shard_of(hash_value);
+    std::lock_guard lock(shard.mutex);
+    auto* table = shard.table.load(std::memory_order_relaxed);
+    auto mask = table->capacity - 1;
+    for (auto pos = hash_value & mask;; pos = (pos + 1) & mask) {
+        auto slot_id = table->ids[pos].load(std::memory_order_relaxed);
+        if (slot_id == EMPTY_ID) {
+            return false;
+        }
+        if (table->labels[pos].load(std::memory_order_relaxed) == label) {
+            if (slot_id == TOMBSTONE_ID) {
+                return false;
+            }
+            table->ids[pos].store(TOMBSTONE_ID, std::memory_order_release);
+            --shard.size;
+            return true;
+        }
+    }
+}
+
+bool
+LabelRemap::Find(LabelType label, InnerIdType& id) const {
+    auto hash_value = hash(label);
+    const auto& shard = this->shard_of(hash_value);
+    // announce the reader before loading the table, see rehash
+    shard.readers.fetch_add(1, std::memory_order_seq_cst);
+    const auto* table = shard.table.load(std::memory_order_seq_cst);
+    auto mask = table->capacity - 1;
+    bool found = false;
+    for (auto pos = hash_value & mask;; pos = (pos + 1) & mask) {
+        auto slot_id = table->ids[pos].load(std::memory_order_acquire);
+        if (slot_id == EMPTY_ID) {
+            break;
+        }
+        if (table->labels[pos].load(std::memory_order_relaxed) == label) {
+            // labels are unique within a table, a tombstone ends the probe
+            if (slot_id != TOMBSTONE_ID) {
+                id = slot_id;
+                found = true;
+            }
+            break;
+        }
+    }
+    shard.readers.fetch_sub(1, std::memory_order_release);
+    return found;
+}
+
+uint64_t
+LabelRemap::Size() const {
+    uint64_t size = 0;
+    for (uint32_t s = 0; s < shard_count_; ++s) {
+        std::lock_guard lock(shards_[s].mutex);
+        size += shards_[s].size;
+    }
+    return size;
+}
+
+void
+LabelRemap::Reserve(uint64_t count) {
+    auto per_shard = (count + shard_count_ - 1) / shard_count_;
+    auto capacity = next_power_of_two(per_shard * MAX_LOAD_DENOMINATOR / MAX_LOAD_NUMERATOR + 1);
+    for (uint32_t s = 0; s < shard_count_; ++s) {
+        auto& shard = shards_[s];
+        std::lock_guard lock(shard.mutex);
+        if (shard.table.load(std::memory_order_relaxed)->capacity < capacity) {
+            this->rehash(shard, capacity);
+        }
+    }
+}
+
+void
+LabelRemap::Clear() {
+    for (uint32_t s = 0; s < shard_count_; ++s) {
+        auto& shard = shards_[s];
+        this->release_retired(shard);
+        this->free_table(shard.table.load(std::memory_order_relaxed));
+        shard.table.store(this->allocate_table(MIN_SHARD_CAPACITY), std::memory_order_release);
+        shard.size = 0;
+        shard.occupied = 0;
+    }
+}
+
+int64_t
+LabelRemap::GetMemoryUsage() const {
+    auto table_bytes = [](const Table* table) {
+        return static_cast<int64_t>(
+            sizeof(Table) +
+            table->capacity * (sizeof(std::atomic<LabelType>) + sizeof(std::atomic<InnerIdType>)));
+    };
+    auto memory = static_cast<int64_t>(sizeof(LabelRemap) + sizeof(Shard) * shard_count_);
+    for (uint32_t s = 0; s < shard_count_; ++s) {
+        std::lock_guard lock(shards_[s].mutex);
+        memory += table_bytes(shards_[s].table.load(std::memory_order_relaxed));
+        for (const auto* table = shards_[s].retired; table != nullptr;
+             table = table->next_retired) {
+            memory += table_bytes(table);
+        }
+    }
+    return memory;
+}
+
+LabelRemap::Table*
+LabelRemap::allocate_table(uint64_t capacity) {
+    auto* table = static_cast<Table*>(allocator_->Allocate(sizeof(Table)));
+    new (table) Table();
+    table->capacity = capacity;
+    table->labels = static_cast<std::atomic<LabelType>*>(
+        allocator_->Allocate(sizeof(std::atomic<LabelType>) * capacity));
+    table->ids = static_cast<std::atomic<InnerIdType>*>(
+        allocator_->Allocate(sizeof(std::atomic<InnerIdType>) * capacity));
+    for (uint64_t i = 0; i < capacity; ++i) {
+        new (&table->labels[i]) std::atomic<LabelType>(0);
+        new (&table->ids[i]) std::atomic<InnerIdType>(EMPTY_ID);
+    }
+    return table;
+}
+
+void
+LabelRemap::free_table(Table* table) {
+    if (table == nullptr) {
+        return;
+    }
+    allocator_->Deallocate(table->labels);
+    allocator_->Deallocate(table->ids);
+    allocator_->Deallocate(table);
+}
+
+void
+LabelRemap::rehash(Shard& shard, uint64_t capacity) {
+    auto* old_table = shard.table.load(std::memory_order_relaxed);
+    auto* new_table = this->allocate_table(capacity);
+    auto mask = capacity - 1;
+    for (uint64_t i = 0; i < old_table->capacity; ++i) {
+        auto id = old_table->ids[i].load(std::memory_order_relaxed);
+        if (id == EMPTY_ID or id == TOMBSTONE_ID) {
+            continue;
+        }
+        auto label = old_table->labels[i].load(std::memory_order_relaxed);
+        auto pos = hash(label) & mask;
+        while (new_table->ids[pos].load(std::memory_order_relaxed) != EMPTY_ID) {
+            pos = (pos + 1) & mask;
+        }
+        new_table->labels[pos].store(label, std::memory_order_relaxed);
+        new_table->ids[pos].store(id, std::memory_order_relaxed);
+    }
+    shard.table.store(new_table, std::memory_order_seq_cst);
+    shard.occupied = shard.size;
+    old_table->next_retired = shard.retired;
+    shard.retired = old_table;
+    // readers arriving from now on load new_table, so with no reader inside the shard
+    // nobody can still hold a retired table
+    if (shard.readers.load(std::memory_order_seq_cst) == 0) {
+        this->release_retired(shard);
+    }
+}
+
+void
+LabelRemap::release_retired(Shard& shard) {
+    while (shard.retired != nullptr) {
+        auto* next = shard.retired->next_retired;
+        this->free_table(shard.retired);
+        shard.retired = next;
+    }
+}
+
+}  // namespace vsag
@@ -0,0 +1,152 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+
+#include "typing.h"
+#include "vsag/allocator.h"
+
+namespace vsag {
+
+/**
+ * @brief Reverse map from label to inner id, sharded open addressing with lock-free reads.
+ *
+ * Each shard is a linear-probing table of two flat arrays (8-byte labels, 4-byte ids), so an
+ * entry costs 12 bytes per slot instead of a hash node. Writers serialize per shard, readers
+ * never lock. A slot's label never changes once written; Erase only turns its id into a
+ * tombstone, which is what keeps the lock-free probe safe. Tables replaced by a rehash are
+ * retired and freed by a later rehash once no reader is inside the shard.
+ */
+class LabelRemap {
+public:
+    explicit LabelRemap(Allocator* allocator, uint32_t shard_bits = DEFAULT_SHARD_BITS);
+
+    ~LabelRemap();
+
+    LabelRemap(const LabelRemap&) = delete;
+    LabelRemap&
+    operator=(const LabelRemap&) = delete;
+
+    /// Inserts the mapping, overwriting the inner id if the label exists.
+    void
+    Insert(LabelType label, InnerIdType id);
+
+    /// Removes the label, returns false if it does not exist.
+    bool
+    Erase(LabelType label);
+
+    /// Lock-free lookup, safe to call concurrently with Insert and Erase.
+    bool
+    Find(LabelType label, InnerIdType& id) const;
+
+    bool
+    Contains(LabelType label) const {
+        InnerIdType id;
+        return this->Find(label, id);
+    }
+
+    [[nodiscard]] uint64_t
+    Size() const;
+
+    /// Pre-sizes the shards for count labels to avoid rehashing during bulk loads.
+    void
+    Reserve(uint64_t count);
+
+    /// Not safe to call concurrently with any other method.
+    void
+    Clear();
+
+    [[nodiscard]] int64_t
+    GetMemoryUsage() const;
+
+    /// Calls func(label, id) for every live entry, must not run concurrently with writers.
+    template <typename Func>
+    void
+    ForEach(Func&& func) const {
+        for (uint32_t s = 0; s < shard_count_; ++s) {
+            const auto* table = shards_[s].table.load(std::memory_order_acquire);
+            for (uint64_t i = 0; i < table->capacity; ++i) {
+                auto id = table->ids[i].load(std::memory_order_acquire);
+                if (id != EMPTY_ID and id != TOMBSTONE_ID) {
+                    func(table->labels[i].load(std::memory_order_relaxed), id);
+                }
+            }
+        }
+    }
+
+public:
+    static constexpr uint32_t DEFAULT_SHARD_BITS = 4;
+
+private:
+    struct Table {
+        uint64_t capacity{0};  // power of two
+        std::atomic<LabelType>* labels{nullptr};
+        std::atomic<InnerIdType>* ids{nullptr};
+        Table* next_retired{nullptr};
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::atomic<Table*> table{nullptr};
+        uint64_t size{0};      // live entries
+        uint64_t occupied{0};  // live entries and tombstones
+        Table* retired{nullptr};
+        mutable std::atomic<uint32_t> readers{0};
+    };
+
+    static constexpr InnerIdType EMPTY_ID = std::numeric_limits<InnerIdType>::max();
+    static constexpr InnerIdType TOMBSTONE_ID = EMPTY_ID - 1;
+    static constexpr uint64_t MIN_SHARD_CAPACITY = 16;
+
+    static inline uint64_t
+    hash(LabelType label) {
+        // splitmix64 finalizer, labels are often sequential
+        auto x = static_cast<uint64_t>(label);
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    inline Shard&
+    shard_of(uint64_t hash_value) const {
+        return shards_[hash_value >> (64 - shard_bits_)];
+    }
+
+    Table*
+    allocate_table(uint64_t capacity);
+
+    void
+    free_table(Table* table);
+
+    void
+    rehash(Shard& shard, uint64_t capacity);
+
+    void
+    release_retired(Shard& shard);
+
+private:
+    Allocator* const allocator_{nullptr};
+
+    const uint32_t shard_bits_{DEFAULT_SHARD_BITS};
+
+    const uint32_t shard_count_{1U << DEFAULT_SHARD_BITS};
+
+    Shard* shards_{nullptr};
+};
+
+}  // namespace vsag
@@ -0,0 +1,127 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+
+#include "label_remap.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <unordered_map>
+
+#include "impl/allocator/safe_allocator.h"
+#include "label_table.h"
+
+using namespace vsag;
+
+TEST_CASE("LabelRemap Basic Test", "[ut][LabelRemap]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    LabelRemap remap(allocator.get());
+    std::unordered_map<LabelType, InnerIdType> expected;
+    constexpr InnerIdType count = 10000;
+    for (InnerIdType i = 0; i < count; ++i) {
+        auto label = static_cast<LabelType>(i) * 7919 - 5000;
+        remap.Insert(label, i);
+        expected[label] = i;
+    }
+    REQUIRE(remap.Size() == count);
+
+    // erase every third label, then reinsert half of them with new ids
+    for (InnerIdType i = 0; i < count; i += 3) {
+        auto label = static_cast<LabelType>(i) * 7919 - 5000;
+        REQUIRE(remap.Erase(label));
+        REQUIRE_FALSE(remap.Erase(label));
+        expected.erase(label);
+    }
+    for (InnerIdType i = 0; i < count; i += 6) {
+        auto label = static_cast<LabelType>(i) * 7919 - 5000;
+        remap.Insert(label, i + count);
+        expected[label] = i + count;
+    }
+    REQUIRE(remap.Size() == expected.size());
+    for (InnerIdType i = 0; i < count; ++i) {
+        auto label = static_cast<LabelType>(i) * 7919 - 5000;
+        InnerIdType id = 0;
+        auto iter = expected.find(label);
+        REQUIRE(remap.Find(label, id) == (iter != expected.end()));
+        if (iter != expected.end()) {
+            REQUIRE(id == iter->second);
+        }
+    }
+    uint64_t visited = 0;
+    remap.ForEach([&](LabelType label, InnerIdType id) {
+        REQUIRE(expected.at(label) == id);
+        ++visited;
+    });
+    REQUIRE(visited == expected.size());
+    REQUIRE(remap.GetMemoryUsage() > 0);
+
+    remap.Clear();
+    REQUIRE(remap.Size() == 0);
+    REQUIRE_FALSE(remap.Contains(-5000));
+}
+
+TEST_CASE("LabelRemap Concurrent Test", "[ut][LabelRemap]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    LabelRemap remap(allocator.get());
+    constexpr int thread_count = 4;
+    constexpr InnerIdType per_thread = 20000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            for (InnerIdType i = 0; i < per_thread; ++i) {
+                auto id = static_cast<InnerIdType>(t) * per_thread + i;
+                remap.Insert(id, id);
+                if (i % 2 == 1) {
+                    remap.Erase(id - 1);
+                }
+            }
+        });
+    }
+    // readers run without locks while the writers rehash
+    std::atomic<bool> wrong{false};
+    std::thread reader([&]() {
+        for (InnerIdType i = 0; i < per_thread * thread_count; ++i) {
+            InnerIdType id;
+            if (remap.Find(i, id) and id != i) {
+                wrong.store(true);
+            }
+        }
+    });
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    reader.join();
+    REQUIRE_FALSE(wrong.load());
+    REQUIRE(remap.Size() == thread_count * per_thread / 2);
+    for (InnerIdType i = 0; i < per_thread * thread_count; ++i) {
+        REQUIRE(remap.Contains(i) == (i % 2 == 1));
+    }
+}
+
+TEST_CASE("LabelTable Sorted Lookup Test", "[ut][LabelRemap]") {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    LabelTable table(allocator.get(), false);
+    constexpr InnerIdType count = 1000;
+    for (InnerIdType i = 0; i < count; ++i) {
+        table.Insert(i, static_cast<LabelType>(count - i) * 3);
+    }
+    for (InnerIdType i = 0; i < count; ++i) {
+        REQUIRE(table.GetIdByLabel(static_cast<LabelType>(count - i) * 3) == i);
+    }
+    REQUIRE_FALSE(table.CheckLabel(1));
+    REQUIRE_THROWS(table.GetIdByLabel(1));
+
+    // the sorted array is rebuilt after an insert
+    table.Insert(count, 1);
+    REQUIRE(table.GetIdByLabel(1) == count);
+}
@@ -24,8 +24,9 @@ LabelTable::MergeOther(const LabelTablePtr& other, const IdMapFunction& id_map)
     for (int64_t i = 0; i < other_size; ++i) {
         auto new_label = std::get<1>(id_map(other->label_table_[i]));
         this->label_table_[i + total_count_] = new_label;
-        this->label_remap_[new_label] = i + total_count_;
+        this->label_remap_.Insert(new_label, i + total_count_);
     }
     total_count_ += other_size;
+    sorted_valid_.store(false, std::memory_order_release);
 }
 }  // namespace vsag
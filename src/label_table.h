@@ -17,8 +17,10 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <atomic>
 
+#include "label_remap.h"
 #include "storage/stream_reader.h"
 #include "storage/stream_writer.h"
 #include "typing.h"
@@ -43,10 +45,11 @@ public:
                         bool compress_redundant_data = false)
         : allocator_(allocator),
           label_table_(0, allocator),
-          label_remap_(0, allocator),
+          label_remap_(allocator),
           use_reverse_map_(use_reverse_map),
           compress_duplicate_data_(compress_redundant_data),
-          duplicate_records_(0, allocator){};
+          duplicate_records_(0, allocator),
+          sorted_ids_(allocator){};
 
     ~LabelTable() {
         for (int i = 0; i < duplicate_records_.size(); ++i) {
@@ -57,7 +60,9 @@ public:
     inline void
     Insert(InnerIdType id, LabelType label) {
         if (use_reverse_map_) {
-            label_remap_[label] = id;
+            label_remap_.Insert(label, id);
+        } else {
+            sorted_valid_.store(false, std::memory_order_release);
         }
         if (id + 1 > label_table_.size()) {
             label_table_.resize(id + 1);
@@ -71,36 +76,27 @@ public:
         if (not use_reverse_map_) {
             return true;
         }
-        auto iter = label_remap_.find(label);
-        if (iter == label_remap_.end()) {
-            return false;
-        }
-        label_remap_.erase(iter);
-        return true;
+        return label_remap_.Erase(label);
     }
 
     inline InnerIdType
     GetIdByLabel(LabelType label) const {
-        if (use_reverse_map_) {
-            if (this->label_remap_.count(label) == 0) {
-                throw std::runtime_error(fmt::format("label {} is not exists", label));
-            }
-            return this->label_remap_.at(label);
-        }
-        auto result = std::find(label_table_.begin(), label_table_.end(), label);
-        if (result == label_table_.end()) {
+        InnerIdType id;
+        bool found =
+            use_reverse_map_ ? this->label_remap_.Find(label, id) : this->find_sorted(label, id);
+        if (not found) {
             throw std::runtime_error(fmt::format("label {} is not exists", label));
         }
-        return result - label_table_.begin();
+        return id;
     }
 
     inline bool
     CheckLabel(LabelType label) const {
         if (use_reverse_map_) {
-            return label_remap_.find(label) != label_remap_.end();
+            return label_remap_.Contains(label);
         }
-        auto result = std::find(label_table_.begin(), label_table_.end(), label);
-        return result != label_table_.end();
+        InnerIdType id;
+        return this->find_sorted(label, id);
     }
 
     inline LabelType
@@ -130,10 +126,12 @@ public:
     Deserialize(lvalue_or_rvalue<StreamReader> reader) {
         StreamReader::ReadVector(reader, label_table_);
         if (use_reverse_map_) {
+            this->label_remap_.Reserve(label_table_.size());
             for (InnerIdType id = 0; id < label_table_.size(); ++id) {
-                this->label_remap_[label_table_[id]] = id;
+                this->label_remap_.Insert(label_table_[id], id);
             }
         }
+        sorted_valid_.store(false, std::memory_order_release);
         if (compress_duplicate_data_) {
             StreamReader::ReadObj(reader, duplicate_count_);
             duplicate_records_.resize(label_table_.size(), nullptr);
@@ -152,6 +150,7 @@ public:
             return;
         }
         label_table_.resize(new_size);
+        sorted_valid_.store(false, std::memory_order_release);
         if (compress_duplicate_data_) {
             duplicate_records_.resize(new_size, nullptr);
         }
@@ -190,9 +189,46 @@ public:
     void
     MergeOther(const LabelTablePtr& other, const IdMapFunction& id_map = nullptr);
 
+private:
+    /**
+     * @brief Lookup without reverse map, binary search over ids sorted by label.
+     *
+     * The sorted array costs 4 bytes per entry and is rebuilt lazily after the table
+     * changes, so it suits immutable indexes; writers must not race with readers here.
+     */
+    inline bool
+    find_sorted(LabelType label, InnerIdType& id) const {
+        if (not sorted_valid_.load(std::memory_order_acquire)) {
+            std::lock_guard lock(sorted_mutex_);
+            if (not sorted_valid_.load(std::memory_order_relaxed)) {
+                sorted_ids_.resize(label_table_.size());
+                for (InnerIdType i = 0; i < label_table_.size(); ++i) {
+                    sorted_ids_[i] = i;
+                }
+                // ties keep the smallest id first, the same result as a linear scan
+                std::sort(sorted_ids_.begin(),
+                          sorted_ids_.end(),
+                          [this](InnerIdType a, InnerIdType b) {
+                              return label_table_[a] < label_table_[b] or
+                                     (label_table_[a] == label_table_[b] and a < b);
+                          });
+                sorted_valid_.store(true, std::memory_order_release);
+            }
+        }
+        auto iter = std::lower_bound(
+            sorted_ids_.begin(), sorted_ids_.end(), label, [this](InnerIdType a, LabelType l) {
+                return label_table_[a] < l;
+            });
+        if (iter == sorted_ids_.end() or label_table_[*iter] != label) {
+            return false;
+        }
+        id = *iter;
+        return true;
+    }
+
 public:
     Vector<LabelType> label_table_;
-    UnorderedMap<LabelType, InnerIdType> label_remap_;
+    LabelRemap label_remap_;
 
     bool compress_duplicate_data_{true};
 
@@ -203,6 +239,11 @@ public:
     Allocator* allocator_{nullptr};
     std::atomic<int64_t> total_count_{0L};
     bool use_reverse_map_{true};
+
+private:
+    mutable Vector<InnerIdType> sorted_ids_;
+    mutable std::atomic<bool> sorted_valid_{false};
+    mutable std::mutex sorted_mutex_;
 };
 
 }  // namespace vsag
@@ -0,0 +1,78 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "numa_thread_pool.h"
+
+#include "utils/numa.h"
+
+namespace vsag {
+
+// the node the worker running on this thread is pinned to, -1 if not pinned yet
+static thread_local int64_t pinned_numa_node = -1;
+
+NumaThreadPool::NumaThreadPool(std::size_t threads_per_node) {
+    auto node_count = NumaNodeCount();
+    pools_.reserve(node_count);
+    for (uint32_t node = 0; node < node_count; ++node) {
+        pools_.emplace_back(std::make_unique<progschj::ThreadPool>(threads_per_node));
+    }
+}
+
+std::future<void>
+NumaThreadPool::Enqueue(std::function<void(void)> task) {
+    return this->EnqueueOnNode(CurrentNumaNode(), std::move(task));
+}
+
+std::future<void>
+NumaThreadPool::EnqueueOnNode(uint32_t node, std::function<void(void)> task) {
+    node %= static_cast<uint32_t>(pools_.size());
+    if (pools_.size() == 1) {
+        return pools_[0]->enqueue(std::move(task));
+    }
+    return pools_[node]->enqueue([node, task = std::move(task)]() {
+        if (pinned_numa_node != static_cast<int64_t>(node)) {
+            PinThreadToNumaNode(node);
+            pinned_numa_node = node;
+        }
+        task();
+    });
+}
+
+void
+NumaThreadPool::WaitUntilEmpty() {
+    for (auto& pool : pools_) {
+        pool->wait_until_nothing_in_flight();
+    }
+}
+
+void
+NumaThreadPool::SetQueueSizeLimit(std::size_t limit) {
+    for (auto& pool : pools_) {
+        pool->set_queue_size_limit(limit);
+    }
+}
+
+void
+NumaThreadPool::SetPoolSize(std::size_t limit) {
+    for (auto& pool : pools_) {
+        pool->set_pool_size(limit);
+    }
+}
+
+uint32_t
+NumaThreadPool::NodeCount() const {
+    return static_cast<uint32_t>(pools_.size());
+}
+
+}  // namespace vsag
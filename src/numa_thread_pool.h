@@ -0,0 +1,59 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <ThreadPool.h>
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "vsag/thread_pool.h"
+
+namespace vsag {
+
+// one group of workers per numa node, pinned to the cpus of the node on their first task;
+// Enqueue keeps a task on the node of the calling thread, so the search it runs reads the
+// replicas and the first-touched buffers of that node
+class NumaThreadPool : public ThreadPool {
+public:
+    explicit NumaThreadPool(std::size_t threads_per_node);
+
+    std::future<void>
+    Enqueue(std::function<void(void)> task) override;
+
+    std::future<void>
+    EnqueueOnNode(uint32_t node, std::function<void(void)> task);
+
+    void
+    WaitUntilEmpty() override;
+
+    // the limit of each node
+    void
+    SetQueueSizeLimit(std::size_t limit) override;
+
+    // the count of workers of each node
+    void
+    SetPoolSize(std::size_t limit) override;
+
+    [[nodiscard]] uint32_t
+    NodeCount() const;
+
+private:
+    std::vector<std::unique_ptr<progschj::ThreadPool>> pools_;
+};
+
+}  // namespace vsag
@@ -0,0 +1,49 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "numa_thread_pool.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/numa.h"
+
+TEST_CASE("NumaThreadPool Basic Test", "[ut][NumaThreadPool]") {
+    vsag::NumaThreadPool thread_pool(2);
+    REQUIRE(thread_pool.NodeCount() == vsag::NumaNodeCount());
+    thread_pool.SetPoolSize(4);
+    thread_pool.SetQueueSizeLimit(64);
+
+    std::atomic<int> data{0};
+    std::vector<std::future<void>> futures;
+    int round = 32;
+    for (int i = 0; i < round; ++i) {
+        futures.emplace_back(thread_pool.Enqueue([&data]() { data++; }));
+        futures.emplace_back(thread_pool.EnqueueOnNode(i, [&data]() { data++; }));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+    thread_pool.WaitUntilEmpty();
+    REQUIRE(data == round * 2);
+
+    // a task enqueued to a node runs on it
+    for (uint32_t node = 0; node < thread_pool.NodeCount(); ++node) {
+        uint32_t running_node = thread_pool.NodeCount();
+        thread_pool.EnqueueOnNode(node, [&running_node]() {
+                       running_node = vsag::CurrentNumaNode();
+                   })
+            .get();
+        REQUIRE(running_node == node);
+    }
+}
@@ -45,6 +45,15 @@ Options::set_direct_IO_object_align_bit(size_t align_bit) {
     }
 }
 
+void
+Options::set_serialize_align_bit(size_t align_bit) {
+    if (align_bit > 12) {
+        throw std::runtime_error(
+            fmt::format("size ({}) should not be greater than 2^12(4K).", align_bit));
+    }
+    serialize_align_bit_.store(align_bit, std::memory_order_release);
+}
+
 void
 Options::set_block_size_limit(size_t size) {
     if (size < 2ULL * 1024 * 1024) {
@@ -71,4 +80,13 @@ Options::set_num_threads_building(size_t num_threads) {
     num_threads_building_.store(num_threads, std::memory_order_release);
 }
 
+void
+Options::set_num_threads_search(size_t num_threads) {
+    if (num_threads < 1 || num_threads > 200) {
+        throw std::runtime_error(
+            fmt::format("num_threads must be set between 1 and 200, but found {}.", num_threads));
+    }
+    num_threads_search_.store(num_threads, std::memory_order_release);
+}
+
 }  // namespace vsag
@@ -38,6 +38,13 @@ TEST_CASE("Options Test", "[ut][option]") {
     REQUIRE_THROWS(vsag::Option::Instance().set_num_threads_building(0));
     REQUIRE_THROWS(vsag::Option::Instance().set_num_threads_building(201));
 
+    size_t num_threads_search = 16;
+    vsag::Options::Instance().set_num_threads_search(num_threads_search);
+    REQUIRE(vsag::Option::Instance().num_threads_search() == num_threads_search);
+
+    REQUIRE_THROWS(vsag::Option::Instance().set_num_threads_search(0));
+    REQUIRE_THROWS(vsag::Option::Instance().set_num_threads_search(201));
+
     size_t direct_IO_object_align_bit = 12;
     vsag::Options::Instance().set_direct_IO_object_align_bit(direct_IO_object_align_bit);
     REQUIRE(vsag::Option::Instance().direct_IO_object_align_bit() == direct_IO_object_align_bit);
@@ -46,4 +53,16 @@ TEST_CASE("Options Test", "[ut][option]") {
     REQUIRE(vsag::Option::Instance().direct_IO_object_align_bit() == direct_IO_object_align_bit);
 
     REQUIRE_THROWS(vsag::Option::Instance().set_direct_IO_object_align_bit(22));
+
+    vsag::Options::Instance().set_serialize_align_bit(6);
+    REQUIRE(vsag::Option::Instance().serialize_align_bit() == 6);
+    vsag::Options::Instance().set_serialize_align_bit(0);
+    REQUIRE(vsag::Option::Instance().serialize_align_bit() == 0);
+
+    REQUIRE_THROWS(vsag::Option::Instance().set_serialize_align_bit(13));
+
+    REQUIRE_FALSE(vsag::Option::Instance().numa_replication());
+    vsag::Options::Instance().set_numa_replication(true);
+    REQUIRE(vsag::Option::Instance().numa_replication());
+    vsag::Options::Instance().set_numa_replication(false);
 }
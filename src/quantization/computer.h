@@ -76,6 +76,16 @@ public:
                                        dists4);
     }
 
+    inline void
+    ComputeDistsBatch8(const uint8_t* const* codes, float* dists) {
+        quantizer_->ComputeDistsBatch8(this->shared_from_this(), codes, dists);
+    }
+
+    inline void
+    ComputeDistsBatch16(const uint8_t* const* codes, float* dists) {
+        quantizer_->ComputeDistsBatch16(this->shared_from_this(), codes, dists);
+    }
+
 public:
     Allocator* const allocator_{nullptr};
     const T* quantizer_{nullptr};
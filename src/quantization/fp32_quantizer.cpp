@@ -27,6 +27,8 @@ FP32Quantizer<metric>::FP32Quantizer(int dim, Allocator* allocator)
     this->code_size_ = dim * sizeof(float);
     this->query_code_size_ = this->code_size_;
     this->metric_ = metric;
+    this->ip_func_ = SelectFP32ComputeIP(this->dim_);
+    this->l2sqr_func_ = SelectFP32ComputeL2Sqr(this->dim_);
 }
 
 template <MetricType metric>
@@ -101,14 +103,14 @@ template <MetricType metric>
 float
 FP32Quantizer<metric>::ComputeImpl(const uint8_t* codes1, const uint8_t* codes2) {
     if (metric == MetricType::METRIC_TYPE_IP) {
-        return 1.0F - FP32ComputeIP(reinterpret_cast<const float*>(codes1),
-                                    reinterpret_cast<const float*>(codes2),
-                                    this->dim_);
+        return 1.0F - this->ip_func_(reinterpret_cast<const float*>(codes1),
+                                      reinterpret_cast<const float*>(codes2),
+                                      this->dim_);
     }
     if (metric == MetricType::METRIC_TYPE_COSINE) {
-        auto similarity = FP32ComputeIP(reinterpret_cast<const float*>(codes1),
-                                        reinterpret_cast<const float*>(codes2),
-                                        this->dim_);
+        auto similarity = this->ip_func_(reinterpret_cast<const float*>(codes1),
+                                          reinterpret_cast<const float*>(codes2),
+                                          this->dim_);
         if (this->hold_molds_) {
             const auto* mold1 = reinterpret_cast<const float*>(codes1 + this->dim_ * sizeof(float));
             const auto* mold2 = reinterpret_cast<const float*>(codes2 + this->dim_ * sizeof(float));
@@ -117,9 +119,9 @@ FP32Quantizer<metric>::ComputeImpl(const uint8_t* codes1, const uint8_t* codes2)
         return 1.0F - similarity;
     }
     if (metric == MetricType::METRIC_TYPE_L2SQR) {
-        return FP32ComputeL2Sqr(reinterpret_cast<const float*>(codes1),
-                                reinterpret_cast<const float*>(codes2),
-                                this->dim_);
+        return this->l2sqr_func_(reinterpret_cast<const float*>(codes1),
+                                 reinterpret_cast<const float*>(codes2),
+                                 this->dim_);
     }
     return 0.0F;
 }
@@ -162,22 +164,22 @@ FP32Quantizer<metric>::ComputeDistImpl(Computer<FP32Quantizer<metric>>& computer
                                        const uint8_t* codes,
                                        float* dists) const {
     if (metric == MetricType::METRIC_TYPE_IP) {
-        *dists = 1.0F - FP32ComputeIP(reinterpret_cast<const float*>(codes),
-                                      reinterpret_cast<const float*>(computer.buf_),
-                                      this->dim_);
-    } else if (metric == MetricType::METRIC_TYPE_COSINE) {
-        auto similarity = FP32ComputeIP(reinterpret_cast<const float*>(codes),
+        *dists = 1.0F - this->ip_func_(reinterpret_cast<const float*>(codes),
                                         reinterpret_cast<const float*>(computer.buf_),
                                         this->dim_);
+    } else if (metric == MetricType::METRIC_TYPE_COSINE) {
+        auto similarity = this->ip_func_(reinterpret_cast<const float*>(codes),
+                                          reinterpret_cast<const float*>(computer.buf_),
+                                          this->dim_);
         if (this->hold_molds_) {
             const auto* mold = reinterpret_cast<const float*>(codes + this->dim_ * sizeof(float));
             similarity /= mold[0];
         }
         *dists = 1.0F - similarity;
     } else if (metric == MetricType::METRIC_TYPE_L2SQR) {
-        *dists = FP32ComputeL2Sqr(reinterpret_cast<const float*>(codes),
-                                  reinterpret_cast<const float*>(computer.buf_),
-                                  this->dim_);
+        *dists = this->l2sqr_func_(reinterpret_cast<const float*>(codes),
+                                   reinterpret_cast<const float*>(computer.buf_),
+                                   this->dim_);
     } else {
         *dists = 0.0F;
     }
@@ -253,6 +255,49 @@ FP32Quantizer<metric>::ComputeDistsBatch4Impl(Computer<FP32Quantizer<metric>>& c
     }
 }
 
+template <MetricType metric>
+template <int BatchSize>
+void
+FP32Quantizer<metric>::compute_dists_batch(Computer<FP32Quantizer<metric>>& computer,
+                                          const uint8_t* const* codes,
+                                          float* dists) const {
+    static_assert(BatchSize == 8 or BatchSize == 16);
+    const auto* query = reinterpret_cast<const float*>(computer.buf_);
+    const auto* const* fp32_codes = reinterpret_cast<const float* const*>(codes);
+    if constexpr (metric == MetricType::METRIC_TYPE_L2SQR) {
+        auto compute = BatchSize == 8 ? FP32ComputeL2SqrBatch8 : FP32ComputeL2SqrBatch16;
+        compute(query, this->dim_, fp32_codes, dists);
+    } else if constexpr (metric == MetricType::METRIC_TYPE_IP or
+                         metric == MetricType::METRIC_TYPE_COSINE) {
+        auto compute = BatchSize == 8 ? FP32ComputeIPBatch8 : FP32ComputeIPBatch16;
+        compute(query, this->dim_, fp32_codes, dists);
+        for (int i = 0; i < BatchSize; ++i) {
+            if (metric == MetricType::METRIC_TYPE_COSINE and this->hold_molds_) {
+                dists[i] /= fp32_codes[i][this->dim_];
+            }
+            dists[i] = 1.0F - dists[i];
+        }
+    } else {
+        std::fill(dists, dists + BatchSize, 0.0F);
+    }
+}
+
+template <MetricType metric>
+void
+FP32Quantizer<metric>::ComputeDistsBatch8Impl(Computer<FP32Quantizer<metric>>& computer,
+                                              const uint8_t* const* codes,
+                                              float* dists) const {
+    this->compute_dists_batch<8>(computer, codes, dists);
+}
+
+template <MetricType metric>
+void
+FP32Quantizer<metric>::ComputeDistsBatch16Impl(Computer<FP32Quantizer<metric>>& computer,
+                                               const uint8_t* const* codes,
+                                               float* dists) const {
+    this->compute_dists_batch<16>(computer, codes, dists);
+}
+
 template <MetricType metric>
 void
 FP32Quantizer<metric>::ReleaseComputerImpl(Computer<FP32Quantizer<metric>>& computer) const {
@@ -19,6 +19,7 @@
 #include "index/index_common_param.h"
 #include "inner_string_params.h"
 #include "quantizer.h"
+#include "simd/fp32_simd.h"
 
 namespace vsag {
 
@@ -81,6 +82,16 @@ public:
                            float& dists3,
                            float& dists4) const;
 
+    void
+    ComputeDistsBatch8Impl(Computer<FP32Quantizer<metric>>& computer,
+                           const uint8_t* const* codes,
+                           float* dists) const;
+
+    void
+    ComputeDistsBatch16Impl(Computer<FP32Quantizer<metric>>& computer,
+                            const uint8_t* const* codes,
+                            float* dists) const;
+
     void
     ReleaseComputerImpl(Computer<FP32Quantizer<metric>>& computer) const;
 
@@ -88,6 +99,17 @@ public:
     NameImpl() const {
         return QUANTIZATION_TYPE_VALUE_FP32;
     }
+
+private:
+    template <int BatchSize>
+    void
+    compute_dists_batch(Computer<FP32Quantizer<metric>>& computer,
+                        const uint8_t* const* codes,
+                        float* dists) const;
+
+    // picked once by dim, the specialized kernel if the dim is one of FIXED_DIMS
+    FP32ComputeType ip_func_{nullptr};
+    FP32ComputeType l2sqr_func_{nullptr};
 };
 
 }  // namespace vsag
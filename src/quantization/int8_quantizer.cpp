@@ -0,0 +1,169 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "int8_quantizer.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "simd/int8_simd.h"
+
+namespace vsag {
+
+template <MetricType metric>
+INT8Quantizer<metric>::INT8Quantizer(int dim, Allocator* allocator)
+    : Quantizer<INT8Quantizer<metric>>(dim, allocator) {
+    this->code_size_ = dim * sizeof(int8_t);
+    if constexpr (metric == MetricType::METRIC_TYPE_COSINE) {
+        this->code_size_ += sizeof(float);
+    }
+    this->query_code_size_ = this->code_size_;
+    this->metric_ = metric;
+}
+
+template <MetricType metric>
+INT8Quantizer<metric>::INT8Quantizer(const INT8QuantizerParamPtr& param,
+                                     const IndexCommonParam& common_param)
+    : INT8Quantizer<metric>(common_param.dim_, common_param.allocator_.get()) {
+}
+
+template <MetricType metric>
+INT8Quantizer<metric>::INT8Quantizer(const QuantizerParamPtr& param,
+                                     const IndexCommonParam& common_param)
+    : INT8Quantizer<metric>(std::dynamic_pointer_cast<INT8QuantizerParameter>(param),
+                            common_param) {
+}
+
+template <MetricType metric>
+bool
+INT8Quantizer<metric>::TrainImpl(const DataType* data, uint64_t count) {
+    this->is_trained_ = true;
+    return true;
+}
+
+template <MetricType metric>
+bool
+INT8Quantizer<metric>::EncodeOneImpl(const DataType* data, uint8_t* codes) const {
+    const auto* vector = reinterpret_cast<const int8_t*>(data);
+    memcpy(codes, vector, this->dim_ * sizeof(int8_t));
+    if constexpr (metric == MetricType::METRIC_TYPE_COSINE) {
+        float norm = std::sqrt(INT8ComputeIP(vector, vector, this->dim_));
+        memcpy(codes + this->dim_ * sizeof(int8_t), &norm, sizeof(float));
+    }
+    return true;
+}
+
+template <MetricType metric>
+bool
+INT8Quantizer<metric>::EncodeBatchImpl(const DataType* data, uint8_t* codes, uint64_t count) {
+    const auto* vectors = reinterpret_cast<const int8_t*>(data);
+    for (uint64_t i = 0; i < count; ++i) {
+        this->EncodeOneImpl(reinterpret_cast<const DataType*>(vectors + i * this->dim_),
+                            codes + i * this->code_size_);
+    }
+    return true;
+}
+
+template <MetricType metric>
+bool
+INT8Quantizer<metric>::DecodeOneImpl(const uint8_t* codes, DataType* data) {
+    const auto* vector = reinterpret_cast<const int8_t*>(codes);
+    for (uint64_t d = 0; d < this->dim_; ++d) {
+        data[d] = static_cast<DataType>(vector[d]);
+    }
+    return true;
+}
+
+template <MetricType metric>
+bool
+INT8Quantizer<metric>::DecodeBatchImpl(const uint8_t* codes, DataType* data, uint64_t count) {
+    for (uint64_t i = 0; i < count; ++i) {
+        this->DecodeOneImpl(codes + i * this->code_size_, data + i * this->dim_);
+    }
+    return true;
+}
+
+template <MetricType metric>
+inline float
+INT8Quantizer<metric>::compute(const uint8_t* codes1, const uint8_t* codes2) const {
+    const auto* vector1 = reinterpret_cast<const int8_t*>(codes1);
+    const auto* vector2 = reinterpret_cast<const int8_t*>(codes2);
+    if constexpr (metric == MetricType::METRIC_TYPE_L2SQR) {
+        return INT8ComputeL2Sqr(vector1, vector2, this->dim_);
+    } else if constexpr (metric == MetricType::METRIC_TYPE_IP) {
+        return 1 - INT8ComputeIP(vector1, vector2, this->dim_);
+    } else if constexpr (metric == MetricType::METRIC_TYPE_COSINE) {
+        float norm1 = 0.0F;
+        float norm2 = 0.0F;
+        memcpy(&norm1, codes1 + this->dim_ * sizeof(int8_t), sizeof(float));
+        memcpy(&norm2, codes2 + this->dim_ * sizeof(int8_t), sizeof(float));
+        auto norm = norm1 * norm2;
+        if (norm == 0.0F) {
+            return 1.0F;
+        }
+        return 1 - INT8ComputeIP(vector1, vector2, this->dim_) / norm;
+    } else {
+        return 0.0F;
+    }
+}
+
+template <MetricType metric>
+float
+INT8Quantizer<metric>::ComputeImpl(const uint8_t* codes1, const uint8_t* codes2) {
+    return this->compute(codes1, codes2);
+}
+
+template <MetricType metric>
+void
+INT8Quantizer<metric>::ProcessQueryImpl(const DataType* query,
+                                        Computer<INT8Quantizer<metric>>& computer) const {
+    try {
+        if (computer.buf_ == nullptr) {
+            computer.buf_ =
+                reinterpret_cast<uint8_t*>(this->allocator_->Allocate(this->query_code_size_));
+        }
+        this->EncodeOneImpl(query, computer.buf_);
+    } catch (const std::bad_alloc& e) {
+        throw VsagException(ErrorType::NO_ENOUGH_MEMORY, "bad alloc when init computer buf");
+    }
+}
+
+template <MetricType metric>
+void
+INT8Quantizer<metric>::ComputeDistImpl(Computer<INT8Quantizer<metric>>& computer,
+                                       const uint8_t* codes,
+                                       float* dists) const {
+    dists[0] = this->compute(computer.buf_, codes);
+}
+
+template <MetricType metric>
+void
+INT8Quantizer<metric>::ScanBatchDistImpl(Computer<INT8Quantizer<metric>>& computer,
+                                         uint64_t count,
+                                         const uint8_t* codes,
+                                         float* dists) const {
+    for (uint64_t i = 0; i < count; ++i) {
+        dists[i] = this->compute(computer.buf_, codes + i * this->code_size_);
+    }
+}
+
+template <MetricType metric>
+void
+INT8Quantizer<metric>::ReleaseComputerImpl(Computer<INT8Quantizer<metric>>& computer) const {
+    this->allocator_->Deallocate(computer.buf_);
+}
+
+TEMPLATE_QUANTIZER(INT8Quantizer);
+}  // namespace vsag
@@ -0,0 +1,129 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "int8_quantizer.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+
+#include "fixtures.h"
+#include "impl/allocator/safe_allocator.h"
+
+using namespace vsag;
+
+const auto dims = {64, 100, 128};
+const auto counts = {10, 101};
+
+template <MetricType metric>
+void
+TestEncodeDecodeMetricINT8(uint64_t dim, int count) {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    INT8Quantizer<metric> quantizer(dim, allocator.get());
+    auto vecs = fixtures::generate_int8_codes(count, dim);
+    const auto* data = reinterpret_cast<const DataType*>(vecs.data());
+    REQUIRE(quantizer.Train(data, count));
+
+    std::vector<uint8_t> codes(quantizer.GetCodeSize() * count);
+    REQUIRE(quantizer.EncodeBatch(data, codes.data(), count));
+    std::vector<float> out_vec(dim * count);
+    REQUIRE(quantizer.DecodeBatch(codes.data(), out_vec.data(), count));
+    for (uint64_t i = 0; i < dim * count; ++i) {
+        REQUIRE(out_vec[i] == static_cast<float>(vecs[i]));
+    }
+
+    std::vector<uint8_t> one_code(quantizer.GetCodeSize());
+    for (uint64_t i = 0; i < count; ++i) {
+        REQUIRE(quantizer.EncodeOne(reinterpret_cast<const DataType*>(vecs.data() + i * dim),
+                                    one_code.data()));
+        for (uint64_t j = 0; j < quantizer.GetCodeSize(); ++j) {
+            REQUIRE(one_code[j] == codes[i * quantizer.GetCodeSize() + j]);
+        }
+    }
+}
+
+TEST_CASE("INT8 Encode and Decode", "[ut][INT8Quantizer]") {
+    for (auto dim : dims) {
+        for (auto count : counts) {
+            TestEncodeDecodeMetricINT8<MetricType::METRIC_TYPE_L2SQR>(dim, count);
+            TestEncodeDecodeMetricINT8<MetricType::METRIC_TYPE_IP>(dim, count);
+            TestEncodeDecodeMetricINT8<MetricType::METRIC_TYPE_COSINE>(dim, count);
+        }
+    }
+}
+
+template <MetricType metric>
+float
+ExpectedDistanceINT8(const int8_t* vec1, const int8_t* vec2, uint64_t dim) {
+    double ip = 0;
+    double l2 = 0;
+    double norm1 = 0;
+    double norm2 = 0;
+    for (uint64_t d = 0; d < dim; ++d) {
+        double v1 = vec1[d];
+        double v2 = vec2[d];
+        ip += v1 * v2;
+        l2 += (v1 - v2) * (v1 - v2);
+        norm1 += v1 * v1;
+        norm2 += v2 * v2;
+    }
+    if constexpr (metric == MetricType::METRIC_TYPE_L2SQR) {
+        return static_cast<float>(l2);
+    } else if constexpr (metric == MetricType::METRIC_TYPE_IP) {
+        return static_cast<float>(1 - ip);
+    } else {
+        return static_cast<float>(1 - ip / std::sqrt(norm1 * norm2));
+    }
+}
+
+template <MetricType metric>
+void
+TestComputeMetricINT8(uint64_t dim, int count) {
+    auto allocator = SafeAllocator::FactoryDefaultAllocator();
+    INT8Quantizer<metric> quantizer(dim, allocator.get());
+    auto vecs = fixtures::generate_int8_codes(count, dim);
+    auto queries = fixtures::generate_int8_codes(count, dim, 114);
+    std::vector<uint8_t> codes(quantizer.GetCodeSize() * count);
+    quantizer.EncodeBatch(reinterpret_cast<const DataType*>(vecs.data()), codes.data(), count);
+    std::vector<uint8_t> query_codes(quantizer.GetCodeSize() * count);
+    quantizer.EncodeBatch(
+        reinterpret_cast<const DataType*>(queries.data()), query_codes.data(), count);
+
+    std::vector<float> dists(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        const auto* query = queries.data() + i * dim;
+        auto computer = quantizer.FactoryComputer();
+        quantizer.ProcessQuery(reinterpret_cast<const DataType*>(query), computer);
+        quantizer.ScanBatchDists(computer, count, codes.data(), dists.data());
+        for (uint64_t j = 0; j < count; ++j) {
+            auto expected = ExpectedDistanceINT8<metric>(query, vecs.data() + j * dim, dim);
+            auto* code = codes.data() + j * quantizer.GetCodeSize();
+            REQUIRE(std::abs(dists[j] - expected) <= 1e-5 * std::max(1.0F, std::abs(expected)));
+            REQUIRE(quantizer.ComputeDist(computer, code) == dists[j]);
+            REQUIRE(quantizer.Compute(query_codes.data() + i * quantizer.GetCodeSize(), code) ==
+                    dists[j]);
+        }
+    }
+}
+
+TEST_CASE("INT8 Compute", "[ut][INT8Quantizer]") {
+    for (auto dim : dims) {
+        for (auto count : counts) {
+            TestComputeMetricINT8<MetricType::METRIC_TYPE_L2SQR>(dim, count);
+            TestComputeMetricINT8<MetricType::METRIC_TYPE_IP>(dim, count);
+            TestComputeMetricINT8<MetricType::METRIC_TYPE_COSINE>(dim, count);
+        }
+    }
+}
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 
@@ -202,14 +203,38 @@ public:
                        float& dists3,
                        float& dists4) const override {
         auto computer_ptr = std::dynamic_pointer_cast<Computer<QuantT>>(computer);
-        if constexpr (has_ComputeDistsBatch4Impl<QuantT>::value) {
-            cast().ComputeDistsBatch4Impl(
-                *computer_ptr, codes1, codes2, codes3, codes4, dists1, dists2, dists3, dists4);
+        this->compute_dists_batch4(
+            *computer_ptr, codes1, codes2, codes3, codes4, dists1, dists2, dists3, dists4);
+    }
+
+    /**
+     * @brief Compute the distances of 8 codes at once, overwriting dists[0..7].
+     *
+     * Falls back to two 4-way batches when the quantizer has no wider kernel.
+     */
+    inline void
+    ComputeDistsBatch8(ComputerInterfacePtr computer,
+                       const uint8_t* const* codes,
+                       float* dists) const override {
+        auto computer_ptr = std::dynamic_pointer_cast<Computer<QuantT>>(computer);
+        this->compute_dists_batch8(*computer_ptr, codes, dists);
+    }
+
+    /**
+     * @brief Compute the distances of 16 codes at once, overwriting dists[0..15].
+     *
+     * Falls back to two 8-way batches when the quantizer has no wider kernel.
+     */
+    inline void
+    ComputeDistsBatch16(ComputerInterfacePtr computer,
+                        const uint8_t* const* codes,
+                        float* dists) const override {
+        auto computer_ptr = std::dynamic_pointer_cast<Computer<QuantT>>(computer);
+        if constexpr (has_ComputeDistsBatch16Impl<QuantT>::value) {
+            cast().ComputeDistsBatch16Impl(*computer_ptr, codes, dists);
         } else {
-            cast().ComputeDistImpl(*computer_ptr, codes1, &dists1);
-            cast().ComputeDistImpl(*computer_ptr, codes2, &dists2);
-            cast().ComputeDistImpl(*computer_ptr, codes3, &dists3);
-            cast().ComputeDistImpl(*computer_ptr, codes4, &dists4);
+            this->compute_dists_batch8(*computer_ptr, codes, dists);
+            this->compute_dists_batch8(*computer_ptr, codes + 8, dists + 8);
         }
     }
 
@@ -265,6 +290,50 @@ public:
     }
 
 private:
+    inline void
+    compute_dists_batch4(Computer<QuantT>& computer,
+                         const uint8_t* codes1,
+                         const uint8_t* codes2,
+                         const uint8_t* codes3,
+                         const uint8_t* codes4,
+                         float& dists1,
+                         float& dists2,
+                         float& dists3,
+                         float& dists4) const {
+        if constexpr (has_ComputeDistsBatch4Impl<QuantT>::value) {
+            cast().ComputeDistsBatch4Impl(
+                computer, codes1, codes2, codes3, codes4, dists1, dists2, dists3, dists4);
+        } else {
+            cast().ComputeDistImpl(computer, codes1, &dists1);
+            cast().ComputeDistImpl(computer, codes2, &dists2);
+            cast().ComputeDistImpl(computer, codes3, &dists3);
+            cast().ComputeDistImpl(computer, codes4, &dists4);
+        }
+    }
+
+    inline void
+    compute_dists_batch8(Computer<QuantT>& computer,
+                         const uint8_t* const* codes,
+                         float* dists) const {
+        if constexpr (has_ComputeDistsBatch8Impl<QuantT>::value) {
+            cast().ComputeDistsBatch8Impl(computer, codes, dists);
+        } else {
+            // the 4-way kernels accumulate into their outputs
+            std::fill(dists, dists + 8, 0.0F);
+            for (int i = 0; i < 8; i += 4) {
+                this->compute_dists_batch4(computer,
+                                           codes[i],
+                                           codes[i + 1],
+                                           codes[i + 2],
+                                           codes[i + 3],
+                                           dists[i],
+                                           dists[i + 1],
+                                           dists[i + 2],
+                                           dists[i + 3]);
+            }
+        }
+    }
+
     inline QuantT&
     cast() {
         return static_cast<QuantT&>(*this);
@@ -297,6 +366,18 @@ private:
                                  std::declval<float&>(),
                                  std::declval<float&>(),
                                  std::declval<float&>())
+
+    GENERATE_HAS_MEMBER_FUNCTION(ComputeDistsBatch8Impl,
+                                 void,
+                                 std::declval<Computer<QuantT>&>(),
+                                 std::declval<const uint8_t* const*>(),
+                                 std::declval<float*>())
+
+    GENERATE_HAS_MEMBER_FUNCTION(ComputeDistsBatch16Impl,
+                                 void,
+                                 std::declval<Computer<QuantT>&>(),
+                                 std::declval<const uint8_t* const*>(),
+                                 std::declval<float*>())
 };
 
 #define TEMPLATE_QUANTIZER(Name)                        \
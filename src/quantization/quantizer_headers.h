@@ -16,6 +16,7 @@
 #pragma once
 
 #include "fp32_quantizer.h"
+#include "int8_quantizer.h"
 #include "product_quantization/pq_fastscan_quantizer.h"
 #include "product_quantization/product_quantizer.h"
 #include "quantizer.h"
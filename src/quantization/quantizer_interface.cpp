@@ -29,6 +29,9 @@ make_instance(const QuantizerParamPtr& param, const IndexCommonParam& common_par
     if (quantization_string == QUANTIZATION_TYPE_VALUE_FP32) {
         return std::make_shared<FP32Quantizer<metric>>(param, common_param);
     }
+    if (quantization_string == QUANTIZATION_TYPE_VALUE_INT8) {
+        return std::make_shared<INT8Quantizer<metric>>(param, common_param);
+    }
     if (quantization_string == QUANTIZATION_TYPE_VALUE_SQ4) {
         return std::make_shared<SQ4Quantizer<metric>>(param, common_param);
     }
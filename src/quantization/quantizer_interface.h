@@ -153,6 +153,16 @@ public:
                        float& dists3,
                        float& dists4) const = 0;
 
+    virtual void
+    ComputeDistsBatch8(ComputerInterfacePtr computer,
+                       const uint8_t* const* codes,
+                       float* dists) const = 0;
+
+    virtual void
+    ComputeDistsBatch16(ComputerInterfacePtr computer,
+                        const uint8_t* const* codes,
+                        float* dists) const = 0;
+
     virtual void
     ReleaseComputer(ComputerInterfacePtr computer) const = 0;
 
@@ -19,6 +19,7 @@
 
 #include "fp32_quantizer_parameter.h"
 #include "inner_string_params.h"
+#include "int8_quantizer_parameter.h"
 #include "product_quantization/pq_fastscan_quantizer_parameter.h"
 #include "product_quantization/product_quantizer_parameter.h"
 #include "rabitq_quantization/rabitq_quantizer_parameter.h"
@@ -35,6 +36,9 @@ QuantizerParameter::GetQuantizerParameterByJson(const JsonType& json) {
     if (type_name == QUANTIZATION_TYPE_VALUE_FP32) {
         quantizer_param = std::make_shared<FP32QuantizerParameter>();
         quantizer_param->FromJson(json);
+    } else if (type_name == QUANTIZATION_TYPE_VALUE_INT8) {
+        quantizer_param = std::make_shared<INT8QuantizerParameter>();
+        quantizer_param->FromJson(json);
     } else if (type_name == QUANTIZATION_TYPE_VALUE_SQ8) {
         quantizer_param = std::make_shared<SQ8QuantizerParameter>();
         quantizer_param->FromJson(json);
@@ -151,6 +151,44 @@ FP16Quantizer<metric>::ScanBatchDistImpl(Computer<FP16Quantizer<metric>>& comput
     }
 }
 
+template <MetricType metric>
+template <int BatchSize>
+void
+FP16Quantizer<metric>::compute_dists_batch(Computer<FP16Quantizer<metric>>& computer,
+                                          const uint8_t* const* codes,
+                                          float* dists) const {
+    static_assert(BatchSize == 8 or BatchSize == 16);
+    if constexpr (metric == MetricType::METRIC_TYPE_L2SQR) {
+        auto compute = BatchSize == 8 ? FP16ComputeL2SqrBatch8 : FP16ComputeL2SqrBatch16;
+        compute(computer.buf_, codes, this->dim_, dists);
+    } else if constexpr (metric == MetricType::METRIC_TYPE_IP or
+                         metric == MetricType::METRIC_TYPE_COSINE) {
+        auto compute = BatchSize == 8 ? FP16ComputeIPBatch8 : FP16ComputeIPBatch16;
+        compute(computer.buf_, codes, this->dim_, dists);
+        for (int i = 0; i < BatchSize; ++i) {
+            dists[i] = 1 - dists[i];
+        }
+    } else {
+        throw VsagException(ErrorType::INTERNAL_ERROR, "unsupported metric type");
+    }
+}
+
+template <MetricType metric>
+void
+FP16Quantizer<metric>::ComputeDistsBatch8Impl(Computer<FP16Quantizer<metric>>& computer,
+                                              const uint8_t* const* codes,
+                                              float* dists) const {
+    this->compute_dists_batch<8>(computer, codes, dists);
+}
+
+template <MetricType metric>
+void
+FP16Quantizer<metric>::ComputeDistsBatch16Impl(Computer<FP16Quantizer<metric>>& computer,
+                                               const uint8_t* const* codes,
+                                               float* dists) const {
+    this->compute_dists_batch<16>(computer, codes, dists);
+}
+
 template <MetricType metric>
 void
 FP16Quantizer<metric>::ReleaseComputerImpl(Computer<FP16Quantizer<metric>>& computer) const {
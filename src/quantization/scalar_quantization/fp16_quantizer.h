@@ -62,6 +62,16 @@ public:
                       const uint8_t* codes,
                       float* dists) const;
 
+    void
+    ComputeDistsBatch8Impl(Computer<FP16Quantizer<metric>>& computer,
+                           const uint8_t* const* codes,
+                           float* dists) const;
+
+    void
+    ComputeDistsBatch16Impl(Computer<FP16Quantizer<metric>>& computer,
+                            const uint8_t* const* codes,
+                            float* dists) const;
+
     void
     ReleaseComputerImpl(Computer<FP16Quantizer<metric>>& computer) const;
 
@@ -75,6 +85,13 @@ public:
     NameImpl() const {
         return QUANTIZATION_TYPE_VALUE_FP16;
     }
+
+private:
+    template <int BatchSize>
+    void
+    compute_dists_batch(Computer<FP16Quantizer<metric>>& computer,
+                        const uint8_t* const* codes,
+                        float* dists) const;
 };
 
 }  // namespace vsag
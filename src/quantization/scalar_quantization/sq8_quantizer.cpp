@@ -30,6 +30,8 @@ SQ8Quantizer<metric>::SQ8Quantizer(int dim, Allocator* allocator)
     this->metric_ = metric;
     this->diff_.resize(dim, 0);
     this->lower_bound_.resize(dim, std::numeric_limits<DataType>::max());
+    this->ip_func_ = SelectSQ8ComputeIP(this->dim_);
+    this->l2sqr_func_ = SelectSQ8ComputeL2Sqr(this->dim_);
 }
 
 template <MetricType metric>
@@ -162,11 +164,11 @@ SQ8Quantizer<metric>::ComputeDistImpl(Computer<SQ8Quantizer>& computer,
     auto* query = reinterpret_cast<float*>(computer.buf_);
 
     if constexpr (metric == MetricType::METRIC_TYPE_L2SQR) {
-        *dists = SQ8ComputeL2Sqr(
+        *dists = this->l2sqr_func_(
             query, codes, this->lower_bound_.data(), this->diff_.data(), this->dim_);
     } else if constexpr (metric == MetricType::METRIC_TYPE_IP or
                          metric == MetricType::METRIC_TYPE_COSINE) {
-        *dists = 1 - SQ8ComputeIP(
+        *dists = 1 - this->ip_func_(
                          query, codes, this->lower_bound_.data(), this->diff_.data(), this->dim_);
     } else {
         *dists = 0.0F;
@@ -185,6 +187,47 @@ SQ8Quantizer<metric>::ScanBatchDistImpl(Computer<SQ8Quantizer<metric>>& computer
     }
 }
 
+template <MetricType metric>
+template <int BatchSize>
+void
+SQ8Quantizer<metric>::compute_dists_batch(Computer<SQ8Quantizer<metric>>& computer,
+                                         const uint8_t* const* codes,
+                                         float* dists) const {
+    static_assert(BatchSize == 8 or BatchSize == 16);
+    const auto* query = reinterpret_cast<const float*>(computer.buf_);
+    const auto* lower_bound = this->lower_bound_.data();
+    const auto* diff = this->diff_.data();
+    if constexpr (metric == MetricType::METRIC_TYPE_L2SQR) {
+        auto compute = BatchSize == 8 ? SQ8ComputeL2SqrBatch8 : SQ8ComputeL2SqrBatch16;
+        compute(query, codes, lower_bound, diff, this->dim_, dists);
+    } else if constexpr (metric == MetricType::METRIC_TYPE_IP or
+                         metric == MetricType::METRIC_TYPE_COSINE) {
+        auto compute = BatchSize == 8 ? SQ8ComputeIPBatch8 : SQ8ComputeIPBatch16;
+        compute(query, codes, lower_bound, diff, this->dim_, dists);
+        for (int i = 0; i < BatchSize; ++i) {
+            dists[i] = 1 - dists[i];
+        }
+    } else {
+        std::fill(dists, dists + BatchSize, 0.0F);
+    }
+}
+
+template <MetricType metric>
+void
+SQ8Quantizer<metric>::ComputeDistsBatch8Impl(Computer<SQ8Quantizer<metric>>& computer,
+                                             const uint8_t* const* codes,
+                                             float* dists) const {
+    this->compute_dists_batch<8>(computer, codes, dists);
+}
+
+template <MetricType metric>
+void
+SQ8Quantizer<metric>::ComputeDistsBatch16Impl(Computer<SQ8Quantizer<metric>>& computer,
+                                              const uint8_t* const* codes,
+                                              float* dists) const {
+    this->compute_dists_batch<16>(computer, codes, dists);
+}
+
 template <MetricType metric>
 void
 SQ8Quantizer<metric>::SerializeImpl(StreamWriter& writer) {
@@ -18,6 +18,7 @@
 #include "index/index_common_param.h"
 #include "inner_string_params.h"
 #include "quantization/quantizer.h"
+#include "simd/sq8_simd.h"
 #include "sq8_quantizer_parameter.h"
 
 namespace vsag {
@@ -63,6 +64,16 @@ public:
                       const uint8_t* codes,
                       float* dists) const;
 
+    void
+    ComputeDistsBatch8Impl(Computer<SQ8Quantizer<metric>>& computer,
+                           const uint8_t* const* codes,
+                           float* dists) const;
+
+    void
+    ComputeDistsBatch16Impl(Computer<SQ8Quantizer<metric>>& computer,
+                            const uint8_t* const* codes,
+                            float* dists) const;
+
     void
     SerializeImpl(StreamWriter& writer);
 
@@ -80,6 +91,17 @@ public:
 public:
     Vector<DataType> diff_;
     Vector<DataType> lower_bound_;
+
+private:
+    template <int BatchSize>
+    void
+    compute_dists_batch(Computer<SQ8Quantizer<metric>>& computer,
+                        const uint8_t* const* codes,
+                        float* dists) const;
+
+    // picked once by dim, the specialized kernel if the dim is one of FIXED_DIMS
+    SQ8ComputeType ip_func_{nullptr};
+    SQ8ComputeType l2sqr_func_{nullptr};
 };
 
 }  // namespace vsag
@@ -20,6 +20,7 @@
 
 #include "algorithm/sindi/sindi_parameter.h"
 #include "metric_type.h"
+#include "simd/sparse_simd.h"
 #include "utils/sparse_vector_transform.h"
 
 namespace vsag {
@@ -36,6 +37,7 @@ public:
         : sorted_query_(allocator),
           query_retain_ratio_(1.0F - search_param.query_prune_ratio),
           term_retain_ratio_(1.0F - search_param.term_prune_ratio),
+          use_block_max_(search_param.use_block_max),
           raw_query_(sparse_query) {
         sort_sparse_vector(sparse_query, sorted_query_);
 
@@ -80,9 +82,20 @@ public:
         //  __builtin_prefetch(term_datas + term_count / 2, 0, 3);
         //  __builtin_prefetch(global_dists + term_ids[term_count / 2], 0, 3);
 
-        for (auto i = 0; i < term_count; i++) {
-            global_dists[term_ids[i]] += query_val * term_datas[i];
-        }
+        SparseAccumulate(query_val, term_ids, term_datas, term_count, global_dists);
+    }
+
+    inline void
+    ScanForAccumulateSQ8(uint32_t term_iterator,
+                         const uint32_t* term_ids,
+                         const uint8_t* term_codes,
+                         float lower_bound,
+                         float diff,
+                         uint32_t term_count,
+                         float* global_dists) {
+        float query_val = sorted_query_[term_iterator].second;
+        SparseAccumulateSQ8(
+            query_val, term_ids, term_codes, lower_bound, diff, term_count, global_dists);
     }
 
     inline bool
@@ -105,6 +118,11 @@ public:
         return sorted_query_[term_iterator].first;
     }
 
+    float
+    GetValue(uint32_t term_iterator) {
+        return sorted_query_[term_iterator].second;
+    }
+
 public:
     Vector<std::pair<uint32_t, float>> sorted_query_;
 
@@ -114,6 +132,8 @@ public:
 
     float term_retain_ratio_{0.0F};
 
+    bool use_block_max_{false};
+
     uint32_t pruned_len_{0};
 
     uint32_t term_iterator_{0};
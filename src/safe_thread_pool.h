@@ -59,14 +59,27 @@ public:
     std::future<void>
     Enqueue(std::function<void(void)> task) override {
         auto func_wrapper = [task = std::move(task)]() {
+            ++worker_depth();
             try {
                 task();
             } catch (std::exception& e) {
                 logger::error("error in thread pool: " + std::string(e.what()));
             }
+            --worker_depth();
         };
         return pool_->Enqueue(func_wrapper);
     }
+
+    /**
+     * @brief Checks if the calling thread runs a task of a SafeThreadPool.
+     *
+     * A task which enqueues sub-tasks and blocks on them deadlocks once every worker of the
+     * pool does the same, so such a task runs its sub-tasks inline when this returns true.
+     */
+    static bool
+    InWorkerThread() {
+        return worker_depth() > 0;
+    }
     void
     WaitUntilEmpty() override {
         pool_->WaitUntilEmpty();
@@ -80,6 +93,13 @@ public:
         pool_->SetPoolSize(limit);
     }
 
+private:
+    static uint32_t&
+    worker_depth() {
+        thread_local uint32_t depth = 0;
+        return depth;
+    }
+
 private:
     ThreadPool* pool_{nullptr};
     std::shared_ptr<ThreadPool> pool_ptr_{nullptr};
@@ -20,6 +20,7 @@
 #include <cmath>
 #include <cstdint>
 
+#include "fixed_dim.h"
 #include "simd.h"
 
 #define PORTABLE_ALIGN32 __attribute__((aligned(32)))
@@ -279,6 +280,46 @@ FP32ComputeL2SqrBatch4(const float* RESTRICT query,
 #endif
 }
 
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP32ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP32ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP32ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP32ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
 void
 FP32Sub(const float* x, const float* y, float* z, uint64_t dim) {
 #if defined(ENABLE_AVX)
@@ -527,6 +568,46 @@ FP16ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, u
 #endif
 }
 
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP16ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP16ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP16ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP16ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
 #if defined(ENABLE_AVX)
@@ -537,6 +618,12 @@ INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uin
 #endif
 }
 
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
+    // AVX has no 256 bit integer arithmetic
+    return sse::INT8ComputeIP(query, codes, dim);
+}
+
 float
 SQ8ComputeIP(const float* RESTRICT query,
              const uint8_t* RESTRICT codes,
@@ -622,6 +709,54 @@ SQ8ComputeL2Sqr(const float* RESTRICT query,
 #endif
 }
 
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = SQ8ComputeIP(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = SQ8ComputeL2Sqr(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = SQ8ComputeIP(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = SQ8ComputeL2Sqr(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
 float
 SQ8ComputeCodesIP(const uint8_t* RESTRICT codes1,
                   const uint8_t* RESTRICT codes2,
@@ -1039,4 +1174,116 @@ KacsWalk(float* data, size_t len) {
     return sse::FHTRotate(data, len);
 #endif
 }
+
+void
+SparseAccumulate(float query_val,
+                 const uint32_t* RESTRICT ids,
+                 const float* RESTRICT datas,
+                 uint32_t count,
+                 float* RESTRICT dists) {
+    sse::SparseAccumulate(query_val, ids, datas, count, dists);
+}
+
+void
+SparseAccumulateSQ8(float query_val,
+                    const uint32_t* RESTRICT ids,
+                    const uint8_t* RESTRICT codes,
+                    float lower_bound,
+                    float diff,
+                    uint32_t count,
+                    float* RESTRICT dists) {
+    sse::SparseAccumulateSQ8(query_val, ids, codes, lower_bound, diff, count, dists);
+}
+
+#if defined(ENABLE_AVX)
+__inline float __attribute__((__always_inline__)) reduce_add_256(__m256 sum) {
+    __m128 sum128 = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+    sum128 = _mm_hadd_ps(sum128, sum128);
+    sum128 = _mm_hadd_ps(sum128, sum128);
+    return _mm_cvtss_f32(sum128);
+}
+
+template <uint64_t Dim>
+static float
+fp32_compute_ip_fixed_dim(const float* RESTRICT query,
+                          const float* RESTRICT codes,
+                          uint64_t /*dim*/) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+    for (uint64_t i = 0; i < Dim; i += 32) {
+        __m256 prod0 = _mm256_mul_ps(_mm256_loadu_ps(query + i), _mm256_loadu_ps(codes + i));
+        __m256 prod1 =
+            _mm256_mul_ps(_mm256_loadu_ps(query + i + 8), _mm256_loadu_ps(codes + i + 8));
+        __m256 prod2 =
+            _mm256_mul_ps(_mm256_loadu_ps(query + i + 16), _mm256_loadu_ps(codes + i + 16));
+        __m256 prod3 =
+            _mm256_mul_ps(_mm256_loadu_ps(query + i + 24), _mm256_loadu_ps(codes + i + 24));
+        sum0 = _mm256_add_ps(sum0, prod0);
+        sum1 = _mm256_add_ps(sum1, prod1);
+        sum2 = _mm256_add_ps(sum2, prod2);
+        sum3 = _mm256_add_ps(sum3, prod3);
+    }
+    return reduce_add_256(_mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3)));
+}
+
+template <uint64_t Dim>
+static float
+fp32_compute_l2sqr_fixed_dim(const float* RESTRICT query,
+                             const float* RESTRICT codes,
+                             uint64_t /*dim*/) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+    for (uint64_t i = 0; i < Dim; i += 32) {
+        __m256 diff0 = _mm256_sub_ps(_mm256_loadu_ps(query + i), _mm256_loadu_ps(codes + i));
+        __m256 diff1 =
+            _mm256_sub_ps(_mm256_loadu_ps(query + i + 8), _mm256_loadu_ps(codes + i + 8));
+        __m256 diff2 =
+            _mm256_sub_ps(_mm256_loadu_ps(query + i + 16), _mm256_loadu_ps(codes + i + 16));
+        __m256 diff3 =
+            _mm256_sub_ps(_mm256_loadu_ps(query + i + 24), _mm256_loadu_ps(codes + i + 24));
+        sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(diff0, diff0));
+        sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(diff1, diff1));
+        sum2 = _mm256_add_ps(sum2, _mm256_mul_ps(diff2, diff2));
+        sum3 = _mm256_add_ps(sum3, _mm256_mul_ps(diff3, diff3));
+    }
+    return reduce_add_256(_mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3)));
+}
+#endif
+
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim) {
+#if defined(ENABLE_AVX)
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_ip_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return sse::FP32ComputeIPFixedDim(dim);
+#endif
+}
+
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim) {
+#if defined(ENABLE_AVX)
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_l2sqr_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return sse::FP32ComputeL2SqrFixedDim(dim);
+#endif
+}
+
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim) {
+    return sse::SQ8ComputeIPFixedDim(dim);
+}
+
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim) {
+    return sse::SQ8ComputeL2SqrFixedDim(dim);
+}
+
 }  // namespace vsag::avx
@@ -20,6 +20,7 @@
 #include <cmath>
 #include <cstdint>
 
+#include "fixed_dim.h"
 #include "simd.h"
 
 #define PORTABLE_ALIGN32 __attribute__((aligned(32)))
@@ -273,6 +274,101 @@ FP32ComputeL2SqrBatch4(const float* RESTRICT query,
 #endif
 }
 
+#if defined(ENABLE_AVX2)
+__inline float __attribute__((__always_inline__)) reduce_add_256(__m256 sum) {
+    __m128 sum128 = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+    sum128 = _mm_hadd_ps(sum128, sum128);
+    sum128 = _mm_hadd_ps(sum128, sum128);
+    return _mm_cvtss_f32(sum128);
+}
+
+// one accumulator per code, so every query lane is loaded once for the whole batch
+template <int N, bool IsIP>
+__inline void __attribute__((__always_inline__))
+fp32_compute_batch(const float* RESTRICT query,
+                   uint64_t dim,
+                   const float* const* codes,
+                   float* results) {
+    __m256 sum[N];
+    for (int j = 0; j < N; ++j) {
+        sum[j] = _mm256_setzero_ps();
+    }
+    uint64_t i = 0;
+    for (; i + 7 < dim; i += 8) {
+        __m256 q = _mm256_loadu_ps(query + i);
+        for (int j = 0; j < N; ++j) {
+            __m256 code = _mm256_loadu_ps(codes[j] + i);
+            if constexpr (IsIP) {
+                sum[j] = _mm256_fmadd_ps(q, code, sum[j]);
+            } else {
+                __m256 delta = _mm256_sub_ps(q, code);
+                sum[j] = _mm256_fmadd_ps(delta, delta, sum[j]);
+            }
+        }
+    }
+    for (int j = 0; j < N; ++j) {
+        results[j] = reduce_add_256(sum[j]);
+        if constexpr (IsIP) {
+            results[j] += avx::FP32ComputeIP(query + i, codes[j] + i, dim - i);
+        } else {
+            results[j] += avx::FP32ComputeL2Sqr(query + i, codes[j] + i, dim - i);
+        }
+    }
+}
+#endif
+
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results) {
+#if defined(ENABLE_AVX2)
+    fp32_compute_batch<8, true>(query, dim, codes, results);
+#else
+    avx::FP32ComputeIPBatch8(query, dim, codes, results);
+#endif
+}
+
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results) {
+#if defined(ENABLE_AVX2)
+    fp32_compute_batch<8, false>(query, dim, codes, results);
+#else
+    avx::FP32ComputeL2SqrBatch8(query, dim, codes, results);
+#endif
+}
+
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results) {
+#if defined(ENABLE_AVX2)
+    // sixteen ymm accumulators would spill, so the batch runs as two 8-way halves
+    fp32_compute_batch<8, true>(query, dim, codes, results);
+    fp32_compute_batch<8, true>(query, dim, codes + 8, results + 8);
+#else
+    avx::FP32ComputeIPBatch16(query, dim, codes, results);
+#endif
+}
+
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results) {
+#if defined(ENABLE_AVX2)
+    // sixteen ymm accumulators would spill, so the batch runs as two 8-way halves
+    fp32_compute_batch<8, false>(query, dim, codes, results);
+    fp32_compute_batch<8, false>(query, dim, codes + 8, results + 8);
+#else
+    avx::FP32ComputeL2SqrBatch16(query, dim, codes, results);
+#endif
+}
+
 void
 FP32Sub(const float* x, const float* y, float* z, uint64_t dim) {
 #if defined(ENABLE_AVX2)
@@ -503,6 +599,98 @@ FP16ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, u
 #endif
 }
 
+#if defined(ENABLE_AVX2)
+template <int N, bool IsIP>
+__inline void __attribute__((__always_inline__))
+fp16_compute_batch(const uint8_t* RESTRICT query,
+                   const uint8_t* const* codes,
+                   uint64_t dim,
+                   float* results) {
+    const auto* query_fp16 = reinterpret_cast<const uint16_t*>(query);
+    __m256 sum[N];
+    for (int j = 0; j < N; ++j) {
+        sum[j] = _mm256_setzero_ps();
+    }
+    uint64_t i = 0;
+    for (; i + 7 < dim; i += 8) {
+        // the query is converted once and shared by all codes in the batch
+        __m128i query_load = _mm_loadu_si128(reinterpret_cast<const __m128i*>(query_fp16 + i));
+        __m256 q = _mm256_cvtph_ps(query_load);
+        for (int j = 0; j < N; ++j) {
+            const auto* code_fp16 = reinterpret_cast<const uint16_t*>(codes[j]);
+            __m128i code_load = _mm_loadu_si128(reinterpret_cast<const __m128i*>(code_fp16 + i));
+            __m256 code = _mm256_cvtph_ps(code_load);
+            if constexpr (IsIP) {
+                sum[j] = _mm256_fmadd_ps(q, code, sum[j]);
+            } else {
+                __m256 delta = _mm256_sub_ps(q, code);
+                sum[j] = _mm256_fmadd_ps(delta, delta, sum[j]);
+            }
+        }
+    }
+    for (int j = 0; j < N; ++j) {
+        results[j] = reduce_add_256(sum[j]);
+        if constexpr (IsIP) {
+            results[j] += avx::FP16ComputeIP(query + i * 2, codes[j] + i * 2, dim - i);
+        } else {
+            results[j] += avx::FP16ComputeL2Sqr(query + i * 2, codes[j] + i * 2, dim - i);
+        }
+    }
+}
+#endif
+
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results) {
+#if defined(ENABLE_AVX2)
+    fp16_compute_batch<8, true>(query, codes, dim, results);
+#else
+    avx::FP16ComputeIPBatch8(query, codes, dim, results);
+#endif
+}
+
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results) {
+#if defined(ENABLE_AVX2)
+    fp16_compute_batch<8, false>(query, codes, dim, results);
+#else
+    avx::FP16ComputeL2SqrBatch8(query, codes, dim, results);
+#endif
+}
+
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results) {
+#if defined(ENABLE_AVX2)
+    // sixteen ymm accumulators would spill, so the batch runs as two 8-way halves
+    fp16_compute_batch<8, true>(query, codes, dim, results);
+    fp16_compute_batch<8, true>(query, codes + 8, dim, results + 8);
+#else
+    avx::FP16ComputeIPBatch16(query, codes, dim, results);
+#endif
+}
+
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results) {
+#if defined(ENABLE_AVX2)
+    // sixteen ymm accumulators would spill, so the batch runs as two 8-way halves
+    fp16_compute_batch<8, false>(query, codes, dim, results);
+    fp16_compute_batch<8, false>(query, codes + 8, dim, results + 8);
+#else
+    avx::FP16ComputeL2SqrBatch16(query, codes, dim, results);
+#endif
+}
+
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
 #if defined(ENABLE_AVX2)
@@ -547,6 +735,46 @@ INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uin
 #endif
 }
 
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX2)
+    constexpr int64_t BATCH_SIZE{16};
+
+    const uint64_t n = dim / BATCH_SIZE;
+
+    if (n == 0) {
+        return avx::INT8ComputeIP(query, codes, dim);
+    }
+
+    __m256i sum = _mm256_setzero_si256();
+
+    for (uint64_t i = 0; i < n; ++i) {
+        __m128i q = _mm_loadu_si128(reinterpret_cast<const __m128i*>(query + BATCH_SIZE * i));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + BATCH_SIZE * i));
+
+        __m256i q_int16 = _mm256_cvtepi8_epi16(q);
+        __m256i c_int16 = _mm256_cvtepi8_epi16(c);
+
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(q_int16, c_int16));
+    }
+
+    alignas(32) int32_t result[BATCH_SIZE / 2];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(result), sum);
+
+    int32_t ip = 0;
+    for (int i = 0; i < BATCH_SIZE / 2; ++i) {
+        ip += result[i];
+    }
+
+    ip += static_cast<int32_t>(
+        avx::INT8ComputeIP(query + BATCH_SIZE * n, codes + BATCH_SIZE * n, dim - BATCH_SIZE * n));
+
+    return static_cast<float>(ip);
+#else
+    return avx::INT8ComputeIP(query, codes, dim);
+#endif
+}
+
 float
 SQ8ComputeIP(const float* RESTRICT query,
              const uint8_t* RESTRICT codes,
@@ -632,6 +860,111 @@ SQ8ComputeL2Sqr(const float* RESTRICT query,
 #endif
 }
 
+#if defined(ENABLE_AVX2)
+template <int N, bool IsIP>
+__inline void __attribute__((__always_inline__))
+sq8_compute_batch(const float* RESTRICT query,
+                  const uint8_t* const* codes,
+                  const float* RESTRICT lower_bound,
+                  const float* RESTRICT diff,
+                  uint64_t dim,
+                  float* results) {
+    const __m256 scale = _mm256_set1_ps(1.0F / 255.0F);
+    __m256 sum[N];
+    for (int j = 0; j < N; ++j) {
+        sum[j] = _mm256_setzero_ps();
+    }
+    uint64_t i = 0;
+    for (; i + 7 < dim; i += 8) {
+        // query, diff and lower bound are loaded once and shared by all codes in the batch
+        __m256 q = _mm256_loadu_ps(query + i);
+        __m256 diff_values = _mm256_loadu_ps(diff + i);
+        __m256 lower_bound_values = _mm256_loadu_ps(lower_bound + i);
+        for (int j = 0; j < N; ++j) {
+            __m256i code_values = _mm256_cvtepu8_epi32(load_8_char(codes[j] + i));
+            __m256 normalized = _mm256_mul_ps(_mm256_cvtepi32_ps(code_values), scale);
+            __m256 code = _mm256_fmadd_ps(normalized, diff_values, lower_bound_values);
+            if constexpr (IsIP) {
+                sum[j] = _mm256_fmadd_ps(q, code, sum[j]);
+            } else {
+                __m256 delta = _mm256_sub_ps(q, code);
+                sum[j] = _mm256_fmadd_ps(delta, delta, sum[j]);
+            }
+        }
+    }
+    for (int j = 0; j < N; ++j) {
+        results[j] = reduce_add_256(sum[j]);
+        if constexpr (IsIP) {
+            results[j] += avx::SQ8ComputeIP(
+                query + i, codes[j] + i, lower_bound + i, diff + i, dim - i);
+        } else {
+            results[j] += avx::SQ8ComputeL2Sqr(
+                query + i, codes[j] + i, lower_bound + i, diff + i, dim - i);
+        }
+    }
+}
+#endif
+
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results) {
+#if defined(ENABLE_AVX2)
+    sq8_compute_batch<8, true>(query, codes, lower_bound, diff, dim, results);
+#else
+    avx::SQ8ComputeIPBatch8(query, codes, lower_bound, diff, dim, results);
+#endif
+}
+
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results) {
+#if defined(ENABLE_AVX2)
+    sq8_compute_batch<8, false>(query, codes, lower_bound, diff, dim, results);
+#else
+    avx::SQ8ComputeL2SqrBatch8(query, codes, lower_bound, diff, dim, results);
+#endif
+}
+
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results) {
+#if defined(ENABLE_AVX2)
+    // sixteen ymm accumulators would spill, so the batch runs as two 8-way halves
+    sq8_compute_batch<8, true>(query, codes, lower_bound, diff, dim, results);
+    sq8_compute_batch<8, true>(query, codes + 8, lower_bound, diff, dim, results + 8);
+#else
+    avx::SQ8ComputeIPBatch16(query, codes, lower_bound, diff, dim, results);
+#endif
+}
+
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results) {
+#if defined(ENABLE_AVX2)
+    // sixteen ymm accumulators would spill, so the batch runs as two 8-way halves
+    sq8_compute_batch<8, false>(query, codes, lower_bound, diff, dim, results);
+    sq8_compute_batch<8, false>(query, codes + 8, lower_bound, diff, dim, results + 8);
+#else
+    avx::SQ8ComputeL2SqrBatch16(query, codes, lower_bound, diff, dim, results);
+#endif
+}
+
 float
 SQ8ComputeCodesIP(const uint8_t* RESTRICT codes1,
                   const uint8_t* RESTRICT codes2,
@@ -1122,4 +1455,212 @@ KacsWalk(float* data, size_t len) {
     return avx::KacsWalk(data, len);
 #endif
 }
+
+void
+SparseAccumulate(float query_val,
+                 const uint32_t* RESTRICT ids,
+                 const float* RESTRICT datas,
+                 uint32_t count,
+                 float* RESTRICT dists) {
+#if defined(ENABLE_AVX2)
+    // avx2 has no scatter, the gathered and updated lanes are stored back one by one
+    const __m256 query = _mm256_set1_ps(query_val);
+    alignas(32) float sums[8];
+    uint32_t i = 0;
+    for (; i + 7 < count; i += 8) {
+        __m256i id_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids + i));
+        __m256 dist_vec = _mm256_i32gather_ps(dists, id_vec, 4);
+        __m256 data_vec = _mm256_loadu_ps(datas + i);
+        _mm256_store_ps(sums, _mm256_fmadd_ps(query, data_vec, dist_vec));
+        for (uint32_t j = 0; j < 8; ++j) {
+            dists[ids[i + j]] = sums[j];
+        }
+    }
+    if (i < count) {
+        generic::SparseAccumulate(query_val, ids + i, datas + i, count - i, dists);
+    }
+#else
+    avx::SparseAccumulate(query_val, ids, datas, count, dists);
+#endif
+}
+
+void
+SparseAccumulateSQ8(float query_val,
+                    const uint32_t* RESTRICT ids,
+                    const uint8_t* RESTRICT codes,
+                    float lower_bound,
+                    float diff,
+                    uint32_t count,
+                    float* RESTRICT dists) {
+#if defined(ENABLE_AVX2)
+    const __m256 bias = _mm256_set1_ps(query_val * lower_bound);
+    const __m256 scale = _mm256_set1_ps(query_val * diff / 255.0F);
+    alignas(32) float sums[8];
+    uint32_t i = 0;
+    for (; i + 7 < count; i += 8) {
+        __m256i id_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids + i));
+        __m256 dist_vec = _mm256_i32gather_ps(dists, id_vec, 4);
+        __m128i code_vec = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(codes + i));
+        __m256 weight_vec = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(code_vec));
+        dist_vec = _mm256_add_ps(dist_vec, _mm256_fmadd_ps(scale, weight_vec, bias));
+        _mm256_store_ps(sums, dist_vec);
+        for (uint32_t j = 0; j < 8; ++j) {
+            dists[ids[i + j]] = sums[j];
+        }
+    }
+    if (i < count) {
+        generic::SparseAccumulateSQ8(
+            query_val, ids + i, codes + i, lower_bound, diff, count - i, dists);
+    }
+#else
+    avx::SparseAccumulateSQ8(query_val, ids, codes, lower_bound, diff, count, dists);
+#endif
+}
+
+#if defined(ENABLE_AVX2)
+template <uint64_t Dim>
+static float
+fp32_compute_ip_fixed_dim(const float* RESTRICT query,
+                          const float* RESTRICT codes,
+                          uint64_t /*dim*/) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+    for (uint64_t i = 0; i < Dim; i += 32) {
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(query + i), _mm256_loadu_ps(codes + i), sum0);
+        sum1 =
+            _mm256_fmadd_ps(_mm256_loadu_ps(query + i + 8), _mm256_loadu_ps(codes + i + 8), sum1);
+        sum2 =
+            _mm256_fmadd_ps(_mm256_loadu_ps(query + i + 16), _mm256_loadu_ps(codes + i + 16), sum2);
+        sum3 =
+            _mm256_fmadd_ps(_mm256_loadu_ps(query + i + 24), _mm256_loadu_ps(codes + i + 24), sum3);
+    }
+    return reduce_add_256(_mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3)));
+}
+
+template <uint64_t Dim>
+static float
+fp32_compute_l2sqr_fixed_dim(const float* RESTRICT query,
+                             const float* RESTRICT codes,
+                             uint64_t /*dim*/) {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+    for (uint64_t i = 0; i < Dim; i += 32) {
+        __m256 diff0 = _mm256_sub_ps(_mm256_loadu_ps(query + i), _mm256_loadu_ps(codes + i));
+        __m256 diff1 =
+            _mm256_sub_ps(_mm256_loadu_ps(query + i + 8), _mm256_loadu_ps(codes + i + 8));
+        __m256 diff2 =
+            _mm256_sub_ps(_mm256_loadu_ps(query + i + 16), _mm256_loadu_ps(codes + i + 16));
+        __m256 diff3 =
+            _mm256_sub_ps(_mm256_loadu_ps(query + i + 24), _mm256_loadu_ps(codes + i + 24));
+        sum0 = _mm256_fmadd_ps(diff0, diff0, sum0);
+        sum1 = _mm256_fmadd_ps(diff1, diff1, sum1);
+        sum2 = _mm256_fmadd_ps(diff2, diff2, sum2);
+        sum3 = _mm256_fmadd_ps(diff3, diff3, sum3);
+    }
+    return reduce_add_256(_mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3)));
+}
+#endif
+
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim) {
+#if defined(ENABLE_AVX2)
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_ip_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return avx::FP32ComputeIPFixedDim(dim);
+#endif
+}
+
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim) {
+#if defined(ENABLE_AVX2)
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_l2sqr_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return avx::FP32ComputeL2SqrFixedDim(dim);
+#endif
+}
+
+#if defined(ENABLE_AVX2)
+template <uint64_t Dim>
+static float
+sq8_compute_ip_fixed_dim(const float* RESTRICT query,
+                         const uint8_t* RESTRICT codes,
+                         const float* RESTRICT lower_bound,
+                         const float* RESTRICT diff,
+                         uint64_t /*dim*/) {
+    const __m256 scale = _mm256_set1_ps(1.0f / 255.0f);
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    for (uint64_t i = 0; i < Dim; i += 16) {
+        __m256 codes0 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(load_8_char(codes + i)));
+        __m256 codes1 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(load_8_char(codes + i + 8)));
+        __m256 adjusted0 = _mm256_fmadd_ps(_mm256_mul_ps(codes0, scale),
+                                           _mm256_loadu_ps(diff + i),
+                                           _mm256_loadu_ps(lower_bound + i));
+        __m256 adjusted1 = _mm256_fmadd_ps(_mm256_mul_ps(codes1, scale),
+                                           _mm256_loadu_ps(diff + i + 8),
+                                           _mm256_loadu_ps(lower_bound + i + 8));
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(query + i), adjusted0, sum0);
+        sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(query + i + 8), adjusted1, sum1);
+    }
+    return reduce_add_256(_mm256_add_ps(sum0, sum1));
+}
+
+template <uint64_t Dim>
+static float
+sq8_compute_l2sqr_fixed_dim(const float* RESTRICT query,
+                            const uint8_t* RESTRICT codes,
+                            const float* RESTRICT lower_bound,
+                            const float* RESTRICT diff,
+                            uint64_t /*dim*/) {
+    const __m256 scale = _mm256_set1_ps(1.0f / 255.0f);
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    for (uint64_t i = 0; i < Dim; i += 16) {
+        __m256 codes0 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(load_8_char(codes + i)));
+        __m256 codes1 = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(load_8_char(codes + i + 8)));
+        __m256 adjusted0 = _mm256_fmadd_ps(_mm256_mul_ps(codes0, scale),
+                                           _mm256_loadu_ps(diff + i),
+                                           _mm256_loadu_ps(lower_bound + i));
+        __m256 adjusted1 = _mm256_fmadd_ps(_mm256_mul_ps(codes1, scale),
+                                           _mm256_loadu_ps(diff + i + 8),
+                                           _mm256_loadu_ps(lower_bound + i + 8));
+        __m256 dist0 = _mm256_sub_ps(_mm256_loadu_ps(query + i), adjusted0);
+        __m256 dist1 = _mm256_sub_ps(_mm256_loadu_ps(query + i + 8), adjusted1);
+        sum0 = _mm256_fmadd_ps(dist0, dist0, sum0);
+        sum1 = _mm256_fmadd_ps(dist1, dist1, sum1);
+    }
+    return reduce_add_256(_mm256_add_ps(sum0, sum1));
+}
+#endif
+
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim) {
+#if defined(ENABLE_AVX2)
+    return SelectFixedDimKernel<SQ8ComputeType>(dim, [](auto fixed_dim) -> SQ8ComputeType {
+        return sq8_compute_ip_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return avx::SQ8ComputeIPFixedDim(dim);
+#endif
+}
+
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim) {
+#if defined(ENABLE_AVX2)
+    return SelectFixedDimKernel<SQ8ComputeType>(dim, [](auto fixed_dim) -> SQ8ComputeType {
+        return sq8_compute_l2sqr_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return avx::SQ8ComputeL2SqrFixedDim(dim);
+#endif
+}
+
 }  // namespace vsag::avx2
@@ -18,6 +18,7 @@
 
 #include <cmath>
 
+#include "fixed_dim.h"
 #include "simd.h"
 
 #define PORTABLE_ALIGN32 __attribute__((aligned(32)))
@@ -316,6 +317,90 @@ FP32ComputeL2SqrBatch4(const float* RESTRICT query,
 #endif
 }
 
+#if defined(ENABLE_AVX512)
+// one accumulator per code, so every query lane is loaded once for the whole batch
+template <int N, bool IsIP>
+__inline void __attribute__((__always_inline__))
+fp32_compute_batch(const float* RESTRICT query,
+                   uint64_t dim,
+                   const float* const* codes,
+                   float* results) {
+    __m512 sum[N];
+    for (int j = 0; j < N; ++j) {
+        sum[j] = _mm512_setzero_ps();
+    }
+    uint64_t i = 0;
+    for (; i + 15 < dim; i += 16) {
+        __m512 q = _mm512_loadu_ps(query + i);
+        for (int j = 0; j < N; ++j) {
+            __m512 code = _mm512_loadu_ps(codes[j] + i);
+            if constexpr (IsIP) {
+                sum[j] = _mm512_fmadd_ps(q, code, sum[j]);
+            } else {
+                __m512 delta = _mm512_sub_ps(q, code);
+                sum[j] = _mm512_fmadd_ps(delta, delta, sum[j]);
+            }
+        }
+    }
+    for (int j = 0; j < N; ++j) {
+        results[j] = _mm512_reduce_add_ps(sum[j]);
+        if constexpr (IsIP) {
+            results[j] += avx2::FP32ComputeIP(query + i, codes[j] + i, dim - i);
+        } else {
+            results[j] += avx2::FP32ComputeL2Sqr(query + i, codes[j] + i, dim - i);
+        }
+    }
+}
+#endif
+
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results) {
+#if defined(ENABLE_AVX512)
+    fp32_compute_batch<8, true>(query, dim, codes, results);
+#else
+    avx2::FP32ComputeIPBatch8(query, dim, codes, results);
+#endif
+}
+
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results) {
+#if defined(ENABLE_AVX512)
+    fp32_compute_batch<8, false>(query, dim, codes, results);
+#else
+    avx2::FP32ComputeL2SqrBatch8(query, dim, codes, results);
+#endif
+}
+
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results) {
+#if defined(ENABLE_AVX512)
+    fp32_compute_batch<16, true>(query, dim, codes, results);
+#else
+    avx2::FP32ComputeIPBatch16(query, dim, codes, results);
+#endif
+}
+
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results) {
+#if defined(ENABLE_AVX512)
+    fp32_compute_batch<16, false>(query, dim, codes, results);
+#else
+    avx2::FP32ComputeL2SqrBatch16(query, dim, codes, results);
+#endif
+}
+
 void
 FP32Sub(const float* x, const float* y, float* z, uint64_t dim) {
 #if defined(ENABLE_AVX512)
@@ -457,6 +542,39 @@ INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uin
 #endif
 }
 
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX512)
+    constexpr int64_t BATCH_SIZE{32};
+
+    const uint64_t n = dim / BATCH_SIZE;
+
+    if (n == 0) {
+        return avx2::INT8ComputeIP(query, codes, dim);
+    }
+
+    __m512i sum = _mm512_setzero_si512();
+
+    for (uint64_t i = 0; i < n; ++i) {
+        __m256i q = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(query + BATCH_SIZE * i));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + BATCH_SIZE * i));
+
+        __m512i q_int16 = _mm512_cvtepi8_epi16(q);
+        __m512i c_int16 = _mm512_cvtepi8_epi16(c);
+
+        sum = _mm512_add_epi32(sum, _mm512_madd_epi16(q_int16, c_int16));
+    }
+
+    int32_t ip = _mm512_reduce_add_epi32(sum);
+    ip += static_cast<int32_t>(avx2::INT8ComputeIP(
+        query + BATCH_SIZE * n, codes + BATCH_SIZE * n, dim - BATCH_SIZE * n));
+
+    return static_cast<float>(ip);
+#else
+    return avx2::INT8ComputeIP(query, codes, dim);
+#endif
+}
+
 float
 BF16ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
 #if defined(ENABLE_AVX512)
@@ -583,6 +701,94 @@ FP16ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, u
 #endif
 }
 
+#if defined(ENABLE_AVX512)
+template <int N, bool IsIP>
+__inline void __attribute__((__always_inline__))
+fp16_compute_batch(const uint8_t* RESTRICT query,
+                   const uint8_t* const* codes,
+                   uint64_t dim,
+                   float* results) {
+    const auto* query_fp16 = reinterpret_cast<const uint16_t*>(query);
+    __m512 sum[N];
+    for (int j = 0; j < N; ++j) {
+        sum[j] = _mm512_setzero_ps();
+    }
+    uint64_t i = 0;
+    for (; i + 15 < dim; i += 16) {
+        // the query is converted once and shared by all codes in the batch
+        __m256i query_load = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(query_fp16 + i));
+        __m512 q = _mm512_cvtph_ps(query_load);
+        for (int j = 0; j < N; ++j) {
+            const auto* code_fp16 = reinterpret_cast<const uint16_t*>(codes[j]);
+            __m256i code_load = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(code_fp16 + i));
+            __m512 code = _mm512_cvtph_ps(code_load);
+            if constexpr (IsIP) {
+                sum[j] = _mm512_fmadd_ps(q, code, sum[j]);
+            } else {
+                __m512 delta = _mm512_sub_ps(q, code);
+                sum[j] = _mm512_fmadd_ps(delta, delta, sum[j]);
+            }
+        }
+    }
+    for (int j = 0; j < N; ++j) {
+        results[j] = _mm512_reduce_add_ps(sum[j]);
+        if constexpr (IsIP) {
+            results[j] += avx2::FP16ComputeIP(query + i * 2, codes[j] + i * 2, dim - i);
+        } else {
+            results[j] += avx2::FP16ComputeL2Sqr(query + i * 2, codes[j] + i * 2, dim - i);
+        }
+    }
+}
+#endif
+
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results) {
+#if defined(ENABLE_AVX512)
+    fp16_compute_batch<8, true>(query, codes, dim, results);
+#else
+    avx2::FP16ComputeIPBatch8(query, codes, dim, results);
+#endif
+}
+
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results) {
+#if defined(ENABLE_AVX512)
+    fp16_compute_batch<8, false>(query, codes, dim, results);
+#else
+    avx2::FP16ComputeL2SqrBatch8(query, codes, dim, results);
+#endif
+}
+
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results) {
+#if defined(ENABLE_AVX512)
+    fp16_compute_batch<16, true>(query, codes, dim, results);
+#else
+    avx2::FP16ComputeIPBatch16(query, codes, dim, results);
+#endif
+}
+
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results) {
+#if defined(ENABLE_AVX512)
+    fp16_compute_batch<16, false>(query, codes, dim, results);
+#else
+    avx2::FP16ComputeL2SqrBatch16(query, codes, dim, results);
+#endif
+}
+
 float
 SQ8ComputeIP(const float* RESTRICT query,
              const uint8_t* RESTRICT codes,
@@ -652,6 +858,108 @@ SQ8ComputeL2Sqr(const float* RESTRICT query,
 #endif
 }
 
+#if defined(ENABLE_AVX512)
+template <int N, bool IsIP>
+__inline void __attribute__((__always_inline__))
+sq8_compute_batch(const float* RESTRICT query,
+                  const uint8_t* const* codes,
+                  const float* RESTRICT lower_bound,
+                  const float* RESTRICT diff,
+                  uint64_t dim,
+                  float* results) {
+    const __m512 scale = _mm512_set1_ps(1.0F / 255.0F);
+    __m512 sum[N];
+    for (int j = 0; j < N; ++j) {
+        sum[j] = _mm512_setzero_ps();
+    }
+    uint64_t i = 0;
+    for (; i + 15 < dim; i += 16) {
+        // query, diff and lower bound are loaded once and shared by all codes in the batch
+        __m512 q = _mm512_loadu_ps(query + i);
+        __m512 diff_values = _mm512_loadu_ps(diff + i);
+        __m512 lower_bound_values = _mm512_loadu_ps(lower_bound + i);
+        for (int j = 0; j < N; ++j) {
+            __m128i code_load = _mm_loadu_si128(reinterpret_cast<const __m128i*>(codes[j] + i));
+            __m512i code_values = _mm512_cvtepu8_epi32(code_load);
+            __m512 normalized = _mm512_mul_ps(_mm512_cvtepi32_ps(code_values), scale);
+            __m512 code = _mm512_fmadd_ps(normalized, diff_values, lower_bound_values);
+            if constexpr (IsIP) {
+                sum[j] = _mm512_fmadd_ps(q, code, sum[j]);
+            } else {
+                __m512 delta = _mm512_sub_ps(q, code);
+                sum[j] = _mm512_fmadd_ps(delta, delta, sum[j]);
+            }
+        }
+    }
+    for (int j = 0; j < N; ++j) {
+        results[j] = _mm512_reduce_add_ps(sum[j]);
+        if constexpr (IsIP) {
+            results[j] += avx2::SQ8ComputeIP(
+                query + i, codes[j] + i, lower_bound + i, diff + i, dim - i);
+        } else {
+            results[j] += avx2::SQ8ComputeL2Sqr(
+                query + i, codes[j] + i, lower_bound + i, diff + i, dim - i);
+        }
+    }
+}
+#endif
+
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results) {
+#if defined(ENABLE_AVX512)
+    sq8_compute_batch<8, true>(query, codes, lower_bound, diff, dim, results);
+#else
+    avx2::SQ8ComputeIPBatch8(query, codes, lower_bound, diff, dim, results);
+#endif
+}
+
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results) {
+#if defined(ENABLE_AVX512)
+    sq8_compute_batch<8, false>(query, codes, lower_bound, diff, dim, results);
+#else
+    avx2::SQ8ComputeL2SqrBatch8(query, codes, lower_bound, diff, dim, results);
+#endif
+}
+
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results) {
+#if defined(ENABLE_AVX512)
+    sq8_compute_batch<16, true>(query, codes, lower_bound, diff, dim, results);
+#else
+    avx2::SQ8ComputeIPBatch16(query, codes, lower_bound, diff, dim, results);
+#endif
+}
+
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results) {
+#if defined(ENABLE_AVX512)
+    sq8_compute_batch<16, false>(query, codes, lower_bound, diff, dim, results);
+#else
+    avx2::SQ8ComputeL2SqrBatch16(query, codes, lower_bound, diff, dim, results);
+#endif
+}
+
 float
 SQ8ComputeCodesIP(const uint8_t* RESTRICT codes1,
                   const uint8_t* RESTRICT codes2,
@@ -1243,4 +1551,223 @@ FHTRotate(float* data, size_t dim_) {
     return generic::FHTRotate(data, dim_);
 #endif
 }
+
+void
+SparseAccumulate(float query_val,
+                 const uint32_t* RESTRICT ids,
+                 const float* RESTRICT datas,
+                 uint32_t count,
+                 float* RESTRICT dists) {
+#if defined(ENABLE_AVX512)
+    const __m512 query = _mm512_set1_ps(query_val);
+    uint32_t i = 0;
+    for (; i + 15 < count; i += 16) {
+        __m512i id_vec = _mm512_loadu_si512(ids + i);
+        __m512 dist_vec = _mm512_i32gather_ps(id_vec, dists, 4);
+        __m512 data_vec = _mm512_loadu_ps(datas + i);
+        _mm512_i32scatter_ps(dists, id_vec, _mm512_fmadd_ps(query, data_vec, dist_vec), 4);
+    }
+    if (i < count) {
+        avx2::SparseAccumulate(query_val, ids + i, datas + i, count - i, dists);
+    }
+#else
+    avx2::SparseAccumulate(query_val, ids, datas, count, dists);
+#endif
+}
+
+void
+SparseAccumulateSQ8(float query_val,
+                    const uint32_t* RESTRICT ids,
+                    const uint8_t* RESTRICT codes,
+                    float lower_bound,
+                    float diff,
+                    uint32_t count,
+                    float* RESTRICT dists) {
+#if defined(ENABLE_AVX512)
+    const __m512 bias = _mm512_set1_ps(query_val * lower_bound);
+    const __m512 scale = _mm512_set1_ps(query_val * diff / 255.0F);
+    uint32_t i = 0;
+    for (; i + 15 < count; i += 16) {
+        __m512i id_vec = _mm512_loadu_si512(ids + i);
+        __m512 dist_vec = _mm512_i32gather_ps(id_vec, dists, 4);
+        __m128i code_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + i));
+        __m512 weight_vec = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(code_vec));
+        dist_vec = _mm512_add_ps(dist_vec, _mm512_fmadd_ps(scale, weight_vec, bias));
+        _mm512_i32scatter_ps(dists, id_vec, dist_vec, 4);
+    }
+    if (i < count) {
+        avx2::SparseAccumulateSQ8(
+            query_val, ids + i, codes + i, lower_bound, diff, count - i, dists);
+    }
+#else
+    avx2::SparseAccumulateSQ8(query_val, ids, codes, lower_bound, diff, count, dists);
+#endif
+}
+
+#if defined(ENABLE_AVX512)
+template <uint64_t Dim>
+static float
+fp32_compute_ip_fixed_dim(const float* RESTRICT query,
+                          const float* RESTRICT codes,
+                          uint64_t /*dim*/) {
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    __m512 sum2 = _mm512_setzero_ps();
+    __m512 sum3 = _mm512_setzero_ps();
+    constexpr uint64_t main_dim = Dim - Dim % 64;
+    for (uint64_t i = 0; i < main_dim; i += 64) {
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(query + i), _mm512_loadu_ps(codes + i), sum0);
+        sum1 =
+            _mm512_fmadd_ps(_mm512_loadu_ps(query + i + 16), _mm512_loadu_ps(codes + i + 16), sum1);
+        sum2 =
+            _mm512_fmadd_ps(_mm512_loadu_ps(query + i + 32), _mm512_loadu_ps(codes + i + 32), sum2);
+        sum3 =
+            _mm512_fmadd_ps(_mm512_loadu_ps(query + i + 48), _mm512_loadu_ps(codes + i + 48), sum3);
+    }
+    if constexpr (main_dim < Dim) {
+        sum0 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(query + main_dim), _mm512_loadu_ps(codes + main_dim), sum0);
+        sum1 = _mm512_fmadd_ps(
+            _mm512_loadu_ps(query + main_dim + 16), _mm512_loadu_ps(codes + main_dim + 16), sum1);
+    }
+    sum0 = _mm512_add_ps(_mm512_add_ps(sum0, sum1), _mm512_add_ps(sum2, sum3));
+    return _mm512_reduce_add_ps(sum0);
+}
+
+template <uint64_t Dim>
+static float
+fp32_compute_l2sqr_fixed_dim(const float* RESTRICT query,
+                             const float* RESTRICT codes,
+                             uint64_t /*dim*/) {
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    __m512 sum2 = _mm512_setzero_ps();
+    __m512 sum3 = _mm512_setzero_ps();
+    constexpr uint64_t main_dim = Dim - Dim % 64;
+    for (uint64_t i = 0; i < main_dim; i += 64) {
+        __m512 diff0 = _mm512_sub_ps(_mm512_loadu_ps(query + i), _mm512_loadu_ps(codes + i));
+        __m512 diff1 =
+            _mm512_sub_ps(_mm512_loadu_ps(query + i + 16), _mm512_loadu_ps(codes + i + 16));
+        __m512 diff2 =
+            _mm512_sub_ps(_mm512_loadu_ps(query + i + 32), _mm512_loadu_ps(codes + i + 32));
+        __m512 diff3 =
+            _mm512_sub_ps(_mm512_loadu_ps(query + i + 48), _mm512_loadu_ps(codes + i + 48));
+        sum0 = _mm512_fmadd_ps(diff0, diff0, sum0);
+        sum1 = _mm512_fmadd_ps(diff1, diff1, sum1);
+        sum2 = _mm512_fmadd_ps(diff2, diff2, sum2);
+        sum3 = _mm512_fmadd_ps(diff3, diff3, sum3);
+    }
+    if constexpr (main_dim < Dim) {
+        __m512 diff0 =
+            _mm512_sub_ps(_mm512_loadu_ps(query + main_dim), _mm512_loadu_ps(codes + main_dim));
+        __m512 diff1 = _mm512_sub_ps(_mm512_loadu_ps(query + main_dim + 16),
+                                     _mm512_loadu_ps(codes + main_dim + 16));
+        sum0 = _mm512_fmadd_ps(diff0, diff0, sum0);
+        sum1 = _mm512_fmadd_ps(diff1, diff1, sum1);
+    }
+    sum0 = _mm512_add_ps(_mm512_add_ps(sum0, sum1), _mm512_add_ps(sum2, sum3));
+    return _mm512_reduce_add_ps(sum0);
+}
+
+template <uint64_t Dim>
+static float
+sq8_compute_ip_fixed_dim(const float* RESTRICT query,
+                         const uint8_t* RESTRICT codes,
+                         const float* RESTRICT lower_bound,
+                         const float* RESTRICT diff,
+                         uint64_t /*dim*/) {
+    const __m512 scale = _mm512_set1_ps(1.0F / 255.0F);
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    for (uint64_t i = 0; i < Dim; i += 32) {
+        __m512 codes0 = _mm512_cvtepi32_ps(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + i))));
+        __m512 codes1 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + i + 16))));
+        __m512 adjusted0 = _mm512_fmadd_ps(_mm512_mul_ps(codes0, scale),
+                                           _mm512_loadu_ps(diff + i),
+                                           _mm512_loadu_ps(lower_bound + i));
+        __m512 adjusted1 = _mm512_fmadd_ps(_mm512_mul_ps(codes1, scale),
+                                           _mm512_loadu_ps(diff + i + 16),
+                                           _mm512_loadu_ps(lower_bound + i + 16));
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(query + i), adjusted0, sum0);
+        sum1 = _mm512_fmadd_ps(_mm512_loadu_ps(query + i + 16), adjusted1, sum1);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(sum0, sum1));
+}
+
+template <uint64_t Dim>
+static float
+sq8_compute_l2sqr_fixed_dim(const float* RESTRICT query,
+                            const uint8_t* RESTRICT codes,
+                            const float* RESTRICT lower_bound,
+                            const float* RESTRICT diff,
+                            uint64_t /*dim*/) {
+    const __m512 scale = _mm512_set1_ps(1.0F / 255.0F);
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    for (uint64_t i = 0; i < Dim; i += 32) {
+        __m512 codes0 = _mm512_cvtepi32_ps(
+            _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + i))));
+        __m512 codes1 = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + i + 16))));
+        __m512 adjusted0 = _mm512_fmadd_ps(_mm512_mul_ps(codes0, scale),
+                                           _mm512_loadu_ps(diff + i),
+                                           _mm512_loadu_ps(lower_bound + i));
+        __m512 adjusted1 = _mm512_fmadd_ps(_mm512_mul_ps(codes1, scale),
+                                           _mm512_loadu_ps(diff + i + 16),
+                                           _mm512_loadu_ps(lower_bound + i + 16));
+        __m512 dist0 = _mm512_sub_ps(_mm512_loadu_ps(query + i), adjusted0);
+        __m512 dist1 = _mm512_sub_ps(_mm512_loadu_ps(query + i + 16), adjusted1);
+        sum0 = _mm512_fmadd_ps(dist0, dist0, sum0);
+        sum1 = _mm512_fmadd_ps(dist1, dist1, sum1);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(sum0, sum1));
+}
+#endif
+
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim) {
+#if defined(ENABLE_AVX512)
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_ip_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return avx2::FP32ComputeIPFixedDim(dim);
+#endif
+}
+
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim) {
+#if defined(ENABLE_AVX512)
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_l2sqr_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return avx2::FP32ComputeL2SqrFixedDim(dim);
+#endif
+}
+
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim) {
+#if defined(ENABLE_AVX512)
+    return SelectFixedDimKernel<SQ8ComputeType>(dim, [](auto fixed_dim) -> SQ8ComputeType {
+        return sq8_compute_ip_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return avx2::SQ8ComputeIPFixedDim(dim);
+#endif
+}
+
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim) {
+#if defined(ENABLE_AVX512)
+    return SelectFixedDimKernel<SQ8ComputeType>(dim, [](auto fixed_dim) -> SQ8ComputeType {
+        return sq8_compute_l2sqr_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return avx2::SQ8ComputeL2SqrFixedDim(dim);
+#endif
+}
+
 }  // namespace vsag::avx512
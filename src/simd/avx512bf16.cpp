@@ -0,0 +1,56 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#if defined(ENABLE_AVX512BF16)
+#include <immintrin.h>
+#endif
+
+#include "simd.h"
+
+namespace vsag::avx512bf16 {
+
+float
+BF16ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX512BF16)
+    // vdpbf16ps multiplies pairs of bf16 into fp32 lanes, no widening to fp32 is needed
+    const auto* query_bf16 = reinterpret_cast<const uint16_t*>(query);
+    const auto* codes_bf16 = reinterpret_cast<const uint16_t*>(codes);
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    uint64_t i = 0;
+    for (; i + 64 <= dim; i += 64) {
+        auto q0 = (__m512bh)_mm512_loadu_si512(query_bf16 + i);
+        auto c0 = (__m512bh)_mm512_loadu_si512(codes_bf16 + i);
+        auto q1 = (__m512bh)_mm512_loadu_si512(query_bf16 + i + 32);
+        auto c1 = (__m512bh)_mm512_loadu_si512(codes_bf16 + i + 32);
+        sum0 = _mm512_dpbf16_ps(sum0, q0, c0);
+        sum1 = _mm512_dpbf16_ps(sum1, q1, c1);
+    }
+    if (i + 32 <= dim) {
+        auto q0 = (__m512bh)_mm512_loadu_si512(query_bf16 + i);
+        auto c0 = (__m512bh)_mm512_loadu_si512(codes_bf16 + i);
+        sum0 = _mm512_dpbf16_ps(sum0, q0, c0);
+        i += 32;
+    }
+    float ip = _mm512_reduce_add_ps(_mm512_add_ps(sum0, sum1));
+    if (i < dim) {
+        ip += avx512::BF16ComputeIP(query + i * 2, codes + i * 2, dim - i);
+    }
+    return ip;
+#else
+    return avx512::BF16ComputeIP(query, codes, dim);
+#endif
+}
+
+}  // namespace vsag::avx512bf16
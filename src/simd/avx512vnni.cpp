@@ -0,0 +1,112 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#if defined(ENABLE_AVX512VNNI)
+#include <immintrin.h>
+#endif
+
+#include "simd.h"
+
+namespace vsag::avx512vnni {
+
+float
+SQ8UniformComputeCodesIP(const uint8_t* RESTRICT codes1,
+                         const uint8_t* RESTRICT codes2,
+                         uint64_t dim) {
+#if defined(ENABLE_AVX512VNNI)
+    // vpdpbusd multiplies unsigned by signed bytes, so codes2 is shifted into the signed range:
+    // x * y = x * (y - 128) + 128 * x, and the sum of x comes from a second vpdpbusd with ones
+    const __m512i sign_flip = _mm512_set1_epi8(static_cast<char>(0x80));
+    const __m512i ones = _mm512_set1_epi8(1);
+    __m512i sum = _mm512_setzero_si512();
+    __m512i sum_x = _mm512_setzero_si512();
+    uint64_t d = 0;
+    for (; d + 64 <= dim; d += 64) {
+        auto xx = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(codes1 + d));
+        auto yy = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(codes2 + d));
+        sum = _mm512_dpbusd_epi32(sum, xx, _mm512_xor_si512(yy, sign_flip));
+        sum_x = _mm512_dpbusd_epi32(sum_x, xx, ones);
+    }
+    int32_t result = _mm512_reduce_add_epi32(sum) + 128 * _mm512_reduce_add_epi32(sum_x);
+    if (d < dim) {
+        result += static_cast<int32_t>(
+            avx512::SQ8UniformComputeCodesIP(codes1 + d, codes2 + d, dim - d));
+    }
+    return static_cast<float>(result);
+#else
+    return avx512::SQ8UniformComputeCodesIP(codes1, codes2, dim);
+#endif
+}
+
+float
+INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX512VNNI)
+    __m512i sum0 = _mm512_setzero_si512();
+    __m512i sum1 = _mm512_setzero_si512();
+    uint64_t d = 0;
+    for (; d + 64 <= dim; d += 64) {
+        __m512i q0 = _mm512_cvtepi8_epi16(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(query + d)));
+        __m512i c0 = _mm512_cvtepi8_epi16(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + d)));
+        __m512i q1 = _mm512_cvtepi8_epi16(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(query + d + 32)));
+        __m512i c1 = _mm512_cvtepi8_epi16(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + d + 32)));
+        __m512i diff0 = _mm512_sub_epi16(q0, c0);
+        __m512i diff1 = _mm512_sub_epi16(q1, c1);
+        // vpdpwssd fuses the madd of the squared differences with the accumulation
+        sum0 = _mm512_dpwssd_epi32(sum0, diff0, diff0);
+        sum1 = _mm512_dpwssd_epi32(sum1, diff1, diff1);
+    }
+    int32_t l2 = _mm512_reduce_add_epi32(_mm512_add_epi32(sum0, sum1));
+    if (d < dim) {
+        l2 += static_cast<int32_t>(avx512::INT8ComputeL2Sqr(query + d, codes + d, dim - d));
+    }
+    return static_cast<float>(l2);
+#else
+    return avx512::INT8ComputeL2Sqr(query, codes, dim);
+#endif
+}
+
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_AVX512VNNI)
+    __m512i sum0 = _mm512_setzero_si512();
+    __m512i sum1 = _mm512_setzero_si512();
+    uint64_t d = 0;
+    for (; d + 64 <= dim; d += 64) {
+        __m512i q0 = _mm512_cvtepi8_epi16(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(query + d)));
+        __m512i c0 = _mm512_cvtepi8_epi16(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + d)));
+        __m512i q1 = _mm512_cvtepi8_epi16(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(query + d + 32)));
+        __m512i c1 = _mm512_cvtepi8_epi16(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + d + 32)));
+        // both sides are signed, so the words go through vpdpwssd instead of vpdpbusd
+        sum0 = _mm512_dpwssd_epi32(sum0, q0, c0);
+        sum1 = _mm512_dpwssd_epi32(sum1, q1, c1);
+    }
+    int32_t ip = _mm512_reduce_add_epi32(_mm512_add_epi32(sum0, sum1));
+    if (d < dim) {
+        ip += static_cast<int32_t>(avx512::INT8ComputeIP(query + d, codes + d, dim - d));
+    }
+    return static_cast<float>(ip);
+#else
+    return avx512::INT8ComputeIP(query, codes, dim);
+#endif
+}
+
+}  // namespace vsag::avx512vnni
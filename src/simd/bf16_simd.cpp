@@ -21,7 +21,11 @@ namespace vsag {
 
 static BF16ComputeType
 GetBF16ComputeIP() {
-    if (SimdStatus::SupportAVX512()) {
+    if (SimdStatus::SupportAVX512BF16()) {
+#if defined(ENABLE_AVX512BF16)
+        return avx512bf16::BF16ComputeIP;
+#endif
+    } else if (SimdStatus::SupportAVX512()) {
 #if defined(ENABLE_AVX512)
         return avx512::BF16ComputeIP;
 #endif
@@ -69,7 +69,7 @@ TEST_CASE("Encode & Decode BF16", "[ut][simd]") {
     };
 
 TEST_CASE("BF16 SIMD Compute", "[ut][simd]") {
-    int64_t dim = GENERATE(1, 8, 16, 32, 256);
+    int64_t dim = GENERATE(1, 8, 16, 32, 100, 256);
     int64_t count = 100;
 
     auto vec1_fp32 = fixtures::generate_vectors(count, dim, false, 39);
@@ -80,6 +80,12 @@ TEST_CASE("BF16 SIMD Compute", "[ut][simd]") {
         auto i = j * 2;
         TEST_ACCURACY(BF16ComputeIP);
         TEST_ACCURACY(BF16ComputeL2Sqr);
+        if (SimdStatus::SupportAVX512BF16()) {
+            auto gt = generic::BF16ComputeIP(vec1.data() + i * dim, vec2.data() + i * dim, dim);
+            auto avx512bf16 =
+                avx512bf16::BF16ComputeIP(vec1.data() + i * dim, vec2.data() + i * dim, dim);
+            REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(avx512bf16));
+        }
     }
 }
 
@@ -103,6 +109,7 @@ TEST_CASE("BF16 Benchmark", "[ut][simd][!benchmark]") {
     BENCHMARK_SIMD_COMPUTE(avx, BF16ComputeIP);
     BENCHMARK_SIMD_COMPUTE(avx2, BF16ComputeIP);
     BENCHMARK_SIMD_COMPUTE(avx512, BF16ComputeIP);
+    BENCHMARK_SIMD_COMPUTE(avx512bf16, BF16ComputeIP);
     BENCHMARK_SIMD_COMPUTE(neon, BF16ComputeIP);
 
     BENCHMARK_SIMD_COMPUTE(generic, BF16ComputeL2Sqr);
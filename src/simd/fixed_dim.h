@@ -0,0 +1,50 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace vsag {
+
+// the dims the distance kernels are specialized for at compile time, each one is a multiple of
+// 32 so the kernels of every instruction set run without a tail loop
+constexpr uint64_t FIXED_DIMS[] = {96, 128, 256, 384, 512, 768, 960, 1024, 1536};
+
+template <typename FuncType, typename MakeFunc, std::size_t... I>
+FuncType
+select_fixed_dim_kernel(uint64_t dim, MakeFunc make, std::index_sequence<I...>) {
+    FuncType kernel = nullptr;
+    ((dim == FIXED_DIMS[I] ? (kernel = make(std::integral_constant<uint64_t, FIXED_DIMS[I]>{}))
+                           : kernel),
+     ...);
+    return kernel;
+}
+
+/**
+ * @brief Returns make(std::integral_constant<uint64_t, dim>{}) if dim is one of FIXED_DIMS,
+ * otherwise nullptr, so that the kernel for a runtime dim is picked once per computer.
+ */
+template <typename FuncType, typename MakeFunc>
+FuncType
+SelectFixedDimKernel(uint64_t dim, MakeFunc make) {
+    return select_fixed_dim_kernel<FuncType>(
+        dim, make, std::make_index_sequence<std::size(FIXED_DIMS)>{});
+}
+
+}  // namespace vsag
@@ -72,4 +72,112 @@ GetFP16ComputeL2Sqr() {
     return generic::FP16ComputeL2Sqr;
 }
 FP16ComputeType FP16ComputeL2Sqr = GetFP16ComputeL2Sqr();
+
+static FP16ComputeBatchType
+GetFP16ComputeIPBatch8() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::FP16ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::FP16ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::FP16ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::FP16ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::FP16ComputeIPBatch8;
+#endif
+    }
+    return generic::FP16ComputeIPBatch8;
+}
+FP16ComputeBatchType FP16ComputeIPBatch8 = GetFP16ComputeIPBatch8();
+
+static FP16ComputeBatchType
+GetFP16ComputeL2SqrBatch8() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::FP16ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::FP16ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::FP16ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::FP16ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::FP16ComputeL2SqrBatch8;
+#endif
+    }
+    return generic::FP16ComputeL2SqrBatch8;
+}
+FP16ComputeBatchType FP16ComputeL2SqrBatch8 = GetFP16ComputeL2SqrBatch8();
+
+static FP16ComputeBatchType
+GetFP16ComputeIPBatch16() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::FP16ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::FP16ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::FP16ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::FP16ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::FP16ComputeIPBatch16;
+#endif
+    }
+    return generic::FP16ComputeIPBatch16;
+}
+FP16ComputeBatchType FP16ComputeIPBatch16 = GetFP16ComputeIPBatch16();
+
+static FP16ComputeBatchType
+GetFP16ComputeL2SqrBatch16() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::FP16ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::FP16ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::FP16ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::FP16ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::FP16ComputeL2SqrBatch16;
+#endif
+    }
+    return generic::FP16ComputeL2SqrBatch16;
+}
+FP16ComputeBatchType FP16ComputeL2SqrBatch16 = GetFP16ComputeL2SqrBatch16();
 }  // namespace vsag
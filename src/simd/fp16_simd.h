@@ -30,6 +30,26 @@ float
 FP16ToFloat(const uint16_t bf16_value);
 uint16_t
 FloatToFP16(const float fp32_value);
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results);
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results);
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results);
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results);
 }  // namespace generic
 
 namespace sse {
@@ -37,6 +57,26 @@ float
 FP16ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim);
 float
 FP16ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim);
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results);
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results);
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results);
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results);
 }  // namespace sse
 
 namespace avx {
@@ -44,6 +84,26 @@ float
 FP16ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim);
 float
 FP16ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim);
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results);
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results);
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results);
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results);
 }  // namespace avx
 
 namespace avx2 {
@@ -51,6 +111,26 @@ float
 FP16ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim);
 float
 FP16ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim);
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results);
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results);
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results);
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results);
 }  // namespace avx2
 
 namespace avx512 {
@@ -58,6 +138,26 @@ float
 FP16ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim);
 float
 FP16ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim);
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results);
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results);
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results);
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results);
 }  // namespace avx512
 
 namespace neon {
@@ -65,6 +165,26 @@ float
 FP16ComputeIP(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim);
 float
 FP16ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, uint64_t dim);
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results);
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results);
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results);
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results);
 }  // namespace neon
 
 using FP16ComputeType = float (*)(const uint8_t* RESTRICT query,
@@ -73,4 +193,13 @@ using FP16ComputeType = float (*)(const uint8_t* RESTRICT query,
 extern FP16ComputeType FP16ComputeIP;
 extern FP16ComputeType FP16ComputeL2Sqr;
 
+using FP16ComputeBatchType = void (*)(const uint8_t* RESTRICT query,
+                                      const uint8_t* const* codes,
+                                      uint64_t dim,
+                                      float* results);
+extern FP16ComputeBatchType FP16ComputeIPBatch8;
+extern FP16ComputeBatchType FP16ComputeL2SqrBatch8;
+extern FP16ComputeBatchType FP16ComputeIPBatch16;
+extern FP16ComputeBatchType FP16ComputeL2SqrBatch16;
+
 }  // namespace vsag
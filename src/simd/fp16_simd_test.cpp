@@ -88,6 +88,61 @@ TEST_CASE("FP16 SIMD Compute", "[ut][simd]") {
     }
 }
 
+#define TEST_ACCURACY_BATCH(Func, FuncBatch, BatchSize)                           \
+    {                                                                             \
+        const auto* query = vec1.data() + i * dim * 2;                            \
+        std::vector<const uint8_t*> codes(BatchSize);                             \
+        std::vector<float> gts(BatchSize);                                        \
+        for (uint64_t j = 0; j < BatchSize; ++j) {                                \
+            codes[j] = vec2.data() + (i + j) * dim * 2;                           \
+            gts[j] = generic::Func(query, codes[j], dim);                         \
+        }                                                                         \
+        std::vector<float> result(BatchSize);                                     \
+        auto check_result = [&]() {                                               \
+            for (uint64_t j = 0; j < BatchSize; ++j) {                            \
+                REQUIRE(fixtures::dist_t(gts[j]) == fixtures::dist_t(result[j])); \
+            }                                                                     \
+        };                                                                        \
+        generic::FuncBatch(query, codes.data(), dim, result.data());              \
+        check_result();                                                           \
+        if (SimdStatus::SupportSSE()) {                                           \
+            sse::FuncBatch(query, codes.data(), dim, result.data());              \
+            check_result();                                                       \
+        }                                                                         \
+        if (SimdStatus::SupportAVX()) {                                           \
+            avx::FuncBatch(query, codes.data(), dim, result.data());              \
+            check_result();                                                       \
+        }                                                                         \
+        if (SimdStatus::SupportAVX2()) {                                          \
+            avx2::FuncBatch(query, codes.data(), dim, result.data());             \
+            check_result();                                                       \
+        }                                                                         \
+        if (SimdStatus::SupportAVX512()) {                                        \
+            avx512::FuncBatch(query, codes.data(), dim, result.data());           \
+            check_result();                                                       \
+        }                                                                         \
+        if (SimdStatus::SupportNEON()) {                                          \
+            neon::FuncBatch(query, codes.data(), dim, result.data());             \
+            check_result();                                                       \
+        }                                                                         \
+    }                                                                            
+
+TEST_CASE("FP16 SIMD Compute Batch", "[ut][simd]") {
+    int64_t dim = GENERATE(1, 8, 16, 17, 32, 256);
+    int64_t count = 100;
+
+    auto vec1_fp32 = fixtures::generate_vectors(count, dim, false, 39);
+    auto vec1 = encode_fp16(vec1_fp32, count * dim);
+    auto vec2_fp32 = fixtures::generate_vectors(count, dim, false, 87);
+    auto vec2 = encode_fp16(vec2_fp32, count * dim);
+    for (uint64_t i = 0; i + 16 <= count; i += 16) {
+        TEST_ACCURACY_BATCH(FP16ComputeIP, FP16ComputeIPBatch8, 8);
+        TEST_ACCURACY_BATCH(FP16ComputeL2Sqr, FP16ComputeL2SqrBatch8, 8);
+        TEST_ACCURACY_BATCH(FP16ComputeIP, FP16ComputeIPBatch16, 16);
+        TEST_ACCURACY_BATCH(FP16ComputeL2Sqr, FP16ComputeL2SqrBatch16, 16);
+    }
+}
+
 #define BENCHMARK_SIMD_COMPUTE(Simd, Comp)                                         \
     BENCHMARK_ADVANCED(#Simd #Comp) {                                              \
         for (int i = 0; i < count; ++i) {                                          \
@@ -127,6 +127,114 @@ GetFP32ComputeL2SqrBatch4() {
 }
 FP32ComputeBatch4Type FP32ComputeL2SqrBatch4 = GetFP32ComputeL2SqrBatch4();
 
+static FP32ComputeBatchType
+GetFP32ComputeIPBatch8() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::FP32ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::FP32ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::FP32ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::FP32ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::FP32ComputeIPBatch8;
+#endif
+    }
+    return generic::FP32ComputeIPBatch8;
+}
+FP32ComputeBatchType FP32ComputeIPBatch8 = GetFP32ComputeIPBatch8();
+
+static FP32ComputeBatchType
+GetFP32ComputeL2SqrBatch8() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::FP32ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::FP32ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::FP32ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::FP32ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::FP32ComputeL2SqrBatch8;
+#endif
+    }
+    return generic::FP32ComputeL2SqrBatch8;
+}
+FP32ComputeBatchType FP32ComputeL2SqrBatch8 = GetFP32ComputeL2SqrBatch8();
+
+static FP32ComputeBatchType
+GetFP32ComputeIPBatch16() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::FP32ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::FP32ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::FP32ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::FP32ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::FP32ComputeIPBatch16;
+#endif
+    }
+    return generic::FP32ComputeIPBatch16;
+}
+FP32ComputeBatchType FP32ComputeIPBatch16 = GetFP32ComputeIPBatch16();
+
+static FP32ComputeBatchType
+GetFP32ComputeL2SqrBatch16() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::FP32ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::FP32ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::FP32ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::FP32ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::FP32ComputeL2SqrBatch16;
+#endif
+    }
+    return generic::FP32ComputeL2SqrBatch16;
+}
+FP32ComputeBatchType FP32ComputeL2SqrBatch16 = GetFP32ComputeL2SqrBatch16();
+
 static FP32ArithmeticType
 GetFP32Sub() {
     if (SimdStatus::SupportAVX512()) {
@@ -262,4 +370,70 @@ GetFP32ReduceAdd() {
 }
 FP32ReduceType FP32ReduceAdd = GetFP32ReduceAdd();
 
+static FP32ComputeFixedDimType
+GetFP32ComputeIPFixedDim() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::FP32ComputeIPFixedDim;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::FP32ComputeIPFixedDim;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::FP32ComputeIPFixedDim;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::FP32ComputeIPFixedDim;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::FP32ComputeIPFixedDim;
+#endif
+    }
+    return generic::FP32ComputeIPFixedDim;
+}
+FP32ComputeFixedDimType FP32ComputeIPFixedDim = GetFP32ComputeIPFixedDim();
+
+static FP32ComputeFixedDimType
+GetFP32ComputeL2SqrFixedDim() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::FP32ComputeL2SqrFixedDim;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::FP32ComputeL2SqrFixedDim;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::FP32ComputeL2SqrFixedDim;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::FP32ComputeL2SqrFixedDim;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::FP32ComputeL2SqrFixedDim;
+#endif
+    }
+    return generic::FP32ComputeL2SqrFixedDim;
+}
+FP32ComputeFixedDimType FP32ComputeL2SqrFixedDim = GetFP32ComputeL2SqrFixedDim();
+
+FP32ComputeType
+SelectFP32ComputeIP(uint64_t dim) {
+    auto kernel = FP32ComputeIPFixedDim(dim);
+    return kernel != nullptr ? kernel : FP32ComputeIP;
+}
+
+FP32ComputeType
+SelectFP32ComputeL2Sqr(uint64_t dim) {
+    auto kernel = FP32ComputeL2SqrFixedDim(dim);
+    return kernel != nullptr ? kernel : FP32ComputeL2Sqr;
+}
+
 }  // namespace vsag
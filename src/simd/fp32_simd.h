@@ -21,6 +21,10 @@
 #include "simd_marco.h"
 namespace vsag {
 
+using FP32ComputeType = float (*)(const float* RESTRICT query,
+                                  const float* RESTRICT codes,
+                                  uint64_t dim);
+
 namespace generic {
 float
 FP32ComputeIP(const float* RESTRICT query, const float* RESTRICT codes, uint64_t dim);
@@ -59,6 +63,30 @@ FP32Div(const float* x, const float* y, float* z, uint64_t dim);
 
 float
 FP32ReduceAdd(const float* x, uint64_t dim);
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results);
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results);
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results);
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results);
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim);
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace generic
 
 namespace sse {
@@ -99,6 +127,30 @@ FP32Div(const float* x, const float* y, float* z, uint64_t dim);
 
 float
 FP32ReduceAdd(const float* x, uint64_t dim);
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results);
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results);
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results);
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results);
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim);
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace sse
 
 namespace avx {
@@ -139,6 +191,30 @@ FP32Div(const float* x, const float* y, float* z, uint64_t dim);
 
 float
 FP32ReduceAdd(const float* x, uint64_t dim);
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results);
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results);
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results);
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results);
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim);
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace avx
 
 namespace avx2 {
@@ -179,6 +255,30 @@ FP32Div(const float* x, const float* y, float* z, uint64_t dim);
 
 float
 FP32ReduceAdd(const float* x, uint64_t dim);
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results);
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results);
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results);
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results);
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim);
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace avx2
 
 namespace avx512 {
@@ -219,6 +319,30 @@ FP32Div(const float* x, const float* y, float* z, uint64_t dim);
 
 float
 FP32ReduceAdd(const float* x, uint64_t dim);
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results);
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results);
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results);
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results);
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim);
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace avx512
 
 namespace neon {
@@ -259,11 +383,32 @@ FP32Div(const float* x, const float* y, float* z, uint64_t dim);
 
 float
 FP32ReduceAdd(const float* x, uint64_t dim);
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results);
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results);
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results);
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results);
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim);
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace neon
 
-using FP32ComputeType = float (*)(const float* RESTRICT query,
-                                  const float* RESTRICT codes,
-                                  uint64_t dim);
 extern FP32ComputeType FP32ComputeIP;
 extern FP32ComputeType FP32ComputeL2Sqr;
 
@@ -280,6 +425,15 @@ using FP32ComputeBatch4Type = void (*)(const float* RESTRICT query,
 extern FP32ComputeBatch4Type FP32ComputeIPBatch4;
 extern FP32ComputeBatch4Type FP32ComputeL2SqrBatch4;
 
+using FP32ComputeBatchType = void (*)(const float* RESTRICT query,
+                                      uint64_t dim,
+                                      const float* const* codes,
+                                      float* results);
+extern FP32ComputeBatchType FP32ComputeIPBatch8;
+extern FP32ComputeBatchType FP32ComputeL2SqrBatch8;
+extern FP32ComputeBatchType FP32ComputeIPBatch16;
+extern FP32ComputeBatchType FP32ComputeL2SqrBatch16;
+
 using FP32ArithmeticType = void (*)(const float* x, const float* y, float* z, uint64_t dim);
 extern FP32ArithmeticType FP32Sub;
 extern FP32ArithmeticType FP32Add;
@@ -288,4 +442,17 @@ extern FP32ArithmeticType FP32Div;
 
 using FP32ReduceType = float (*)(const float* x, uint64_t dim);
 extern FP32ReduceType FP32ReduceAdd;
+
+// returns the kernel specialized for dim (see FIXED_DIMS), nullptr if there is none
+using FP32ComputeFixedDimType = FP32ComputeType (*)(uint64_t dim);
+extern FP32ComputeFixedDimType FP32ComputeIPFixedDim;
+extern FP32ComputeFixedDimType FP32ComputeL2SqrFixedDim;
+
+// the kernel specialized for dim if there is one, FP32ComputeIP otherwise
+FP32ComputeType
+SelectFP32ComputeIP(uint64_t dim);
+
+// the kernel specialized for dim if there is one, FP32ComputeL2Sqr otherwise
+FP32ComputeType
+SelectFP32ComputeL2Sqr(uint64_t dim);
 }  // namespace vsag
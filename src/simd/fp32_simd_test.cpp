@@ -18,6 +18,7 @@
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include "fixed_dim.h"
 #include "fixtures.h"
 #include "simd_status.h"
 
@@ -194,6 +195,45 @@ using namespace vsag;
         }                                                                                \
     };
 
+#define TEST_FP32_COMPUTE_ACCURACY_BATCH(Func, FuncBatch, BatchSize)              \
+    {                                                                             \
+        const auto* query = vec1.data() + i * dim;                                \
+        std::vector<const float*> codes(BatchSize);                               \
+        std::vector<float> gts(BatchSize);                                        \
+        for (uint64_t j = 0; j < BatchSize; ++j) {                                \
+            codes[j] = vec2.data() + (i + j) * dim;                               \
+            gts[j] = generic::Func(query, codes[j], dim);                         \
+        }                                                                         \
+        std::vector<float> result(BatchSize);                                     \
+        auto check_result = [&]() {                                               \
+            for (uint64_t j = 0; j < BatchSize; ++j) {                            \
+                REQUIRE(fixtures::dist_t(gts[j]) == fixtures::dist_t(result[j])); \
+            }                                                                     \
+        };                                                                        \
+        generic::FuncBatch(query, dim, codes.data(), result.data());              \
+        check_result();                                                           \
+        if (SimdStatus::SupportSSE()) {                                           \
+            sse::FuncBatch(query, dim, codes.data(), result.data());              \
+            check_result();                                                       \
+        }                                                                         \
+        if (SimdStatus::SupportAVX()) {                                           \
+            avx::FuncBatch(query, dim, codes.data(), result.data());              \
+            check_result();                                                       \
+        }                                                                         \
+        if (SimdStatus::SupportAVX2()) {                                          \
+            avx2::FuncBatch(query, dim, codes.data(), result.data());             \
+            check_result();                                                       \
+        }                                                                         \
+        if (SimdStatus::SupportAVX512()) {                                        \
+            avx512::FuncBatch(query, dim, codes.data(), result.data());           \
+            check_result();                                                       \
+        }                                                                         \
+        if (SimdStatus::SupportNEON()) {                                          \
+            neon::FuncBatch(query, dim, codes.data(), result.data());             \
+            check_result();                                                       \
+        }                                                                         \
+    }                                                                            
+
 TEST_CASE("FP32 SIMD Compute", "[ut][simd]") {
     const std::vector<int64_t> dims = {8, 16, 32, 256};
     int64_t count = 100;
@@ -212,7 +252,50 @@ TEST_CASE("FP32 SIMD Compute", "[ut][simd]") {
             TEST_FP32_COMPUTE_ACCURACY_BATCH4(FP32ComputeIP, FP32ComputeIPBatch4);
             TEST_FP32_COMPUTE_ACCURACY_BATCH4(FP32ComputeL2Sqr, FP32ComputeL2SqrBatch4);
         }
+        for (uint64_t i = 0; i + 16 <= count; i += 16) {
+            TEST_FP32_COMPUTE_ACCURACY_BATCH(FP32ComputeIP, FP32ComputeIPBatch8, 8);
+            TEST_FP32_COMPUTE_ACCURACY_BATCH(FP32ComputeL2Sqr, FP32ComputeL2SqrBatch8, 8);
+            TEST_FP32_COMPUTE_ACCURACY_BATCH(FP32ComputeIP, FP32ComputeIPBatch16, 16);
+            TEST_FP32_COMPUTE_ACCURACY_BATCH(FP32ComputeL2Sqr, FP32ComputeL2SqrBatch16, 16);
+        }
+    }
+}
+
+#define TEST_FP32_FIXED_DIM_ACCURACY(Simd, Supported, Func)                             \
+    if (Supported) {                                                                    \
+        auto kernel = Simd::Func##FixedDim(dim);                                        \
+        REQUIRE(kernel != nullptr);                                                     \
+        for (uint64_t i = 0; i < count; ++i) {                                          \
+            auto gt = generic::Func(vec1.data() + i * dim, vec2.data() + i * dim, dim); \
+            auto result = kernel(vec1.data() + i * dim, vec2.data() + i * dim, dim);    \
+            REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(result));                  \
+        }                                                                               \
     }
+
+TEST_CASE("FP32 SIMD Compute Fixed Dim", "[ut][simd]") {
+    int64_t count = 20;
+    for (auto dim : FIXED_DIMS) {
+        auto vec1 = fixtures::generate_vectors(count * 2, dim);
+        std::vector<float> vec2(vec1.begin() + count * dim, vec1.end());
+        TEST_FP32_FIXED_DIM_ACCURACY(generic, true, FP32ComputeIP);
+        TEST_FP32_FIXED_DIM_ACCURACY(generic, true, FP32ComputeL2Sqr);
+        TEST_FP32_FIXED_DIM_ACCURACY(sse, SimdStatus::SupportSSE(), FP32ComputeIP);
+        TEST_FP32_FIXED_DIM_ACCURACY(sse, SimdStatus::SupportSSE(), FP32ComputeL2Sqr);
+        TEST_FP32_FIXED_DIM_ACCURACY(avx, SimdStatus::SupportAVX(), FP32ComputeIP);
+        TEST_FP32_FIXED_DIM_ACCURACY(avx, SimdStatus::SupportAVX(), FP32ComputeL2Sqr);
+        TEST_FP32_FIXED_DIM_ACCURACY(avx2, SimdStatus::SupportAVX2(), FP32ComputeIP);
+        TEST_FP32_FIXED_DIM_ACCURACY(avx2, SimdStatus::SupportAVX2(), FP32ComputeL2Sqr);
+        TEST_FP32_FIXED_DIM_ACCURACY(avx512, SimdStatus::SupportAVX512(), FP32ComputeIP);
+        TEST_FP32_FIXED_DIM_ACCURACY(avx512, SimdStatus::SupportAVX512(), FP32ComputeL2Sqr);
+        TEST_FP32_FIXED_DIM_ACCURACY(neon, SimdStatus::SupportNEON(), FP32ComputeIP);
+        TEST_FP32_FIXED_DIM_ACCURACY(neon, SimdStatus::SupportNEON(), FP32ComputeL2Sqr);
+        REQUIRE(SelectFP32ComputeIP(dim) == FP32ComputeIPFixedDim(dim));
+    }
+
+    // a dim without a specialized kernel falls back to the runtime dim kernel
+    REQUIRE(generic::FP32ComputeIPFixedDim(100) == nullptr);
+    REQUIRE(SelectFP32ComputeIP(100) == FP32ComputeIP);
+    REQUIRE(SelectFP32ComputeL2Sqr(100) == FP32ComputeL2Sqr);
 }
 
 #define BENCHMARK_SIMD_COMPUTE(Simd, Comp)                                 \
@@ -13,6 +13,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "fixed_dim.h"
 #include "simd.h"
 
 namespace vsag::generic {
@@ -150,6 +151,46 @@ FP32ComputeL2SqrBatch4(const float* RESTRICT query,
     }
 }
 
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP32ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP32ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP32ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP32ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
 void
 FP32Sub(const float* x, const float* y, float* z, uint64_t dim) {
     for (uint64_t i = 0; i < dim; ++i) {
@@ -202,6 +243,15 @@ INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uin
     return result;
 }
 
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
+    int32_t result = 0;
+    for (uint64_t i = 0; i < dim; ++i) {
+        result += static_cast<int32_t>(query[i]) * static_cast<int32_t>(codes[i]);
+    }
+    return static_cast<float>(result);
+}
+
 float
 BF16ToFloat(const uint16_t bf16_value) {
     FP32Struct fp32;
@@ -288,6 +338,46 @@ FP16ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, u
     return result;
 }
 
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP16ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP16ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP16ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP16ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
 float
 SQ8ComputeIP(const float* RESTRICT query,
              const uint8_t* RESTRICT codes,
@@ -317,6 +407,54 @@ SQ8ComputeL2Sqr(const float* RESTRICT query,
     return result;
 }
 
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = SQ8ComputeIP(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = SQ8ComputeL2Sqr(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = SQ8ComputeIP(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = SQ8ComputeL2Sqr(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
 float
 SQ8ComputeCodesIP(const uint8_t* RESTRICT codes1,
                   const uint8_t* RESTRICT codes2,
@@ -700,4 +838,115 @@ FHTRotate(float* data, size_t dim_) {
     }
 }
 
+void
+SparseAccumulate(float query_val,
+                 const uint32_t* RESTRICT ids,
+                 const float* RESTRICT datas,
+                 uint32_t count,
+                 float* RESTRICT dists) {
+    for (uint32_t i = 0; i < count; ++i) {
+        dists[ids[i]] += query_val * datas[i];
+    }
+}
+
+void
+SparseAccumulateSQ8(float query_val,
+                    const uint32_t* RESTRICT ids,
+                    const uint8_t* RESTRICT codes,
+                    float lower_bound,
+                    float diff,
+                    uint32_t count,
+                    float* RESTRICT dists) {
+    // query_val * (lower_bound + code * diff / 255) = bias + scale * code
+    float bias = query_val * lower_bound;
+    float scale = query_val * diff / 255.0F;
+    for (uint32_t i = 0; i < count; ++i) {
+        dists[ids[i]] += bias + scale * static_cast<float>(codes[i]);
+    }
+}
+
+template <uint64_t Dim>
+static float
+fp32_compute_ip_fixed_dim(const float* RESTRICT query,
+                          const float* RESTRICT codes,
+                          uint64_t /*dim*/) {
+    float result = 0.0f;
+    for (uint64_t i = 0; i < Dim; ++i) {
+        result += query[i] * codes[i];
+    }
+    return result;
+}
+
+template <uint64_t Dim>
+static float
+fp32_compute_l2sqr_fixed_dim(const float* RESTRICT query,
+                             const float* RESTRICT codes,
+                             uint64_t /*dim*/) {
+    float result = 0.0f;
+    for (uint64_t i = 0; i < Dim; ++i) {
+        auto val = query[i] - codes[i];
+        result += val * val;
+    }
+    return result;
+}
+
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim) {
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_ip_fixed_dim<decltype(fixed_dim)::value>;
+    });
+}
+
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim) {
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_l2sqr_fixed_dim<decltype(fixed_dim)::value>;
+    });
+}
+
+template <uint64_t Dim>
+static float
+sq8_compute_ip_fixed_dim(const float* RESTRICT query,
+                         const uint8_t* RESTRICT codes,
+                         const float* RESTRICT lower_bound,
+                         const float* RESTRICT diff,
+                         uint64_t /*dim*/) {
+    float result = 0.0f;
+    for (uint64_t i = 0; i < Dim; ++i) {
+        result += query[i] * static_cast<float>(static_cast<float>(codes[i]) / 255.0 * diff[i] +
+                                                lower_bound[i]);
+    }
+    return result;
+}
+
+template <uint64_t Dim>
+static float
+sq8_compute_l2sqr_fixed_dim(const float* RESTRICT query,
+                            const uint8_t* RESTRICT codes,
+                            const float* RESTRICT lower_bound,
+                            const float* RESTRICT diff,
+                            uint64_t /*dim*/) {
+    float result = 0.0f;
+    for (uint64_t i = 0; i < Dim; ++i) {
+        auto val = (query[i] - static_cast<float>(static_cast<float>(codes[i]) / 255.0 * diff[i] +
+                                                  lower_bound[i]));
+        result += val * val;
+    }
+    return result;
+}
+
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim) {
+    return SelectFixedDimKernel<SQ8ComputeType>(dim, [](auto fixed_dim) -> SQ8ComputeType {
+        return sq8_compute_ip_fixed_dim<decltype(fixed_dim)::value>;
+    });
+}
+
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim) {
+    return SelectFixedDimKernel<SQ8ComputeType>(dim, [](auto fixed_dim) -> SQ8ComputeType {
+        return sq8_compute_l2sqr_fixed_dim<decltype(fixed_dim)::value>;
+    });
+}
+
 }  // namespace vsag::generic
@@ -24,36 +24,56 @@ namespace vsag {
 namespace generic {
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
 }  // namespace generic
 
 namespace sse {
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
 }  // namespace sse
 
 namespace avx {
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
 }  // namespace avx
 
 namespace avx2 {
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
 }  // namespace avx2
 
 namespace avx512 {
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
 }  // namespace avx512
 
+namespace avx512vnni {
+float
+INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
+}  // namespace avx512vnni
+
 namespace neon {
 // TODO(lc): impl
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim);
 }  // namespace neon
 
 using INT8ComputeType = float (*)(const int8_t* RESTRICT query,
                                   const int8_t* RESTRICT codes,
                                   uint64_t dim);
 extern INT8ComputeType INT8ComputeL2Sqr;
+extern INT8ComputeType INT8ComputeIP;
 }  // namespace vsag
@@ -44,6 +44,11 @@ using namespace vsag;
             avx512 = avx512::Func(vec1.data() + i * dim, vec2.data() + i * dim, dim); \
             REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(avx512));                \
         }                                                                             \
+        if (SimdStatus::SupportAVX512VNNI()) {                                        \
+            auto avx512vnni =                                                         \
+                avx512vnni::Func(vec1.data() + i * dim, vec2.data() + i * dim, dim);  \
+            REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(avx512vnni));            \
+        }                                                                             \
         if (SimdStatus::SupportNEON()) {                                              \
             neon = neon::Func(vec1.data() + i * dim, vec2.data() + i * dim, dim);     \
             REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(neon));                  \
@@ -51,13 +56,14 @@ using namespace vsag;
     };
 
 TEST_CASE("INT8 SIMD Compute", "[ut][simd][int8]") {
-    const std::vector<int64_t> dims = {8, 16, 32, 256};
+    const std::vector<int64_t> dims = {8, 16, 32, 100, 256};
     int64_t count = 100;
     for (const auto& dim : dims) {
         auto vec1 = fixtures::generate_int8_codes(count * 2, dim);
         std::vector<int8_t> vec2(vec1.begin() + count * dim, vec1.end());
         for (uint64_t i = 0; i < count; ++i) {
             TEST_INT8_COMPUTE_ACCURACY(INT8ComputeL2Sqr);
+            TEST_INT8_COMPUTE_ACCURACY(INT8ComputeIP);
         }
         //TODO(lc): Add batch compute func test
         for (uint64_t i = 0; i < count; i += 4) {
@@ -83,5 +89,13 @@ TEST_CASE("INT8 Benchmark", "[ut][simd][int8][!benchmark]") {
     BENCHMARK_SIMD_COMPUTE(sse, INT8ComputeL2Sqr);
     BENCHMARK_SIMD_COMPUTE(avx2, INT8ComputeL2Sqr);
     BENCHMARK_SIMD_COMPUTE(avx512, INT8ComputeL2Sqr);
+    BENCHMARK_SIMD_COMPUTE(avx512vnni, INT8ComputeL2Sqr);
     BENCHMARK_SIMD_COMPUTE(neon, INT8ComputeL2Sqr);
+
+    BENCHMARK_SIMD_COMPUTE(generic, INT8ComputeIP);
+    BENCHMARK_SIMD_COMPUTE(sse, INT8ComputeIP);
+    BENCHMARK_SIMD_COMPUTE(avx2, INT8ComputeIP);
+    BENCHMARK_SIMD_COMPUTE(avx512, INT8ComputeIP);
+    BENCHMARK_SIMD_COMPUTE(avx512vnni, INT8ComputeIP);
+    BENCHMARK_SIMD_COMPUTE(neon, INT8ComputeIP);
 }
@@ -19,6 +19,7 @@
 #include <cmath>
 #include <cstdint>
 
+#include "fixed_dim.h"
 #include "simd.h"
 
 #define PORTABLE_ALIGN32 __attribute__((aligned(32)))
@@ -389,6 +390,46 @@ FP32ComputeL2SqrBatch4(const float* RESTRICT query,
 #endif
 }
 
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP32ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP32ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP32ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP32ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
 void
 FP32Sub(const float* x, const float* y, float* z, uint64_t dim) {
 #if defined(ENABLE_NEON)
@@ -789,6 +830,46 @@ FP16ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, u
 #endif
 }
 
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP16ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP16ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP16ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP16ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
 #if defined(ENABLE_NEON)
 __inline float32x4_t __attribute__((__always_inline__)) load_4_uint8_to_float(const uint8_t* data) {
     uint32x4_t code_values = {data[0], data[1], data[2], data[3]};
@@ -876,6 +957,39 @@ INT8ComputeL2Sqr(const int8_t* __restrict query, const int8_t* __restrict codes,
 #endif
 }
 
+float
+INT8ComputeIP(const int8_t* __restrict query, const int8_t* __restrict codes, uint64_t dim) {
+#if defined(ENABLE_NEON)
+    constexpr int BATCH_SIZE{8};
+
+    const uint64_t n = dim / BATCH_SIZE;
+
+    if (n == 0) {
+        return generic::INT8ComputeIP(query, codes, dim);
+    }
+
+    int32x4_t sum = vdupq_n_s32(0);
+    for (uint64_t i{0}; i < n; i++) {
+        int16x8_t q_16 = vmovl_s8(vld1_s8(query + BATCH_SIZE * i));
+        int16x8_t c_16 = vmovl_s8(vld1_s8(codes + BATCH_SIZE * i));
+
+        sum = vmlal_s16(sum, vget_low_s16(q_16), vget_low_s16(c_16));
+        sum = vmlal_s16(sum, vget_high_s16(q_16), vget_high_s16(c_16));
+    }
+
+    int32_t result[4];
+    vst1q_s32(result, sum);
+    int32_t ip = result[0] + result[1] + result[2] + result[3];
+
+    ip += static_cast<int32_t>(generic::INT8ComputeIP(
+        query + BATCH_SIZE * n, codes + BATCH_SIZE * n, dim - BATCH_SIZE * n));
+
+    return static_cast<float>(ip);
+#else
+    return generic::INT8ComputeIP(query, codes, dim);
+#endif
+}
+
 float
 SQ8ComputeIP(const float* RESTRICT query,
              const uint8_t* RESTRICT codes,
@@ -1111,6 +1225,54 @@ SQ8ComputeL2Sqr(const float* RESTRICT query,
 #endif
 }
 
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = SQ8ComputeIP(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = SQ8ComputeL2Sqr(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = SQ8ComputeIP(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = SQ8ComputeL2Sqr(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
 float
 SQ8ComputeCodesIP(const uint8_t* RESTRICT codes1,
                   const uint8_t* RESTRICT codes2,
@@ -1931,4 +2093,98 @@ BitNot(const uint8_t* x, const uint64_t num_byte, uint8_t* result) {
 #endif
 }
 
+void
+SparseAccumulate(float query_val,
+                 const uint32_t* RESTRICT ids,
+                 const float* RESTRICT datas,
+                 uint32_t count,
+                 float* RESTRICT dists) {
+    generic::SparseAccumulate(query_val, ids, datas, count, dists);
+}
+
+void
+SparseAccumulateSQ8(float query_val,
+                    const uint32_t* RESTRICT ids,
+                    const uint8_t* RESTRICT codes,
+                    float lower_bound,
+                    float diff,
+                    uint32_t count,
+                    float* RESTRICT dists) {
+    generic::SparseAccumulateSQ8(query_val, ids, codes, lower_bound, diff, count, dists);
+}
+
+#if defined(ENABLE_NEON)
+template <uint64_t Dim>
+static float
+fp32_compute_ip_fixed_dim(const float* RESTRICT query,
+                          const float* RESTRICT codes,
+                          uint64_t /*dim*/) {
+    float32x4_t sum0 = vdupq_n_f32(0.0F);
+    float32x4_t sum1 = vdupq_n_f32(0.0F);
+    float32x4_t sum2 = vdupq_n_f32(0.0F);
+    float32x4_t sum3 = vdupq_n_f32(0.0F);
+    for (uint64_t i = 0; i < Dim; i += 16) {
+        sum0 = vfmaq_f32(sum0, vld1q_f32(query + i), vld1q_f32(codes + i));
+        sum1 = vfmaq_f32(sum1, vld1q_f32(query + i + 4), vld1q_f32(codes + i + 4));
+        sum2 = vfmaq_f32(sum2, vld1q_f32(query + i + 8), vld1q_f32(codes + i + 8));
+        sum3 = vfmaq_f32(sum3, vld1q_f32(query + i + 12), vld1q_f32(codes + i + 12));
+    }
+    return vaddvq_f32(vaddq_f32(vaddq_f32(sum0, sum1), vaddq_f32(sum2, sum3)));
+}
+
+template <uint64_t Dim>
+static float
+fp32_compute_l2sqr_fixed_dim(const float* RESTRICT query,
+                             const float* RESTRICT codes,
+                             uint64_t /*dim*/) {
+    float32x4_t sum0 = vdupq_n_f32(0.0F);
+    float32x4_t sum1 = vdupq_n_f32(0.0F);
+    float32x4_t sum2 = vdupq_n_f32(0.0F);
+    float32x4_t sum3 = vdupq_n_f32(0.0F);
+    for (uint64_t i = 0; i < Dim; i += 16) {
+        float32x4_t diff0 = vsubq_f32(vld1q_f32(query + i), vld1q_f32(codes + i));
+        float32x4_t diff1 = vsubq_f32(vld1q_f32(query + i + 4), vld1q_f32(codes + i + 4));
+        float32x4_t diff2 = vsubq_f32(vld1q_f32(query + i + 8), vld1q_f32(codes + i + 8));
+        float32x4_t diff3 = vsubq_f32(vld1q_f32(query + i + 12), vld1q_f32(codes + i + 12));
+        sum0 = vfmaq_f32(sum0, diff0, diff0);
+        sum1 = vfmaq_f32(sum1, diff1, diff1);
+        sum2 = vfmaq_f32(sum2, diff2, diff2);
+        sum3 = vfmaq_f32(sum3, diff3, diff3);
+    }
+    return vaddvq_f32(vaddq_f32(vaddq_f32(sum0, sum1), vaddq_f32(sum2, sum3)));
+}
+#endif
+
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim) {
+#if defined(ENABLE_NEON)
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_ip_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return generic::FP32ComputeIPFixedDim(dim);
+#endif
+}
+
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim) {
+#if defined(ENABLE_NEON)
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_l2sqr_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return generic::FP32ComputeL2SqrFixedDim(dim);
+#endif
+}
+
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim) {
+    return generic::SQ8ComputeIPFixedDim(dim);
+}
+
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim) {
+    return generic::SQ8ComputeL2SqrFixedDim(dim);
+}
+
 }  // namespace vsag::neon
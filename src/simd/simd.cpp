@@ -71,6 +71,16 @@ setup_simd() {
     ret.dist_support_avx512vpopcntdq = true;
 #endif
 
+    ret.runtime_has_avx512vnni = cpuinfo_has_x86_avx512vnni();
+#ifdef ENABLE_AVX512VNNI
+    ret.dist_support_avx512vnni = true;
+#endif
+
+    ret.runtime_has_avx512bf16 = cpuinfo_has_x86_avx512bf16();
+#ifdef ENABLE_AVX512BF16
+    ret.dist_support_avx512bf16 = true;
+#endif
+
     if (cpuinfo_has_arm_neon()) {
         ret.runtime_has_neon = true;
 #ifndef ENABLE_NEON
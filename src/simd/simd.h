@@ -30,6 +30,7 @@
 #include "rabitq_simd.h"
 #include "simd_marco.h"
 #include "simd_status.h"
+#include "sparse_simd.h"
 #include "sq4_simd.h"
 #include "sq4_uniform_simd.h"
 #include "sq8_simd.h"
@@ -33,6 +33,8 @@ public:
     bool dist_support_avx512vl = false;
     bool dist_support_neon = false;
     bool dist_support_avx512vpopcntdq = false;
+    bool dist_support_avx512vnni = false;
+    bool dist_support_avx512bf16 = false;
     bool runtime_has_sse = false;
     bool runtime_has_avx = false;
     bool runtime_has_avx2 = false;
@@ -42,6 +44,8 @@ public:
     bool runtime_has_avx512vl = false;
     bool runtime_has_neon = false;
     bool runtime_has_avx512vpopcntdq = false;
+    bool runtime_has_avx512vnni = false;
+    bool runtime_has_avx512bf16 = false;
 
     static bool is_inited;
 
@@ -75,6 +79,26 @@ public:
 #endif
     }
 
+    static inline bool
+    SupportAVX512VNNI() {
+        Init();
+#if defined(ENABLE_AVX512VNNI)
+        return SupportAVX512() and cpuinfo_has_x86_avx512vnni();
+#else
+        return false;
+#endif
+    }
+
+    static inline bool
+    SupportAVX512BF16() {
+        Init();
+#if defined(ENABLE_AVX512BF16)
+        return SupportAVX512() and cpuinfo_has_x86_avx512bf16();
+#else
+        return false;
+#endif
+    }
+
     static inline bool
     SupportAVX2() {
         Init();
@@ -163,6 +187,16 @@ public:
         return status_to_string(dist_support_avx512vpopcntdq, runtime_has_avx512vpopcntdq);
     }
 
+    [[nodiscard]] std::string
+    avx512vnni() const {
+        return status_to_string(dist_support_avx512vnni, runtime_has_avx512vnni);
+    }
+
+    [[nodiscard]] std::string
+    avx512bf16() const {
+        return status_to_string(dist_support_avx512bf16, runtime_has_avx512bf16);
+    }
+
     static std::string
     boolean_to_string(bool value) {
         if (value) {
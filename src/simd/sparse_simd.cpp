@@ -0,0 +1,75 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparse_simd.h"
+
+#include "simd_status.h"
+
+namespace vsag {
+
+static SparseAccumulateType
+GetSparseAccumulate() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::SparseAccumulate;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::SparseAccumulate;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::SparseAccumulate;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::SparseAccumulate;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::SparseAccumulate;
+#endif
+    }
+    return generic::SparseAccumulate;
+}
+SparseAccumulateType SparseAccumulate = GetSparseAccumulate();
+
+static SparseAccumulateSQ8Type
+GetSparseAccumulateSQ8() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::SparseAccumulateSQ8;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::SparseAccumulateSQ8;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::SparseAccumulateSQ8;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::SparseAccumulateSQ8;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::SparseAccumulateSQ8;
+#endif
+    }
+    return generic::SparseAccumulateSQ8;
+}
+SparseAccumulateSQ8Type SparseAccumulateSQ8 = GetSparseAccumulateSQ8();
+}  // namespace vsag
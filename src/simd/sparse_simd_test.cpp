@@ -0,0 +1,87 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparse_simd.h"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+#include "fixtures.h"
+#include "simd_status.h"
+
+using namespace vsag;
+
+static void
+check_dists(const std::vector<float>& gt, const std::vector<float>& dists) {
+    REQUIRE(gt.size() == dists.size());
+    for (size_t i = 0; i < gt.size(); ++i) {
+        REQUIRE(std::abs(gt[i] - dists[i]) <= 1e-4F * std::max(1.0F, std::abs(gt[i])));
+    }
+}
+
+#define TEST_ACCURACY(Func, ...)                                        \
+    {                                                                   \
+        std::vector<float> gt(init_dists);                              \
+        generic::Func(__VA_ARGS__, gt.data());                          \
+        if (SimdStatus::SupportSSE()) {                                 \
+            std::vector<float> dists(init_dists);                       \
+            sse::Func(__VA_ARGS__, dists.data());                       \
+            check_dists(gt, dists);                                     \
+        }                                                               \
+        if (SimdStatus::SupportAVX()) {                                 \
+            std::vector<float> dists(init_dists);                       \
+            avx::Func(__VA_ARGS__, dists.data());                       \
+            check_dists(gt, dists);                                     \
+        }                                                               \
+        if (SimdStatus::SupportAVX2()) {                                \
+            std::vector<float> dists(init_dists);                       \
+            avx2::Func(__VA_ARGS__, dists.data());                      \
+            check_dists(gt, dists);                                     \
+        }                                                               \
+        if (SimdStatus::SupportAVX512()) {                              \
+            std::vector<float> dists(init_dists);                       \
+            avx512::Func(__VA_ARGS__, dists.data());                    \
+            check_dists(gt, dists);                                     \
+        }                                                               \
+        if (SimdStatus::SupportNEON()) {                                \
+            std::vector<float> dists(init_dists);                       \
+            neon::Func(__VA_ARGS__, dists.data());                      \
+            check_dists(gt, dists);                                     \
+        }                                                               \
+        std::vector<float> dists(init_dists);                           \
+        Func(__VA_ARGS__, dists.data());                                \
+        check_dists(gt, dists);                                         \
+    }
+
+TEST_CASE("Sparse SIMD Accumulate", "[ut][simd]") {
+    constexpr uint32_t window_size = 1000;
+    const std::vector<uint32_t> counts = {1, 7, 8, 15, 16, 33, 100, 513, window_size};
+    std::mt19937 rng(fixtures::RandomValue(0, 9999));
+    std::vector<uint32_t> ids(window_size);
+    std::iota(ids.begin(), ids.end(), 0);
+    auto init_dists = fixtures::generate_vectors(1, window_size, false, 17);
+    for (auto count : counts) {
+        std::shuffle(ids.begin(), ids.end(), rng);
+        auto datas = fixtures::generate_vectors(1, count, false, static_cast<int>(count));
+        auto codes = fixtures::generate_uint8_codes(1, count, static_cast<int>(count));
+        float query_val = -0.75F;
+        TEST_ACCURACY(SparseAccumulate, query_val, ids.data(), datas.data(), count);
+        TEST_ACCURACY(
+            SparseAccumulateSQ8, query_val, ids.data(), codes.data(), -0.5F, 2.0F, count);
+    }
+}
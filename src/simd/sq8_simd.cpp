@@ -73,6 +73,114 @@ GetSQ8ComputeL2Sqr() {
 }
 SQ8ComputeType SQ8ComputeL2Sqr = GetSQ8ComputeL2Sqr();
 
+static SQ8ComputeBatchType
+GetSQ8ComputeIPBatch8() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::SQ8ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::SQ8ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::SQ8ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::SQ8ComputeIPBatch8;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::SQ8ComputeIPBatch8;
+#endif
+    }
+    return generic::SQ8ComputeIPBatch8;
+}
+SQ8ComputeBatchType SQ8ComputeIPBatch8 = GetSQ8ComputeIPBatch8();
+
+static SQ8ComputeBatchType
+GetSQ8ComputeL2SqrBatch8() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::SQ8ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::SQ8ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::SQ8ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::SQ8ComputeL2SqrBatch8;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::SQ8ComputeL2SqrBatch8;
+#endif
+    }
+    return generic::SQ8ComputeL2SqrBatch8;
+}
+SQ8ComputeBatchType SQ8ComputeL2SqrBatch8 = GetSQ8ComputeL2SqrBatch8();
+
+static SQ8ComputeBatchType
+GetSQ8ComputeIPBatch16() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::SQ8ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::SQ8ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::SQ8ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::SQ8ComputeIPBatch16;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::SQ8ComputeIPBatch16;
+#endif
+    }
+    return generic::SQ8ComputeIPBatch16;
+}
+SQ8ComputeBatchType SQ8ComputeIPBatch16 = GetSQ8ComputeIPBatch16();
+
+static SQ8ComputeBatchType
+GetSQ8ComputeL2SqrBatch16() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::SQ8ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::SQ8ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::SQ8ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::SQ8ComputeL2SqrBatch16;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::SQ8ComputeL2SqrBatch16;
+#endif
+    }
+    return generic::SQ8ComputeL2SqrBatch16;
+}
+SQ8ComputeBatchType SQ8ComputeL2SqrBatch16 = GetSQ8ComputeL2SqrBatch16();
+
 static SQ8ComputeCodesType
 GetSQ8ComputeCodesIP() {
     if (SimdStatus::SupportAVX512()) {
@@ -126,4 +234,71 @@ GetSQ8ComputeCodesL2Sqr() {
     return generic::SQ8ComputeCodesL2Sqr;
 }
 SQ8ComputeCodesType SQ8ComputeCodesL2Sqr = GetSQ8ComputeCodesL2Sqr();
+
+static SQ8ComputeFixedDimType
+GetSQ8ComputeIPFixedDim() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::SQ8ComputeIPFixedDim;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::SQ8ComputeIPFixedDim;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::SQ8ComputeIPFixedDim;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::SQ8ComputeIPFixedDim;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::SQ8ComputeIPFixedDim;
+#endif
+    }
+    return generic::SQ8ComputeIPFixedDim;
+}
+SQ8ComputeFixedDimType SQ8ComputeIPFixedDim = GetSQ8ComputeIPFixedDim();
+
+static SQ8ComputeFixedDimType
+GetSQ8ComputeL2SqrFixedDim() {
+    if (SimdStatus::SupportAVX512()) {
+#if defined(ENABLE_AVX512)
+        return avx512::SQ8ComputeL2SqrFixedDim;
+#endif
+    } else if (SimdStatus::SupportAVX2()) {
+#if defined(ENABLE_AVX2)
+        return avx2::SQ8ComputeL2SqrFixedDim;
+#endif
+    } else if (SimdStatus::SupportAVX()) {
+#if defined(ENABLE_AVX)
+        return avx::SQ8ComputeL2SqrFixedDim;
+#endif
+    } else if (SimdStatus::SupportSSE()) {
+#if defined(ENABLE_SSE)
+        return sse::SQ8ComputeL2SqrFixedDim;
+#endif
+    } else if (SimdStatus::SupportNEON()) {
+#if defined(ENABLE_NEON)
+        return neon::SQ8ComputeL2SqrFixedDim;
+#endif
+    }
+    return generic::SQ8ComputeL2SqrFixedDim;
+}
+SQ8ComputeFixedDimType SQ8ComputeL2SqrFixedDim = GetSQ8ComputeL2SqrFixedDim();
+
+SQ8ComputeType
+SelectSQ8ComputeIP(uint64_t dim) {
+    auto kernel = SQ8ComputeIPFixedDim(dim);
+    return kernel != nullptr ? kernel : SQ8ComputeIP;
+}
+
+SQ8ComputeType
+SelectSQ8ComputeL2Sqr(uint64_t dim) {
+    auto kernel = SQ8ComputeL2SqrFixedDim(dim);
+    return kernel != nullptr ? kernel : SQ8ComputeL2Sqr;
+}
+
 }  // namespace vsag
@@ -19,6 +19,13 @@
 
 #include "simd_marco.h"
 namespace vsag {
+
+using SQ8ComputeType = float (*)(const float* RESTRICT query,
+                                 const uint8_t* RESTRICT codes,
+                                 const float* RESTRICT lower_bound,
+                                 const float* RESTRICT diff,
+                                 uint64_t dim);
+
 namespace generic {
 float
 SQ8ComputeIP(const float* RESTRICT query,
@@ -44,6 +51,38 @@ SQ8ComputeCodesL2Sqr(const uint8_t* RESTRICT codes1,
                      const float* RESTRICT lower_bound,
                      const float* RESTRICT diff,
                      uint64_t dim);
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results);
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results);
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results);
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results);
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim);
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace generic
 
 namespace sse {
@@ -71,6 +110,38 @@ SQ8ComputeCodesL2Sqr(const uint8_t* RESTRICT codes1,
                      const float* RESTRICT lower_bound,
                      const float* RESTRICT diff,
                      uint64_t dim);
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results);
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results);
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results);
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results);
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim);
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace sse
 
 namespace avx {
@@ -98,6 +169,38 @@ SQ8ComputeCodesL2Sqr(const uint8_t* RESTRICT codes1,
                      const float* RESTRICT lower_bound,
                      const float* RESTRICT diff,
                      uint64_t dim);
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results);
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results);
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results);
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results);
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim);
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace avx
 
 namespace avx2 {
@@ -125,6 +228,38 @@ SQ8ComputeCodesL2Sqr(const uint8_t* RESTRICT codes1,
                      const float* RESTRICT lower_bound,
                      const float* RESTRICT diff,
                      uint64_t dim);
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results);
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results);
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results);
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results);
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim);
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace avx2
 
 namespace avx512 {
@@ -152,6 +287,38 @@ SQ8ComputeCodesL2Sqr(const uint8_t* RESTRICT codes1,
                      const float* RESTRICT lower_bound,
                      const float* RESTRICT diff,
                      uint64_t dim);
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results);
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results);
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results);
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results);
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim);
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace avx512
 
 namespace neon {
@@ -179,16 +346,54 @@ SQ8ComputeCodesL2Sqr(const uint8_t* RESTRICT codes1,
                      const float* RESTRICT lower_bound,
                      const float* RESTRICT diff,
                      uint64_t dim);
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results);
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results);
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results);
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results);
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim);
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim);
 }  // namespace neon
 
-using SQ8ComputeType = float (*)(const float* RESTRICT query,
-                                 const uint8_t* RESTRICT codes,
-                                 const float* RESTRICT lower_bound,
-                                 const float* RESTRICT diff,
-                                 uint64_t dim);
 extern SQ8ComputeType SQ8ComputeIP;
 extern SQ8ComputeType SQ8ComputeL2Sqr;
 
+using SQ8ComputeBatchType = void (*)(const float* RESTRICT query,
+                                     const uint8_t* const* codes,
+                                     const float* RESTRICT lower_bound,
+                                     const float* RESTRICT diff,
+                                     uint64_t dim,
+                                     float* results);
+extern SQ8ComputeBatchType SQ8ComputeIPBatch8;
+extern SQ8ComputeBatchType SQ8ComputeL2SqrBatch8;
+extern SQ8ComputeBatchType SQ8ComputeIPBatch16;
+extern SQ8ComputeBatchType SQ8ComputeL2SqrBatch16;
+
 using SQ8ComputeCodesType = float (*)(const uint8_t* RESTRICT codes1,
                                       const uint8_t* RESTRICT codes2,
                                       const float* RESTRICT lower_bound,
@@ -197,4 +402,17 @@ using SQ8ComputeCodesType = float (*)(const uint8_t* RESTRICT codes1,
 
 extern SQ8ComputeCodesType SQ8ComputeCodesIP;
 extern SQ8ComputeCodesType SQ8ComputeCodesL2Sqr;
+
+// returns the kernel specialized for dim (see FIXED_DIMS), nullptr if there is none
+using SQ8ComputeFixedDimType = SQ8ComputeType (*)(uint64_t dim);
+extern SQ8ComputeFixedDimType SQ8ComputeIPFixedDim;
+extern SQ8ComputeFixedDimType SQ8ComputeL2SqrFixedDim;
+
+// the kernel specialized for dim if there is one, SQ8ComputeIP otherwise
+SQ8ComputeType
+SelectSQ8ComputeIP(uint64_t dim);
+
+// the kernel specialized for dim if there is one, SQ8ComputeL2Sqr otherwise
+SQ8ComputeType
+SelectSQ8ComputeL2Sqr(uint64_t dim);
 }  // namespace vsag
@@ -18,6 +18,7 @@
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include "fixed_dim.h"
 #include "fixtures.h"
 #include "simd_status.h"
 
@@ -95,6 +96,108 @@ TEST_CASE("SQ8 SIMD Compute", "[ut][simd]") {
     }
 }
 
+#define TEST_FIXED_DIM_ACCURACY(Simd, Supported, Func)                                             \
+    if (Supported) {                                                                               \
+        auto kernel = Simd::Func##FixedDim(dim);                                                   \
+        REQUIRE(kernel != nullptr);                                                                \
+        for (uint64_t i = 0; i < count; ++i) {                                                     \
+            auto gt = generic::Func(                                                               \
+                vec1.data() + i * dim, vec2.data() + i * dim, lb.data(), diff.data(), dim);        \
+            auto result =                                                                          \
+                kernel(vec1.data() + i * dim, vec2.data() + i * dim, lb.data(), diff.data(), dim); \
+            REQUIRE(fixtures::dist_t(gt) == fixtures::dist_t(result));                             \
+        }                                                                                          \
+    }
+
+TEST_CASE("SQ8 SIMD Compute Fixed Dim", "[ut][simd]") {
+    int64_t count = 20;
+    for (auto dim : FIXED_DIMS) {
+        auto vec1 = fixtures::generate_vectors(count * 2, dim);
+        std::vector<uint8_t> vec2(count * dim);
+        std::transform(vec1.begin() + count * dim, vec1.end(), vec2.begin(), [](float x) {
+            return uint64_t(x * 255.0);
+        });
+        auto lb = fixtures::generate_vectors(1, dim, true, 183);
+        auto diff = fixtures::generate_vectors(1, dim, true, 657);
+        TEST_FIXED_DIM_ACCURACY(generic, true, SQ8ComputeIP);
+        TEST_FIXED_DIM_ACCURACY(generic, true, SQ8ComputeL2Sqr);
+        TEST_FIXED_DIM_ACCURACY(sse, SimdStatus::SupportSSE(), SQ8ComputeIP);
+        TEST_FIXED_DIM_ACCURACY(sse, SimdStatus::SupportSSE(), SQ8ComputeL2Sqr);
+        TEST_FIXED_DIM_ACCURACY(avx, SimdStatus::SupportAVX(), SQ8ComputeIP);
+        TEST_FIXED_DIM_ACCURACY(avx, SimdStatus::SupportAVX(), SQ8ComputeL2Sqr);
+        TEST_FIXED_DIM_ACCURACY(avx2, SimdStatus::SupportAVX2(), SQ8ComputeIP);
+        TEST_FIXED_DIM_ACCURACY(avx2, SimdStatus::SupportAVX2(), SQ8ComputeL2Sqr);
+        TEST_FIXED_DIM_ACCURACY(avx512, SimdStatus::SupportAVX512(), SQ8ComputeIP);
+        TEST_FIXED_DIM_ACCURACY(avx512, SimdStatus::SupportAVX512(), SQ8ComputeL2Sqr);
+        TEST_FIXED_DIM_ACCURACY(neon, SimdStatus::SupportNEON(), SQ8ComputeIP);
+        TEST_FIXED_DIM_ACCURACY(neon, SimdStatus::SupportNEON(), SQ8ComputeL2Sqr);
+    }
+
+    // a dim without a specialized kernel falls back to the runtime dim kernel
+    REQUIRE(generic::SQ8ComputeIPFixedDim(100) == nullptr);
+    REQUIRE(SelectSQ8ComputeIP(100) == SQ8ComputeIP);
+    REQUIRE(SelectSQ8ComputeL2Sqr(100) == SQ8ComputeL2Sqr);
+}
+
+#define TEST_ACCURACY_BATCH(Func, FuncBatch, BatchSize)                                         \
+    {                                                                                           \
+        const auto* query = vec1.data() + i * dim;                                              \
+        std::vector<const uint8_t*> codes(BatchSize);                                           \
+        std::vector<float> gts(BatchSize);                                                      \
+        for (uint64_t j = 0; j < BatchSize; ++j) {                                              \
+            codes[j] = vec2.data() + (i + j) * dim;                                             \
+            gts[j] = generic::Func(query, codes[j], lb.data(), diff.data(), dim);               \
+        }                                                                                       \
+        std::vector<float> result(BatchSize);                                                   \
+        auto check_result = [&]() {                                                             \
+            for (uint64_t j = 0; j < BatchSize; ++j) {                                          \
+                REQUIRE(fixtures::dist_t(gts[j]) == fixtures::dist_t(result[j]));               \
+            }                                                                                   \
+        };                                                                                      \
+        generic::FuncBatch(query, codes.data(), lb.data(), diff.data(), dim, result.data());    \
+        check_result();                                                                         \
+        if (SimdStatus::SupportSSE()) {                                                         \
+            sse::FuncBatch(query, codes.data(), lb.data(), diff.data(), dim, result.data());    \
+            check_result();                                                                     \
+        }                                                                                       \
+        if (SimdStatus::SupportAVX()) {                                                         \
+            avx::FuncBatch(query, codes.data(), lb.data(), diff.data(), dim, result.data());    \
+            check_result();                                                                     \
+        }                                                                                       \
+        if (SimdStatus::SupportAVX2()) {                                                        \
+            avx2::FuncBatch(query, codes.data(), lb.data(), diff.data(), dim, result.data());   \
+            check_result();                                                                     \
+        }                                                                                       \
+        if (SimdStatus::SupportAVX512()) {                                                      \
+            avx512::FuncBatch(query, codes.data(), lb.data(), diff.data(), dim, result.data()); \
+            check_result();                                                                     \
+        }                                                                                       \
+        if (SimdStatus::SupportNEON()) {                                                        \
+            neon::FuncBatch(query, codes.data(), lb.data(), diff.data(), dim, result.data());   \
+            check_result();                                                                     \
+        }                                                                                       \
+    }                                                                                          
+
+TEST_CASE("SQ8 SIMD Compute Batch", "[ut][simd]") {
+    auto dims = fixtures::get_common_used_dims();
+    int64_t count = 100;
+    for (const auto& dim : dims) {
+        auto vec1 = fixtures::generate_vectors(count * 2, dim);
+        std::vector<uint8_t> vec2(count * dim);
+        std::transform(vec1.begin() + count * dim, vec1.end(), vec2.begin(), [](float x) {
+            return uint64_t(x * 255.0);
+        });
+        auto lb = fixtures::generate_vectors(1, dim, true, 183);
+        auto diff = fixtures::generate_vectors(1, dim, true, 657);
+        for (uint64_t i = 0; i + 16 <= count; i += 16) {
+            TEST_ACCURACY_BATCH(SQ8ComputeIP, SQ8ComputeIPBatch8, 8);
+            TEST_ACCURACY_BATCH(SQ8ComputeL2Sqr, SQ8ComputeL2SqrBatch8, 8);
+            TEST_ACCURACY_BATCH(SQ8ComputeIP, SQ8ComputeIPBatch16, 16);
+            TEST_ACCURACY_BATCH(SQ8ComputeL2Sqr, SQ8ComputeL2SqrBatch16, 16);
+        }
+    }
+}
+
 #define BENCHMARK_SIMD_COMPUTE(Simd, Comp)                                                         \
     BENCHMARK_ADVANCED(#Simd #Comp) {                                                              \
         for (int i = 0; i < count; ++i) {                                                          \
@@ -21,7 +21,11 @@ namespace vsag {
 
 static SQ8UniformComputeCodesType
 GetSQ8UniformComputeCodesIP() {
-    if (SimdStatus::SupportAVX512()) {
+    if (SimdStatus::SupportAVX512VNNI()) {
+#if defined(ENABLE_AVX512VNNI)
+        return avx512vnni::SQ8UniformComputeCodesIP;
+#endif
+    } else if (SimdStatus::SupportAVX512()) {
 #if defined(ENABLE_AVX512)
         return avx512::SQ8UniformComputeCodesIP;
 #endif
@@ -55,6 +55,13 @@ SQ8UniformComputeCodesIP(const uint8_t* RESTRICT codes1,
                          uint64_t dim);
 }  // namespace avx512
 
+namespace avx512vnni {
+float
+SQ8UniformComputeCodesIP(const uint8_t* RESTRICT codes1,
+                         const uint8_t* RESTRICT codes2,
+                         uint64_t dim);
+}  // namespace avx512vnni
+
 namespace neon {
 float
 SQ8UniformComputeCodesIP(const uint8_t* RESTRICT codes1,
@@ -19,6 +19,7 @@
 
 #include <cmath>
 
+#include "fixed_dim.h"
 #include "simd.h"
 
 #define PORTABLE_ALIGN32 __attribute__((aligned(32)))
@@ -267,6 +268,46 @@ FP32ComputeL2SqrBatch4(const float* RESTRICT query,
 #endif
 }
 
+void
+FP32ComputeIPBatch8(const float* RESTRICT query,
+                    uint64_t dim,
+                    const float* const* codes,
+                    float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP32ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeL2SqrBatch8(const float* RESTRICT query,
+                       uint64_t dim,
+                       const float* const* codes,
+                       float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP32ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeIPBatch16(const float* RESTRICT query,
+                     uint64_t dim,
+                     const float* const* codes,
+                     float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP32ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP32ComputeL2SqrBatch16(const float* RESTRICT query,
+                        uint64_t dim,
+                        const float* const* codes,
+                        float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP32ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
 void
 FP32Sub(const float* x, const float* y, float* z, uint64_t dim) {
 #if defined(ENABLE_SSE)
@@ -458,6 +499,46 @@ FP16ComputeL2Sqr(const uint8_t* RESTRICT query, const uint8_t* RESTRICT codes, u
     return generic::FP16ComputeL2Sqr(query, codes, dim);
 }
 
+void
+FP16ComputeIPBatch8(const uint8_t* RESTRICT query,
+                    const uint8_t* const* codes,
+                    uint64_t dim,
+                    float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP16ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeL2SqrBatch8(const uint8_t* RESTRICT query,
+                       const uint8_t* const* codes,
+                       uint64_t dim,
+                       float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = FP16ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeIPBatch16(const uint8_t* RESTRICT query,
+                     const uint8_t* const* codes,
+                     uint64_t dim,
+                     float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP16ComputeIP(query, codes[i], dim);
+    }
+}
+
+void
+FP16ComputeL2SqrBatch16(const uint8_t* RESTRICT query,
+                        const uint8_t* const* codes,
+                        uint64_t dim,
+                        float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = FP16ComputeL2Sqr(query, codes[i], dim);
+    }
+}
+
 float
 INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
 #if defined(ENABLE_SSE)
@@ -498,6 +579,42 @@ INT8ComputeL2Sqr(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uin
 #endif
 }
 
+float
+INT8ComputeIP(const int8_t* RESTRICT query, const int8_t* RESTRICT codes, uint64_t dim) {
+#if defined(ENABLE_SSE)
+    constexpr int64_t BATCH_SIZE{8};
+
+    const uint64_t n = dim / BATCH_SIZE;
+
+    if (n == 0) {
+        return generic::INT8ComputeIP(query, codes, dim);
+    }
+
+    __m128i sum = _mm_setzero_si128();
+
+    for (uint64_t i = 0; i < n; ++i) {
+        __m128i q = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(query + BATCH_SIZE * i));
+        __m128i c = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(codes + BATCH_SIZE * i));
+
+        __m128i q_low = _mm_cvtepi8_epi16(q);
+        __m128i c_low = _mm_cvtepi8_epi16(c);
+
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(q_low, c_low));
+    }
+
+    alignas(16) int32_t result[BATCH_SIZE / 2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(result), sum);
+    int32_t ip = result[0] + result[1] + result[2] + result[3];
+
+    ip += static_cast<int32_t>(generic::INT8ComputeIP(
+        query + BATCH_SIZE * n, codes + BATCH_SIZE * n, dim - BATCH_SIZE * n));
+
+    return static_cast<float>(ip);
+#else
+    return generic::INT8ComputeIP(query, codes, dim);
+#endif
+}
+
 float
 SQ8ComputeIP(const float* RESTRICT query,
              const uint8_t* RESTRICT codes,
@@ -582,6 +699,54 @@ SQ8ComputeL2Sqr(const float* RESTRICT query,
 #endif
 }
 
+void
+SQ8ComputeIPBatch8(const float* RESTRICT query,
+                   const uint8_t* const* codes,
+                   const float* RESTRICT lower_bound,
+                   const float* RESTRICT diff,
+                   uint64_t dim,
+                   float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = SQ8ComputeIP(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeL2SqrBatch8(const float* RESTRICT query,
+                      const uint8_t* const* codes,
+                      const float* RESTRICT lower_bound,
+                      const float* RESTRICT diff,
+                      uint64_t dim,
+                      float* results) {
+    for (int i = 0; i < 8; ++i) {
+        results[i] = SQ8ComputeL2Sqr(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeIPBatch16(const float* RESTRICT query,
+                    const uint8_t* const* codes,
+                    const float* RESTRICT lower_bound,
+                    const float* RESTRICT diff,
+                    uint64_t dim,
+                    float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = SQ8ComputeIP(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
+void
+SQ8ComputeL2SqrBatch16(const float* RESTRICT query,
+                       const uint8_t* const* codes,
+                       const float* RESTRICT lower_bound,
+                       const float* RESTRICT diff,
+                       uint64_t dim,
+                       float* results) {
+    for (int i = 0; i < 16; ++i) {
+        results[i] = SQ8ComputeL2Sqr(query, codes[i], lower_bound, diff, dim);
+    }
+}
+
 float
 SQ8ComputeCodesIP(const uint8_t* RESTRICT codes1,
                   const uint8_t* RESTRICT codes2,
@@ -1030,4 +1195,109 @@ KacsWalk(float* data, size_t len) {
     return generic::KacsWalk(data, len);
 #endif
 }
+
+void
+SparseAccumulate(float query_val,
+                 const uint32_t* RESTRICT ids,
+                 const float* RESTRICT datas,
+                 uint32_t count,
+                 float* RESTRICT dists) {
+    generic::SparseAccumulate(query_val, ids, datas, count, dists);
+}
+
+void
+SparseAccumulateSQ8(float query_val,
+                    const uint32_t* RESTRICT ids,
+                    const uint8_t* RESTRICT codes,
+                    float lower_bound,
+                    float diff,
+                    uint32_t count,
+                    float* RESTRICT dists) {
+    generic::SparseAccumulateSQ8(query_val, ids, codes, lower_bound, diff, count, dists);
+}
+
+#if defined(ENABLE_SSE)
+template <uint64_t Dim>
+static float
+fp32_compute_ip_fixed_dim(const float* RESTRICT query,
+                          const float* RESTRICT codes,
+                          uint64_t /*dim*/) {
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    __m128 sum2 = _mm_setzero_ps();
+    __m128 sum3 = _mm_setzero_ps();
+    for (uint64_t i = 0; i < Dim; i += 16) {
+        __m128 prod0 = _mm_mul_ps(_mm_loadu_ps(query + i), _mm_loadu_ps(codes + i));
+        __m128 prod1 = _mm_mul_ps(_mm_loadu_ps(query + i + 4), _mm_loadu_ps(codes + i + 4));
+        __m128 prod2 = _mm_mul_ps(_mm_loadu_ps(query + i + 8), _mm_loadu_ps(codes + i + 8));
+        __m128 prod3 = _mm_mul_ps(_mm_loadu_ps(query + i + 12), _mm_loadu_ps(codes + i + 12));
+        sum0 = _mm_add_ps(sum0, prod0);
+        sum1 = _mm_add_ps(sum1, prod1);
+        sum2 = _mm_add_ps(sum2, prod2);
+        sum3 = _mm_add_ps(sum3, prod3);
+    }
+    __m128 sum = _mm_add_ps(_mm_add_ps(sum0, sum1), _mm_add_ps(sum2, sum3));
+    alignas(16) float result[4];
+    _mm_store_ps(result, sum);
+    return result[0] + result[1] + result[2] + result[3];
+}
+
+template <uint64_t Dim>
+static float
+fp32_compute_l2sqr_fixed_dim(const float* RESTRICT query,
+                             const float* RESTRICT codes,
+                             uint64_t /*dim*/) {
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+    __m128 sum2 = _mm_setzero_ps();
+    __m128 sum3 = _mm_setzero_ps();
+    for (uint64_t i = 0; i < Dim; i += 16) {
+        __m128 diff0 = _mm_sub_ps(_mm_loadu_ps(query + i), _mm_loadu_ps(codes + i));
+        __m128 diff1 = _mm_sub_ps(_mm_loadu_ps(query + i + 4), _mm_loadu_ps(codes + i + 4));
+        __m128 diff2 = _mm_sub_ps(_mm_loadu_ps(query + i + 8), _mm_loadu_ps(codes + i + 8));
+        __m128 diff3 = _mm_sub_ps(_mm_loadu_ps(query + i + 12), _mm_loadu_ps(codes + i + 12));
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(diff0, diff0));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(diff1, diff1));
+        sum2 = _mm_add_ps(sum2, _mm_mul_ps(diff2, diff2));
+        sum3 = _mm_add_ps(sum3, _mm_mul_ps(diff3, diff3));
+    }
+    __m128 sum = _mm_add_ps(_mm_add_ps(sum0, sum1), _mm_add_ps(sum2, sum3));
+    alignas(16) float result[4];
+    _mm_store_ps(result, sum);
+    return result[0] + result[1] + result[2] + result[3];
+}
+#endif
+
+FP32ComputeType
+FP32ComputeIPFixedDim(uint64_t dim) {
+#if defined(ENABLE_SSE)
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_ip_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return generic::FP32ComputeIPFixedDim(dim);
+#endif
+}
+
+FP32ComputeType
+FP32ComputeL2SqrFixedDim(uint64_t dim) {
+#if defined(ENABLE_SSE)
+    return SelectFixedDimKernel<FP32ComputeType>(dim, [](auto fixed_dim) -> FP32ComputeType {
+        return fp32_compute_l2sqr_fixed_dim<decltype(fixed_dim)::value>;
+    });
+#else
+    return generic::FP32ComputeL2SqrFixedDim(dim);
+#endif
+}
+
+SQ8ComputeType
+SQ8ComputeIPFixedDim(uint64_t dim) {
+    return generic::SQ8ComputeIPFixedDim(dim);
+}
+
+SQ8ComputeType
+SQ8ComputeL2SqrFixedDim(uint64_t dim) {
+    return generic::SQ8ComputeL2SqrFixedDim(dim);
+}
+
 }  // namespace vsag::sse
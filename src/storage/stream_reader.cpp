@@ -15,9 +15,14 @@
 
 #include "stream_reader.h"
 
+#include <fcntl.h>
 #include <fmt/format.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 
@@ -167,6 +172,23 @@ BufferStreamReader::~BufferStreamReader() {
     allocator_->Deallocate(buffer_);
 }
 
+bool
+BufferStreamReader::SupportDirectData() const {
+    return reader_impl_->SupportDirectData();
+}
+
+std::shared_ptr<const uint8_t>
+BufferStreamReader::DirectData(uint64_t size) {
+    if (not reader_impl_->SupportDirectData()) {
+        return nullptr;
+    }
+    // drop the cached bytes and move the underlying reader to the logical cursor
+    this->Seek(this->GetCursor());
+    auto data = reader_impl_->DirectData(size);
+    cursor_ += size;
+    return data;
+}
+
 uint64_t
 SliceStreamReader::Length() {
     return length_;
@@ -197,6 +219,25 @@ SliceStreamReader::GetCursor() const {
     return cursor_;
 }
 
+bool
+SliceStreamReader::SupportDirectData() const {
+    return reader_impl_->SupportDirectData();
+}
+
+std::shared_ptr<const uint8_t>
+SliceStreamReader::DirectData(uint64_t size) {
+    if (not reader_impl_->SupportDirectData()) {
+        return nullptr;
+    }
+    if (cursor_ + size > length_) {
+        throw vsag::VsagException(vsag::ErrorType::READ_ERROR,
+                                  "SliceStreamReader: Read operation exceeds slice boundary");
+    }
+    auto data = reader_impl_->DirectData(size);
+    cursor_ += size;
+    return data;
+}
+
 SliceStreamReader::SliceStreamReader(StreamReader* reader, uint64_t begin, uint64_t length)
     : StreamReader(length), reader_impl_(reader), begin_(begin) {
     // vsag::logger::trace("SliceReader [{}, {})", begin_, begin_ + length_);
@@ -208,3 +249,74 @@ SliceStreamReader::SliceStreamReader(StreamReader* reader, uint64_t length)
     begin_ = reader->GetCursor();
     // vsag::logger::trace("SliceReader [{}, {})", begin_, begin_ + length_);
 }
+
+void
+MMapStreamReader::Read(char* data, uint64_t size) {
+    if (cursor_ + size > length_) {
+        throw vsag::VsagException(
+            vsag::ErrorType::READ_ERROR,
+            fmt::format("Attempted to read: {} bytes. Remaining content size: {} bytes.",
+                        size,
+                        length_ - cursor_));
+    }
+    memcpy(data, mapping_.get() + cursor_, size);
+    cursor_ += size;
+}
+
+void
+MMapStreamReader::Seek(uint64_t cursor) {
+    cursor_ = cursor;
+}
+
+uint64_t
+MMapStreamReader::GetCursor() const {
+    return cursor_;
+}
+
+std::shared_ptr<const uint8_t>
+MMapStreamReader::DirectData(uint64_t size) {
+    if (cursor_ + size > length_) {
+        throw vsag::VsagException(
+            vsag::ErrorType::READ_ERROR,
+            fmt::format("Attempted to map: {} bytes. Remaining content size: {} bytes.",
+                        size,
+                        length_ - cursor_));
+    }
+    // aliasing constructor, the pointer keeps the whole mapping alive
+    std::shared_ptr<const uint8_t> data(mapping_, mapping_.get() + cursor_);
+    cursor_ += size;
+    return data;
+}
+
+MMapStreamReader::MMapStreamReader(const std::string& file_path) {
+    auto fd = open(file_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw vsag::VsagException(
+            vsag::ErrorType::MISSING_FILE,
+            fmt::format("open file {} error {}", file_path, strerror(errno)));
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        throw vsag::VsagException(
+            vsag::ErrorType::READ_ERROR,
+            fmt::format("stat file {} error {}", file_path, strerror(errno)));
+    }
+    length_ = static_cast<uint64_t>(file_stat.st_size);
+    if (length_ == 0) {
+        close(fd);
+        return;
+    }
+    void* addr = mmap(nullptr, length_, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping holds its own reference to the file
+    close(fd);
+    if (addr == MAP_FAILED) {
+        throw vsag::VsagException(
+            vsag::ErrorType::READ_ERROR,
+            fmt::format("mmap file {} error {}", file_path, strerror(errno)));
+    }
+    auto length = length_;
+    mapping_ = std::shared_ptr<const uint8_t>(
+        static_cast<const uint8_t*>(addr),
+        [length](const uint8_t* ptr) { munmap(const_cast<uint8_t*>(ptr), length); });
+}
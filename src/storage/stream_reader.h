@@ -19,6 +19,7 @@
 #include <functional>
 #include <iostream>
 #include <istream>
+#include <memory>
 #include <stack>
 
 #include "../logger.h"
@@ -76,6 +77,24 @@ public:
         return length_;
     }
 
+    /// Whether DirectData can expose the underlying bytes without copying.
+    [[nodiscard]] virtual bool
+    SupportDirectData() const {
+        return false;
+    }
+
+    /**
+     * @brief Returns the next size bytes in place and advances the cursor.
+     *
+     * The returned pointer shares ownership of the underlying storage, so it stays valid
+     * after the reader is gone. Returns nullptr without moving the cursor if the reader
+     * does not support direct data.
+     */
+    [[nodiscard]] virtual std::shared_ptr<const uint8_t>
+    DirectData(uint64_t size) {
+        return nullptr;
+    }
+
 public:
     [[nodiscard]] SliceStreamReader
     Slice(uint64_t begin, uint64_t length);
@@ -162,6 +181,12 @@ public:
     [[nodiscard]] uint64_t
     GetCursor() const override;
 
+    [[nodiscard]] bool
+    SupportDirectData() const override;
+
+    [[nodiscard]] std::shared_ptr<const uint8_t>
+    DirectData(uint64_t size) override;
+
 public:
     explicit BufferStreamReader(StreamReader* reader, size_t max_size, vsag::Allocator* allocator);
 
@@ -192,6 +217,12 @@ public:
     [[nodiscard]] uint64_t
     GetCursor() const override;
 
+    [[nodiscard]] bool
+    SupportDirectData() const override;
+
+    [[nodiscard]] std::shared_ptr<const uint8_t>
+    DirectData(uint64_t size) override;
+
 public:
     // create a slice from specified position
     SliceStreamReader(StreamReader* reader, uint64_t begin, uint64_t length);
@@ -203,3 +234,37 @@ private:
     uint64_t begin_{0};
     uint64_t cursor_{0};
 };
+
+/**
+ * @brief Reads a serialized index from a read-only mapping of the whole file.
+ *
+ * DirectData hands out pointers into the mapping, which lets in-memory IO alias the file
+ * instead of copying it; pages are faulted in on first access. The mapping is released when
+ * the reader and every pointer it returned are gone.
+ */
+class MMapStreamReader : public StreamReader {
+public:
+    void
+    Read(char* data, uint64_t size) override;
+
+    void
+    Seek(uint64_t cursor) override;
+
+    [[nodiscard]] uint64_t
+    GetCursor() const override;
+
+    [[nodiscard]] bool
+    SupportDirectData() const override {
+        return true;
+    }
+
+    [[nodiscard]] std::shared_ptr<const uint8_t>
+    DirectData(uint64_t size) override;
+
+public:
+    explicit MMapStreamReader(const std::string& file_path);
+
+private:
+    std::shared_ptr<const uint8_t> mapping_{nullptr};
+    uint64_t cursor_{0};
+};
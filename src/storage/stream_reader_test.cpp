@@ -18,6 +18,10 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <cstdint>
+#include <fstream>
+
+#include "fixtures.h"
+#include "impl/allocator/safe_allocator.h"
 
 // fill buffer with below and return a wrappered StreamReader object:
 // ['1' '1' ... repeats 1024 times]
@@ -112,3 +116,52 @@ TEST_CASE("SliceStreamReader", "[ut][stream_reader]") {
     // std::cout << std::string(read_buffer3, 24) << std::endl;
     REQUIRE(check_func(read_buffer3, '3', 24));
 }
+
+TEST_CASE("MMapStreamReader", "[ut][stream_reader]") {
+    fixtures::TempDir dir("mmap_stream_reader");
+    auto path = dir.GenerateRandomFile();
+    char buffer[4096]{};
+    {
+        gen_4k_data_and_return_stream_reader(buffer);
+        std::ofstream out(path, std::ios::binary);
+        out.write(buffer, 4096);
+    }
+
+    MMapStreamReader reader(path);
+    REQUIRE(reader.Length() == 4096);
+    REQUIRE(reader.SupportDirectData());
+
+    char ch{'0'};
+    reader.Seek(2048);
+    reader.Read(&ch, 1);
+    REQUIRE(ch == '3');
+    REQUIRE(reader.GetCursor() == 2049);
+
+    // direct data points into the mapping and advances the cursor
+    reader.Seek(1024);
+    auto data = reader.DirectData(1024);
+    REQUIRE(data != nullptr);
+    REQUIRE(memcmp(data.get(), buffer + 1024, 1024) == 0);
+    REQUIRE(reader.GetCursor() == 2048);
+    REQUIRE_THROWS(reader.DirectData(4096));
+
+    // slices and buffered readers forward direct data to the mapping
+    reader.Seek(3072);
+    auto slice = reader.Slice(1024);
+    REQUIRE(slice.SupportDirectData());
+    auto slice_data = slice.DirectData(1024);
+    REQUIRE(slice_data.get() == data.get() + 2048);
+
+    auto allocator = vsag::SafeAllocator::FactoryDefaultAllocator();
+    reader.Seek(0);
+    BufferStreamReader buffer_reader(&reader, 4096, allocator.get());
+    buffer_reader.Read(&ch, 1);
+    REQUIRE(ch == '1');
+    REQUIRE(buffer_reader.SupportDirectData());
+    auto buffer_data = buffer_reader.DirectData(1023);
+    REQUIRE(buffer_data.get() == data.get() - 1023);
+    buffer_reader.Read(&ch, 1);
+    REQUIRE(ch == '2');
+
+    REQUIRE_THROWS(MMapStreamReader(dir.path + "not_exist"));
+}
@@ -0,0 +1,125 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "lock_free_histogram.h"
+
+#include <cmath>
+
+namespace vsag {
+
+uint32_t
+LockFreeHistogram::BucketIndex(uint64_t value) {
+    if (value < (SUB_BUCKET_COUNT << 1)) {
+        return static_cast<uint32_t>(value);
+    }
+    auto msb = static_cast<uint32_t>(63 - __builtin_clzll(value));
+    auto sub = static_cast<uint32_t>((value >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1));
+    return (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + sub;
+}
+
+uint64_t
+LockFreeHistogram::BucketUpperBound(uint32_t index) {
+    if (index < (SUB_BUCKET_COUNT << 1)) {
+        return index;
+    }
+    auto msb = index / SUB_BUCKET_COUNT + SUB_BUCKET_BITS - 1;
+    auto sub = static_cast<uint64_t>(index % SUB_BUCKET_COUNT);
+    auto shift = msb - SUB_BUCKET_BITS;
+    auto lower = (SUB_BUCKET_COUNT + sub) << shift;
+    return lower + ((1ULL << shift) - 1);
+}
+
+void
+LockFreeHistogram::Record(uint64_t value) {
+    // max goes first, so a percentile clamped by it is rarely below the recorded value
+    auto cur_max = max_.load(std::memory_order_relaxed);
+    while (value > cur_max and
+           not max_.compare_exchange_weak(cur_max, value, std::memory_order_relaxed)) {
+    }
+    buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+uint64_t
+LockFreeHistogram::Count() const {
+    return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t
+LockFreeHistogram::Sum() const {
+    return sum_.load(std::memory_order_relaxed);
+}
+
+uint64_t
+LockFreeHistogram::Max() const {
+    return max_.load(std::memory_order_relaxed);
+}
+
+double
+LockFreeHistogram::Mean() const {
+    auto count = this->Count();
+    if (count == 0) {
+        return 0;
+    }
+    return static_cast<double>(this->Sum()) / static_cast<double>(count);
+}
+
+uint64_t
+LockFreeHistogram::Percentile(double ratio) const {
+    // the buckets are summed instead of using count_, they may be a few records ahead of it
+    uint64_t total = 0;
+    for (const auto& bucket : buckets_) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return 0;
+    }
+    ratio = std::min(std::max(ratio, 0.0), 1.0);
+    auto rank = std::max<uint64_t>(
+        static_cast<uint64_t>(std::ceil(ratio * static_cast<double>(total))), 1);
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(BucketUpperBound(i), this->Max());
+        }
+    }
+    return this->Max();
+}
+
+void
+LockFreeHistogram::Reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+JsonType
+LockFreeHistogram::ToJson() const {
+    JsonType json;
+    json["count"] = this->Count();
+    json["mean"] = this->Mean();
+    json["max"] = this->Max();
+    json["p50"] = this->Percentile(0.5);
+    json["p90"] = this->Percentile(0.9);
+    json["p99"] = this->Percentile(0.99);
+    json["p999"] = this->Percentile(0.999);
+    return json;
+}
+
+}  // namespace vsag
@@ -0,0 +1,74 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "typing.h"
+
+namespace vsag {
+
+// a histogram of non-negative integers which many threads record into without locks, each
+// power of two range is split into 2^SUB_BUCKET_BITS linear buckets, so a percentile is off by
+// at most 1 / 2^SUB_BUCKET_BITS of the value; the values below 2^(SUB_BUCKET_BITS + 1) are exact
+class LockFreeHistogram {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 2;
+    static constexpr uint32_t SUB_BUCKET_COUNT = 1U << SUB_BUCKET_BITS;
+    static constexpr uint32_t BUCKET_COUNT = 64 * SUB_BUCKET_COUNT;
+
+    LockFreeHistogram() = default;
+
+    void
+    Record(uint64_t value);
+
+    [[nodiscard]] uint64_t
+    Count() const;
+
+    [[nodiscard]] uint64_t
+    Sum() const;
+
+    [[nodiscard]] uint64_t
+    Max() const;
+
+    [[nodiscard]] double
+    Mean() const;
+
+    // the upper bound of the bucket holding the value at rank ceil(ratio * count), 0 if empty
+    [[nodiscard]] uint64_t
+    Percentile(double ratio) const;
+
+    void
+    Reset();
+
+    // count, mean, max and p50/p90/p99/p999
+    [[nodiscard]] JsonType
+    ToJson() const;
+
+    static uint32_t
+    BucketIndex(uint64_t value);
+
+    static uint64_t
+    BucketUpperBound(uint32_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+}  // namespace vsag
@@ -0,0 +1,95 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "lock_free_histogram.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+using namespace vsag;
+
+TEST_CASE("LockFreeHistogram Bucket Test", "[ut][LockFreeHistogram]") {
+    // small values are exact, larger values keep their bucket order
+    for (uint64_t value = 0; value < 8; ++value) {
+        REQUIRE(LockFreeHistogram::BucketIndex(value) == value);
+        REQUIRE(LockFreeHistogram::BucketUpperBound(value) == value);
+    }
+    uint32_t last_index = LockFreeHistogram::BucketIndex(7);
+    for (uint64_t value = 8; value < 100000; value += 7) {
+        auto index = LockFreeHistogram::BucketIndex(value);
+        REQUIRE(index >= last_index);
+        REQUIRE(index < LockFreeHistogram::BUCKET_COUNT);
+        auto upper = LockFreeHistogram::BucketUpperBound(index);
+        REQUIRE(upper >= value);
+        REQUIRE(upper - value <= value / LockFreeHistogram::SUB_BUCKET_COUNT);
+        last_index = index;
+    }
+    auto max_index = LockFreeHistogram::BucketIndex(std::numeric_limits<uint64_t>::max());
+    REQUIRE(max_index < LockFreeHistogram::BUCKET_COUNT);
+    REQUIRE(LockFreeHistogram::BucketUpperBound(max_index) ==
+            std::numeric_limits<uint64_t>::max());
+}
+
+TEST_CASE("LockFreeHistogram Percentile Test", "[ut][LockFreeHistogram]") {
+    LockFreeHistogram histogram;
+    REQUIRE(histogram.Count() == 0);
+    REQUIRE(histogram.Percentile(0.5) == 0);
+    REQUIRE(histogram.Mean() == 0);
+
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        histogram.Record(value);
+    }
+    REQUIRE(histogram.Count() == 1000);
+    REQUIRE(histogram.Sum() == 500500);
+    REQUIRE(histogram.Max() == 1000);
+    REQUIRE(histogram.Mean() == 500.5);
+
+    auto p50 = histogram.Percentile(0.5);
+    REQUIRE(p50 >= 500);
+    REQUIRE(p50 <= 500 + 500 / LockFreeHistogram::SUB_BUCKET_COUNT);
+    auto p99 = histogram.Percentile(0.99);
+    REQUIRE(p99 >= 990);
+    REQUIRE(p99 <= 1000);
+    REQUIRE(histogram.Percentile(1.0) == 1000);
+
+    auto json = histogram.ToJson();
+    REQUIRE(json["count"].get<uint64_t>() == 1000);
+    REQUIRE(json["p50"].get<uint64_t>() == p50);
+
+    histogram.Reset();
+    REQUIRE(histogram.Count() == 0);
+    REQUIRE(histogram.Max() == 0);
+}
+
+TEST_CASE("LockFreeHistogram Concurrent Record Test", "[ut][LockFreeHistogram]") {
+    LockFreeHistogram histogram;
+    uint64_t thread_count = 8;
+    uint64_t per_thread = 10000;
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            for (uint64_t i = 0; i < per_thread; ++i) {
+                histogram.Record(t * per_thread + i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto total = thread_count * per_thread;
+    REQUIRE(histogram.Count() == total);
+    REQUIRE(histogram.Sum() == total * (total - 1) / 2);
+    REQUIRE(histogram.Max() == total - 1);
+}
@@ -0,0 +1,159 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "numa.h"
+
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace vsag {
+
+// the memory policies of mbind(2), numaif.h belongs to libnuma and is not required
+static constexpr int NUMA_MPOL_PREFERRED = 1;
+static constexpr int NUMA_MPOL_INTERLEAVE = 3;
+static constexpr uint64_t NUMA_MAX_NODES = 1024;
+
+static std::string
+read_sysfs(const std::string& path) {
+    std::ifstream file(path);
+    std::string content;
+    std::getline(file, content);
+    return content;
+}
+
+std::vector<uint32_t>
+ParseNumaIdList(const std::string& list) {
+    std::vector<uint32_t> ids;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty()) {
+            continue;
+        }
+        try {
+            auto dash = range.find('-');
+            auto first = static_cast<uint32_t>(std::stoul(range.substr(0, dash)));
+            auto last = dash == std::string::npos
+                            ? first
+                            : static_cast<uint32_t>(std::stoul(range.substr(dash + 1)));
+            for (auto id = first; id <= last; ++id) {
+                ids.emplace_back(id);
+            }
+        } catch (const std::exception&) {
+            return {};
+        }
+    }
+    return ids;
+}
+
+uint32_t
+NumaNodeCount() {
+    static const uint32_t count = []() -> uint32_t {
+        auto nodes = ParseNumaIdList(read_sysfs("/sys/devices/system/node/online"));
+        if (nodes.empty()) {
+            return 1;
+        }
+        return std::min<uint32_t>(nodes.back() + 1, NUMA_MAX_NODES);
+    }();
+    return count;
+}
+
+std::vector<uint32_t>
+NumaNodeCpus(uint32_t node) {
+    return ParseNumaIdList(
+        read_sysfs("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+}
+
+uint32_t
+CurrentNumaNode() {
+    if (NumaNodeCount() == 1) {
+        return 0;
+    }
+#if defined(SYS_getcpu)
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0 and node < NumaNodeCount()) {
+        return node;
+    }
+#endif
+    return 0;
+}
+
+bool
+PinThreadToNumaNode(uint32_t node) {
+    auto cpus = NumaNodeCpus(node);
+    if (cpus.empty()) {
+        return false;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (auto cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+    return sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+}
+
+static bool
+set_memory_policy(void* addr, uint64_t size, int mode, const std::vector<uint64_t>& node_mask) {
+#if defined(SYS_mbind)
+    if (addr == nullptr or size == 0) {
+        return false;
+    }
+    // mbind works on whole pages, the partial pages at both ends are covered as well
+    auto page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    auto begin = reinterpret_cast<uint64_t>(addr) & ~(page_size - 1);
+    auto end = reinterpret_cast<uint64_t>(addr) + size;
+    auto max_node = static_cast<uint64_t>(node_mask.size()) * 64 + 1;
+    return syscall(SYS_mbind,
+                   reinterpret_cast<void*>(begin),
+                   end - begin,
+                   mode,
+                   node_mask.data(),
+                   max_node,
+                   0) == 0;
+#else
+    return false;
+#endif
+}
+
+bool
+BindMemoryToNumaNode(void* addr, uint64_t size, uint32_t node) {
+    if (NumaNodeCount() == 1 or node >= NumaNodeCount()) {
+        return false;
+    }
+    std::vector<uint64_t> node_mask((NumaNodeCount() + 63) / 64, 0);
+    node_mask[node / 64] |= 1ULL << (node % 64);
+    return set_memory_policy(addr, size, NUMA_MPOL_PREFERRED, node_mask);
+}
+
+bool
+InterleaveMemoryOnNumaNodes(void* addr, uint64_t size) {
+    if (NumaNodeCount() == 1) {
+        return false;
+    }
+    std::vector<uint64_t> node_mask((NumaNodeCount() + 63) / 64, 0);
+    for (uint32_t node = 0; node < NumaNodeCount(); ++node) {
+        node_mask[node / 64] |= 1ULL << (node % 64);
+    }
+    return set_memory_policy(addr, size, NUMA_MPOL_INTERLEAVE, node_mask);
+}
+
+}  // namespace vsag
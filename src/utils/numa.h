@@ -0,0 +1,53 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vsag {
+
+// thin wrappers of the linux numa syscalls and sysfs, no libnuma is required; on a machine
+// with one node (or without numa support) they report node 0 and placement is a no-op
+
+// the count of online numa nodes, at least 1
+uint32_t
+NumaNodeCount();
+
+// the cpus of node, empty if it is unknown
+std::vector<uint32_t>
+NumaNodeCpus(uint32_t node);
+
+// the node of the cpu the calling thread runs on
+uint32_t
+CurrentNumaNode();
+
+// pins the calling thread to the cpus of node, returns false if it fails
+bool
+PinThreadToNumaNode(uint32_t node);
+
+// prefers node for the pages of [addr, addr + size) which are not touched yet
+bool
+BindMemoryToNumaNode(void* addr, uint64_t size, uint32_t node);
+
+// spreads the pages of [addr, addr + size) which are not touched yet over all nodes
+bool
+InterleaveMemoryOnNumaNodes(void* addr, uint64_t size);
+
+// parses a sysfs cpu or node list like "0-3,8,10-11"
+std::vector<uint32_t>
+ParseNumaIdList(const std::string& list);
+
+}  // namespace vsag
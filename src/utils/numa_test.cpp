@@ -0,0 +1,42 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "numa.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+using namespace vsag;
+
+TEST_CASE("Numa Id List Parse Test", "[ut][Numa]") {
+    REQUIRE(ParseNumaIdList("0") == std::vector<uint32_t>{0});
+    REQUIRE(ParseNumaIdList("0-3") == std::vector<uint32_t>{0, 1, 2, 3});
+    REQUIRE(ParseNumaIdList("0-1,4,6-7") == std::vector<uint32_t>{0, 1, 4, 6, 7});
+    REQUIRE(ParseNumaIdList("").empty());
+    REQUIRE(ParseNumaIdList("a-b").empty());
+}
+
+TEST_CASE("Numa Topology Test", "[ut][Numa]") {
+    auto node_count = NumaNodeCount();
+    REQUIRE(node_count >= 1);
+    REQUIRE(CurrentNumaNode() < node_count);
+
+    std::vector<uint8_t> buffer(1024 * 1024);
+    if (node_count == 1) {
+        // placement is a no-op without numa
+        REQUIRE_FALSE(BindMemoryToNumaNode(buffer.data(), buffer.size(), 0));
+        REQUIRE_FALSE(InterleaveMemoryOnNumaNodes(buffer.data(), buffer.size()));
+    }
+    REQUIRE_FALSE(BindMemoryToNumaNode(buffer.data(), buffer.size(), node_count));
+}
@@ -0,0 +1,87 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "search_statistics.h"
+
+#include <exception>
+
+namespace vsag {
+
+static uint64_t
+to_microseconds(double ms) {
+    return static_cast<uint64_t>(ms * 1000.0);
+}
+
+void
+SearchStatisticsCollector::Record(const SearchStatistics& stats) {
+    total_time_us_.Record(to_microseconds(stats.total_time_ms));
+    graph_time_us_.Record(to_microseconds(stats.graph_time_ms));
+    distance_time_us_.Record(to_microseconds(stats.distance_time_ms));
+    io_time_us_.Record(to_microseconds(stats.io_time_ms));
+    hops_.Record(stats.hops);
+    dist_cmp_.Record(stats.dist_cmp);
+    io_bytes_.Record(stats.io_bytes);
+    filter_rejections_.Record(stats.filter_rejections);
+}
+
+JsonType
+SearchStatisticsCollector::ToJson() const {
+    JsonType json;
+    json["total_time_us"] = total_time_us_.ToJson();
+    json["graph_time_us"] = graph_time_us_.ToJson();
+    json["distance_time_us"] = distance_time_us_.ToJson();
+    json["io_time_us"] = io_time_us_.ToJson();
+    json["hops"] = hops_.ToJson();
+    json["dist_cmp"] = dist_cmp_.ToJson();
+    json["io_bytes"] = io_bytes_.ToJson();
+    json["filter_rejections"] = filter_rejections_.ToJson();
+    return json;
+}
+
+void
+SearchStatisticsCollector::Reset() {
+    total_time_us_.Reset();
+    graph_time_us_.Reset();
+    distance_time_us_.Reset();
+    io_time_us_.Reset();
+    hops_.Reset();
+    dist_cmp_.Reset();
+    io_bytes_.Reset();
+    filter_rejections_.Reset();
+}
+
+SearchStatisticsScope::SearchStatisticsScope(SearchStatistics* stats,
+                                             SearchStatisticsCollector* collector)
+    : stats_(stats), previous_(current_search_statistics), collector_(collector) {
+    if (stats_ != nullptr) {
+        *stats_ = SearchStatistics();
+        current_search_statistics = stats_;
+        start_ = StatisticsClock::now();
+        uncaught_exceptions_ = std::uncaught_exceptions();
+    }
+}
+
+SearchStatisticsScope::~SearchStatisticsScope() {
+    if (stats_ == nullptr) {
+        return;
+    }
+    current_search_statistics = previous_;
+    stats_->total_time_ms = ElapsedMilliseconds(start_);
+    // a failed search is not recorded
+    if (collector_ != nullptr and std::uncaught_exceptions() == uncaught_exceptions_) {
+        collector_->Record(*stats_);
+    }
+}
+
+}  // namespace vsag
@@ -0,0 +1,131 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+#include <algorithm>
+#include <chrono>
+
+#include "lock_free_histogram.h"
+#include "typing.h"
+#include "vsag/search_request.h"
+
+namespace vsag {
+
+// the statistics of the search running on this thread, nullptr when it is not requested,
+// the io layer adds the reads of non-memory ios to it
+inline thread_local SearchStatistics* current_search_statistics = nullptr;
+
+using StatisticsClock = std::chrono::steady_clock;
+
+inline double
+ElapsedMilliseconds(const StatisticsClock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(StatisticsClock::now() - start).count();
+}
+
+// counts one io call into the current search statistics, a no-op when there is none
+class IOStatisticsGuard {
+public:
+    IOStatisticsGuard(uint64_t bytes, uint64_t count) : stats_(current_search_statistics) {
+        if (stats_ != nullptr) {
+            stats_->io_bytes += bytes;
+            stats_->io_count += count;
+            start_ = StatisticsClock::now();
+        }
+    }
+
+    ~IOStatisticsGuard() {
+        if (stats_ != nullptr) {
+            stats_->io_time_ms += ElapsedMilliseconds(start_);
+        }
+    }
+
+private:
+    SearchStatistics* stats_{nullptr};
+    StatisticsClock::time_point start_;
+};
+
+// splits the time of a search into stages, the io issued inside a stage is counted in
+// io_time_ms instead of the stage, a no-op when stats is nullptr
+class SearchStageTimer {
+public:
+    explicit SearchStageTimer(SearchStatistics* stats) : stats_(stats) {
+    }
+
+    inline void
+    Start() {
+        if (stats_ != nullptr) {
+            start_ = StatisticsClock::now();
+            io_time_ms_ = stats_->io_time_ms;
+        }
+    }
+
+    // adds the time since Start to the stage field, e.g. &SearchStatistics::graph_time_ms
+    inline void
+    Stop(double SearchStatistics::*stage) {
+        if (stats_ != nullptr) {
+            auto io_time_ms = stats_->io_time_ms - io_time_ms_;
+            stats_->*stage += std::max(ElapsedMilliseconds(start_) - io_time_ms, 0.0);
+        }
+    }
+
+private:
+    SearchStatistics* stats_{nullptr};
+    StatisticsClock::time_point start_;
+    double io_time_ms_{0};
+};
+
+// the per index aggregation of the searches which requested statistics
+class SearchStatisticsCollector {
+public:
+    void
+    Record(const SearchStatistics& stats);
+
+    [[nodiscard]] JsonType
+    ToJson() const;
+
+    void
+    Reset();
+
+private:
+    LockFreeHistogram total_time_us_;
+    LockFreeHistogram graph_time_us_;
+    LockFreeHistogram distance_time_us_;
+    LockFreeHistogram io_time_us_;
+    LockFreeHistogram hops_;
+    LockFreeHistogram dist_cmp_;
+    LockFreeHistogram io_bytes_;
+    LockFreeHistogram filter_rejections_;
+};
+
+// resets stats and installs it as the statistics of this thread for the scope of one search,
+// at the end the total time is filled and the search is recorded into collector
+class SearchStatisticsScope {
+public:
+    SearchStatisticsScope(SearchStatistics* stats, SearchStatisticsCollector* collector);
+
+    ~SearchStatisticsScope();
+
+    SearchStatisticsScope(const SearchStatisticsScope&) = delete;
+    SearchStatisticsScope&
+    operator=(const SearchStatisticsScope&) = delete;
+
+private:
+    SearchStatistics* stats_{nullptr};
+    SearchStatistics* previous_{nullptr};
+    SearchStatisticsCollector* collector_{nullptr};
+    StatisticsClock::time_point start_;
+    int uncaught_exceptions_{0};
+};
+
+}  // namespace vsag
@@ -0,0 +1,84 @@
+
+// Copyright 2024-present the vsag project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "search_statistics.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+
+using namespace vsag;
+
+TEST_CASE("SearchStatisticsScope Test", "[ut][SearchStatistics]") {
+    SearchStatisticsCollector collector;
+    SearchStatistics stats;
+    stats.hops = 100;
+
+    {
+        // no statistics requested, the io counters go nowhere
+        SearchStatisticsScope scope(nullptr, &collector);
+        REQUIRE(current_search_statistics == nullptr);
+        IOStatisticsGuard guard(4096, 1);
+    }
+    REQUIRE(collector.ToJson()["hops"]["count"].get<uint64_t>() == 0);
+
+    {
+        SearchStatisticsScope scope(&stats, &collector);
+        REQUIRE(stats.hops == 0);
+        REQUIRE(current_search_statistics == &stats);
+        {
+            IOStatisticsGuard guard(4096, 2);
+        }
+        {
+            IOStatisticsGuard guard(1024, 1);
+        }
+        stats.hops = 7;
+    }
+    REQUIRE(current_search_statistics == nullptr);
+    REQUIRE(stats.io_bytes == 5120);
+    REQUIRE(stats.io_count == 3);
+    REQUIRE(stats.total_time_ms >= stats.io_time_ms);
+    auto json = collector.ToJson();
+    REQUIRE(json["hops"]["count"].get<uint64_t>() == 1);
+    REQUIRE(json["hops"]["max"].get<uint64_t>() == 7);
+    REQUIRE(json["io_bytes"]["max"].get<uint64_t>() == 5120);
+
+    // a failed search is not recorded
+    REQUIRE_THROWS_AS(
+        [&]() {
+            SearchStatisticsScope scope(&stats, &collector);
+            throw std::runtime_error("search failed");
+        }(),
+        std::runtime_error);
+    REQUIRE(collector.ToJson()["hops"]["count"].get<uint64_t>() == 1);
+
+    collector.Reset();
+    REQUIRE(collector.ToJson()["hops"]["count"].get<uint64_t>() == 0);
+}
+
+TEST_CASE("SearchStageTimer Test", "[ut][SearchStatistics]") {
+    SearchStatistics stats;
+    SearchStageTimer timer(&stats);
+    timer.Start();
+    stats.io_time_ms += 1e6;  // io inside the stage is not counted to the stage
+    timer.Stop(&SearchStatistics::graph_time_ms);
+    REQUIRE(stats.graph_time_ms == 0);
+
+    timer.Start();
+    timer.Stop(&SearchStatistics::distance_time_ms);
+    REQUIRE(stats.distance_time_ms >= 0);
+
+    SearchStageTimer empty_timer(nullptr);
+    empty_timer.Start();
+    empty_timer.Stop(&SearchStatistics::graph_time_ms);
+}
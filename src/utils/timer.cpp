@@ -36,6 +36,13 @@ Timer::Record() {
 
 bool
 Timer::CheckOvertime() {
+    if (cancel_flag_ != nullptr and cancel_flag_->load(std::memory_order_relaxed)) {
+        return true;
+    }
+    if (deadline_ != std::chrono::steady_clock::time_point::max() and
+        std::chrono::steady_clock::now() > deadline_) {
+        return true;
+    }
     if (threshold_ == std::numeric_limits<double>::max()) {
         return false;
     }
@@ -48,6 +55,16 @@ Timer::SetThreshold(double threshold) {
     threshold_ = threshold;
 }
 
+void
+Timer::SetDeadline(std::chrono::steady_clock::time_point deadline) {
+    deadline_ = deadline;
+}
+
+void
+Timer::SetCancelFlag(std::shared_ptr<std::atomic<bool>> cancel_flag) {
+    cancel_flag_ = std::move(cancel_flag);
+}
+
 Timer::~Timer() {
     auto finish = std::chrono::steady_clock::now();
     std::chrono::duration<double, std::milli> duration = finish - start;
@@ -14,7 +14,10 @@
 // limitations under the License.
 
 #pragma once
+#include <atomic>
 #include <chrono>
+#include <limits>
+#include <memory>
 
 namespace vsag {
 class Timer {
@@ -33,12 +36,22 @@ public:
     void
     SetThreshold(double threshold);
 
+    // CheckOvertime also turns true at this time point
+    void
+    SetDeadline(std::chrono::steady_clock::time_point deadline);
+
+    // CheckOvertime also turns true once the flag is set
+    void
+    SetCancelFlag(std::shared_ptr<std::atomic<bool>> cancel_flag);
+
     bool
     CheckOvertime();
 
 private:
     double* ref_{nullptr};
     double threshold_{std::numeric_limits<double>::max()};
+    std::chrono::steady_clock::time_point deadline_{std::chrono::steady_clock::time_point::max()};
+    std::shared_ptr<std::atomic<bool>> cancel_flag_{nullptr};
     std::chrono::steady_clock::time_point start;
 };
 }  // namespace vsag
@@ -15,25 +15,241 @@
 
 #include "visited_list.h"
 
+#include <algorithm>
 #include <limits>
 
 namespace vsag {
-VisitedList::VisitedList(InnerIdType max_size, Allocator* allocator)
+VisitedList::VisitedList(InnerIdType max_size, Allocator* allocator, VisitedListMode mode)
+    : max_size_(max_size),
+      allocator_(allocator),
+      mode_(mode == VisitedListMode::AUTO ? VisitedListMode::DENSE : mode) {
+    if (mode_ == VisitedListMode::DENSE) {
+        this->list_ = reinterpret_cast<VisitedListType*>(
+            allocator_->Allocate((uint64_t)max_size * sizeof(VisitedListType)));
+        memset(list_, 0, max_size_ * sizeof(VisitedListType));
+    } else if (mode_ == VisitedListMode::SPARSE) {
+        block_count_ = ((uint64_t)max_size >> SPARSE_BLOCK_BITS) + 1;
+        blocks_ =
+            reinterpret_cast<uint64_t**>(allocator_->Allocate(block_count_ * sizeof(uint64_t*)));
+        block_epochs_ =
+            reinterpret_cast<uint64_t*>(allocator_->Allocate(block_count_ * sizeof(uint64_t)));
+        memset(static_cast<void*>(blocks_), 0, block_count_ * sizeof(uint64_t*));
+        memset(block_epochs_, 0, block_count_ * sizeof(uint64_t));
+    } else {
+        bloom_ = reinterpret_cast<uint64_t*>(allocator_->Allocate((1ULL << HASH_BLOOM_BITS) / 8));
+        memset(bloom_, 0, (1ULL << HASH_BLOOM_BITS) / 8);
+        this->hash_resize(HASH_INIT_CAPACITY);
+    }
+    tag_ = 1;
+}
+
+VisitedList::~VisitedList() {
+    if (list_ != nullptr) {
+        allocator_->Deallocate(list_);
+    }
+    if (blocks_ != nullptr) {
+        for (uint64_t i = 0; i < block_count_; ++i) {
+            if (blocks_[i] != nullptr) {
+                allocator_->Deallocate(blocks_[i]);
+            }
+        }
+        allocator_->Deallocate(blocks_);
+        allocator_->Deallocate(block_epochs_);
+    }
+    if (table_ != nullptr) {
+        allocator_->Deallocate(bloom_);
+        allocator_->Deallocate(table_);
+    }
+}
+
+void
+VisitedList::Reset() {
+    ++reset_count_;
+    if (mode_ == VisitedListMode::DENSE) {
+        if (tag_ == std::numeric_limits<VisitedListType>::max()) {
+            memset(list_, 0, max_size_ * sizeof(VisitedListType));
+            tag_ = 0;
+        }
+        ++tag_;
+    } else if (mode_ == VisitedListMode::SPARSE) {
+        ++epoch_;
+        if (reset_count_ % COMPACT_INTERVAL == 0) {
+            for (uint64_t i = 0; i < block_count_; ++i) {
+                if (blocks_[i] != nullptr and epoch_ - block_epochs_[i] > COMPACT_INTERVAL) {
+                    allocator_->Deallocate(blocks_[i]);
+                    blocks_[i] = nullptr;
+                    --allocated_block_count_;
+                }
+            }
+        }
+    } else {
+        max_size_in_window_ = std::max(max_size_in_window_, size_);
+        if (reset_count_ % COMPACT_INTERVAL == 0) {
+            auto new_capacity = static_cast<uint64_t>(HASH_INIT_CAPACITY);
+            while (new_capacity < max_size_in_window_ * 2) {
+                new_capacity <<= 1;
+            }
+            max_size_in_window_ = 0;
+            if (new_capacity < capacity_) {
+                this->hash_resize(new_capacity);
+            }
+        }
+        if (size_ > 0) {
+            memset(bloom_, 0, (1ULL << HASH_BLOOM_BITS) / 8);
+            memset(static_cast<void*>(table_), 0xFF, capacity_ * sizeof(InnerIdType));
+            size_ = 0;
+        }
+    }
+}
+
+uint64_t
+VisitedList::GetMemoryUsage() const {
+    if (mode_ == VisitedListMode::DENSE) {
+        return max_size_ * sizeof(VisitedListType);
+    }
+    if (mode_ == VisitedListMode::SPARSE) {
+        return block_count_ * (sizeof(uint64_t*) + sizeof(uint64_t)) +
+               allocated_block_count_ * SPARSE_BLOCK_WORDS * sizeof(uint64_t);
+    }
+    return (1ULL << HASH_BLOOM_BITS) / 8 + capacity_ * sizeof(InnerIdType);
+}
+
+void
+VisitedList::sparse_set(InnerIdType id) {
+    auto block_id = id >> SPARSE_BLOCK_BITS;
+    auto*& block = blocks_[block_id];
+    if (block_epochs_[block_id] != epoch_) {
+        if (block == nullptr) {
+            block = reinterpret_cast<uint64_t*>(
+                allocator_->Allocate(SPARSE_BLOCK_WORDS * sizeof(uint64_t)));
+            ++allocated_block_count_;
+        }
+        memset(block, 0, SPARSE_BLOCK_WORDS * sizeof(uint64_t));
+        block_epochs_[block_id] = epoch_;
+    }
+    block[(id & SPARSE_BLOCK_MASK) >> 6] |= 1ULL << (id & 63);
+}
+
+void
+VisitedList::hash_set(InnerIdType id) {
+    if ((size_ + 1) * 2 > capacity_) {
+        this->hash_resize(capacity_ * 2);
+    }
+    auto h = hash_id(id);
+    auto bloom_mask = (1ULL << HASH_BLOOM_BITS) - 1;
+    auto b1 = h & bloom_mask;
+    auto b2 = (h >> HASH_BLOOM_BITS) & bloom_mask;
+    bloom_[b1 >> 6] |= 1ULL << (b1 & 63);
+    bloom_[b2 >> 6] |= 1ULL << (b2 & 63);
+    auto mask = capacity_ - 1;
+    for (auto pos = h & mask;; pos = (pos + 1) & mask) {
+        if (table_[pos] == id) {
+            return;
+        }
+        if (table_[pos] == HASH_EMPTY) {
+            table_[pos] = id;
+            ++size_;
+            return;
+        }
+    }
+}
+
+void
+VisitedList::hash_resize(uint64_t new_capacity) {
+    auto* old_table = table_;
+    auto old_capacity = capacity_;
+    table_ = reinterpret_cast<InnerIdType*>(
+        allocator_->Allocate(new_capacity * sizeof(InnerIdType)));
+    memset(static_cast<void*>(table_), 0xFF, new_capacity * sizeof(InnerIdType));
+    capacity_ = new_capacity;
+    if (old_table == nullptr) {
+        return;
+    }
+    auto mask = capacity_ - 1;
+    for (uint64_t i = 0; i < old_capacity; ++i) {
+        auto id = old_table[i];
+        if (id == HASH_EMPTY) {
+            continue;
+        }
+        for (auto pos = hash_id(id) & mask;; pos = (pos + 1) & mask) {
+            if (table_[pos] == HASH_EMPTY) {
+                table_[pos] = id;
+                break;
+            }
+        }
+    }
+    allocator_->Deallocate(old_table);
+}
+
+AdaptiveVisitedListPool::AdaptiveVisitedListPool(uint64_t init_size,
+                                                 Allocator* allocator,
+                                                 InnerIdType max_size,
+                                                 uint32_t max_degree,
+                                                 VisitedListMode mode)
+    : max_size_(max_size), max_degree_(max_degree), mode_(mode) {
+    // only the pool of the initial mode is filled, the others grow when taken from
+    auto init_mode = this->SelectMode(0);
+    auto make_pool = [&](VisitedListMode pool_mode) {
+        return std::make_shared<VisitedListPool>(
+            pool_mode == init_mode ? init_size : 0, allocator, max_size, allocator, pool_mode);
+    };
+    dense_pool_ = make_pool(VisitedListMode::DENSE);
+    sparse_pool_ = make_pool(VisitedListMode::SPARSE);
+    hash_pool_ = make_pool(VisitedListMode::HASH);
+}
+
+VisitedListMode
+AdaptiveVisitedListPool::SelectMode(uint64_t ef) const {
+    if (mode_ != VisitedListMode::AUTO) {
+        return mode_;
+    }
+    if (max_size_ <= DENSE_VISITED_LIST_MAX_SIZE) {
+        return VisitedListMode::DENSE;
+    }
+    if (std::max(ef, (uint64_t)1) * max_degree_ <= HASH_VISITED_LIST_MAX_VISITS) {
+        return VisitedListMode::HASH;
+    }
+    return VisitedListMode::SPARSE;
+}
+
+const std::shared_ptr<VisitedListPool>&
+AdaptiveVisitedListPool::GetPool(VisitedListMode mode) const {
+    if (mode == VisitedListMode::SPARSE) {
+        return sparse_pool_;
+    }
+    if (mode == VisitedListMode::HASH) {
+        return hash_pool_;
+    }
+    return dense_pool_;
+}
+
+VisitedListPtr
+AdaptiveVisitedListPool::TakeOne(uint64_t ef) {
+    return this->GetPool(this->SelectMode(ef))->TakeOne();
+}
+
+void
+AdaptiveVisitedListPool::ReturnOne(VisitedListPtr& obj) {
+    this->GetPool(obj->Mode())->ReturnOne(obj);
+}
+
+ConcurrentVisitedList::ConcurrentVisitedList(InnerIdType max_size, Allocator* allocator)
     : max_size_(max_size), allocator_(allocator) {
-    this->list_ = reinterpret_cast<VisitedListType*>(
+    static_assert(sizeof(std::atomic<VisitedListType>) == sizeof(VisitedListType));
+    this->list_ = reinterpret_cast<std::atomic<VisitedListType>*>(
         allocator_->Allocate((uint64_t)max_size * sizeof(VisitedListType)));
-    memset(list_, 0, max_size_ * sizeof(VisitedListType));
+    memset(static_cast<void*>(list_), 0, max_size_ * sizeof(VisitedListType));
     tag_ = 1;
 }
 
-VisitedList::~VisitedList() {
+ConcurrentVisitedList::~ConcurrentVisitedList() {
     allocator_->Deallocate(list_);
 }
 
 void
-VisitedList::Reset() {
+ConcurrentVisitedList::Reset() {
     if (tag_ == std::numeric_limits<VisitedListType>::max()) {
-        memset(list_, 0, max_size_ * sizeof(VisitedListType));
+        memset(static_cast<void*>(list_), 0, max_size_ * sizeof(VisitedListType));
         tag_ = 0;
     }
     ++tag_;
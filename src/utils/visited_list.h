@@ -14,7 +14,9 @@
 // limitations under the License.
 
 #pragma once
+#include <atomic>
 #include <cstring>
+#include <limits>
 
 #include "prefetch.h"
 #include "resource_object.h"
@@ -24,43 +26,240 @@
 
 namespace vsag {
 
+enum class VisitedListMode {
+    AUTO = 0,    // chosen per search by AdaptiveVisitedListPool, a single list treats it as DENSE
+    DENSE = 1,   // one uint16 tag per element, the fastest but 2 bytes * max_size
+    SPARSE = 2,  // two-level bitmap, a 8KB block is allocated only when an id inside is visited
+    HASH = 3,    // bloom filter plus small hash set, the memory only depends on the visited count
+};
+
+// a dense list is always used when an index holds no more than this count of elements
+static constexpr InnerIdType DENSE_VISITED_LIST_MAX_SIZE = 1U << 22;
+// a hash list is used when ef * max_degree is no more than this count
+static constexpr uint64_t HASH_VISITED_LIST_MAX_VISITS = 1ULL << 16;
+
 class VisitedList : public ResourceObject {
 public:
     using VisitedListType = uint16_t;
 
+    static constexpr uint32_t SPARSE_BLOCK_BITS = 16;
+    static constexpr uint32_t HASH_BLOOM_BITS = 16;
+    static constexpr uint32_t HASH_INIT_CAPACITY = 1U << 12;
+    // every this count of searches, Reset releases the sparse blocks not visited during them
+    // and shrinks the hash set to the largest size seen during them
+    static constexpr uint64_t COMPACT_INTERVAL = 64;
+
 public:
-    explicit VisitedList(InnerIdType max_size, Allocator* allocator);
+    explicit VisitedList(InnerIdType max_size,
+                         Allocator* allocator,
+                         VisitedListMode mode = VisitedListMode::DENSE);
     ~VisitedList() override;
 
     void
     Set(const InnerIdType& id) {
-        this->list_[id] = this->tag_;
+        if (this->mode_ == VisitedListMode::DENSE) {
+            this->list_[id] = this->tag_;
+        } else if (this->mode_ == VisitedListMode::SPARSE) {
+            this->sparse_set(id);
+        } else {
+            this->hash_set(id);
+        }
     }
 
     [[nodiscard]] bool
     Get(const InnerIdType& id) {
-        return this->list_[id] == this->tag_;
+        if (this->mode_ == VisitedListMode::DENSE) {
+            return this->list_[id] == this->tag_;
+        }
+        if (this->mode_ == VisitedListMode::SPARSE) {
+            auto block_id = id >> SPARSE_BLOCK_BITS;
+            return this->block_epochs_[block_id] == this->epoch_ and
+                   ((this->blocks_[block_id][(id & SPARSE_BLOCK_MASK) >> 6] >> (id & 63)) & 1) !=
+                       0;
+        }
+        return this->hash_get(id);
     }
 
     void
     Prefetch(const InnerIdType& id) {
-        PrefetchLines(this->list_ + id, 64);
+        if (this->mode_ == VisitedListMode::DENSE) {
+            PrefetchLines(this->list_ + id, 64);
+        } else if (this->mode_ == VisitedListMode::SPARSE) {
+            const auto* block = this->blocks_[id >> SPARSE_BLOCK_BITS];
+            if (block != nullptr) {
+                PrefetchLines(block + ((id & SPARSE_BLOCK_MASK) >> 6), 64);
+            }
+        } else {
+            PrefetchLines(this->table_ + (hash_id(id) & (this->capacity_ - 1)), 64);
+        }
     }
 
     void
     Reset() override;
 
+    [[nodiscard]] VisitedListMode
+    Mode() const {
+        return this->mode_;
+    }
+
+    // the bytes currently held by this list
+    [[nodiscard]] uint64_t
+    GetMemoryUsage() const;
+
+private:
+    static constexpr InnerIdType SPARSE_BLOCK_MASK = (1U << SPARSE_BLOCK_BITS) - 1;
+    static constexpr uint64_t SPARSE_BLOCK_WORDS = (1ULL << SPARSE_BLOCK_BITS) / 64;
+    static constexpr InnerIdType HASH_EMPTY = std::numeric_limits<InnerIdType>::max();
+
+    static inline uint64_t
+    hash_id(InnerIdType id) {
+        return (static_cast<uint64_t>(id) * 0x9E3779B97F4A7C15ULL) >> 32;
+    }
+
+    void
+    sparse_set(InnerIdType id);
+
+    bool
+    hash_get(InnerIdType id) const {
+        auto h = hash_id(id);
+        auto bloom_mask = (1ULL << HASH_BLOOM_BITS) - 1;
+        auto b1 = h & bloom_mask;
+        auto b2 = (h >> HASH_BLOOM_BITS) & bloom_mask;
+        if (((bloom_[b1 >> 6] >> (b1 & 63)) & (bloom_[b2 >> 6] >> (b2 & 63)) & 1) == 0) {
+            return false;
+        }
+        auto mask = this->capacity_ - 1;
+        for (auto pos = h & mask;; pos = (pos + 1) & mask) {
+            if (this->table_[pos] == id) {
+                return true;
+            }
+            if (this->table_[pos] == HASH_EMPTY) {
+                return false;
+            }
+        }
+    }
+
+    void
+    hash_set(InnerIdType id);
+
+    void
+    hash_resize(uint64_t new_capacity);
+
 private:
     Allocator* const allocator_{nullptr};
 
+    const VisitedListMode mode_{VisitedListMode::DENSE};
+
+    // dense
     VisitedListType* list_{nullptr};
 
     VisitedListType tag_{1};
 
     const InnerIdType max_size_{0};
+
+    // sparse, a block holds valid bits only when its epoch equals the current one,
+    // so Reset does not touch the blocks and a block is cleared when first visited in an epoch
+    uint64_t** blocks_{nullptr};
+    uint64_t* block_epochs_{nullptr};
+    uint64_t block_count_{0};
+    uint64_t allocated_block_count_{0};
+    uint64_t epoch_{1};
+
+    // hash
+    uint64_t* bloom_{nullptr};
+    InnerIdType* table_{nullptr};
+    uint64_t capacity_{0};
+    uint64_t size_{0};
+    uint64_t max_size_in_window_{0};
+
+    uint64_t reset_count_{0};
 };
 
 using VisitedListPool = ResourceObjectPool<VisitedList>;
 using VisitedListPtr = std::shared_ptr<VisitedList>;
 
+/*
+ * keeps one pool for each kind of visited list, and picks the kind for every search
+ * by the index size and the ef of the search when the mode is AUTO
+ */
+class AdaptiveVisitedListPool {
+public:
+    AdaptiveVisitedListPool(uint64_t init_size,
+                            Allocator* allocator,
+                            InnerIdType max_size,
+                            uint32_t max_degree,
+                            VisitedListMode mode = VisitedListMode::AUTO);
+
+    VisitedListPtr
+    TakeOne(uint64_t ef = 0);
+
+    void
+    ReturnOne(VisitedListPtr& obj);
+
+    [[nodiscard]] VisitedListMode
+    SelectMode(uint64_t ef) const;
+
+    [[nodiscard]] const std::shared_ptr<VisitedListPool>&
+    GetPool(VisitedListMode mode) const;
+
+private:
+    const InnerIdType max_size_{0};
+
+    const uint32_t max_degree_{0};
+
+    const VisitedListMode mode_{VisitedListMode::AUTO};
+
+    std::shared_ptr<VisitedListPool> dense_pool_{nullptr};
+    std::shared_ptr<VisitedListPool> sparse_pool_{nullptr};
+    std::shared_ptr<VisitedListPool> hash_pool_{nullptr};
+};
+
+using AdaptiveVisitedListPoolPtr = std::shared_ptr<AdaptiveVisitedListPool>;
+
+/*
+ * lock-free visited list shared by the workers of one parallel search,
+ * TestAndSet returns whether the id was already visited and marks it atomically
+ */
+class ConcurrentVisitedList : public ResourceObject {
+public:
+    using VisitedListType = uint16_t;
+
+public:
+    explicit ConcurrentVisitedList(InnerIdType max_size, Allocator* allocator);
+    ~ConcurrentVisitedList() override;
+
+    [[nodiscard]] bool
+    TestAndSet(const InnerIdType& id) {
+        if (this->list_[id].load(std::memory_order_relaxed) == this->tag_) {
+            return true;
+        }
+        return this->list_[id].exchange(this->tag_, std::memory_order_relaxed) == this->tag_;
+    }
+
+    [[nodiscard]] bool
+    Get(const InnerIdType& id) const {
+        return this->list_[id].load(std::memory_order_relaxed) == this->tag_;
+    }
+
+    void
+    Prefetch(const InnerIdType& id) {
+        PrefetchLines(this->list_ + id, 64);
+    }
+
+    void
+    Reset() override;
+
+private:
+    Allocator* const allocator_{nullptr};
+
+    std::atomic<VisitedListType>* list_{nullptr};
+
+    VisitedListType tag_{1};
+
+    const InnerIdType max_size_{0};
+};
+
+using ConcurrentVisitedListPool = ResourceObjectPool<ConcurrentVisitedList>;
+using ConcurrentVisitedListPtr = std::shared_ptr<ConcurrentVisitedList>;
+
 }  // namespace vsag
@@ -16,6 +16,7 @@
 #include "visited_list.h"
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <thread>
 
 #include "impl/allocator/default_allocator.h"
@@ -139,3 +140,111 @@ TEST_CASE("VisitedListPool Basic Test", "[ut][VisitedListPool]") {
         }
     }
 }
+
+TEST_CASE("VisitedList Modes Test", "[ut][VisitedList]") {
+    auto allocator = std::make_shared<DefaultAllocator>();
+    InnerIdType size = 1U << 20;
+    auto mode = GENERATE(VisitedListMode::DENSE, VisitedListMode::SPARSE, VisitedListMode::HASH);
+    auto vl_ptr = std::make_shared<VisitedList>(size, allocator.get(), mode);
+    REQUIRE(vl_ptr->Mode() == mode);
+
+    // more rounds than COMPACT_INTERVAL, and some rounds grow the hash set
+    for (int round = 0; round < 150; ++round) {
+        int count = round % 10 == 0 ? 20000 : 500;
+        std::unordered_set<InnerIdType> ids;
+        for (int i = 0; i < count; ++i) {
+            auto id = static_cast<InnerIdType>(random() % size);
+            ids.insert(id);
+            vl_ptr->Prefetch(id);
+            vl_ptr->Set(id);
+        }
+        for (auto& id : ids) {
+            REQUIRE(vl_ptr->Get(id));
+        }
+        for (int i = 0; i < 2000; ++i) {
+            auto id = static_cast<InnerIdType>(random() % size);
+            if (ids.count(id) == 0) {
+                REQUIRE_FALSE(vl_ptr->Get(id));
+            }
+        }
+        vl_ptr->Reset();
+        for (auto& id : ids) {
+            REQUIRE_FALSE(vl_ptr->Get(id));
+        }
+    }
+    if (mode != VisitedListMode::DENSE) {
+        REQUIRE(vl_ptr->GetMemoryUsage() < size * sizeof(VisitedList::VisitedListType));
+    }
+}
+
+TEST_CASE("AdaptiveVisitedListPool Basic Test", "[ut][VisitedListPool]") {
+    auto allocator = std::make_shared<DefaultAllocator>();
+    uint32_t max_degree = 32;
+
+    SECTION("small index always uses dense list") {
+        AdaptiveVisitedListPool pool(1, allocator.get(), 1000, max_degree);
+        REQUIRE(pool.SelectMode(10) == VisitedListMode::DENSE);
+        REQUIRE(pool.SelectMode(100000) == VisitedListMode::DENSE);
+    }
+
+    SECTION("large index selects by ef") {
+        AdaptiveVisitedListPool pool(
+            0, allocator.get(), DENSE_VISITED_LIST_MAX_SIZE + 1, max_degree);
+        REQUIRE(pool.SelectMode(10) == VisitedListMode::HASH);
+        REQUIRE(pool.SelectMode(HASH_VISITED_LIST_MAX_VISITS) == VisitedListMode::SPARSE);
+
+        auto vl = pool.TakeOne(10);
+        REQUIRE(vl->Mode() == VisitedListMode::HASH);
+        vl->Set(DENSE_VISITED_LIST_MAX_SIZE);
+        REQUIRE(vl->Get(DENSE_VISITED_LIST_MAX_SIZE));
+        pool.ReturnOne(vl);
+        REQUIRE(pool.GetPool(VisitedListMode::HASH)->GetSize() == 1);
+        REQUIRE(pool.GetPool(VisitedListMode::SPARSE)->GetSize() == 0);
+
+        vl = pool.TakeOne(10);
+        REQUIRE_FALSE(vl->Get(DENSE_VISITED_LIST_MAX_SIZE));
+        pool.ReturnOne(vl);
+    }
+
+    SECTION("fixed mode") {
+        AdaptiveVisitedListPool pool(1, allocator.get(), 1000, max_degree, VisitedListMode::SPARSE);
+        auto vl = pool.TakeOne(10);
+        REQUIRE(vl->Mode() == VisitedListMode::SPARSE);
+        pool.ReturnOne(vl);
+    }
+}
+
+TEST_CASE("ConcurrentVisitedList Basic Test", "[ut][VisitedList]") {
+    auto allocator = std::make_shared<DefaultAllocator>();
+    InnerIdType size = 10000;
+    auto vl_ptr = std::make_shared<ConcurrentVisitedList>(size, allocator.get());
+
+    SECTION("test set & reset") {
+        REQUIRE_FALSE(vl_ptr->TestAndSet(10));
+        REQUIRE(vl_ptr->TestAndSet(10));
+        REQUIRE(vl_ptr->Get(10));
+        vl_ptr->Reset();
+        REQUIRE_FALSE(vl_ptr->Get(10));
+        REQUIRE_FALSE(vl_ptr->TestAndSet(10));
+    }
+
+    SECTION("test concurrency") {
+        // every id must be claimed by exactly one thread
+        std::atomic<uint64_t> claimed{0};
+        auto func = [&]() {
+            for (InnerIdType i = 0; i < size; ++i) {
+                if (not vl_ptr->TestAndSet(i)) {
+                    claimed++;
+                }
+            }
+        };
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back(func);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        REQUIRE(claimed.load() == size);
+    }
+}
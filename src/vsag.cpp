@@ -54,6 +54,8 @@ init() {
     ss << "\ncpu avx512bw >> " << simd_status.avx512bw();
     ss << "\ncpu avx512vl >> " << simd_status.avx512vl();
     ss << "\ncpu avx512vpopcntdq >> " << simd_status.avx512vpopcntdq();
+    ss << "\ncpu avx512vnni >> " << simd_status.avx512vnni();
+    ss << "\ncpu avx512bf16 >> " << simd_status.avx512bf16();
     ss << "\ncpu neon >> " << simd_status.neon();
     ss << "\n====vsag init done====";
     logger::debug(ss.str());
@@ -18,6 +18,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 #include <limits>
+#include <map>
 
 #include "fixtures/test_dataset_pool.h"
 #include "fixtures/test_logger.h"
@@ -871,6 +872,9 @@ TestHGraphRemove(const fixtures::HGraphTestIndexPtr& test_index,
                     dim, resource->base_count, metric_type);
                 TestIndex::TestRemoveIndex(index, dataset, true);
                 HGraphTestIndex::TestGeneral(index, dataset, search_param, recall);
+
+                index = TestIndex::TestFactory(test_index->name, param, true);
+                TestIndex::TestConcurrentRemove(index, dataset, search_param);
                 vsag::Options::Instance().set_block_size_limit(origin_size);
             }
         }
@@ -937,6 +941,55 @@ TEST_CASE("[Daily] HGraph Compressed Graph Build", "[ft][hgraph][daily]") {
     TestHGraphCompressedBuild(test_index, resource);
 }
 
+static void
+TestHGraphColocatedBuild(const fixtures::HGraphTestIndexPtr& test_index,
+                         const fixtures::HGraphResourcePtr& resource) {
+    using namespace fixtures;
+    auto search_param = fmt::format(fixtures::search_param_tmp, 200, false);
+
+    for (auto metric_type : resource->metric_types) {
+        for (auto dim : resource->dims) {
+            for (auto& [base_quantization_str, recall] : resource->test_cases) {
+                INFO(fmt::format("metric_type: {}, dim: {}, base_quantization_str: {}, recall: {}",
+                                 metric_type,
+                                 dim,
+                                 base_quantization_str,
+                                 recall));
+                // the co-located nodes carry the precise codes, only indexes with reorder
+                if (base_quantization_str.find(',') == std::string::npos or
+                    (HGraphTestIndex::IsRaBitQ(base_quantization_str) &&
+                     dim < fixtures::RABITQ_MIN_RACALL_DIM)) {
+                    continue;
+                }
+                HGraphTestIndex::HGraphBuildParam build_param(
+                    metric_type, dim, base_quantization_str);
+                build_param.graph_storage = "colocated";
+                auto param = HGraphTestIndex::GenerateHGraphBuildParametersString(build_param);
+                auto index = TestIndex::TestFactory(test_index->name, param, true);
+                auto dataset = HGraphTestIndex::pool.GetDatasetAndCreate(
+                    dim, resource->base_count, metric_type);
+                TestIndex::TestBuildIndex(index, dataset, true);
+                HGraphTestIndex::TestGeneral(index, dataset, search_param, recall);
+                auto index2 = TestIndex::TestFactory(test_index->name, param, true);
+                TestIndex::TestSerializeFile(index, index2, dataset, search_param, true);
+            }
+        }
+    }
+}
+
+TEST_CASE("[PR] HGraph Colocated Graph Build", "[ft][hgraph][pr]") {
+    auto test_index = std::make_shared<fixtures::HGraphTestIndex>();
+    auto resource = test_index->GetResource(true);
+    resource->test_cases = {{"sq8_uniform,fp32", 0.98}};
+    TestHGraphColocatedBuild(test_index, resource);
+}
+
+TEST_CASE("[Daily] HGraph Colocated Graph Build", "[ft][hgraph][daily]") {
+    auto test_index = std::make_shared<fixtures::HGraphTestIndex>();
+    auto resource = test_index->GetResource(false);
+    TestHGraphColocatedBuild(test_index, resource);
+}
+
 static void
 TestHGraphMerge(const fixtures::HGraphTestIndexPtr& test_index,
                 const fixtures::HGraphResourcePtr& resource) {
@@ -1870,3 +1923,245 @@ TEST_CASE("[Daily]HGraph Disk IO Type Index", "[ft][hgraph][serialization][daily
     auto resource = test_index->GetResource(false);
     TestHGraphDiskIOType(test_index, resource);
 }
+
+TEST_CASE_PERSISTENT_FIXTURE(fixtures::HGraphTestIndex,
+                             "HGraph Continue Build With Progress",
+                             "[ft][hgraph]") {
+    auto metric_type = fixtures::RandomSelect<std::string>({"l2", "ip", "cosine"})[0];
+    INFO(fmt::format("metric_type: {}", metric_type));
+
+    auto search_param = fmt::format(fixtures::search_param_tmp, 200, false);
+    constexpr auto parameter_temp = R"(
+    {{
+        "dtype": "float32",
+        "metric_type": "{}",
+        "dim": {},
+        "index_param": {{
+            "base_quantization_type": "sq8",
+            "max_degree": 32,
+            "ef_construction": 200,
+            "build_batch_size": 300,
+            "build_checkpoint_interval": 2
+        }}
+    }}
+    )";
+    auto dim = 64;
+    auto dataset = pool.GetDatasetAndCreate(dim, 1000, metric_type);
+    auto param = fmt::format(parameter_temp, metric_type, dim);
+
+    // the progress of every stage ends with finished == total
+    std::map<std::string, std::pair<uint64_t, uint64_t>> progress;
+    auto callback = [&](const std::string& stage, uint64_t finished, uint64_t total) {
+        REQUIRE(finished <= total);
+        if (progress.count(stage) != 0) {
+            REQUIRE(progress[stage].first <= finished);
+        }
+        progress[stage] = {finished, total};
+    };
+
+    // build with a single index continuously
+    auto index = TestFactory(name, param, true);
+    REQUIRE(index->SetBuildProgressCallback(callback).has_value());
+    vsag::Index::Checkpoint checkpoint;
+    vsag::Index::Checkpoint partial;
+    uint64_t round = 0;
+    while (not checkpoint.finish) {
+        checkpoint = index->ContinueBuild(dataset->base_, checkpoint.data).value();
+        ++round;
+        // 900 vectors inserted, the snapshot in the checkpoint only holds the first 600
+        if (round == 4) {
+            partial = checkpoint;
+        }
+    }
+    // train, 4 rounds of insert, optimize
+    REQUIRE(round == 6);
+    REQUIRE(index->GetNumElements() == dataset->base_->GetNumElements());
+    REQUIRE(progress["train"].first == 1);
+    REQUIRE(progress["insert"].first == 1000);
+    REQUIRE(progress["insert"].second == 1000);
+    REQUIRE(progress["optimize"].first == 1);
+    HGraphTestIndex::TestGeneral(index, dataset, search_param, 0.95);
+
+    // resume every stage on a fresh index from the checkpoint of the last one
+    vsag::Index::Checkpoint resumed;
+    while (not resumed.finish) {
+        auto fresh_index = TestFactory(name, param, true);
+        resumed = fresh_index->ContinueBuild(dataset->base_, resumed.data).value();
+        index = fresh_index;
+    }
+    REQUIRE(index->GetNumElements() == dataset->base_->GetNumElements());
+    HGraphTestIndex::TestGeneral(index, dataset, search_param, 0.95);
+
+    // a fresh index replays the batches inserted after the snapshot
+    auto replayed_index = TestFactory(name, param, true);
+    while (not partial.finish) {
+        partial = replayed_index->ContinueBuild(dataset->base_, partial.data).value();
+    }
+    REQUIRE(replayed_index->GetNumElements() == dataset->base_->GetNumElements());
+    HGraphTestIndex::TestGeneral(replayed_index, dataset, search_param, 0.95);
+}
+
+TEST_CASE_PERSISTENT_FIXTURE(fixtures::HGraphTestIndex, "HGraph Int8 Vectors", "[ft][hgraph]") {
+    auto metric_type = GENERATE("l2", "cosine");
+    auto use_reorder = GENERATE(false, true);
+    INFO(fmt::format("metric_type: {}, use_reorder: {}", metric_type, use_reorder));
+
+    constexpr auto parameter_temp = R"(
+    {{
+        "dtype": "int8",
+        "metric_type": "{}",
+        "dim": {},
+        "index_param": {{
+            "base_quantization_type": "int8",
+            "use_reorder": {},
+            "precise_quantization_type": "int8",
+            "max_degree": 32,
+            "ef_construction": 200
+        }}
+    }}
+    )";
+    int64_t dim = 64;
+    int64_t count = 1000;
+    auto vectors = fixtures::generate_int8_codes(count, dim);
+    std::vector<int64_t> ids(count);
+    for (int64_t i = 0; i < count; ++i) {
+        ids[i] = i;
+    }
+    auto base = vsag::Dataset::Make();
+    base->NumElements(count)->Dim(dim)->Ids(ids.data())->Int8Vectors(vectors.data())->Owner(false);
+
+    auto param = fmt::format(parameter_temp, metric_type, dim, use_reorder);
+    auto index = TestFactory(name, param, true);
+    REQUIRE(index->Build(base).has_value());
+    REQUIRE(index->GetNumElements() == count);
+
+    // every base vector finds itself without being widened to float
+    auto search_param = fmt::format(fixtures::search_param_tmp, 100, false);
+    int64_t correct = 0;
+    for (int64_t i = 0; i < count; ++i) {
+        auto query = vsag::Dataset::Make();
+        query->NumElements(1)->Dim(dim)->Int8Vectors(vectors.data() + i * dim)->Owner(false);
+        auto result = index->KnnSearch(query, 1, search_param);
+        REQUIRE(result.has_value());
+        if (result.value()->GetDim() == 1 and result.value()->GetIds()[0] == i) {
+            ++correct;
+        }
+    }
+    REQUIRE(correct >= count * 99 / 100);
+
+    // the repair of the removed points searches with their int8 codes as well
+    int64_t remove_count = count / 5;
+    for (int64_t i = 0; i < remove_count; ++i) {
+        auto remove_result = index->Remove(ids[i]);
+        REQUIRE(remove_result.has_value());
+        REQUIRE(remove_result.value());
+    }
+    REQUIRE(index->GetNumElements() == count - remove_count);
+    correct = 0;
+    for (int64_t i = 0; i < count; ++i) {
+        auto query = vsag::Dataset::Make();
+        query->NumElements(1)->Dim(dim)->Int8Vectors(vectors.data() + i * dim)->Owner(false);
+        auto result = index->KnnSearch(query, 1, search_param);
+        REQUIRE(result.has_value());
+        if (result.value()->GetDim() == 0) {
+            continue;
+        }
+        auto id = result.value()->GetIds()[0];
+        REQUIRE(id >= remove_count);
+        if (id == i) {
+            ++correct;
+        }
+    }
+    REQUIRE(correct >= (count - remove_count) * 99 / 100);
+
+    // a float query cannot be compared with the int8 codes
+    std::vector<float> float_query(dim, 0.0F);
+    REQUIRE_FALSE(index->CalcDistanceById(float_query.data(), ids[count - 1]).has_value());
+
+    constexpr auto invalid_temp = R"(
+    {
+        "dtype": "int8",
+        "metric_type": "l2",
+        "dim": 64,
+        "index_param": {
+            "base_quantization_type": "fp32"
+        }
+    })";
+    REQUIRE_THROWS(TestFactory(name, invalid_temp, false));
+}
+
+TEST_CASE_PERSISTENT_FIXTURE(fixtures::HGraphTestIndex,
+                             "HGraph Batch Search With Request",
+                             "[ft][hgraph]") {
+    constexpr auto parameter_temp = R"(
+    {{
+        "dtype": "float32",
+        "metric_type": "l2",
+        "dim": {},
+        "index_param": {{
+            "base_quantization_type": "fp32",
+            "max_degree": 32,
+            "ef_construction": 200
+        }}
+    }}
+    )";
+    int64_t dim = 32;
+    int64_t count = 1000;
+    int64_t query_count = 20;
+    int64_t k = 10;
+    auto vectors = fixtures::generate_vectors(count, dim);
+    std::vector<int64_t> ids(count);
+    for (int64_t i = 0; i < count; ++i) {
+        ids[i] = i;
+    }
+    auto base = vsag::Dataset::Make();
+    base->NumElements(count)->Dim(dim)->Ids(ids.data())->Float32Vectors(vectors.data())->Owner(
+        false);
+    auto index = TestFactory(name, fmt::format(parameter_temp, dim), true);
+    REQUIRE(index->Build(base).has_value());
+
+    class OddFilter : public vsag::Filter {
+    public:
+        [[nodiscard]] bool
+        CheckValid(int64_t id) const override {
+            return id % 2 == 0;
+        }
+    };
+
+    // the filtered batch runs query by query, the unfiltered one interleaves the queries
+    auto filter = GENERATE(false, true);
+    auto parallelism = GENERATE(1, 4);
+    INFO(fmt::format("filter: {}, parallelism: {}", filter, parallelism));
+    auto query = vsag::Dataset::Make();
+    query->NumElements(query_count)->Dim(dim)->Float32Vectors(vectors.data())->Owner(false);
+    vsag::SearchRequest request;
+    request.query_ = query;
+    request.topk_ = k;
+    request.params_str_ =
+        fmt::format(R"({{"hgraph": {{"ef_search": 100, "parallelism": {}}}}})", parallelism);
+    if (filter) {
+        request.filter_ = std::make_shared<OddFilter>();
+    }
+    vsag::SearchStatistics statistics;
+    request.statistics_ = &statistics;
+    auto result = index->SearchWithRequest(request);
+    REQUIRE(result.has_value());
+    REQUIRE(result.value()->GetNumElements() == query_count);
+    REQUIRE(result.value()->GetDim() == k);
+    REQUIRE(statistics.dist_cmp > 0);
+    if (filter) {
+        REQUIRE(statistics.plan_graph + statistics.plan_two_hop + statistics.plan_brute_force ==
+                query_count);
+    }
+
+    // each row holds the results of its own query, the base vector itself comes first
+    const auto* result_ids = result.value()->GetIds();
+    for (int64_t q = 0; q < query_count; ++q) {
+        if (not filter or q % 2 == 0) {
+            REQUIRE(result_ids[q * k] == q);
+        }
+        for (int64_t j = 0; j < k; ++j) {
+            REQUIRE((not filter or result_ids[q * k + j] % 2 == 0));
+        }
+    }
+}
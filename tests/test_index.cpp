@@ -15,6 +15,8 @@
 
 #include "test_index.h"
 
+#include <unordered_set>
+
 #include "fixtures/memory_record_allocator.h"
 #include "fixtures/test_logger.h"
 #include "fixtures/test_reader.h"
@@ -1817,6 +1819,66 @@ TestIndex::TestRemoveIndex(const TestIndex::IndexPtr& index,
     }
 }
 
+void
+TestIndex::TestConcurrentRemove(const TestIndex::IndexPtr& index,
+                                const TestDatasetPtr& dataset,
+                                const std::string& search_param) {
+    fixtures::logger::LoggerReplacer _;
+
+    auto base = dataset->base_;
+    auto base_count = base->GetNumElements();
+    auto remove_count = static_cast<int64_t>(base_count * 0.2);
+    auto dim = base->GetDim();
+    auto build_result = index->Build(base);
+    REQUIRE(build_result.has_value());
+
+    auto make_one = [&](int64_t i) {
+        auto data_one = vsag::Dataset::Make();
+        data_one->Dim(dim)
+            ->Ids(base->GetIds() + i)
+            ->NumElements(1)
+            ->Float32Vectors(base->GetFloat32Vectors() + i * dim)
+            ->Owner(false);
+        return data_one;
+    };
+
+    // removes race with the searches, a removed label must never come back afterwards
+    fixtures::ThreadPool pool(5);
+    std::vector<std::future<bool>> futures;
+    for (int64_t i = 0; i < remove_count; ++i) {
+        futures.emplace_back(pool.enqueue(
+            [&](int64_t id) -> bool { return index->Remove(base->GetIds()[id]).has_value(); },
+            i));
+        futures.emplace_back(pool.enqueue(
+            [&](int64_t id) -> bool {
+                return index->KnnSearch(make_one(id), 10, search_param).has_value();
+            },
+            i + remove_count));
+    }
+    for (auto& future : futures) {
+        REQUIRE(future.get());
+    }
+    REQUIRE(index->GetNumberRemoved() == remove_count);
+    REQUIRE(index->GetNumElements() == base_count - remove_count);
+
+    std::unordered_set<int64_t> removed(base->GetIds(), base->GetIds() + remove_count);
+    for (int64_t i = 0; i < remove_count; ++i) {
+        auto result = index->KnnSearch(make_one(i), 10, search_param);
+        REQUIRE(result.has_value());
+        for (int64_t j = 0; j < result.value()->GetDim(); ++j) {
+            REQUIRE(removed.count(result.value()->GetIds()[j]) == 0);
+        }
+    }
+
+    // the removed labels can be added again, possibly onto reclaimed inner ids
+    for (int64_t i = 0; i < remove_count; ++i) {
+        auto add_result = index->Add(make_one(i));
+        REQUIRE(add_result.has_value());
+        REQUIRE(add_result.value().empty());
+    }
+    REQUIRE(index->GetNumElements() == base_count);
+}
+
 template <class T>
 std::string
 create_attr_string(const std::string& name, const std::vector<T>& values) {
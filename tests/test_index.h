@@ -77,6 +77,11 @@ public:
                     const TestDatasetPtr& dataset,
                     bool expected_success = true);
 
+    static void
+    TestConcurrentRemove(const IndexPtr& index,
+                         const TestDatasetPtr& dataset,
+                         const std::string& search_param);
+
     static void
     TestUpdateId(const IndexPtr& index,
                  const TestDatasetPtr& dataset,
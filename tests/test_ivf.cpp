@@ -1370,3 +1370,137 @@ TEST_CASE("[Daily] IVF GNO-IMI Build with Residual", "[ft][ivf][daily]") {
     auto resource = test_index->GetResource(false);
     TestIVFGNOIMIBuildWithResidual(test_index, resource);
 }
+
+TEST_CASE_PERSISTENT_FIXTURE(fixtures::IVFTestIndex, "IVF Int8 Vectors", "[ft][ivf]") {
+    auto metric_type = GENERATE("l2", "cosine");
+    auto use_reorder = GENERATE(false, true);
+    INFO(fmt::format("metric_type: {}, use_reorder: {}", metric_type, use_reorder));
+
+    constexpr auto parameter_temp = R"(
+    {{
+        "dtype": "int8",
+        "metric_type": "{}",
+        "dim": {},
+        "index_param": {{
+            "buckets_count": 20,
+            "base_quantization_type": "int8",
+            "ivf_train_type": "kmeans",
+            "use_reorder": {},
+            "precise_quantization_type": "int8"
+        }}
+    }}
+    )";
+    int64_t dim = 64;
+    int64_t count = 1000;
+    auto vectors = fixtures::generate_int8_codes(count, dim);
+    std::vector<int64_t> ids(count);
+    for (int64_t i = 0; i < count; ++i) {
+        ids[i] = i;
+    }
+    auto base = vsag::Dataset::Make();
+    base->NumElements(count)->Dim(dim)->Ids(ids.data())->Int8Vectors(vectors.data())->Owner(false);
+
+    auto param = fmt::format(parameter_temp, metric_type, dim, use_reorder);
+    auto index = TestFactory(name, param, true);
+    REQUIRE(index->Build(base).has_value());
+    REQUIRE(index->GetNumElements() == count);
+
+    // the query is classified by its float copy and scanned by its int8 codes
+    auto search_param = fmt::format(fixtures::search_param_tmp, 20);
+    for (int64_t i = 0; i < count; ++i) {
+        auto query = vsag::Dataset::Make();
+        query->NumElements(1)->Dim(dim)->Int8Vectors(vectors.data() + i * dim)->Owner(false);
+        auto result = index->KnnSearch(query, 1, search_param);
+        REQUIRE(result.has_value());
+        REQUIRE(result.value()->GetDim() == 1);
+        REQUIRE(result.value()->GetIds()[0] == i);
+    }
+
+    constexpr auto invalid_temp = R"(
+    {
+        "dtype": "int8",
+        "metric_type": "l2",
+        "dim": 64,
+        "index_param": {
+            "buckets_count": 20,
+            "base_quantization_type": "sq8"
+        }
+    })";
+    REQUIRE_THROWS(TestFactory(name, invalid_temp, false));
+}
+
+TEST_CASE_PERSISTENT_FIXTURE(fixtures::IVFTestIndex,
+                             "IVF Parallel Scan Matches Serial Scan",
+                             "[ft][ivf]") {
+    auto use_residual = GENERATE(false, true);
+    auto buckets_per_data = GENERATE(1, 2);
+    INFO(fmt::format("use_residual: {}, buckets_per_data: {}", use_residual, buckets_per_data));
+
+    // skewed buckets: clusters of 70%, 20%, 7% and 3% of the points, so one bucket spans
+    // several scan chunks while the others fill a part of one
+    int64_t dim = 64;
+    std::vector<int64_t> cluster_sizes = {2800, 800, 280, 120};
+    int64_t count = 4000;
+    auto centers = fixtures::generate_vectors(cluster_sizes.size(), dim, false, 7);
+    auto vectors = fixtures::generate_vectors(count, dim, false, 11);
+    std::vector<int64_t> ids(count);
+    int64_t offset = 0;
+    for (uint64_t c = 0; c < cluster_sizes.size(); ++c) {
+        for (int64_t i = offset; i < offset + cluster_sizes[c]; ++i) {
+            ids[i] = i;
+            for (int64_t d = 0; d < dim; ++d) {
+                vectors[i * dim + d] = centers[c * dim + d] * 10.0F + vectors[i * dim + d] * 0.1F;
+            }
+        }
+        offset += cluster_sizes[c];
+    }
+    auto base = vsag::Dataset::Make();
+    base->NumElements(count)->Dim(dim)->Ids(ids.data())->Float32Vectors(vectors.data())->Owner(
+        false);
+
+    auto param = GenerateIVFBuildParametersString(
+        "l2", dim, "fp32", 4, "kmeans", use_residual, buckets_per_data, false, 4);
+    auto index = TestFactory(name, param, true);
+    REQUIRE(index->Build(base).has_value());
+
+    constexpr static const char* parallel_search_param_tmp = R"(
+        {{
+            "ivf": {{
+                "scan_buckets_count": 4,
+                "factor": 4.0,
+                "parallelism": {}
+            }}
+        }})";
+    auto serial_param = fmt::format(parallel_search_param_tmp, 1);
+    auto parallel_param = fmt::format(parallel_search_param_tmp, 4);
+    int64_t k = 10;
+    for (int64_t i = 0; i < count; i += 97) {
+        auto query = vsag::Dataset::Make();
+        query->NumElements(1)->Dim(dim)->Float32Vectors(vectors.data() + i * dim)->Owner(false);
+
+        auto serial = index->KnnSearch(query, k, serial_param);
+        auto parallel = index->KnnSearch(query, k, parallel_param);
+        REQUIRE(serial.has_value());
+        REQUIRE(parallel.has_value());
+        REQUIRE(serial.value()->GetDim() == parallel.value()->GetDim());
+        for (int64_t j = 0; j < serial.value()->GetDim(); ++j) {
+            REQUIRE(serial.value()->GetIds()[j] == parallel.value()->GetIds()[j]);
+            REQUIRE(std::abs(serial.value()->GetDistances()[j] -
+                             parallel.value()->GetDistances()[j]) < 1e-5);
+        }
+
+        // the radius keeps about the k nearest points
+        auto radius = serial.value()->GetDistances()[serial.value()->GetDim() - 1];
+        auto serial_range = index->RangeSearch(query, radius, serial_param);
+        auto parallel_range = index->RangeSearch(query, radius, parallel_param);
+        REQUIRE(serial_range.has_value());
+        REQUIRE(parallel_range.has_value());
+        std::unordered_set<int64_t> serial_ids(
+            serial_range.value()->GetIds(),
+            serial_range.value()->GetIds() + serial_range.value()->GetDim());
+        std::unordered_set<int64_t> parallel_ids(
+            parallel_range.value()->GetIds(),
+            parallel_range.value()->GetIds() + parallel_range.value()->GetDim());
+        REQUIRE(serial_ids == parallel_ids);
+    }
+}